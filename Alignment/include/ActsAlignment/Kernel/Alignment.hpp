@@ -14,6 +14,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "ActsAlignment/Kernel/AlignmentSolver.hpp"
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
 
 #include <limits>
@@ -88,6 +89,9 @@ struct AlignmentOptions {
 
   // The alignment mask for different iterations
   std::map<unsigned int, AlignmentMask> iterationState;
+
+  // The options for solving the alignment equation
+  AlignmentSolverOptions solverOptions;
 };
 
 /// @brief Alignment result struct
@@ -100,9 +104,13 @@ struct AlignmentResult {
   std::unordered_map<Acts::SurfacePlacementBase*, Acts::Transform3>
       alignedParameters;
 
-  // The covariance of alignment parameters
+  // The covariance of alignment parameters (only for the dense solver)
   Acts::DynamicMatrix alignmentCovariance;
 
+  // The diagonal blocks of the covariance of alignment parameters, indexed by
+  // the alignable surface index
+  std::vector<Acts::AlignmentMatrix> alignmentCovarianceBlocks;
+
   // The average chi2/ndf (ndf is the measurement dim)
   double averageChi2ONdf = std::numeric_limits<double>::max();
 
@@ -182,13 +190,15 @@ struct Alignment {
   /// @param fitOptions The fit Options steering the fit
   /// @param alignResult [in, out] The aligned result
   /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param solverOptions The options for solving the alignment equation
   template <typename trajectory_container_t,
             typename start_parameters_container_t, typename fit_options_t>
   void calculateAlignmentParameters(
       const trajectory_container_t& trajectoryCollection,
       const start_parameters_container_t& startParametersCollection,
       const fit_options_t& fitOptions, AlignmentResult& alignResult,
-      const AlignmentMask& alignMask = AlignmentMask::All) const;
+      const AlignmentMask& alignMask = AlignmentMask::All,
+      const AlignmentSolverOptions& solverOptions = {}) const;
 
   /// @brief calculate the alignment parameters delta from a set of
   /// TrackAlignmentStates
@@ -196,10 +206,11 @@ struct Alignment {
   /// @param TrackStateCollection The collection of TrackAlignmentStates
   /// as input of fitting
   /// @param alignResult [in, out] The aligned result
-  /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param solverOptions The options for solving the alignment equation
   void calculateAlignmentParameters(
       const std::vector<detail::TrackAlignmentState>& trackAlignmentStates,
-      AlignmentResult& alignResult) const;
+      AlignmentResult& alignResult,
+      const AlignmentSolverOptions& solverOptions = {}) const;
 
   /// @brief update the detector element alignment parameters
   ///
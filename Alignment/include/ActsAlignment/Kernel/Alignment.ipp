@@ -69,7 +69,8 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const start_parameters_container_t& startParametersCollection,
     const fit_options_t& fitOptions,
     ActsAlignment::AlignmentResult& alignResult,
-    const ActsAlignment::AlignmentMask& alignMask) const {
+    const ActsAlignment::AlignmentMask& alignMask,
+    const ActsAlignment::AlignmentSolverOptions& solverOptions) const {
   // The number of trajectories must be equal to the number of starting
   // parameters
   assert(trajectoryCollection.size() == startParametersCollection.size());
@@ -102,74 +103,80 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const auto& alignState = evaluateRes.value();
     alignmentStates.push_back(alignState);
   }
-  return calculateAlignmentParameters(alignmentStates, alignResult);
+  return calculateAlignmentParameters(alignmentStates, alignResult,
+                                      solverOptions);
 }
 
 template <typename fitter_t>
 void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const std::vector<detail::TrackAlignmentState>& trackAlignmentStates,
-    AlignmentResult& alignResult) const {
+    AlignmentResult& alignResult,
+    const AlignmentSolverOptions& solverOptions) const {
   // The total alignment degree of freedom
   alignResult.alignmentDof =
       alignResult.idxedAlignSurfaces.size() * Acts::eAlignmentSize;
-  // Initialize derivative of chi2 w.r.t. alignment parameters for all tracks
-  Acts::DynamicVector sumChi2Derivative =
-      Acts::DynamicVector::Zero(alignResult.alignmentDof);
-  Acts::DynamicMatrix sumChi2SecondDerivative = Acts::DynamicMatrix::Zero(
-      alignResult.alignmentDof, alignResult.alignmentDof);
-  alignResult.chi2 = 0;
-  alignResult.measurementDim = 0;
+  // Sum the derivative of chi2 w.r.t. alignment parameters for all tracks
+  const detail::AlignmentSystem alignSystem =
+      detail::accumulateAlignmentSystem(trackAlignmentStates,
+                                        alignResult.idxedAlignSurfaces.size(),
+                                        solverOptions.numThreads,
+                                        solverOptions.executor);
+  const Acts::DynamicVector& sumChi2Derivative = alignSystem.chi2Derivative;
+  alignResult.chi2 = alignSystem.chi2;
+  alignResult.measurementDim = alignSystem.measurementDim;
   alignResult.numTracks = trackAlignmentStates.size();
-  double sumChi2ONdf = 0;
-  for (const auto& alignState : trackAlignmentStates) {
-    for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
-      const auto& [dstRow, srcRow] = rows;
-      // Fill the results into full chi2 derivative matrix
-      sumChi2Derivative.segment<Acts::eAlignmentSize>(dstRow *
-                                                      Acts::eAlignmentSize) +=
-          alignState.alignmentToChi2Derivative.segment(
-              srcRow * Acts::eAlignmentSize, Acts::eAlignmentSize);
+  alignResult.averageChi2ONdf =
+      alignSystem.sumChi2ONdf / alignResult.numTracks;
 
-      for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
-        const auto& [dstCol, srcCol] = cols;
-        sumChi2SecondDerivative
-            .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
-                dstRow * Acts::eAlignmentSize, dstCol * Acts::eAlignmentSize) +=
-            alignState.alignmentToChi2SecondDerivative.block(
-                srcRow * Acts::eAlignmentSize, srcCol * Acts::eAlignmentSize,
-                Acts::eAlignmentSize, Acts::eAlignmentSize);
-      }
-    }
-    alignResult.chi2 += alignState.chi2;
-    alignResult.measurementDim += alignState.measurementDim;
-    sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
-  }
-  alignResult.averageChi2ONdf = sumChi2ONdf / alignResult.numTracks;
-
-  // Get the inverse of chi2 second derivative matrix (we need this to
-  // calculate the covariance of the alignment parameters)
-  // @TODO: use more stable method for solving the inverse
   std::size_t alignDof = alignResult.alignmentDof;
-  Acts::DynamicMatrix sumChi2SecondDerivativeInverse =
-      Acts::DynamicMatrix::Zero(alignDof, alignDof);
-  sumChi2SecondDerivativeInverse = sumChi2SecondDerivative.inverse();
-  if (sumChi2SecondDerivativeInverse.hasNaN()) {
-    ACTS_DEBUG("Chi2 second derivative inverse has NaN");
-  }
-
   // Initialize the alignment results
   alignResult.deltaAlignmentParameters = Acts::DynamicVector::Zero(alignDof);
-  alignResult.alignmentCovariance =
-      Acts::DynamicMatrix::Zero(alignDof, alignDof);
-  // Solve the linear equation to get alignment parameters change
-  alignResult.deltaAlignmentParameters =
-      -sumChi2SecondDerivative.fullPivLu().solve(sumChi2Derivative);
-  ACTS_VERBOSE("sumChi2SecondDerivative = \n" << sumChi2SecondDerivative);
-  ACTS_VERBOSE("sumChi2Derivative = \n" << sumChi2Derivative);
-  ACTS_VERBOSE("alignResult.deltaAlignmentParameters \n");
+  alignResult.alignmentCovarianceBlocks.clear();
 
-  // Alignment parameters covariance
-  alignResult.alignmentCovariance = 2 * sumChi2SecondDerivativeInverse;
+  if (solverOptions.solver != AlignmentSolver::Dense) {
+    // Only the diagonal blocks of the covariance are calculated
+    alignResult.alignmentCovariance = Acts::DynamicMatrix();
+    auto solveRes = detail::solveSparseAlignmentSystem(
+        alignSystem, solverOptions, alignResult.deltaAlignmentParameters,
+        alignResult.alignmentCovarianceBlocks);
+    if (!solveRes.ok()) {
+      ACTS_ERROR("Solving the alignment equation failed: " << solveRes.error());
+      alignResult.deltaAlignmentParameters.setZero();
+      alignResult.result = solveRes.error();
+    }
+    ACTS_VERBOSE("sumChi2Derivative = \n" << sumChi2Derivative);
+  } else {
+    const Acts::DynamicMatrix sumChi2SecondDerivative =
+        detail::denseChi2SecondDerivative(alignSystem);
+
+    // Get the inverse of chi2 second derivative matrix (we need this to
+    // calculate the covariance of the alignment parameters)
+    // @TODO: use more stable method for solving the inverse
+    Acts::DynamicMatrix sumChi2SecondDerivativeInverse =
+        Acts::DynamicMatrix::Zero(alignDof, alignDof);
+    sumChi2SecondDerivativeInverse = sumChi2SecondDerivative.inverse();
+    if (sumChi2SecondDerivativeInverse.hasNaN()) {
+      ACTS_DEBUG("Chi2 second derivative inverse has NaN");
+    }
+
+    // Solve the linear equation to get alignment parameters change
+    alignResult.deltaAlignmentParameters =
+        -sumChi2SecondDerivative.fullPivLu().solve(sumChi2Derivative);
+    ACTS_VERBOSE("sumChi2SecondDerivative = \n" << sumChi2SecondDerivative);
+    ACTS_VERBOSE("sumChi2Derivative = \n" << sumChi2Derivative);
+    ACTS_VERBOSE("alignResult.deltaAlignmentParameters \n");
+
+    // Alignment parameters covariance
+    alignResult.alignmentCovariance = 2 * sumChi2SecondDerivativeInverse;
+    for (std::size_t iSurface = 0;
+         iSurface < alignResult.idxedAlignSurfaces.size(); iSurface++) {
+      alignResult.alignmentCovarianceBlocks.push_back(
+          alignResult.alignmentCovariance
+              .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
+                  iSurface * Acts::eAlignmentSize,
+                  iSurface * Acts::eAlignmentSize));
+    }
+  }
   // chi2 change
   alignResult.deltaChi2 = 0.5 * sumChi2Derivative.transpose() *
                           alignResult.deltaAlignmentParameters;
@@ -270,7 +277,8 @@ ActsAlignment::Alignment<fitter_t>::align(
     // Calculate the alignment parameters delta etc.
     calculateAlignmentParameters(
         trajectoryCollection, startParametersCollection,
-        alignOptions.fitOptions, alignResult, alignMask);
+        alignOptions.fitOptions, alignResult, alignMask,
+        alignOptions.solverOptions);
     // Screen out the information
     ACTS_INFO("iIter = " << iIter << ", total chi2 = " << alignResult.chi2
                          << ", total measurementDim = "
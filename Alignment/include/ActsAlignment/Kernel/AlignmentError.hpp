@@ -17,7 +17,8 @@ namespace ActsAlignment {
 enum class AlignmentError {
   NoAlignmentDofOnTrack = 1,
   AlignmentParametersUpdateFailure = 2,
-  ConvergeFailure = 3
+  ConvergeFailure = 3,
+  LinearSolverFailure = 4
 };
 
 namespace detail {
@@ -35,6 +36,8 @@ class AlignmentErrorCategory : public std::error_category {
         return "Update to alignment parameters failure";
       case AlignmentError::ConvergeFailure:
         return "The alignment is not converged";
+      case AlignmentError::LinearSolverFailure:
+        return "Failed to solve the alignment equation";
       default:
         return "unknown";
     }
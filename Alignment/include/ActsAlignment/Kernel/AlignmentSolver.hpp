@@ -0,0 +1,59 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+
+namespace ActsAlignment {
+
+/// The method used to solve the alignment equation
+enum class AlignmentSolver {
+  /// Dense inversion of the full chi2 second derivative matrix. The full
+  /// covariance of the alignment parameters is available.
+  Dense,
+  /// Sparse Cholesky (LDLT) decomposition of the chi2 second derivative
+  /// matrix. Only the diagonal blocks of the covariance are computed.
+  SparseCholesky,
+  /// Jacobi preconditioned conjugate gradient on the sparse chi2 second
+  /// derivative matrix. Only the diagonal blocks of the covariance are
+  /// computed.
+  ConjugateGradient,
+};
+
+/// Options steering the accumulation and the solution of the alignment
+/// equation
+struct AlignmentSolverOptions {
+  /// The solver to use
+  AlignmentSolver solver = AlignmentSolver::Dense;
+
+  /// The number of threads used to accumulate the chi2 derivatives of the
+  /// tracks and to compute the covariance blocks of the sparse solvers
+  std::size_t numThreads = 1;
+
+  /// Optional executor for the parallel loops, e.g. running them in an
+  /// existing TBB task arena. It replaces the threads which are otherwise
+  /// started for every loop, they are only run in parallel if numThreads is
+  /// larger than 1.
+  Acts::ParallelExecutor executor;
+
+  /// Whether to compute the covariance of the alignment parameters. For the
+  /// sparse solvers this needs one solution per alignment degree of freedom.
+  bool computeCovariance = true;
+
+  /// The relative residual tolerance of the conjugate gradient
+  double tolerance = 1e-10;
+
+  /// The maximum number of conjugate gradient iterations, 0 means twice the
+  /// number of alignment degrees of freedom
+  std::size_t maxIterations = 0;
+};
+
+}  // namespace ActsAlignment
@@ -14,9 +14,13 @@
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Result.hpp"
 #include "ActsAlignment/Kernel/AlignmentMask.hpp"
+#include "ActsAlignment/Kernel/AlignmentSolver.hpp"
 
+#include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 namespace ActsAlignment::detail {
 
@@ -66,6 +70,83 @@ struct TrackAlignmentState {
       alignedSurfaces;
 };
 
+///
+///@brief struct to store the chi2 derivatives summed over all tracks
+///
+/// The second derivative is stored as the lower triangle of its
+/// eAlignmentSize x eAlignmentSize blocks, keyed by the indices of the row and
+/// column surfaces. Only pairs of surfaces crossed by a common track have a
+/// block, i.e. the memory scales with the number of such pairs instead of the
+/// square of the number of alignable surfaces.
+struct AlignmentSystem {
+  // The number of alignable surfaces
+  std::size_t numSurfaces = 0;
+
+  // The derivative of chi2 w.r.t. alignment parameters
+  Acts::DynamicVector chi2Derivative;
+
+  // The non-zero blocks of the second derivative of chi2 w.r.t. alignment
+  // parameters with row surface index >= column surface index
+  std::unordered_map<std::uint64_t, Acts::AlignmentMatrix>
+      chi2SecondDerivativeBlocks;
+
+  // The chi2
+  double chi2 = 0;
+
+  // The measurement dimension from all tracks
+  std::size_t measurementDim = 0;
+
+  // The sum of chi2/ndf of all tracks
+  double sumChi2ONdf = 0;
+
+  /// The key of the second derivative block of two surfaces
+  static std::uint64_t blockKey(std::size_t rowSurface,
+                                std::size_t colSurface) {
+    return (static_cast<std::uint64_t>(rowSurface) << 32) |
+           static_cast<std::uint64_t>(colSurface);
+  }
+};
+
+/// Sum the chi2 derivatives of the tracks
+///
+/// The tracks are split into contiguous ranges which are accumulated
+/// concurrently and merged afterwards.
+///
+/// @param trackAlignmentStates The alignment states of the tracks
+/// @param numSurfaces The number of alignable surfaces
+/// @param numThreads The number of threads to use
+/// @param executor Optional executor for the ranges
+///
+/// @return The summed chi2 derivatives
+AlignmentSystem accumulateAlignmentSystem(
+    const std::vector<TrackAlignmentState>& trackAlignmentStates,
+    std::size_t numSurfaces, std::size_t numThreads,
+    const Acts::ParallelExecutor& executor = {});
+
+/// Expand the second derivative of an alignment system into a dense matrix
+///
+/// @param system The alignment system
+///
+/// @return The full chi2 second derivative matrix
+Acts::DynamicMatrix denseChi2SecondDerivative(const AlignmentSystem& system);
+
+/// Solve the alignment equation with one of the sparse solvers
+///
+/// Alignment parameters without any constraint from the tracks, e.g. those
+/// disabled by the alignment mask, are kept fixed and get a zero covariance.
+///
+/// @param system The alignment system
+/// @param options The solver options
+/// @param [out] deltaAlignmentParameters The change of alignment parameters
+/// @param [out] covarianceBlocks The diagonal covariance blocks of the
+/// alignment parameters per surface, only filled if requested in the options
+///
+/// @return Failure if the decomposition or the iterative solution failed
+Acts::Result<void> solveSparseAlignmentSystem(
+    const AlignmentSystem& system, const AlignmentSolverOptions& options,
+    Acts::DynamicVector& deltaAlignmentParameters,
+    std::vector<Acts::AlignmentMatrix>& covarianceBlocks);
+
 /// Reset some columns of the alignment to bound derivative to zero if the
 /// relevant degree of freedom is fixed
 ///
@@ -8,6 +8,100 @@
 
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
 
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsAlignment/Kernel/AlignmentError.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+
+namespace {
+
+using SparseMatrix = Eigen::SparseMatrix<double>;
+
+/// Split [0, n) into at most numThreads contiguous ranges and call
+/// func(iRange, begin, end) for each of them concurrently
+template <typename func_t>
+void parallelForRanges(std::size_t n, std::size_t numThreads,
+                       const Acts::ParallelExecutor& executor,
+                       const func_t& func) {
+  const std::size_t nRanges =
+      std::max<std::size_t>(std::min(numThreads, n), 1);
+  Acts::parallelFor(
+      nRanges, nRanges,
+      [&](std::size_t iRange) {
+        func(iRange, n * iRange / nRanges, n * (iRange + 1) / nRanges);
+      },
+      executor);
+}
+
+/// Add the contributions of the tracks in [begin, end) to a system
+void accumulateTracks(
+    const std::vector<ActsAlignment::detail::TrackAlignmentState>& states,
+    std::size_t begin, std::size_t end,
+    ActsAlignment::detail::AlignmentSystem& system) {
+  constexpr std::size_t size = Acts::eAlignmentSize;
+  for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+    const auto& alignState = states[iTrack];
+    for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
+      const auto& [dstRow, srcRow] = rows;
+      system.chi2Derivative.segment<size>(dstRow * size) +=
+          alignState.alignmentToChi2Derivative.segment<size>(srcRow * size);
+
+      for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
+        const auto& [dstCol, srcCol] = cols;
+        if (dstCol > dstRow) {
+          continue;
+        }
+        // Eigen matrices are not initialized on construction
+        system.chi2SecondDerivativeBlocks
+            .try_emplace(system.blockKey(dstRow, dstCol),
+                         Acts::AlignmentMatrix::Zero())
+            .first->second +=
+            alignState.alignmentToChi2SecondDerivative.block<size, size>(
+                srcRow * size, srcCol * size);
+      }
+    }
+    system.chi2 += alignState.chi2;
+    system.measurementDim += alignState.measurementDim;
+    system.sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+  }
+}
+
+/// Compute the diagonal covariance blocks of the surfaces in [begin, end)
+template <typename solver_t>
+bool fillCovarianceBlocks(const solver_t& solver, std::size_t begin,
+                          std::size_t end, const std::vector<bool>& fixed,
+                          std::vector<Acts::AlignmentMatrix>& blocks) {
+  constexpr std::size_t size = Acts::eAlignmentSize;
+  const std::size_t alignDof = fixed.size();
+  Acts::DynamicMatrix unitColumns = Acts::DynamicMatrix::Zero(alignDof, size);
+  for (std::size_t iSurface = begin; iSurface < end; ++iSurface) {
+    const std::size_t offset = iSurface * size;
+    unitColumns.middleRows<size>(offset).setIdentity();
+    const Acts::DynamicMatrix inverseColumns = solver.solve(unitColumns);
+    unitColumns.middleRows<size>(offset).setZero();
+    if (solver.info() != Eigen::Success) {
+      return false;
+    }
+    // The covariance is twice the inverse of the chi2 second derivative
+    Acts::AlignmentMatrix& block = blocks[iSurface];
+    block = 2 * inverseColumns.middleRows<size>(offset);
+    for (std::size_t i = 0; i < size; ++i) {
+      if (fixed[offset + i]) {
+        block.row(i).setZero();
+        block.col(i).setZero();
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 namespace ActsAlignment::detail {
 
 void resetAlignmentDerivative(Acts::AlignmentToBoundMatrix& alignToBound,
@@ -32,4 +126,160 @@ void resetAlignmentDerivative(Acts::AlignmentToBoundMatrix& alignToBound,
   }
 }
 
+AlignmentSystem accumulateAlignmentSystem(
+    const std::vector<TrackAlignmentState>& trackAlignmentStates,
+    std::size_t numSurfaces, std::size_t numThreads,
+    const Acts::ParallelExecutor& executor) {
+  const std::size_t nTracks = trackAlignmentStates.size();
+  const std::size_t nRanges =
+      std::max<std::size_t>(std::min(numThreads, nTracks), 1);
+  std::vector<AlignmentSystem> partialSystems(nRanges);
+  for (auto& partial : partialSystems) {
+    partial.numSurfaces = numSurfaces;
+    partial.chi2Derivative =
+        Acts::DynamicVector::Zero(numSurfaces * Acts::eAlignmentSize);
+  }
+  parallelForRanges(nTracks, nRanges, executor,
+                    [&](std::size_t iRange, std::size_t begin,
+                        std::size_t end) {
+                      accumulateTracks(trackAlignmentStates, begin, end,
+                                       partialSystems[iRange]);
+                    });
+
+  // Merge the partial sums in a fixed order to be reproducible
+  AlignmentSystem system = std::move(partialSystems.front());
+  for (std::size_t iRange = 1; iRange < nRanges; ++iRange) {
+    const AlignmentSystem& partial = partialSystems[iRange];
+    system.chi2Derivative += partial.chi2Derivative;
+    for (const auto& [key, block] : partial.chi2SecondDerivativeBlocks) {
+      auto [it, inserted] =
+          system.chi2SecondDerivativeBlocks.try_emplace(key, block);
+      if (!inserted) {
+        it->second += block;
+      }
+    }
+    system.chi2 += partial.chi2;
+    system.measurementDim += partial.measurementDim;
+    system.sumChi2ONdf += partial.sumChi2ONdf;
+  }
+  return system;
+}
+
+Acts::DynamicMatrix denseChi2SecondDerivative(const AlignmentSystem& system) {
+  constexpr std::size_t size = Acts::eAlignmentSize;
+  const std::size_t alignDof = system.numSurfaces * size;
+  Acts::DynamicMatrix matrix = Acts::DynamicMatrix::Zero(alignDof, alignDof);
+  for (const auto& [key, block] : system.chi2SecondDerivativeBlocks) {
+    const std::size_t row = key >> 32;
+    const std::size_t col = key & 0xffffffff;
+    matrix.block<size, size>(row * size, col * size) = block;
+    if (row != col) {
+      matrix.block<size, size>(col * size, row * size) = block.transpose();
+    }
+  }
+  return matrix;
+}
+
+Acts::Result<void> solveSparseAlignmentSystem(
+    const AlignmentSystem& system, const AlignmentSolverOptions& options,
+    Acts::DynamicVector& deltaAlignmentParameters,
+    std::vector<Acts::AlignmentMatrix>& covarianceBlocks) {
+  constexpr std::size_t size = Acts::eAlignmentSize;
+  const std::size_t alignDof = system.numSurfaces * size;
+
+  // Fill the lower triangle of the chi2 second derivative
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(system.chi2SecondDerivativeBlocks.size() * size * size);
+  Acts::DynamicVector diagonal = Acts::DynamicVector::Zero(alignDof);
+  for (const auto& [key, block] : system.chi2SecondDerivativeBlocks) {
+    const std::size_t row = key >> 32;
+    const std::size_t col = key & 0xffffffff;
+    for (std::size_t i = 0; i < size; ++i) {
+      const std::size_t jEnd = row == col ? i + 1 : size;
+      for (std::size_t j = 0; j < jEnd; ++j) {
+        if (block(i, j) != 0.) {
+          triplets.emplace_back(row * size + i, col * size + j, block(i, j));
+        }
+      }
+    }
+    if (row == col) {
+      diagonal.segment<size>(row * size) = block.diagonal();
+    }
+  }
+  // Parameters without any constraint have vanishing rows and columns. They
+  // are kept fixed by a unit diagonal and a vanishing derivative.
+  std::vector<bool> fixed(alignDof, false);
+  Acts::DynamicVector chi2Derivative = system.chi2Derivative;
+  for (std::size_t i = 0; i < alignDof; ++i) {
+    if (diagonal[i] == 0.) {
+      fixed[i] = true;
+      chi2Derivative[i] = 0.;
+      triplets.emplace_back(i, i, 1.);
+    }
+  }
+  SparseMatrix chi2SecondDerivative(alignDof, alignDof);
+  chi2SecondDerivative.setFromTriplets(triplets.begin(), triplets.end());
+  triplets = {};
+
+  covarianceBlocks.assign(
+      options.computeCovariance ? system.numSurfaces : 0,
+      Acts::AlignmentMatrix::Zero());
+  std::atomic<bool> covarianceOk = true;
+
+  if (options.solver == AlignmentSolver::SparseCholesky) {
+    Eigen::SimplicialLDLT<SparseMatrix, Eigen::Lower> ldlt(
+        chi2SecondDerivative);
+    if (ldlt.info() != Eigen::Success) {
+      return AlignmentError::LinearSolverFailure;
+    }
+    deltaAlignmentParameters = -ldlt.solve(chi2Derivative);
+    if (options.computeCovariance) {
+      // The decomposition is only read when solving
+      parallelForRanges(
+          system.numSurfaces, options.numThreads, options.executor,
+          [&](std::size_t /*iRange*/, std::size_t begin, std::size_t end) {
+            if (!fillCovarianceBlocks(ldlt, begin, end, fixed,
+                                      covarianceBlocks)) {
+              covarianceOk = false;
+            }
+          });
+    }
+  } else {
+    using ConjugateGradient =
+        Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower,
+                                 Eigen::DiagonalPreconditioner<double>>;
+    auto makeSolver = [&]() {
+      auto cg = std::make_unique<ConjugateGradient>();
+      cg->setTolerance(options.tolerance);
+      cg->setMaxIterations(options.maxIterations > 0
+                               ? options.maxIterations
+                               : 2 * alignDof);
+      cg->compute(chi2SecondDerivative);
+      return cg;
+    };
+    auto cg = makeSolver();
+    deltaAlignmentParameters = -cg->solve(chi2Derivative);
+    if (cg->info() != Eigen::Success) {
+      return AlignmentError::LinearSolverFailure;
+    }
+    if (options.computeCovariance) {
+      // Solving updates the iteration statistics of the solver, so every
+      // thread needs its own instance
+      parallelForRanges(
+          system.numSurfaces, options.numThreads, options.executor,
+          [&](std::size_t /*iRange*/, std::size_t begin, std::size_t end) {
+            if (!fillCovarianceBlocks(*makeSolver(), begin, end, fixed,
+                                      covarianceBlocks)) {
+              covarianceOk = false;
+            }
+          });
+    }
+  }
+
+  if (!covarianceOk) {
+    return AlignmentError::LinearSolverFailure;
+  }
+  return Acts::Result<void>::success();
+}
+
 }  // namespace ActsAlignment::detail
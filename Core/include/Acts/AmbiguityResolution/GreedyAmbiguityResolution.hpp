@@ -42,6 +42,12 @@ class GreedyAmbiguityResolution {
 
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+
+    /// Resolve on a compressed track-measurement graph with an indexed
+    /// priority queue. Only the tracks sharing measurements with an evicted
+    /// track are updated instead of rescanning all selected tracks in every
+    /// iteration. The selected tracks are the same as without it.
+    bool useSharedHitGraph = false;
   };
 
   /// Mutable state used by the greedy ambiguity resolution.
@@ -99,6 +105,8 @@ class GreedyAmbiguityResolution {
   void resolve(State& state) const;
 
  private:
+  void resolveWithSharedHitGraph(State& state) const;
+
   Config m_cfg;
 
   /// Logging instance
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include <boost/pending/disjoint_sets.hpp>
@@ -99,6 +100,30 @@ struct ClusteringData {
   Acts::Ccl::DisjointSets ds{};
 };
 
+/// Collection of mutable data used by the sorted-input clustering utilities.
+///
+/// The buffers only grow with the number of cells of the largest module and
+/// are reset without releasing memory, so one instance can be reused for all
+/// modules processed by a thread.
+struct SortedClusteringData {
+  /// Clear all clustering data, but keep the memory
+  void clear() {
+    labels.clear();
+    nClusters.clear();
+    parents.clear();
+    finalLabels.clear();
+  }
+
+  /// Cluster labels for each cell, starting at 1
+  std::vector<Acts::Ccl::Label> labels{};
+  /// Number of cells per cluster
+  std::vector<std::size_t> nClusters{};
+  /// Parent of each provisional label in the union-find forest
+  std::vector<Acts::Ccl::Label> parents{};
+  /// Final label of each provisional root label
+  std::vector<Acts::Ccl::Label> finalLabels{};
+};
+
 template <typename Cell>
 concept HasRetrievableColumnInfo = requires(Cell cell) {
   { getCellColumn(cell) } -> std::same_as<int>;
@@ -224,6 +249,82 @@ template <typename CellCollection, typename ClusterCollection,
 void createClusters(Acts::Ccl::ClusteringData& data, CellCollection& cells,
                     ClusterCollection& clusters, Connect&& connect = Connect());
 
+/// @brief labelSortedClusters
+///
+/// Connected component labelling of cells which are already sorted
+/// column-wise, i.e. by column and then by row. The cells are neither copied
+/// nor sorted. They are processed column by column and each cell is only
+/// compared to the preceding cells of its own and of the previous column,
+/// scanning backwards until the connection type signals a stop.
+///
+/// The clusters are labelled in the order of their first cell.
+///
+/// @param [in,out] data buffers, `labels` and `nClusters` hold the result
+/// @param [in] cells the sorted cell collection to be labeled
+/// @param [in] connect the connection type (see DefaultConnect)
+/// @throws std::invalid_argument if the input is not sorted or contains
+///         duplicate cells.
+template <typename CellCollection, std::size_t GridDim = 2,
+          typename Connect =
+              DefaultConnect<typename CellCollection::value_type, GridDim>>
+  requires(GridDim == 1 || GridDim == 2)
+void labelSortedClusters(Acts::Ccl::SortedClusteringData& data,
+                         const CellCollection& cells,
+                         Connect&& connect = Connect());
+
+/// @brief createSortedClusters
+/// Label cells sorted column-wise with labelSortedClusters and append the
+/// clusters to the output collection in the order of their first cell.
+///
+/// @throws std::invalid_argument if the input is not sorted or contains
+///         duplicate cells.
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim = 2,
+          typename Connect =
+              DefaultConnect<typename CellCollection::value_type, GridDim>>
+  requires((GridDim == 1 || GridDim == 2) &&
+           Acts::Ccl::CanAcceptCell<typename CellCollection::value_type,
+                                    typename ClusterCollection::value_type>)
+void createSortedClusters(Acts::Ccl::SortedClusteringData& data,
+                          const CellCollection& cells,
+                          ClusterCollection& clusters,
+                          Connect&& connect = Connect());
+
+/// @brief createSortedModuleClusters
+/// Cluster the cells of many modules stored in one flat array.
+///
+/// The cells of module `i` are `cells[moduleOffsets[i], moduleOffsets[i+1])`
+/// and have to be sorted column-wise within the module. The clusters of all
+/// modules are appended to the output collection in module order, and the
+/// clusters of module `i` are found in
+/// `clusters[clusterOffsets[i], clusterOffsets[i+1])`. Modules do not share
+/// any state, so disjoint module ranges can be clustered concurrently with one
+/// `data` instance and one output collection per thread.
+///
+/// @param [in,out] data buffers reused for all modules
+/// @param [in] cells the cells of all modules
+/// @param [in] moduleOffsets the first cell of each module followed by the
+///             total number of cells
+/// @param [out] clusters the output cluster collection
+/// @param [out] clusterOffsets the first cluster of each module followed by
+///              the size of the output collection
+/// @param [in] connect the connection type (see DefaultConnect)
+/// @throws std::invalid_argument if the offsets are inconsistent, or if the
+///         cells of a module are not sorted or contain duplicates.
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim = 2,
+          typename Connect =
+              DefaultConnect<typename CellCollection::value_type, GridDim>>
+  requires((GridDim == 1 || GridDim == 2) &&
+           Acts::Ccl::CanAcceptCell<typename CellCollection::value_type,
+                                    typename ClusterCollection::value_type>)
+void createSortedModuleClusters(Acts::Ccl::SortedClusteringData& data,
+                                const CellCollection& cells,
+                                std::span<const std::size_t> moduleOffsets,
+                                ClusterCollection& clusters,
+                                std::vector<std::size_t>& clusterOffsets,
+                                Connect&& connect = Connect());
+
 }  // namespace Acts::Ccl
 
 #include "Acts/Clusterization/Clusterization.ipp"
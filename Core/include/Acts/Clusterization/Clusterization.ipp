@@ -13,6 +13,8 @@
 #include <algorithm>
 #include <array>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts::Ccl {
@@ -276,4 +278,157 @@ void createClusters(Acts::Ccl::ClusteringData& data, CellCollection& cells,
                                                               clusters);
 }
 
+// Root of a provisional label with path halving
+inline Label findRoot(std::vector<Label>& parents, Label label) {
+  while (parents[label] != label) {
+    parents[label] = parents[parents[label]];
+    label = parents[label];
+  }
+  return label;
+}
+
+template <typename CellCollection, std::size_t GridDim, typename Connect>
+  requires(GridDim == 1 || GridDim == 2)
+void labelSortedClusters(Acts::Ccl::SortedClusteringData& data,
+                         const CellCollection& cells, Connect&& connect) {
+  using Cell = typename CellCollection::value_type;
+  const Acts::Ccl::Compare<Cell, GridDim> compare;
+
+  data.clear();
+  data.labels.resize(cells.size(), NO_LABEL);
+  // Provisional labels start at 1, the first entry is a placeholder
+  data.parents.push_back(NO_LABEL);
+
+  // First pass: Allocate provisional labels and merge them for connected
+  // cells. Only the current and the previous column are searched.
+  std::size_t previousColumnBegin = 0;
+  std::size_t columnBegin = 0;
+  for (std::size_t nCell = 0; nCell < cells.size(); ++nCell) {
+    const Cell& cell = cells[nCell];
+
+    if (nCell > 0) {
+      const Cell& previousCell = cells[nCell - 1];
+      if (compare(cell, previousCell)) {
+        throw std::invalid_argument(
+            "Clusterization: input is not sorted column-wise");
+      }
+      const int column = getCellColumn(cell);
+      const int previousColumn = getCellColumn(previousCell);
+      if (column != previousColumn) {
+        previousColumnBegin =
+            (column == previousColumn + 1) ? columnBegin : nCell;
+        columnBegin = nCell;
+      }
+    }
+
+    Label label = NO_LABEL;
+    for (std::size_t i = nCell; i > previousColumnBegin; --i) {
+      const std::size_t other = i - 1;
+      const ConnectResult cr = connect(cell, cells[other]);
+
+      if (cr == ConnectResult::eDuplicate) {
+        throw std::invalid_argument(
+            "Clusterization: input contains duplicate cells");
+      }
+      if (cr == ConnectResult::eNoConnStop) {
+        break;
+      }
+      if (cr == ConnectResult::eNoConn) {
+        continue;
+      }
+
+      // Keep the smallest root so that labels follow the cell order
+      Label root = findRoot(data.parents, data.labels[other]);
+      if (label == NO_LABEL) {
+        label = root;
+      } else if (root != label) {
+        if (root < label) {
+          std::swap(root, label);
+        }
+        data.parents[root] = label;
+      }
+    }
+
+    if (label == NO_LABEL) {
+      label = static_cast<Label>(data.parents.size());
+      data.parents.push_back(label);
+    }
+    data.labels[nCell] = label;
+  }
+
+  // Second pass: Replace the provisional labels by consecutive final labels
+  // and count the cells per cluster
+  data.finalLabels.resize(data.parents.size(), NO_LABEL);
+  for (Label& label : data.labels) {
+    Label& finalLabel = data.finalLabels[findRoot(data.parents, label)];
+    if (finalLabel == NO_LABEL) {
+      data.nClusters.push_back(0);
+      finalLabel = static_cast<Label>(data.nClusters.size());
+    }
+    label = finalLabel;
+    ++data.nClusters[label - 1];
+  }
+}
+
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim, typename Connect>
+  requires((GridDim == 1 || GridDim == 2) &&
+           Acts::Ccl::CanAcceptCell<typename CellCollection::value_type,
+                                    typename ClusterCollection::value_type>)
+void createSortedClusters(Acts::Ccl::SortedClusteringData& data,
+                          const CellCollection& cells,
+                          ClusterCollection& clusters, Connect&& connect) {
+  if (cells.empty()) {
+    return;
+  }
+
+  Acts::Ccl::labelSortedClusters<CellCollection, GridDim, Connect>(
+      data, cells, std::forward<Connect>(connect));
+
+  // Every label has at least one cell, no empty clusters to remove
+  const std::size_t previousSize = clusters.size();
+  clusters.resize(previousSize + data.nClusters.size());
+  for (std::size_t i = 0; i < data.nClusters.size(); ++i) {
+    Acts::Ccl::reserve(clusters[previousSize + i], data.nClusters[i]);
+  }
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    clusterAddCell(clusters[previousSize + data.labels[i] - 1], cells[i]);
+  }
+}
+
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim, typename Connect>
+  requires((GridDim == 1 || GridDim == 2) &&
+           Acts::Ccl::CanAcceptCell<typename CellCollection::value_type,
+                                    typename ClusterCollection::value_type>)
+void createSortedModuleClusters(Acts::Ccl::SortedClusteringData& data,
+                                const CellCollection& cells,
+                                std::span<const std::size_t> moduleOffsets,
+                                ClusterCollection& clusters,
+                                std::vector<std::size_t>& clusterOffsets,
+                                Connect&& connect) {
+  using Cell = typename CellCollection::value_type;
+  using CellSpan = std::span<const Cell>;
+
+  clusterOffsets.clear();
+  if (moduleOffsets.empty()) {
+    return;
+  }
+  if (moduleOffsets.back() > cells.size() ||
+      !std::ranges::is_sorted(moduleOffsets)) {
+    throw std::invalid_argument("Clusterization: inconsistent module offsets");
+  }
+
+  clusterOffsets.reserve(moduleOffsets.size());
+  clusterOffsets.push_back(clusters.size());
+  for (std::size_t i = 0; i + 1 < moduleOffsets.size(); ++i) {
+    const CellSpan moduleCells(std::ranges::data(cells) + moduleOffsets[i],
+                               moduleOffsets[i + 1] - moduleOffsets[i]);
+    Acts::Ccl::createSortedClusters<CellSpan, ClusterCollection, GridDim,
+                                    Connect>(data, moduleCells, clusters,
+                                             std::forward<Connect>(connect));
+    clusterOffsets.push_back(clusters.size());
+  }
+}
+
 }  // namespace Acts::Ccl
@@ -0,0 +1,516 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainerBackendConcept.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/EventData/Types.hpp"
+#include "Acts/EventData/detail/DynamicColumn.hpp"
+#include "Acts/EventData/detail/DynamicKeyIterator.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+class TrackingGeometry;
+class VectorMultiTrajectory;
+class VectorTrackContainer;
+template <typename T>
+struct IsReadOnlyMultiTrajectory;
+template <typename T>
+struct IsReadOnlyTrackContainer;
+
+namespace detail_mtc {
+
+using IndexType = TrackIndexType;
+
+constexpr auto kInvalid = kTrackIndexInvalid;
+/// Invalid offset into the measurement sections
+constexpr auto kInvalidOffset = std::numeric_limits<std::uint64_t>::max();
+
+/// Magic bytes at the start of every mapped track file
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S', 'T', 'R', 'K', 0};
+/// Current version of the on-disk layout. Readers reject any other version.
+constexpr std::uint32_t kVersion = 2;
+/// Written as-is to detect files produced on a host with different byte order
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+/// Every section starts at a multiple of this many bytes
+constexpr std::size_t kSectionAlignment = 64;
+
+/// Bits stored in @c StateRecord::flags and @c TrackRecord::flags
+enum RecordFlags : std::uint32_t {
+  HasProjector = 1 << 0,
+  HasSourceLink = 1 << 1,
+  HasGeometrySurface = 1 << 2,
+  HasPerigeeSurface = 1 << 3,
+};
+
+/// Sections of a mapped track file, in the order they are written
+enum class Section : std::uint32_t {
+  States = 0,
+  Parameters,
+  Covariances,
+  Jacobians,
+  Measurements,
+  MeasurementCovariances,
+  Tracks,
+  TrackParameters,
+  TrackCovariances,
+  Perigees,
+  NumSections,
+};
+
+constexpr std::size_t kNumSections =
+    static_cast<std::size_t>(Section::NumSections);
+
+/// File header. The section table gives the byte offset and the number of
+/// elements of each section.
+struct FileHeader {
+  std::array<char, 8> magic{};
+  std::uint32_t version = 0;
+  std::uint32_t byteOrderMark = 0;
+  std::uint64_t headerSize = 0;
+  std::uint64_t fileSize = 0;
+  std::array<std::uint64_t, kNumSections> offsets{};
+  std::array<std::uint64_t, kNumSections> counts{};
+};
+
+/// Fixed size record per track state. Component indices refer to the
+/// parameter, covariance and jacobian sections, offsets to the measurement
+/// sections.
+struct StateRecord {
+  IndexType previous = kInvalid;
+  IndexType next = kInvalid;
+  IndexType ipredicted = kInvalid;
+  IndexType ifiltered = kInvalid;
+  IndexType ismoothed = kInvalid;
+  IndexType ijacobian = kInvalid;
+  IndexType measdim = kInvalid;
+  float chi2 = 0;
+  std::uint64_t measOffset = kInvalidOffset;
+  std::uint64_t measCovOffset = kInvalidOffset;
+  double pathLength = 0;
+  TrackStateType::raw_type typeFlags = 0;
+  SerializedSubspaceIndices projector = 0;
+  std::uint64_t sourceLink = 0;
+  std::uint64_t surface = 0;
+  std::uint32_t flags = 0;
+  std::uint32_t padding = 0;
+};
+
+/// Fixed size record per track. Parameters and covariance live in their own
+/// sections and are indexed by the track index.
+struct TrackRecord {
+  IndexType tipIndex = kInvalid;
+  IndexType stemIndex = kInvalid;
+  unsigned int nMeasurements = 0;
+  unsigned int nHoles = 0;
+  unsigned int ndf = 0;
+  unsigned int nOutliers = 0;
+  unsigned int nSharedHits = 0;
+  float chi2 = 0;
+  std::uint64_t surface = 0;
+  std::int32_t absPdg = 0;
+  float mass = 0;
+  float absCharge = 0;
+  std::uint32_t flags = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader> &&
+              std::is_standard_layout_v<FileHeader>);
+static_assert(std::is_trivially_copyable_v<StateRecord> &&
+              std::is_standard_layout_v<StateRecord>);
+static_assert(std::is_trivially_copyable_v<TrackRecord> &&
+              std::is_standard_layout_v<TrackRecord>);
+// The records have no implicit padding, all bytes written to disk belong to
+// a member
+static_assert(sizeof(StateRecord) == 96, "StateRecord layout changed");
+static_assert(sizeof(TrackRecord) == 56, "TrackRecord layout changed");
+
+}  // namespace detail_mtc
+
+/// Read-only memory mapping of a track file written by
+/// @ref writeMappedTrackFile.
+///
+/// The file consists of a header followed by a fixed set of sections, each of
+/// which is a flat array of trivially copyable records or of doubles. Opening
+/// a file maps it into memory and validates the header and the section table,
+/// which takes constant time independent of the number of tracks. The
+/// individual records are not validated.
+///
+/// Reference surfaces are stored as geometry identifiers and resolved lazily
+/// through the tracking geometry given in the configuration. Perigee surfaces
+/// without geometry identifier are stored by transform and are recreated on
+/// first access. Source links are stored as 64-bit identifiers which are
+/// converted back using the configured decoder.
+class MappedTrackFile {
+ public:
+  /// Converts a stored source link identifier back to a source link
+  using SourceLinkDecoder = Delegate<SourceLink(std::uint64_t)>;
+
+  /// Configuration of the reader
+  struct Config {
+    /// Tracking geometry used to resolve reference surfaces
+    const TrackingGeometry* trackingGeometry = nullptr;
+    /// Decoder for source links. If not connected, the track states report
+    /// no uncalibrated source link.
+    SourceLinkDecoder sourceLinkDecoder;
+  };
+
+  /// Map a file into memory without surface or source link resolution
+  /// @param path Path of the file to map
+  /// @throws std::runtime_error if the file cannot be mapped or has an
+  ///         unsupported layout
+  explicit MappedTrackFile(const std::filesystem::path& path);
+
+  /// Map a file into memory
+  /// @param path Path of the file to map
+  /// @param cfg Reader configuration
+  /// @throws std::runtime_error if the file cannot be mapped or has an
+  ///         unsupported layout
+  MappedTrackFile(const std::filesystem::path& path, const Config& cfg);
+
+  MappedTrackFile(const MappedTrackFile&) = delete;
+  MappedTrackFile& operator=(const MappedTrackFile&) = delete;
+
+  ~MappedTrackFile();
+
+  /// Access the reader configuration
+  /// @return The configuration
+  const Config& config() const { return m_cfg; }
+
+  /// @return Number of track states in the file
+  std::size_t numTrackStates() const { return m_states.size(); }
+
+  /// @return Number of tracks in the file
+  std::size_t numTracks() const { return m_tracks.size(); }
+
+  /// @return The track state records
+  std::span<const detail_mtc::StateRecord> states() const { return m_states; }
+
+  /// @return The track records
+  std::span<const detail_mtc::TrackRecord> tracks() const { return m_tracks; }
+
+  /// Access a section of doubles
+  /// @param section The section to access
+  /// @return Pointer to the first element of the section
+  const double* doubles(detail_mtc::Section section) const {
+    return m_doubles[static_cast<std::size_t>(section)];
+  }
+
+  /// Resolve a stored surface reference
+  /// @param flags Record flags describing the kind of the reference
+  /// @param surface The stored reference
+  /// @return The surface or nullptr if none is stored or it cannot be resolved
+  const Surface* surface(std::uint32_t flags, std::uint64_t surface) const;
+
+ private:
+  Config m_cfg;
+
+  const std::byte* m_data = nullptr;
+  std::size_t m_size = 0;
+
+  std::span<const detail_mtc::StateRecord> m_states;
+  std::span<const detail_mtc::TrackRecord> m_tracks;
+  std::array<const double*, detail_mtc::kNumSections> m_doubles{};
+  std::size_t m_numPerigees = 0;
+
+  mutable std::mutex m_perigeeMutex;
+  mutable std::unordered_map<std::uint64_t, std::shared_ptr<const Surface>>
+      m_perigees;
+};
+
+/// Write track states and tracks to a file that can be opened with
+/// @ref MappedTrackFile.
+///
+/// Parameters, covariances and jacobians that are shared between track states
+/// stay shared in the output. Dynamic columns are not written.
+///
+/// @param path Output file path
+/// @param gctx Geometry context used to store perigee surfaces
+/// @param tracks The track container backend
+/// @param trackStates The track state container backend
+/// @param sourceLinkEncoder Converts source links to 64-bit identifiers. If
+///        not connected, no source links are written.
+/// @throws std::invalid_argument if a reference surface has neither a
+///         geometry identifier nor is a perigee surface
+/// @throws std::runtime_error if the file cannot be written
+void writeMappedTrackFile(
+    const std::filesystem::path& path, const GeometryContext& gctx,
+    const VectorTrackContainer& tracks,
+    const VectorMultiTrajectory& trackStates,
+    const Delegate<std::uint64_t(const SourceLink&)>& sourceLinkEncoder = {});
+
+class MappedMultiTrajectory;
+
+template <>
+struct IsReadOnlyMultiTrajectory<MappedMultiTrajectory> : std::true_type {};
+
+/// Read-only multi-trajectory backend on top of a @ref MappedTrackFile.
+/// All accessors return views into the mapped memory.
+/// @ingroup eventdata_tracks
+class MappedMultiTrajectory final
+    : public MultiTrajectory<MappedMultiTrajectory> {
+#ifndef DOXYGEN
+  friend MultiTrajectory<MappedMultiTrajectory>;
+#endif
+
+ public:
+  /// Constructor
+  /// @param file The mapped file
+  explicit MappedMultiTrajectory(std::shared_ptr<const MappedTrackFile> file)
+      : m_file{std::move(file)},
+        m_states{m_file->states()},
+        m_params{m_file->doubles(detail_mtc::Section::Parameters)},
+        m_cov{m_file->doubles(detail_mtc::Section::Covariances)},
+        m_jac{m_file->doubles(detail_mtc::Section::Jacobians)},
+        m_meas{m_file->doubles(detail_mtc::Section::Measurements)},
+        m_measCov{
+            m_file->doubles(detail_mtc::Section::MeasurementCovariances)} {}
+
+  // BEGIN INTERFACE
+
+  /// Get parameters for a track state
+  /// @param parIdx The parameter index
+  /// @return Parameters vector
+  ConstTrackStateProxy::ConstParameters parameters_impl(
+      IndexType parIdx) const {
+    return ConstTrackStateProxy::ConstParameters{
+        m_params + static_cast<std::size_t>(parIdx) * eBoundSize};
+  }
+
+  /// Get covariance for a track state
+  /// @param parIdx The parameter index
+  /// @return Covariance matrix
+  ConstTrackStateProxy::ConstCovariance covariance_impl(
+      IndexType parIdx) const {
+    return ConstTrackStateProxy::ConstCovariance{
+        m_cov + static_cast<std::size_t>(parIdx) * eBoundSize * eBoundSize};
+  }
+
+  /// Get jacobian for a track state
+  /// @param istate The track state index
+  /// @return Jacobian matrix
+  ConstTrackStateProxy::ConstCovariance jacobian_impl(IndexType istate) const {
+    return ConstTrackStateProxy::ConstCovariance{
+        m_jac + static_cast<std::size_t>(m_states[istate].ijacobian) *
+                    eBoundSize * eBoundSize};
+  }
+
+  /// Get calibrated measurement for a track state
+  /// @param istate Index of the track state
+  /// @return Calibrated measurement
+  template <std::size_t measdim>
+  ConstTrackStateProxy::ConstCalibrated<measdim> calibrated_impl(
+      IndexType istate) const {
+    return ConstTrackStateProxy::ConstCalibrated<measdim>{
+        m_meas + m_states[istate].measOffset};
+  }
+
+  /// Get calibrated measurement covariance for a track state
+  /// @param istate Index of the track state
+  /// @return Calibrated measurement covariance
+  template <std::size_t measdim>
+  ConstTrackStateProxy::ConstCalibratedCovariance<measdim>
+  calibratedCovariance_impl(IndexType istate) const {
+    return ConstTrackStateProxy::ConstCalibratedCovariance<measdim>{
+        m_measCov + m_states[istate].measCovOffset};
+  }
+
+  /// Check if a track state has a component
+  /// @param key The component key
+  /// @param istate The track state index
+  /// @return True if the component exists
+  bool has_impl(HashedString key, IndexType istate) const;
+
+  /// Get the number of track states
+  /// @return Number of track states
+  IndexType size_impl() const {
+    return static_cast<IndexType>(m_states.size());
+  }
+
+  /// Get a component from a track state
+  /// @param key The component key
+  /// @param istate The track state index
+  /// @return Pointer to the component value
+  std::any component_impl(HashedString key, IndexType istate) const;
+
+  /// Check if a column exists
+  /// @param key The column key
+  /// @return True if the column exists
+  bool hasColumn_impl(HashedString key) const;
+
+  /// Get the calibrated measurement dimension of a track state
+  /// @param istate The track state index
+  /// @return The measurement dimension
+  IndexType calibratedSize_impl(IndexType istate) const {
+    return m_states[istate].measdim;
+  }
+
+  /// Get the uncalibrated source link of a track state
+  /// @param istate The track state index
+  /// @return The decoded source link
+  SourceLink getUncalibratedSourceLink_impl(IndexType istate) const {
+    return m_file->config().sourceLinkDecoder(m_states[istate].sourceLink);
+  }
+
+  /// Get the reference surface of a track state
+  /// @param istate The track state index
+  /// @return The reference surface or nullptr
+  const Surface* referenceSurface_impl(IndexType istate) const {
+    return m_file->surface(m_states[istate].flags, m_states[istate].surface);
+  }
+
+  /// Dynamic columns are not supported, the range is always empty
+  /// @return Empty key range
+  detail::DynamicKeyRange<detail::DynamicColumnBase> dynamicKeys_impl() const {
+    return {m_noDynamic.begin(), m_noDynamic.end()};
+  }
+
+  // END INTERFACE
+
+ private:
+  std::shared_ptr<const MappedTrackFile> m_file;
+  std::span<const detail_mtc::StateRecord> m_states;
+  const double* m_params;
+  const double* m_cov;
+  const double* m_jac;
+  const double* m_meas;
+  const double* m_measCov;
+
+  std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
+      m_noDynamic;
+};
+
+static_assert(
+    ConstMultiTrajectoryBackend<MappedMultiTrajectory>,
+    "MappedMultiTrajectory does not fulfill ConstMultiTrajectoryBackend");
+
+class MappedTrackContainer;
+
+template <>
+struct IsReadOnlyTrackContainer<MappedTrackContainer> : std::true_type {};
+
+/// Read-only track container backend on top of a @ref MappedTrackFile.
+/// All accessors return views into the mapped memory.
+class MappedTrackContainer final {
+ public:
+  /// Type alias for track index type
+  using IndexType = TrackIndexType;
+  /// Constant representing invalid index value
+  static constexpr auto kInvalid = kTrackIndexInvalid;
+
+  /// Type alias for const track parameters
+  using ConstParameters =
+      typename detail_tsp::FixedSizeTypes<eBoundSize, true>::CoefficientsMap;
+  /// Type alias for const track covariance
+  using ConstCovariance =
+      typename detail_tsp::FixedSizeTypes<eBoundSize, true>::CovarianceMap;
+
+  /// Constructor
+  /// @param file The mapped file
+  explicit MappedTrackContainer(std::shared_ptr<const MappedTrackFile> file)
+      : m_file{std::move(file)},
+        m_tracks{m_file->tracks()},
+        m_params{m_file->doubles(detail_mtc::Section::TrackParameters)},
+        m_cov{m_file->doubles(detail_mtc::Section::TrackCovariances)} {}
+
+  // BEGIN INTERFACE
+
+  /// Get the number of tracks
+  /// @return Number of tracks
+  std::size_t size_impl() const { return m_tracks.size(); }
+
+  /// Get a component from a track
+  /// @param key The component key
+  /// @param itrack The track index
+  /// @return Pointer to the component value
+  std::any component_impl(HashedString key, IndexType itrack) const;
+
+  /// Get parameters for a track
+  /// @param itrack The track index
+  /// @return Parameters vector
+  ConstParameters parameters(IndexType itrack) const {
+    return ConstParameters{m_params +
+                           static_cast<std::size_t>(itrack) * eBoundSize};
+  }
+
+  /// Get covariance for a track
+  /// @param itrack The track index
+  /// @return Covariance matrix
+  ConstCovariance covariance(IndexType itrack) const {
+    return ConstCovariance{
+        m_cov + static_cast<std::size_t>(itrack) * eBoundSize * eBoundSize};
+  }
+
+  /// Check if a column exists
+  /// @param key The column key
+  /// @return True if the column exists
+  bool hasColumn_impl(HashedString key) const;
+
+  /// Get the reference surface of a track
+  /// @param itrack The track index
+  /// @return The reference surface or nullptr
+  const Surface* referenceSurface_impl(IndexType itrack) const {
+    return m_file->surface(m_tracks[itrack].flags, m_tracks[itrack].surface);
+  }
+
+  /// Get the particle hypothesis of a track
+  /// @param itrack The track index
+  /// @return The particle hypothesis
+  ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
+    const auto& track = m_tracks[itrack];
+    return ParticleHypothesis{static_cast<PdgParticle>(track.absPdg),
+                              track.mass, track.absCharge};
+  }
+
+  /// Dynamic columns are not supported, the range is always empty
+  /// @return Empty key range
+  detail::DynamicKeyRange<detail::DynamicColumnBase> dynamicKeys_impl() const {
+    return {m_noDynamic.begin(), m_noDynamic.end()};
+  }
+
+  // END INTERFACE
+
+ private:
+  std::shared_ptr<const MappedTrackFile> m_file;
+  std::span<const detail_mtc::TrackRecord> m_tracks;
+  const double* m_params;
+  const double* m_cov;
+
+  std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
+      m_noDynamic;
+};
+
+static_assert(ConstTrackContainerBackend<MappedTrackContainer>,
+              "MappedTrackContainer does not fulfill "
+              "ConstTrackContainerBackend");
+
+}  // namespace Acts
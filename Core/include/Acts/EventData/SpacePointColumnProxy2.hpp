@@ -13,6 +13,7 @@
 #include "Acts/Utilities/detail/ContainerSubset.hpp"
 
 #include <cassert>
+#include <memory_resource>
 #include <span>
 #include <vector>
 
@@ -38,7 +39,7 @@ class SpacePointColumnProxy {
   /// Type alias for container type (const if read-only)
   using Container = const_if_t<ReadOnly, SpacePointContainer2>;
   /// Type alias for column container type (const if read-only)
-  using Column = const_if_t<ReadOnly, std::vector<Value>>;
+  using Column = const_if_t<ReadOnly, std::pmr::vector<Value>>;
 
   /// Constructs a space point column proxy for the given container and column.
   /// @param container The container holding the space point.
@@ -84,7 +85,7 @@ class SpacePointColumnProxy {
 
   /// Returns a const reference to the column container.
   /// @return A const reference to the column container.
-  const std::vector<Value> &column() const noexcept { return *m_column; }
+  const std::pmr::vector<Value> &column() const noexcept { return *m_column; }
 
   /// Returns a mutable span to the column data.
   /// @return A mutable span to the column data.
@@ -180,7 +181,7 @@ class SpacePointColumnProxy {
   Container *m_container{};
   Column *m_column{};
 
-  std::vector<Value> &column() noexcept
+  std::pmr::vector<Value> &column() noexcept
     requires(!ReadOnly)
   {
     return *m_column;
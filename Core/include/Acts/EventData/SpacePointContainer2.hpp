@@ -21,6 +21,7 @@
 #include <cassert>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
@@ -69,27 +70,46 @@ class SpacePointContainer2 {
   explicit SpacePointContainer2(
       SpacePointColumns columns = SpacePointColumns::None) noexcept;
 
-  /// Constructs a copy of the given space point container.
+  /// Constructs an empty space point container which allocates the source
+  /// links and all columns from the given memory resource.
+  /// @param columns The columns to create in the container.
+  /// @param memoryResource The memory resource, which has to outlive the
+  ///        container.
+  SpacePointContainer2(SpacePointColumns columns,
+                       std::pmr::memory_resource *memoryResource) noexcept;
+
+  /// Constructs a copy of the given space point container. The copy uses the
+  /// default memory resource.
   /// @param other The space point container to copy.
   SpacePointContainer2(const SpacePointContainer2 &other) noexcept;
 
-  /// Move constructs a space point container.
+  /// Move constructs a space point container, which keeps the memory resource
+  /// of the moved-from container.
   /// @param other The space point container to move.
   SpacePointContainer2(SpacePointContainer2 &&other) noexcept;
 
   /// Detructs the space point container.
   ~SpacePointContainer2() noexcept = default;
 
-  /// Assignment operator for copying a space point container.
+  /// Assignment operator for copying a space point container. The container
+  /// keeps its memory resource.
   /// @param other The space point container to copy.
   /// @return A reference to this space point container.
   SpacePointContainer2 &operator=(const SpacePointContainer2 &other) noexcept;
 
-  /// Move assignment operator for a space point container.
+  /// Move assignment operator for a space point container. The container
+  /// keeps its memory resource, so the data is copied if the memory resources
+  /// differ.
   /// @param other The space point container to move.
   /// @return A reference to this space point container.
   SpacePointContainer2 &operator=(SpacePointContainer2 &&other) noexcept;
 
+  /// Returns the memory resource used by the container.
+  /// @return The memory resource of the container.
+  std::pmr::memory_resource *memoryResource() const noexcept {
+    return m_memoryResource;
+  }
+
   /// Returns the number of space points in the container.
   /// @return The number of space points in the container.
   std::uint32_t size() const noexcept { return m_size; }
@@ -617,6 +637,9 @@ class SpacePointContainer2 {
   template <typename T>
   using ColumnHolder = detail::sp::ColumnHolder<T>;
 
+  std::pmr::memory_resource *m_memoryResource{
+      std::pmr::get_default_resource()};
+
   std::uint32_t m_size{0};
 
   std::unordered_map<std::string, ColumnHolderBase *> m_allColumns;
@@ -624,7 +647,7 @@ class SpacePointContainer2 {
   std::unordered_map<std::string, std::unique_ptr<ColumnHolderBase>>
       m_dynamicColumns;
 
-  std::vector<SourceLink> m_sourceLinks;
+  std::pmr::vector<SourceLink> m_sourceLinks{m_memoryResource};
 
   std::optional<ColumnHolder<std::uint32_t>> m_sourceLinkOffsetColumn;
   std::optional<ColumnHolder<std::uint8_t>> m_sourceLinkCountColumn;
@@ -713,7 +736,7 @@ class SpacePointContainer2 {
     if (hasColumn(name)) {
       throw std::runtime_error("Column already exists: " + name);
     }
-    auto holder = std::make_unique<Holder>();
+    auto holder = std::make_unique<Holder>(m_memoryResource);
     holder->resize(size());
     auto proxy = holder->proxy(*this);
     m_allColumns.try_emplace(name, holder.get());
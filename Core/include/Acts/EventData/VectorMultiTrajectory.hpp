@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -54,25 +55,48 @@ struct NonInitializingAllocator {
 
   NonInitializingAllocator() noexcept = default;
 
+  explicit NonInitializingAllocator(
+      std::pmr::memory_resource* memoryResource) noexcept
+      : m_memoryResource(memoryResource) {}
+
   template <class U>
   explicit NonInitializingAllocator(
-      const NonInitializingAllocator<U>& /*other*/) noexcept {}
+      const NonInitializingAllocator<U>& other) noexcept
+      : m_memoryResource(other.resource()) {}
 
   template <class U>
-  bool operator==(const NonInitializingAllocator<U>& /*other*/) const noexcept {
-    return true;
+  bool operator==(const NonInitializingAllocator<U>& other) const noexcept {
+    return *m_memoryResource == *other.resource();
   }
 
-  T* allocate(std::size_t n) const { return std::allocator<T>{}.allocate(n); }
+  T* allocate(std::size_t n) const {
+    return static_cast<T*>(
+        m_memoryResource->allocate(n * sizeof(T), alignof(T)));
+  }
 
   void deallocate(T* const p, std::size_t n) const noexcept {
-    std::allocator<T>{}.deallocate(p, n);
+    m_memoryResource->deallocate(p, n * sizeof(T), alignof(T));
   }
 
   void construct(T* /*p*/) const {
     // This construct function intentionally does not initialize the object!
     // Be very careful when using this allocator.
   }
+
+  /// Copies of a container use the default memory resource, like the
+  /// polymorphic allocator
+  NonInitializingAllocator select_on_container_copy_construction()
+      const noexcept {
+    return NonInitializingAllocator{};
+  }
+
+  std::pmr::memory_resource* resource() const noexcept {
+    return m_memoryResource;
+  }
+
+ private:
+  std::pmr::memory_resource* m_memoryResource =
+      std::pmr::get_default_resource();
 };
 
 class VectorMultiTrajectoryBase {
@@ -204,6 +228,22 @@ class VectorMultiTrajectoryBase {
 
   VectorMultiTrajectoryBase() noexcept = default;
 
+  explicit VectorMultiTrajectoryBase(
+      std::pmr::memory_resource* memoryResource) noexcept
+      : m_index{memoryResource},
+        m_previous{memoryResource},
+        m_next{memoryResource},
+        m_params{memoryResource},
+        m_cov{memoryResource},
+        m_meas{NonInitializingAllocator<double>{memoryResource}},
+        m_measOffset{memoryResource},
+        m_measCov{NonInitializingAllocator<double>{memoryResource}},
+        m_measCovOffset{memoryResource},
+        m_jac{memoryResource},
+        m_sourceLinks{memoryResource},
+        m_projectors{memoryResource},
+        m_referenceSurfaces{memoryResource} {}
+
   VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other)
       : m_index{other.m_index},
         m_previous{other.m_previous},
@@ -350,30 +390,33 @@ class VectorMultiTrajectoryBase {
 
  protected:
   /// index to map track states to the corresponding
-  std::vector<IndexData> m_index;
-  std::vector<IndexType> m_previous;
-  std::vector<IndexType> m_next;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
+  std::pmr::vector<IndexData> m_index;
+  std::pmr::vector<IndexType> m_previous;
+  std::pmr::vector<IndexType> m_next;
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
       m_params;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_cov;
 
   std::vector<double, NonInitializingAllocator<double>> m_meas;
-  std::vector<IndexType> m_measOffset;
+  std::pmr::vector<IndexType> m_measOffset;
   std::vector<double, NonInitializingAllocator<double>> m_measCov;
-  std::vector<IndexType> m_measCovOffset;
+  std::pmr::vector<IndexType> m_measCovOffset;
 
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_jac;
-  std::vector<std::optional<SourceLink>> m_sourceLinks;
-  std::vector<SerializedSubspaceIndices> m_projectors;
+  std::pmr::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::pmr::vector<SerializedSubspaceIndices> m_projectors;
 
   // owning vector of shared pointers to surfaces
   //
   // This might be problematic when appending a large number of surfaces
   // trackstates, because vector has to reallocated and thus copy. This might
   // be handled in a smart way by moving but not sure.
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
 
   std::vector<HashedString> m_dynamicKeys;
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
@@ -399,6 +442,15 @@ class VectorMultiTrajectory final
   VectorMultiTrajectory() = default;
   using VectorMultiTrajectoryBase::VectorMultiTrajectoryBase;
 
+  /// Construct an empty multi trajectory which allocates the fixed columns
+  /// from the given memory resource. Dynamic columns are always allocated on
+  /// the heap.
+  /// @param memoryResource The memory resource, which has to outlive the
+  ///        multi trajectory. Copies use the default resource.
+  explicit VectorMultiTrajectory(
+      std::pmr::memory_resource* memoryResource) noexcept
+      : VectorMultiTrajectoryBase{memoryResource} {}
+
   /// Get statistics about memory usage
   /// @return Statistics object
   Statistics statistics() const {
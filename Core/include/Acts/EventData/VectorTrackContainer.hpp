@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -53,6 +54,8 @@ class VectorTrackContainerBase {
  protected:
   VectorTrackContainerBase() = default;
 
+  explicit VectorTrackContainerBase(std::pmr::memory_resource* memoryResource);
+
   VectorTrackContainerBase(const VectorTrackContainerBase& other);
 
   VectorTrackContainerBase(VectorTrackContainerBase&& other) = default;
@@ -181,21 +184,23 @@ class VectorTrackContainerBase {
 
   // END INTERFACE HELPER
 
-  std::vector<IndexType> m_tipIndex;
-  std::vector<IndexType> m_stemIndex;
-  std::vector<ParticleHypothesis> m_particleHypothesis;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
+  std::pmr::vector<IndexType> m_tipIndex;
+  std::pmr::vector<IndexType> m_stemIndex;
+  std::pmr::vector<ParticleHypothesis> m_particleHypothesis;
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
       m_params;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_cov;
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
 
-  std::vector<unsigned int> m_nMeasurements;
-  std::vector<unsigned int> m_nHoles;
-  std::vector<float> m_chi2;
-  std::vector<unsigned int> m_ndf;
-  std::vector<unsigned int> m_nOutliers;
-  std::vector<unsigned int> m_nSharedHits;
+  std::pmr::vector<unsigned int> m_nMeasurements;
+  std::pmr::vector<unsigned int> m_nHoles;
+  std::pmr::vector<float> m_chi2;
+  std::pmr::vector<unsigned int> m_ndf;
+  std::pmr::vector<unsigned int> m_nOutliers;
+  std::pmr::vector<unsigned int> m_nSharedHits;
 
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
@@ -214,6 +219,12 @@ struct IsReadOnlyTrackContainer<VectorTrackContainer> : std::false_type {};
 class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
  public:
   VectorTrackContainer() : VectorTrackContainerBase{} {}
+  /// Construct an empty container which allocates the fixed columns from the
+  /// given memory resource. Dynamic columns are always allocated on the heap.
+  /// @param memoryResource The memory resource, which has to outlive the
+  ///        container. Copies of the container use the default resource.
+  explicit VectorTrackContainer(std::pmr::memory_resource* memoryResource)
+      : VectorTrackContainerBase{memoryResource} {}
   /// Copy constructor
   /// @param other The container to copy
   VectorTrackContainer(const VectorTrackContainer& other) = default;
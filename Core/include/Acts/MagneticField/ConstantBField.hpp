@@ -47,6 +47,18 @@ class ConstantBField final : public MagneticFieldProvider {
     return Result<Vector3>::success(m_BField);
   }
 
+  /// @copydoc MagneticFieldProvider::getFields(PositionBatchView,FieldBatchView,MagneticFieldProvider::Cache&) const
+  ///
+  /// @note The @p positions are ignored, all rows of @p fields are set to
+  ///       the constant field vector.
+  Result<void> getFields(PositionBatchView positions, FieldBatchView fields,
+                         MagneticFieldProvider::Cache& cache) const override {
+    static_cast<void>(positions);
+    static_cast<void>(cache);
+    fields.rowwise() = m_BField.transpose();
+    return Result<void>::success();
+  }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   Acts::MagneticFieldProvider::Cache makeCache(
       const Acts::MagneticFieldContext& mctx) const override {
@@ -15,6 +15,9 @@
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <functional>
 #include <optional>
 #include <vector>
@@ -251,7 +254,8 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
 
     std::size_t i = 0;
     for (std::size_t index : cornerIndices) {
-      neighbors.at(i++) = m_cfg.transformBField(m_cfg.grid.at(index), position);
+      neighbors.at(i++) =
+          m_cfg.transformBField(m_cfg.grid.atUnchecked(index), position);
     }
 
     assert(i == nCorners);
@@ -361,6 +365,94 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
   }
 
+  /// @copydoc MagneticFieldProvider::getFields(PositionBatchView,FieldBatchView,MagneticFieldProvider::Cache&) const
+  ///
+  /// The positions are processed in fixed-size blocks. For each block, the
+  /// grid coordinates, interpolation weights and corner bins of all positions
+  /// are determined first. The corner values are then accumulated for all
+  /// positions of the block at once, which allows the compiler to vectorize
+  /// the interpolation. The cache is not used.
+  Result<void> getFields(PositionBatchView positions, FieldBatchView fields,
+                         MagneticFieldProvider::Cache& cache) const final {
+    static_cast<void>(cache);
+    assert(positions.rows() == fields.rows());
+
+    constexpr std::size_t kBlockSize = 16;
+    constexpr std::size_t nCorners = 1 << DIM_POS;
+    constexpr std::size_t DIM_FIELD = FieldType::RowsAtCompileTime;
+
+    Result<void> result = Result<void>::success();
+    const auto nPositions = static_cast<std::size_t>(positions.rows());
+
+    for (std::size_t start = 0; start < nPositions; start += kBlockSize) {
+      const std::size_t size = std::min(kBlockSize, nPositions - start);
+
+      // unused lanes and lanes outside of the map interpolate the value of
+      // the first bin with zero weights and are discarded afterwards
+      std::array<std::array<double, kBlockSize>, DIM_POS> fractions{};
+      std::array<std::array<std::size_t, kBlockSize>, nCorners> cornerBins{};
+      std::array<bool, kBlockSize> inside{};
+
+      for (std::size_t lane = 0; lane < size; ++lane) {
+        const auto row = static_cast<Eigen::Index>(start + lane);
+        const auto gridPosition =
+            m_cfg.transformPos(positions.row(row).transpose());
+        inside[lane] = isInsideLocal(gridPosition);
+        if (!inside[lane]) {
+          continue;
+        }
+
+        const auto indices = m_cfg.grid.localBinsFromPosition(gridPosition);
+        const auto lowerLeft = m_cfg.grid.lowerLeftBinEdge(indices);
+        const auto upperRight = m_cfg.grid.upperRightBinEdge(indices);
+        for (std::size_t d = 0; d < DIM_POS; ++d) {
+          fractions[d][lane] = (gridPosition[d] - lowerLeft[d]) /
+                               (upperRight[d] - lowerLeft[d]);
+        }
+
+        // corner bins in the canonical order defined in Acts::interpolate
+        std::size_t corner = 0;
+        for (std::size_t bin : m_cfg.grid.closestPointsIndices(gridPosition)) {
+          cornerBins[corner++][lane] = bin;
+        }
+      }
+
+      std::array<std::array<double, kBlockSize>, DIM_FIELD> values{};
+      for (std::size_t corner = 0; corner < nCorners; ++corner) {
+        for (std::size_t lane = 0; lane < kBlockSize; ++lane) {
+          double weight = inside[lane] ? 1. : 0.;
+          for (std::size_t d = 0; d < DIM_POS; ++d) {
+            const bool upper = ((corner >> (DIM_POS - 1 - d)) & 1u) != 0;
+            weight *= upper ? fractions[d][lane] : 1. - fractions[d][lane];
+          }
+          const FieldType& cornerValue =
+              m_cfg.grid.atUnchecked(cornerBins[corner][lane]);
+          for (std::size_t f = 0; f < DIM_FIELD; ++f) {
+            values[f][lane] += weight * cornerValue[f];
+          }
+        }
+      }
+
+      for (std::size_t lane = 0; lane < size; ++lane) {
+        const auto row = static_cast<Eigen::Index>(start + lane);
+        if (!inside[lane]) {
+          fields.row(row).setZero();
+          result = Result<void>::failure(MagneticFieldError::OutOfBounds);
+          continue;
+        }
+        FieldType value;
+        for (std::size_t f = 0; f < DIM_FIELD; ++f) {
+          value[f] = values[f][lane];
+        }
+        fields.row(row) =
+            m_cfg.transformBField(value, positions.row(row).transpose())
+                .transpose();
+      }
+    }
+
+    return result;
+  }
+
  private:
   Config m_cfg;
 
@@ -13,6 +13,8 @@
 #include "Acts/Utilities/Any.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cassert>
+
 namespace Acts {
 
 /// Base class for all magnetic field providers
@@ -61,6 +63,14 @@ namespace Acts {
 ///
 /// Acts::Vector3 fieldValue = *lookupResult;
 /// ```
+///
+/// Clients which need the field at many positions at once, e.g. for all
+/// components of a multi-component state, can use
+/// @ref Acts::MagneticFieldProvider::getFields. It takes the positions in
+/// structure-of-arrays form, i.e. as a column-major `N x 3` matrix, and
+/// writes the field values in the same layout. This replaces `N` virtual
+/// calls with a single one and allows implementations to vectorize over the
+/// lookup positions.
 class MagneticFieldProvider {
  public:
   /// Opaque cache type that can store arbitrary implementation specific cache
@@ -88,6 +98,45 @@ class MagneticFieldProvider {
   virtual Result<Vector3> getField(const Vector3& position,
                                    Cache& cache) const = 0;
 
+  /// Structure-of-arrays storage for a batch of 3D vectors. Each column holds
+  /// one coordinate of all vectors and is contiguous in memory.
+  using VectorBatch = Eigen::Matrix<double, Eigen::Dynamic, 3>;
+  /// Read-only view on a batch of lookup positions
+  using PositionBatchView = Eigen::Ref<const VectorBatch>;
+  /// Writable view on a batch of field values
+  using FieldBatchView = Eigen::Ref<VectorBatch>;
+
+  /// Retrieve magnetic field values for a batch of positions. Requires an
+  /// instance of @ref Acts::MagneticFieldProvider::Cache created through
+  /// @ref makeCache.
+  ///
+  /// The default implementation calls @ref getField for every position.
+  /// Implementations can override this to vectorize over the positions.
+  ///
+  /// @param [in] positions global 3D positions for the lookup, one per row
+  /// @param [out] fields field values, one per row; must have the same number
+  ///              of rows as @p positions
+  /// @param [in,out] cache Field provider specific cache object
+  ///
+  /// @return failure if the lookup failed for at least one position. The
+  ///         field value of such positions is set to zero, all other values
+  ///         are valid.
+  virtual Result<void> getFields(PositionBatchView positions,
+                                 FieldBatchView fields, Cache& cache) const {
+    assert(positions.rows() == fields.rows());
+    Result<void> result = Result<void>::success();
+    for (Eigen::Index i = 0; i < positions.rows(); ++i) {
+      auto res = getField(positions.row(i).transpose(), cache);
+      if (res.ok()) {
+        fields.row(i) = res->transpose();
+      } else {
+        fields.row(i).setZero();
+        result = res.error();
+      }
+    }
+    return result;
+  }
+
   virtual ~MagneticFieldProvider() = default;
 };
 
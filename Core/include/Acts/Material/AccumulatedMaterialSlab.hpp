@@ -73,6 +73,18 @@ class AccumulatedMaterialSlab {
   /// unless explicitly requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Merge the material accumulated in another instance into this one.
+  ///
+  /// @param other Accumulated material, e.g. from a separately filled map
+  ///
+  /// The total stores are combined such that every track of both instances
+  /// contributes equally, i.e. the result is the same as if all tracks had
+  /// been averaged into a single instance. Material that is still pending in
+  /// the per-track store of `other` is added to the per-track store of this
+  /// instance. The merge is associative, which allows to accumulate disjoint
+  /// sets of tracks independently and to combine them in a fixed order.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
@@ -141,6 +141,28 @@ class AccumulatedSurfaceMaterial {
   /// @param emptyHit indicator if this is an empty assignment
   void trackAverage(const Vector3& gp, bool emptyHit = false);
 
+  /// Find the bin triple for a global position
+  ///
+  /// @param gp global position for the bin lookup
+  ///
+  /// @return the bin triple to which material at this position is assigned
+  std::array<std::size_t, 3> binTriple(const Vector3& gp) const;
+
+  /// Merge separately accumulated material into a single bin
+  ///
+  /// @param bin0 the first local bin index
+  /// @param bin1 the second local bin index
+  /// @param slab the accumulated material to be merged
+  void merge(std::size_t bin0, std::size_t bin1,
+             const AccumulatedMaterialSlab& slab);
+
+  /// Merge the material of another accumulation with identical binning
+  ///
+  /// @param other the accumulated surface material to be merged
+  ///
+  /// @note throws std::invalid_argument if the binning does not match
+  void merge(const AccumulatedSurfaceMaterial& other);
+
   /// Total average creates SurfaceMaterial
   /// @return Unique pointer to the averaged surface material
   std::unique_ptr<const ISurfaceMaterial> totalAverage();
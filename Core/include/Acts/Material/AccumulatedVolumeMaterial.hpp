@@ -25,6 +25,13 @@ class AccumulatedVolumeMaterial {
   /// @param mat The material slab to accumulate
   void accumulate(const MaterialSlab& mat);
 
+  /// Merge the entries accumulated in another instance into this one.
+  /// @param other The accumulated volume material to be merged
+  ///
+  /// The result is the same as if all entries had been accumulated into
+  /// a single instance.
+  void merge(const AccumulatedVolumeMaterial& other);
+
   /// Compute the average material collected so far.
   ///
   /// @returns Vacuum properties if no matter has been accumulated yet.
@@ -13,6 +13,11 @@
 #include "Acts/Material/interface/ISurfaceMaterialAccumulator.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace Acts {
 
 /// @brief The binned surface material accumulator
@@ -39,6 +44,19 @@ class BinnedSurfaceMaterialAccumulator final
         accumulatedMaterial;
   };
 
+  /// @brief Nested partial state struct
+  ///
+  /// It only holds the bins touched while it was filled, the binning is
+  /// taken from the full state it was created from.
+  struct PartialState final : public ISurfaceMaterialAccumulator::State {
+    /// The full state providing the binning
+    const BinnedSurfaceMaterialAccumulator::State* fullState = nullptr;
+    /// The accumulated material per geometry ID and local bins (bin0, bin1)
+    std::map<GeometryIdentifier,
+             std::map<std::array<std::size_t, 2>, AccumulatedMaterialSlab>>
+        accumulatedMaterial;
+  };
+
   /// Constructor
   ///
   /// @param cfg the configuration struct
@@ -54,6 +72,20 @@ class BinnedSurfaceMaterialAccumulator final
   std::unique_ptr<ISurfaceMaterialAccumulator::State> createState(
       const GeometryContext& gctx) const override;
 
+  /// Factory for creating a sparse partial state
+  /// @param state is the full state providing the binning
+  /// @return Unique pointer to newly created partial accumulator state
+  std::unique_ptr<ISurfaceMaterialAccumulator::State> createPartialState(
+      const ISurfaceMaterialAccumulator::State& state) const override;
+
+  /// Merge a partial state into the full state
+  ///
+  /// @param state is the full state of the accumulator
+  /// @param partialState is the partial state, it is cleared after merging
+  void mergeState(ISurfaceMaterialAccumulator::State& state,
+                  ISurfaceMaterialAccumulator::State& partialState)
+      const override;
+
   /// @brief Accumulate the material interaction on the surface
   ///
   /// @param state is the state of the accumulator
@@ -80,6 +112,17 @@ class BinnedSurfaceMaterialAccumulator final
                    const GeometryContext& gctx) const override;
 
  private:
+  /// Accumulate the material interactions into a partial state
+  ///
+  /// @param pState is the partial state of the accumulator
+  /// @param interactions is the material interactions, with assigned surfaces
+  /// @param surfacesWithoutAssignment are the surfaces without assignment
+  void accumulatePartial(
+      PartialState& pState,
+      const std::vector<MaterialInteraction>& interactions,
+      const std::vector<IAssignmentFinder::SurfaceAssignment>&
+          surfacesWithoutAssignment) const;
+
   /// Access method to the logger
   const Logger& logger() const { return *m_logger; }
 
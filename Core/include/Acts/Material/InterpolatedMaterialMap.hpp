@@ -162,7 +162,7 @@ struct MaterialMapLookup {
 
     std::size_t i = 0;
     for (std::size_t index : cornerIndices) {
-      neighbors.at(i++) = m_grid.at(index);
+      neighbors.at(i++) = m_grid.atUnchecked(index);
     }
 
     return MaterialCell(m_transformPos, lowerLeft, upperRight,
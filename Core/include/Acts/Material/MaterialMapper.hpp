@@ -65,6 +65,25 @@ class MaterialMapper {
   /// @return Unique pointer to a new material mapping state object
   std::unique_ptr<State> createState(const GeometryContext& gctx) const;
 
+  /// @brief Factory for creating a partial state
+  ///
+  /// Partial states can be filled with `mapMaterial` concurrently, e.g. one
+  /// per event, and are combined with `mergeState` afterwards. Only the
+  /// layout is read from the full state during the mapping.
+  ///
+  /// @param state the full state the partial state is merged into later
+  /// @return Unique pointer to a new, empty partial mapping state
+  std::unique_ptr<State> createPartialState(const State& state) const;
+
+  /// @brief Merge a partial state into the full state
+  ///
+  /// @param state the full state it has been created from
+  /// @param partialState the partial state, it is empty after the call
+  ///
+  /// @note merging in a fixed order makes the result reproducible
+  /// independent of the threads that filled the partial states
+  void mergeState(State& state, State& partialState) const;
+
   /// @brief Map the material interactions to the surfaces
   ///
   /// @param state the state object holding the sub states
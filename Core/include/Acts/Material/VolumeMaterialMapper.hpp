@@ -114,6 +114,15 @@ class VolumeMaterialMapper {
     std::map<GeometryIdentifier, std::unique_ptr<const IVolumeMaterial>>
         volumeMaterial;
 
+    /// The full state a partial state merges into, nullptr for full states
+    const State* fullState = nullptr;
+
+    /// The sparse grid material of a partial state per geometry ID and
+    /// global grid bin
+    std::map<const GeometryIdentifier,
+             std::map<std::size_t, Acts::AccumulatedVolumeMaterial>>
+        partialGrid;
+
     /// Reference to the geometry context for the mapping
     std::reference_wrapper<const GeometryContext> geoContext;
 
@@ -150,6 +159,25 @@ class VolumeMaterialMapper {
                     const MagneticFieldContext& mctx,
                     const TrackingGeometry& tGeometry) const;
 
+  /// @brief helper method that creates a partial cache for the mapping
+  ///
+  /// @param[in] mState The full state the partial state is merged into
+  ///
+  /// Partial states can be filled with `mapMaterialTrack` concurrently,
+  /// they only read the binning and grids of the full state and accumulate
+  /// the touched grid bins sparsely.
+  /// @return State object to be merged with `mergeState`
+  State createPartialState(const State& mState) const;
+
+  /// @brief Merge a partial state into the full state
+  ///
+  /// @param mState The full state the partial state was created from
+  /// @param partialState The partial state, it is empty after the call
+  ///
+  /// @note merging in a fixed order makes the result reproducible
+  /// independent of the threads that filled the partial states
+  void mergeState(State& mState, State& partialState) const;
+
   /// @brief Method to finalize the maps
   ///
   /// It calls the final run averaging and then transforms
@@ -218,6 +246,18 @@ class VolumeMaterialMapper {
       Acts::MaterialSlab properties, const Vector3& position,
       Vector3 direction) const;
 
+  /// Accumulate one extra material point into the grid of a volume
+  ///
+  /// @param mState The state to be filled
+  /// @param geoID The geometry ID of the volume
+  /// @param dimensions The dimension of the material grid
+  /// @param properties material properties of the extra point
+  /// @param position position of the extra point
+  void accumulateGridHit(State& mState, const GeometryIdentifier& geoID,
+                         std::size_t dimensions,
+                         const Acts::MaterialSlab& properties,
+                         const Vector3& position) const;
+
   /// Standard logger method
   const Logger& logger() const { return *m_logger; }
 
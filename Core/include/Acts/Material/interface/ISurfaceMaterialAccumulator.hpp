@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts {
@@ -42,6 +43,33 @@ class ISurfaceMaterialAccumulator {
   virtual std::unique_ptr<State> createState(
       const GeometryContext& gctx) const = 0;
 
+  /// Factory for creating a partial state
+  ///
+  /// A partial state is filled independently of the full state it has been
+  /// created from, e.g. by one thread for one event, and is merged back into
+  /// it with `mergeState`. Implementations should keep it sparse.
+  ///
+  /// @param state the full state providing the accumulation layout
+  /// @return Unique pointer to a new, empty partial state
+  virtual std::unique_ptr<State> createPartialState(
+      [[maybe_unused]] const State& state) const {
+    throw std::logic_error(
+        "This surface material accumulator does not support partial states.");
+  }
+
+  /// Merge a partial state into the full state it has been created from
+  ///
+  /// @param state the full state to merge into
+  /// @param partialState the partial state, it is empty after the call
+  ///
+  /// @note merging the same partial states in the same order gives identical
+  /// results, regardless of which thread filled them
+  virtual void mergeState([[maybe_unused]] State& state,
+                          [[maybe_unused]] State& partialState) const {
+    throw std::logic_error(
+        "This surface material accumulator does not support partial states.");
+  }
+
   /// @brief Accumulate the material interaction on the surface
   ///
   /// @param state is the state of the accumulator
@@ -23,7 +23,9 @@
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cstddef>
 #include <type_traits>
+#include <vector>
 
 namespace Acts {
 
@@ -152,6 +154,70 @@ class EigenStepper final {
     StepperStatistics statistics;
   };
 
+  /// @brief Batch of independent states which are stepped together
+  ///
+  /// The lanes of the batch are stored in structure-of-arrays form. The
+  /// field lookups of all lanes are gathered and evaluated with a single
+  /// call to @ref Acts::MagneticFieldProvider::getFields per Runge-Kutta
+  /// stage, while the step size of every lane is still controlled on its own.
+  ///
+  /// @note All states of a batch have to use the same magnetic field
+  ///       context. The field cache of the first lane is used for the
+  ///       batched lookups.
+  struct BatchState {
+    /// Remove all lanes while keeping the allocated memory
+    void clear() {
+      states.clear();
+      propDirs.clear();
+      materials.clear();
+      results.clear();
+    }
+
+    /// Add a lane to the batch
+    /// @param state The stepper state of the lane
+    /// @param propDir The propagation direction of the lane
+    /// @param material The optional volume material the lane steps through
+    void add(State& state, Direction propDir,
+             const IVolumeMaterial* material) {
+      states.push_back(&state);
+      propDirs.push_back(propDir);
+      materials.push_back(material);
+      results.emplace_back(0.);
+    }
+
+    /// Number of lanes in the batch
+    /// @return The number of lanes
+    std::size_t size() const { return states.size(); }
+
+    /// Stepper states of the lanes
+    std::vector<State*> states;
+    /// Propagation directions of the lanes
+    std::vector<Direction> propDirs;
+    /// Volume materials of the lanes
+    std::vector<const IVolumeMaterial*> materials;
+    /// Step results of the lanes, filled by @ref stepBatch
+    std::vector<Result<double>> results;
+
+    /// Per-lane Runge-Kutta trial step sizes
+    std::vector<double> h;
+    /// Per-lane step sizes at the beginning of the step
+    std::vector<double> initialH;
+    /// Per-lane local integration error estimates
+    std::vector<double> errorEstimate;
+    /// Per-lane number of step trials
+    std::vector<std::size_t> nStepTrials;
+    /// Per-lane flag whether the last trial was accepted
+    std::vector<char> accepted;
+    /// Indices of the lanes which are still adjusting their step size
+    std::vector<std::size_t> lanes;
+    /// Indices of the lanes in the current field lookup
+    std::vector<std::size_t> lookup;
+    /// Gathered field lookup positions
+    MagneticFieldProvider::VectorBatch positions;
+    /// Field values corresponding to @ref positions
+    MagneticFieldProvider::VectorBatch fields;
+  };
+
   /// Constructor requires knowledge of the detector's magnetic field
   /// @param bField The magnetic field provider
   explicit EigenStepper(std::shared_ptr<const MagneticFieldProvider> bField);
@@ -434,9 +500,38 @@ class EigenStepper final {
   Result<double> step(State& state, Direction propDir,
                       const IVolumeMaterial* material) const;
 
+  /// Perform a Runge-Kutta step for all lanes of a batch
+  ///
+  /// This is equivalent to calling @ref step for every lane, but the field
+  /// lookups of a Runge-Kutta stage are evaluated together for all lanes.
+  /// Lanes whose step is accepted or failed leave the batch while the others
+  /// continue to adjust their step size.
+  ///
+  /// @param [in,out] batch The lanes to step, the results are stored in
+  ///                 `batch.results`
+  void stepBatch(BatchState& batch) const;
+
  protected:
   /// Magnetic field inside of the detector
   std::shared_ptr<const MagneticFieldProvider> m_bField;
+
+ private:
+  /// Scaling of the step size for a given local integration error estimate
+  static double stepSizeScaling(const State& state, double errorEstimate);
+
+  /// Whether a local integration error estimate is acceptable
+  static bool isErrorTolerable(const State& state, double errorEstimate);
+
+  /// Update the state after an accepted Runge-Kutta step of size @p h
+  Result<double> finalizeStep(State& state, Direction propDir,
+                              const IVolumeMaterial* material, double h,
+                              double initialH, double errorEstimate,
+                              std::size_t nStepTrials) const;
+
+  /// Evaluate the field for the lanes in `batch.lookup` at the corresponding
+  /// rows of `batch.positions`. Lanes for which the lookup fails get the
+  /// error as result and are removed from `batch.lookup`.
+  void getFields(BatchState& batch) const;
 };
 
 template <>
@@ -165,6 +165,36 @@ void Acts::EigenStepper<E>::transportCovarianceToBound(
       state.pars, freeToBoundCorrection);
 }
 
+template <typename E>
+double Acts::EigenStepper<E>::stepSizeScaling(const State& state,
+                                              const double errorEstimate) {
+  // For details about these values see ATL-SOFT-PUB-2009-001
+  constexpr double lower = 0.25;
+  constexpr double upper = 4.0;
+  // This is given by the order of the Runge-Kutta method
+  constexpr double exponent = 0.25;
+
+  double x = state.options.stepTolerance / errorEstimate;
+
+  if constexpr (exponent == 0.25) {
+    // This is 3x faster than std::pow
+    x = std::sqrt(std::sqrt(x));
+  } else {
+    x = std::pow(x, exponent);
+  }
+
+  return std::clamp(x, lower, upper);
+}
+
+template <typename E>
+bool Acts::EigenStepper<E>::isErrorTolerable(const State& state,
+                                             const double errorEstimate) {
+  // For details about these values see ATL-SOFT-PUB-2009-001
+  constexpr double marginFactor = 4.0;
+
+  return errorEstimate <= marginFactor * state.options.stepTolerance;
+}
+
 template <typename E>
 Acts::Result<double> Acts::EigenStepper<E>::step(
     State& state, Direction propDir, const IVolumeMaterial* material) const {
@@ -189,32 +219,6 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
     return 0.;
   }
 
-  const auto calcStepSizeScaling = [&](const double errorEstimate_) -> double {
-    // For details about these values see ATL-SOFT-PUB-2009-001
-    constexpr double lower = 0.25;
-    constexpr double upper = 4.0;
-    // This is given by the order of the Runge-Kutta method
-    constexpr double exponent = 0.25;
-
-    double x = state.options.stepTolerance / errorEstimate_;
-
-    if constexpr (exponent == 0.25) {
-      // This is 3x faster than std::pow
-      x = std::sqrt(std::sqrt(x));
-    } else {
-      x = std::pow(x, exponent);
-    }
-
-    return std::clamp(x, lower, upper);
-  };
-
-  const auto isErrorTolerable = [&](const double errorEstimate_) {
-    // For details about these values see ATL-SOFT-PUB-2009-001
-    constexpr double marginFactor = 4.0;
-
-    return errorEstimate_ <= marginFactor * state.options.stepTolerance;
-  };
-
   // The following functor starts to perform a Runge-Kutta step of a certain
   // size, going up to the point where it can return an estimate of the local
   // integration error. The results are stated in the local variables above,
@@ -266,7 +270,7 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
     // Protect against division by zero
     errorEstimate = std::max(1e-20, errorEstimate);
 
-    return success(isErrorTolerable(errorEstimate));
+    return success(isErrorTolerable(state, errorEstimate));
   };
 
   const double initialH = state.stepSize.value() * propDir;
@@ -288,8 +292,7 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
 
     ++state.statistics.nRejectedSteps;
 
-    const double stepSizeScaling = calcStepSizeScaling(errorEstimate);
-    h *= stepSizeScaling;
+    h *= stepSizeScaling(state, errorEstimate);
 
     // If step size becomes too small the particle remains at the initial
     // place
@@ -306,6 +309,21 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
     }
   }
 
+  return finalizeStep(state, propDir, material, h, initialH, errorEstimate,
+                      nStepTrials);
+}
+
+template <typename E>
+Acts::Result<double> Acts::EigenStepper<E>::finalizeStep(
+    State& state, Direction propDir, const IVolumeMaterial* material,
+    const double h, const double initialH, const double errorEstimate,
+    const std::size_t nStepTrials) const {
+  // Runge-Kutta integrator state
+  auto& sd = state.stepData;
+
+  const double h2 = h * h;
+  const Vector3 dir = direction(state);
+
   // When doing error propagation, update the associated Jacobian matrix
   if (state.covTransport) {
     // using the direction before updated below
@@ -376,8 +394,8 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
   state.statistics.pathLength += h;
   state.statistics.absolutePathLength += std::abs(h);
 
-  const double stepSizeScaling = calcStepSizeScaling(errorEstimate);
-  const double nextAccuracy = std::abs(h * stepSizeScaling);
+  const double nextAccuracy =
+      std::abs(h * stepSizeScaling(state, errorEstimate));
   const double previousAccuracy = std::abs(state.stepSize.accuracy());
   const double initialStepLength = std::abs(initialH);
   if (nextAccuracy < initialStepLength || nextAccuracy > previousAccuracy) {
@@ -386,3 +404,194 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
 
   return h;
 }
+
+template <typename E>
+void Acts::EigenStepper<E>::getFields(BatchState& batch) const {
+  const auto nLookups = static_cast<Eigen::Index>(batch.lookup.size());
+  if (nLookups == 0) {
+    return;
+  }
+
+  // The lanes share the field provider, so any of their caches can be used
+  State& first = *batch.states[batch.lookup.front()];
+  auto res = m_bField->getFields(batch.positions.topRows(nLookups),
+                                 batch.fields.topRows(nLookups),
+                                 first.fieldCache);
+  if (res.ok()) {
+    return;
+  }
+
+  // Repeat the lookups one by one to find out which of the lanes failed
+  std::size_t nValid = 0;
+  for (Eigen::Index k = 0; k < nLookups; ++k) {
+    const std::size_t lane = batch.lookup[k];
+    auto field =
+        getField(*batch.states[lane], batch.positions.row(k).transpose());
+    if (!field.ok()) {
+      batch.results[lane] = field.error();
+      continue;
+    }
+    batch.fields.row(nValid) = field->transpose();
+    batch.lookup[nValid] = lane;
+    ++nValid;
+  }
+  batch.lookup.resize(nValid);
+}
+
+template <typename E>
+void Acts::EigenStepper<E>::stepBatch(BatchState& batch) const {
+  const std::size_t nLanes = batch.size();
+
+  batch.h.resize(nLanes);
+  batch.initialH.resize(nLanes);
+  batch.errorEstimate.resize(nLanes);
+  batch.nStepTrials.resize(nLanes);
+  batch.accepted.resize(nLanes);
+  batch.positions.resize(nLanes, 3);
+  batch.fields.resize(nLanes, 3);
+
+  // First Runge-Kutta point (at current position)
+  batch.lookup.clear();
+  for (std::size_t lane = 0; lane < nLanes; ++lane) {
+    batch.results[lane] = 0.;
+    batch.positions.row(lane) = position(*batch.states[lane]).transpose();
+    batch.lookup.push_back(lane);
+  }
+  getFields(batch);
+
+  batch.lanes.clear();
+  for (std::size_t k = 0; k < batch.lookup.size(); ++k) {
+    const std::size_t lane = batch.lookup[k];
+    State& state = *batch.states[lane];
+    auto& sd = state.stepData;
+
+    sd.B_first = batch.fields.row(k).transpose();
+    if (!state.extension.template k<0>(state, *this, batch.materials[lane],
+                                       sd.k1, sd.B_first, sd.kQoP)) {
+      continue;
+    }
+
+    batch.initialH[lane] = state.stepSize.value() * batch.propDirs[lane];
+    batch.h[lane] = batch.initialH[lane];
+    batch.errorEstimate[lane] = 0;
+    batch.nStepTrials[lane] = 0;
+    batch.lanes.push_back(lane);
+  }
+
+  // Select and adjust the appropriate Runge-Kutta step size as given
+  // ATL-SOFT-PUB-2009-001 for all lanes at once. Lanes leave the loop as soon
+  // as their step is accepted or failed.
+  while (!batch.lanes.empty()) {
+    // Second Runge-Kutta point
+    batch.lookup.clear();
+    for (const std::size_t lane : batch.lanes) {
+      State& state = *batch.states[lane];
+      const double h = batch.h[lane];
+
+      ++batch.nStepTrials[lane];
+      ++state.statistics.nAttemptedSteps;
+      batch.accepted[lane] = false;
+
+      batch.positions.row(batch.lookup.size()) =
+          (position(state) + h * 0.5 * direction(state) +
+           h * h * 0.125 * state.stepData.k1)
+              .transpose();
+      batch.lookup.push_back(lane);
+    }
+    getFields(batch);
+
+    // Third Runge-Kutta point, which reuses the field of the second one
+    std::size_t nLookups = 0;
+    for (std::size_t k = 0; k < batch.lookup.size(); ++k) {
+      const std::size_t lane = batch.lookup[k];
+      State& state = *batch.states[lane];
+      auto& sd = state.stepData;
+      const IVolumeMaterial* material = batch.materials[lane];
+      const double h = batch.h[lane];
+      const double half_h = h * 0.5;
+
+      sd.B_middle = batch.fields.row(k).transpose();
+      if (!state.extension.template k<1>(state, *this, material, sd.k2,
+                                         sd.B_middle, sd.kQoP, half_h,
+                                         sd.k1) ||
+          !state.extension.template k<2>(state, *this, material, sd.k3,
+                                         sd.B_middle, sd.kQoP, half_h,
+                                         sd.k2)) {
+        continue;
+      }
+
+      batch.positions.row(nLookups) =
+          (position(state) + h * direction(state) + h * h * 0.5 * sd.k3)
+              .transpose();
+      batch.lookup[nLookups] = lane;
+      ++nLookups;
+    }
+    batch.lookup.resize(nLookups);
+
+    // Last Runge-Kutta point
+    getFields(batch);
+    for (std::size_t k = 0; k < batch.lookup.size(); ++k) {
+      const std::size_t lane = batch.lookup[k];
+      State& state = *batch.states[lane];
+      auto& sd = state.stepData;
+      const double h = batch.h[lane];
+
+      sd.B_last = batch.fields.row(k).transpose();
+      if (!state.extension.template k<3>(state, *this, batch.materials[lane],
+                                         sd.k4, sd.B_last, sd.kQoP, h,
+                                         sd.k3)) {
+        continue;
+      }
+
+      // Compute and check the local integration error estimate
+      const double errorEstimate =
+          h * h *
+          ((sd.k1 - sd.k2 - sd.k3 + sd.k4).template lpNorm<1>() +
+           std::abs(sd.kQoP[0] - sd.kQoP[1] - sd.kQoP[2] + sd.kQoP[3]));
+      // Protect against division by zero
+      batch.errorEstimate[lane] = std::max(1e-20, errorEstimate);
+      batch.accepted[lane] = isErrorTolerable(state, batch.errorEstimate[lane]);
+    }
+
+    // Finish the accepted lanes and adjust the step size of the others
+    std::size_t nRemaining = 0;
+    for (const std::size_t lane : batch.lanes) {
+      State& state = *batch.states[lane];
+
+      if (!batch.results[lane].ok()) {
+        // the field lookup failed
+        continue;
+      }
+
+      if (batch.accepted[lane]) {
+        batch.results[lane] = finalizeStep(
+            state, batch.propDirs[lane], batch.materials[lane], batch.h[lane],
+            batch.initialH[lane], batch.errorEstimate[lane],
+            batch.nStepTrials[lane]);
+        continue;
+      }
+
+      ++state.statistics.nRejectedSteps;
+
+      batch.h[lane] *= stepSizeScaling(state, batch.errorEstimate[lane]);
+
+      // If step size becomes too small the particle remains at the initial
+      // place
+      if (std::abs(batch.h[lane]) < std::abs(state.options.stepSizeCutOff)) {
+        batch.results[lane] = EigenStepperError::StepSizeStalled;
+        continue;
+      }
+
+      // If the parameter is off track too much or given stepSize is not
+      // appropriate
+      if (batch.nStepTrials[lane] > state.options.maxRungeKuttaStepTrials) {
+        batch.results[lane] = EigenStepperError::StepSizeAdjustmentFailed;
+        continue;
+      }
+
+      batch.lanes[nRemaining] = lane;
+      ++nRemaining;
+    }
+    batch.lanes.resize(nRemaining);
+  }
+}
@@ -11,6 +11,7 @@
 #include "Acts/EventData/BoundTrackParameters.hpp"
 #include "Acts/EventData/TrackParametersConcept.hpp"
 #include "Acts/Propagator/ActorList.hpp"
+#include "Acts/Propagator/NavigationTarget.hpp"
 #include "Acts/Propagator/PropagatorOptions.hpp"
 #include "Acts/Propagator/PropagatorResult.hpp"
 #include "Acts/Propagator/PropagatorState.hpp"
@@ -21,6 +22,9 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <span>
+#include <vector>
+
 namespace Acts {
 
 /// Common simplified base interface for propagators.
@@ -312,6 +316,26 @@ class Propagator final
   template <typename propagator_state_t>
   Result<void> propagate(propagator_state_t& state) const;
 
+  /// @brief Propagate a batch of independent tracks
+  ///
+  /// This function performs the same propagation as @ref propagate for every
+  /// state, but the tracks are stepped together, such that the stepper can
+  /// evaluate the magnetic field for all of them at once. Actors, aborters and
+  /// navigation are still handled for every track on its own, and every
+  /// track leaves the batch as soon as its propagation is finished.
+  ///
+  /// @note All states have to use the same magnetic field context.
+  ///
+  /// @tparam propagator_state_t Type of the propagator state with options
+  ///
+  /// @param [in,out] states the initialized propagator state objects
+  ///
+  /// @return Propagation results, one per state
+  template <typename propagator_state_t>
+  std::vector<Result<void>> propagateBatch(
+      std::span<propagator_state_t> states) const
+    requires Concepts::BatchStepper<stepper_t>;
+
   /// @brief Builds the propagator result object
   ///
   /// This function creates the propagator result object from the propagator
@@ -351,6 +375,22 @@ class Propagator final
   template <typename propagator_state_t, typename propagator_result_t>
   void moveStateToResult(propagator_state_t& state,
                          propagator_result_t& result) const;
+
+  /// Find the next reachable navigation target and constrain the step size
+  /// towards it
+  template <typename propagator_state_t>
+  Result<NavigationTarget> getNextTarget(propagator_state_t& state) const;
+
+  /// Handle the navigation, actors and aborters after a step was performed
+  ///
+  /// @return whether the propagation was terminated by the aborters
+  template <typename propagator_state_t>
+  Result<bool> postStep(propagator_state_t& state, double stepSize,
+                        NavigationTarget& nextTarget) const;
+
+  /// Call the actors at the end of the propagation
+  template <typename propagator_state_t>
+  Result<void> postPropagation(propagator_state_t& state) const;
 };
 
 }  // namespace Acts
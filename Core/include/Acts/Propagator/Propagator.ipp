@@ -20,6 +20,149 @@
 
 namespace Acts {
 
+template <StepperConcept S, typename N>
+template <typename propagator_state_t>
+Result<NavigationTarget> Propagator<S, N>::getNextTarget(
+    propagator_state_t& state) const {
+  for (unsigned int i = 0; i < state.options.maxTargetSkipping; ++i) {
+    NavigationTarget nextTarget = m_navigator.nextTarget(
+        state.navigation, state.position, state.direction);
+    if (nextTarget.isNone()) {
+      return NavigationTarget::None();
+    }
+    IntersectionStatus preStepSurfaceStatus = m_stepper.updateSurfaceStatus(
+        state.stepping, nextTarget.surface(), nextTarget.intersectionIndex(),
+        state.options.direction, nextTarget.boundaryTolerance(),
+        state.options.surfaceTolerance, ConstrainedStep::Type::Navigator,
+        logger());
+    if (preStepSurfaceStatus == IntersectionStatus::onSurface) {
+      // This indicates a geometry overlap which is not handled by the
+      // navigator, so we skip this target.
+      // This can also happen in a well-behaved geometry with external
+      // surfaces.
+      ACTS_VERBOSE("Pre-step surface status is onSurface, skipping target "
+                   << nextTarget.surface().geometryId());
+      continue;
+    }
+    if (preStepSurfaceStatus == IntersectionStatus::reachable) {
+      return nextTarget;
+    }
+  }
+
+  ACTS_DEBUG("getNextTarget failed to find a valid target surface after "
+             << state.options.maxTargetSkipping << " attempts.");
+  return Result<NavigationTarget>::failure(
+      PropagatorError::NextTargetLimitReached);
+}
+
+template <StepperConcept S, typename N>
+template <typename propagator_state_t>
+Result<bool> Propagator<S, N>::postStep(propagator_state_t& state,
+                                        double stepSize,
+                                        NavigationTarget& nextTarget) const {
+  // helpers because bool and std::error_code are ambiguous
+  constexpr auto success = &Result<bool>::success;
+  constexpr auto failure = &Result<bool>::failure;
+
+  // Accumulate the path length
+  state.pathLength += stepSize;
+  // Update the position and direction
+  state.position = m_stepper.position(state.stepping);
+  state.direction =
+      state.options.direction * m_stepper.direction(state.stepping);
+
+  ACTS_VERBOSE("Step with size " << stepSize << " performed. We are now at "
+                                 << state.position.transpose()
+                                 << " with direction "
+                                 << state.direction.transpose());
+
+  // release actor and aborter constrains after step was performed
+  m_stepper.releaseStepSize(state.stepping, ConstrainedStep::Type::Navigator);
+  m_stepper.releaseStepSize(state.stepping, ConstrainedStep::Type::Actor);
+
+  // Post-stepping: check target status, call actors, check abort conditions
+  state.stage = PropagatorStage::postStep;
+
+  if (!nextTarget.isNone()) {
+    IntersectionStatus postStepSurfaceStatus = m_stepper.updateSurfaceStatus(
+        state.stepping, nextTarget.surface(), nextTarget.intersectionIndex(),
+        state.options.direction, nextTarget.boundaryTolerance(),
+        state.options.surfaceTolerance, ConstrainedStep::Type::Navigator,
+        logger());
+    if (postStepSurfaceStatus == IntersectionStatus::onSurface) {
+      m_navigator.handleSurfaceReached(state.navigation, state.position,
+                                       state.direction, nextTarget.surface());
+    }
+    if (postStepSurfaceStatus != IntersectionStatus::reachable) {
+      nextTarget = NavigationTarget::None();
+    }
+  }
+
+  Result<void> actResult =
+      state.options.actorList.act(state, m_stepper, m_navigator, logger());
+  if (!actResult.ok()) {
+    ACTS_DEBUG("Actor call failed: " << actResult.error() << ": "
+                                     << actResult.error().message());
+    return failure(actResult.error());
+  }
+
+  if (state.options.actorList.checkAbort(state, m_stepper, m_navigator,
+                                         logger())) {
+    return success(true);
+  }
+
+  // Update the position and direction because actors might have changed it
+  state.position = m_stepper.position(state.stepping);
+  state.direction =
+      state.options.direction * m_stepper.direction(state.stepping);
+
+  // Pre-Stepping: target setting
+  state.stage = PropagatorStage::preStep;
+
+  if (!nextTarget.isNone() &&
+      !m_navigator.checkTargetValid(state.navigation, state.position,
+                                    state.direction)) {
+    ACTS_VERBOSE("Target is not valid anymore.");
+    nextTarget = NavigationTarget::None();
+  }
+
+  if (nextTarget.isNone()) {
+    // navigator step constraint is not valid anymore
+    m_stepper.releaseStepSize(state.stepping, ConstrainedStep::Type::Navigator);
+
+    Result<NavigationTarget> nextTargetResult = getNextTarget(state);
+    if (!nextTargetResult.ok()) {
+      ACTS_DEBUG("Failed to get next target: "
+                 << nextTargetResult.error() << ": "
+                 << nextTargetResult.error().message());
+      return failure(nextTargetResult.error());
+    }
+    nextTarget = *nextTargetResult;
+  }
+
+  return success(false);
+}
+
+template <StepperConcept S, typename N>
+template <typename propagator_state_t>
+Result<void> Propagator<S, N>::postPropagation(
+    propagator_state_t& state) const {
+  ACTS_VERBOSE("Stepping loop done.");
+
+  state.stage = PropagatorStage::postPropagation;
+
+  // Post-stepping call to the actor list
+  if (auto postPropagationResult =
+          state.options.actorList.act(state, m_stepper, m_navigator, logger());
+      !postPropagationResult.ok()) {
+    ACTS_DEBUG("Post-propagation actor call failed: "
+               << postPropagationResult.error() << ": "
+               << postPropagationResult.error().message());
+    return postPropagationResult.error();
+  }
+  return Result<void>::success();
+}
+
 template <StepperConcept S, typename N>
 template <typename propagator_state_t>
 Result<void> Propagator<S, N>::propagate(propagator_state_t& state) const {
@@ -39,45 +182,13 @@ Result<void> Propagator<S, N>::propagate(propagator_state_t& state) const {
     return state.options.actorList.act(state, m_stepper, m_navigator, logger());
   }
 
-  auto getNextTarget = [&]() -> Result<NavigationTarget> {
-    for (unsigned int i = 0; i < state.options.maxTargetSkipping; ++i) {
-      NavigationTarget nextTarget = m_navigator.nextTarget(
-          state.navigation, state.position, state.direction);
-      if (nextTarget.isNone()) {
-        return NavigationTarget::None();
-      }
-      IntersectionStatus preStepSurfaceStatus = m_stepper.updateSurfaceStatus(
-          state.stepping, nextTarget.surface(), nextTarget.intersectionIndex(),
-          state.options.direction, nextTarget.boundaryTolerance(),
-          state.options.surfaceTolerance, ConstrainedStep::Type::Navigator,
-          logger());
-      if (preStepSurfaceStatus == IntersectionStatus::onSurface) {
-        // This indicates a geometry overlap which is not handled by the
-        // navigator, so we skip this target.
-        // This can also happen in a well-behaved geometry with external
-        // surfaces.
-        ACTS_VERBOSE("Pre-step surface status is onSurface, skipping target "
-                     << nextTarget.surface().geometryId());
-        continue;
-      }
-      if (preStepSurfaceStatus == IntersectionStatus::reachable) {
-        return nextTarget;
-      }
-    }
-
-    ACTS_DEBUG("getNextTarget failed to find a valid target surface after "
-               << state.options.maxTargetSkipping << " attempts.");
-    return Result<NavigationTarget>::failure(
-        PropagatorError::NextTargetLimitReached);
-  };
-
   // priming error condition
   bool terminatedNormally = false;
 
   // Pre-Stepping: target setting
   state.stage = PropagatorStage::preStep;
 
-  Result<NavigationTarget> nextTargetResult = getNextTarget();
+  Result<NavigationTarget> nextTargetResult = getNextTarget(state);
   if (!nextTargetResult.ok()) {
     ACTS_DEBUG("Failed to get next target: "
                << nextTargetResult.error() << ": "
@@ -99,83 +210,15 @@ Result<void> Propagator<S, N>::propagate(propagator_state_t& state) const {
                                      << res.error().message());
       return res.error();
     }
-    // Accumulate the path length
-    state.pathLength += *res;
-    // Update the position and direction
-    state.position = m_stepper.position(state.stepping);
-    state.direction =
-        state.options.direction * m_stepper.direction(state.stepping);
-
-    ACTS_VERBOSE("Step with size " << *res << " performed. We are now at "
-                                   << state.position.transpose()
-                                   << " with direction "
-                                   << state.direction.transpose());
-
-    // release actor and aborter constrains after step was performed
-    m_stepper.releaseStepSize(state.stepping, ConstrainedStep::Type::Navigator);
-    m_stepper.releaseStepSize(state.stepping, ConstrainedStep::Type::Actor);
-
-    // Post-stepping: check target status, call actors, check abort conditions
-    state.stage = PropagatorStage::postStep;
-
-    if (!nextTarget.isNone()) {
-      IntersectionStatus postStepSurfaceStatus = m_stepper.updateSurfaceStatus(
-          state.stepping, nextTarget.surface(), nextTarget.intersectionIndex(),
-          state.options.direction, nextTarget.boundaryTolerance(),
-          state.options.surfaceTolerance, ConstrainedStep::Type::Navigator,
-          logger());
-      if (postStepSurfaceStatus == IntersectionStatus::onSurface) {
-        m_navigator.handleSurfaceReached(state.navigation, state.position,
-                                         state.direction, nextTarget.surface());
-      }
-      if (postStepSurfaceStatus != IntersectionStatus::reachable) {
-        nextTarget = NavigationTarget::None();
-      }
-    }
 
-    Result<void> actResult =
-        state.options.actorList.act(state, m_stepper, m_navigator, logger());
-    if (!actResult.ok()) {
-      ACTS_DEBUG("Actor call failed: " << actResult.error() << ": "
-                                       << actResult.error().message());
-      return actResult.error();
+    Result<bool> postStepResult = postStep(state, *res, nextTarget);
+    if (!postStepResult.ok()) {
+      return postStepResult.error();
     }
-
-    if (state.options.actorList.checkAbort(state, m_stepper, m_navigator,
-                                           logger())) {
+    if (*postStepResult) {
       terminatedNormally = true;
       break;
     }
-
-    // Update the position and direction because actors might have changed it
-    state.position = m_stepper.position(state.stepping);
-    state.direction =
-        state.options.direction * m_stepper.direction(state.stepping);
-
-    // Pre-Stepping: target setting
-    state.stage = PropagatorStage::preStep;
-
-    if (!nextTarget.isNone() &&
-        !m_navigator.checkTargetValid(state.navigation, state.position,
-                                      state.direction)) {
-      ACTS_VERBOSE("Target is not valid anymore.");
-      nextTarget = NavigationTarget::None();
-    }
-
-    if (nextTarget.isNone()) {
-      // navigator step constraint is not valid anymore
-      m_stepper.releaseStepSize(state.stepping,
-                                ConstrainedStep::Type::Navigator);
-
-      nextTargetResult = getNextTarget();
-      if (!nextTargetResult.ok()) {
-        ACTS_DEBUG("Failed to get next target: "
-                   << nextTargetResult.error() << ": "
-                   << nextTargetResult.error().message());
-        return nextTargetResult.error();
-      }
-      nextTarget = *nextTargetResult;
-    }
   }  // end of stepping loop
 
   // check if we didn't terminate normally via aborters
@@ -186,20 +229,117 @@ Result<void> Propagator<S, N>::propagate(propagator_state_t& state) const {
     return PropagatorError::StepCountLimitReached;
   }
 
-  ACTS_VERBOSE("Stepping loop done.");
+  return postPropagation(state);
+}
 
-  state.stage = PropagatorStage::postPropagation;
+template <StepperConcept S, typename N>
+template <typename propagator_state_t>
+std::vector<Result<void>> Propagator<S, N>::propagateBatch(
+    std::span<propagator_state_t> states) const
+  requires Concepts::BatchStepper<S>
+{
+  ACTS_VERBOSE("Entering batched propagation of " << states.size()
+                                                  << " tracks.");
 
-  // Post-stepping call to the actor list
-  if (auto postPropagationResult =
+  std::vector<Result<void>> results(states.size(), Result<void>::success());
+  std::vector<NavigationTarget> nextTargets(states.size(),
+                                            NavigationTarget::None());
+  // indices of the tracks which are still being propagated
+  std::vector<std::size_t> lanes;
+  lanes.reserve(states.size());
+
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    propagator_state_t& state = states[i];
+
+    state.stage = PropagatorStage::prePropagation;
+
+    // Pre-Propagation: call to the actor list, abort condition check
+    state.options.actorList.act(state, m_stepper, m_navigator, logger());
+
+    if (state.options.actorList.checkAbort(state, m_stepper, m_navigator,
+                                           logger())) {
+      ACTS_VERBOSE("Propagation terminated without going into stepping loop.");
+
+      state.stage = PropagatorStage::postPropagation;
+
+      results[i] =
           state.options.actorList.act(state, m_stepper, m_navigator, logger());
-      !postPropagationResult.ok()) {
-    ACTS_DEBUG("Post-propagation actor call failed: "
-               << postPropagationResult.error() << ": "
-               << postPropagationResult.error().message());
-    return postPropagationResult.error();
+      continue;
+    }
+
+    // Pre-Stepping: target setting
+    state.stage = PropagatorStage::preStep;
+
+    Result<NavigationTarget> nextTargetResult = getNextTarget(state);
+    if (!nextTargetResult.ok()) {
+      ACTS_DEBUG("Failed to get next target: "
+                 << nextTargetResult.error() << ": "
+                 << nextTargetResult.error().message());
+      results[i] = nextTargetResult.error();
+      continue;
+    }
+    nextTargets[i] = *nextTargetResult;
+    lanes.push_back(i);
   }
-  return Result<void>::success();
+
+  ACTS_VERBOSE("Starting batched stepping loop.");
+
+  typename S::BatchState batch;
+  while (!lanes.empty()) {
+    batch.clear();
+
+    // Tracks which ran out of steps leave the batch
+    std::size_t nStepping = 0;
+    for (const std::size_t i : lanes) {
+      propagator_state_t& state = states[i];
+      if (state.steps >= state.options.maxSteps) {
+        ACTS_DEBUG("Propagation reached the step count limit of "
+                   << state.options.maxSteps << " (did " << state.steps
+                   << " steps)");
+        results[i] = PropagatorError::StepCountLimitReached;
+        continue;
+      }
+      batch.add(state.stepping, state.options.direction,
+                m_navigator.currentVolumeMaterial(state.navigation));
+      lanes[nStepping] = i;
+      ++nStepping;
+    }
+    lanes.resize(nStepping);
+
+    // Perform a step for all tracks at once
+    m_stepper.stepBatch(batch);
+
+    std::size_t nRemaining = 0;
+    for (std::size_t k = 0; k < lanes.size(); ++k) {
+      const std::size_t i = lanes[k];
+      propagator_state_t& state = states[i];
+
+      const Result<double>& res = batch.results[k];
+      if (!res.ok()) {
+        ACTS_DEBUG("Step failed with " << res.error() << ": "
+                                       << res.error().message());
+        results[i] = res.error();
+        continue;
+      }
+
+      Result<bool> postStepResult = postStep(state, *res, nextTargets[i]);
+      if (!postStepResult.ok()) {
+        results[i] = postStepResult.error();
+        continue;
+      }
+      if (*postStepResult) {
+        results[i] = postPropagation(state);
+        continue;
+      }
+
+      ++state.steps;
+      lanes[nRemaining] = i;
+      ++nRemaining;
+    }
+    lanes.resize(nRemaining);
+  }
+
+  return results;
 }
 
 template <StepperConcept S, typename N>
@@ -19,6 +19,9 @@
 #include "Acts/Utilities/Logger.hpp"
 
 namespace Acts {
+
+class IVolumeMaterial;
+
 namespace Concepts {
 
 /// @brief Concept that is satisfied by both single- and multi-steppers.
@@ -117,6 +120,19 @@ concept MultiStepper = CommonStepper<Stepper, State> && requires {
     { s.removeMissedComponents(t) } -> std::same_as<void>;
   };
 };
+
+/// @brief Concept that is satisfied by single-steppers which can step a batch
+/// of independent states at once.
+template <typename Stepper>
+concept BatchStepper =
+    SingleStepper<Stepper> &&
+    requires(const Stepper& s, typename Stepper::BatchState& b,
+             typename Stepper::State& t, Direction d,
+             const IVolumeMaterial* m) {
+      { b.clear() } -> std::same_as<void>;
+      { b.add(t, d, m) } -> std::same_as<void>;
+      { s.stepBatch(b) } -> std::same_as<void>;
+    };
 }  // namespace Concepts
 
 /// @brief Concept that is satisfied by steppers.
@@ -53,13 +53,18 @@ struct GbtsNode final {
 };
 
 /// Eta-bin container for GBTS nodes and edge data.
+///
+/// The nodes of the bin are referenced by their index in the flat node vector
+/// of the @ref GbtsNodeStorage.
 struct GbtsEtaBin final {
   GbtsEtaBin();
 
   /// Sort nodes by phi
-  void sortByPhi();
+  /// @param nodes All nodes of the node storage
+  void sortByPhi(std::span<const GbtsNode> nodes);
   /// Initialize node attributes
-  void initializeNodes();
+  /// @param nodes All nodes of the node storage
+  void initializeNodes(std::span<const GbtsNode> nodes);
   /// Check if bin is empty
   /// @return True if bin has no nodes
   bool empty() const { return vn.empty(); }
@@ -68,8 +73,8 @@ struct GbtsEtaBin final {
   /// @param dphi Phi bin width
   void generatePhiIndexing(float dphi);
 
-  /// nodes of the graph
-  std::vector<const GbtsNode*> vn;
+  /// indices of the nodes of the graph in the node storage
+  std::vector<std::uint32_t> vn;
   /// Phi-indexed nodes
   std::vector<std::pair<float, std::uint32_t>> vPhiNodes;
   /// node attributes: minCutOnTau, maxCutOnTau, phi, r, z;
@@ -92,28 +97,38 @@ struct GbtsEtaBin final {
 };
 
 /// Storage container for GBTS nodes
+///
+/// The nodes of all layers are kept in one flat vector owned by the caller.
+/// Eta bins and edges refer to them by index.
 class GbtsNodeStorage final {
  public:
   /// @param geometry Shared pointer to GBTS geometry
   /// @param mlLut Machine learning lookup table
-  explicit GbtsNodeStorage(std::shared_ptr<const GbtsGeometry> geometry,
-                           GbtsMlLookupTable mlLut);
+  /// @param nodes All nodes of the event, grouped by layer
+  GbtsNodeStorage(std::shared_ptr<const GbtsGeometry> geometry,
+                  GbtsMlLookupTable mlLut, std::span<const GbtsNode> nodes);
 
   /// Load pixel graph nodes
   /// @param layerIndex Layer index for the nodes
-  /// @param coll Collection of nodes to load
+  /// @param begin Index of the first node of the layer
+  /// @param end Index past the last node of the layer
   /// @param useMl Use machine learning features
   /// @param maxEndcapClusterWidth Maximum cluster width for endcap nodes
   /// @return Number of nodes loaded
   std::uint32_t loadPixelGraphNodes(std::uint16_t layerIndex,
-                                    const std::span<const GbtsNode> coll,
+                                    std::uint32_t begin, std::uint32_t end,
                                     bool useMl, float maxEndcapClusterWidth);
   /// Load strip graph nodes
   /// @param layerIndex Layer index for the nodes
-  /// @param coll Collection of nodes to load
+  /// @param begin Index of the first node of the layer
+  /// @param end Index past the last node of the layer
   /// @return Number of nodes loaded
   std::uint32_t loadStripGraphNodes(std::uint16_t layerIndex,
-                                    const std::span<const GbtsNode> coll);
+                                    std::uint32_t begin, std::uint32_t end);
+
+  /// Get all nodes, indexed by the eta bins and the edges
+  /// @return The flat node vector
+  std::span<const GbtsNode> nodes() const { return m_nodes; }
 
   /// Get the total number of nodes
   /// @return Total number of nodes
@@ -144,28 +159,35 @@ class GbtsNodeStorage final {
   /// Machine learning lookup table
   GbtsMlLookupTable m_mlLut;
 
+  /// All nodes of the event
+  std::span<const GbtsNode> m_nodes;
+
   /// Eta bins for node storage
   std::vector<GbtsEtaBin> m_etaBins;
 };
 
 /// Edge between two GBTS nodes with fit parameters.
 struct GbtsEdge final {
+  /// Index of a missing node
+  static constexpr std::uint32_t kInvalidNode =
+      std::numeric_limits<std::uint32_t>::max();
+
   GbtsEdge() = default;
 
   /// Constructor
-  /// @param n1_ First node
-  /// @param n2_ Second node
+  /// @param n1_ Index of the first node in the node storage
+  /// @param n2_ Index of the second node in the node storage
   /// @param p1_ First fit parameter
   /// @param p2_ Second fit parameter
   /// @param p3_ Third fit parameter
-  GbtsEdge(const GbtsNode* n1_, const GbtsNode* n2_, float p1_, float p2_,
+  GbtsEdge(std::uint32_t n1_, std::uint32_t n2_, float p1_, float p2_,
            float p3_)
       : n1{n1_}, n2{n2_}, level{1}, next{1}, p{p1_, p2_, p3_} {}
 
-  /// First node of the edge
-  const GbtsNode* n1{nullptr};
-  /// Second node of the edge
-  const GbtsNode* n2{nullptr};
+  /// Index of the first node of the edge in the node storage
+  std::uint32_t n1{kInvalidNode};
+  /// Index of the second node of the edge in the node storage
+  std::uint32_t n2{kInvalidNode};
 
   /// Level in the graph hierarchy
   std::int8_t level{-1};
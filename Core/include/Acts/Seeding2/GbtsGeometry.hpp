@@ -10,6 +10,7 @@
 
 #include "Acts/Seeding2/GbtsLayerConnection.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <unordered_map>
@@ -137,6 +138,14 @@ class GbtsGeometry final {
     return m_binGroups;
   }
 
+  /// Get the stages of the bin groups. Stage i consists of the bin groups in
+  /// [stages[i], stages[i + 1]). The n2 bins of a group only appear as n1
+  /// bins in earlier stages, so the groups of one stage are independent.
+  /// @return Offsets of the stages in the bin groups vector
+  const std::vector<std::size_t>& binGroupStages() const {
+    return m_binGroupStages;
+  }
+
   /// Get layer by ID
   /// @param id Layer ID
   /// @return Pointer to layer or nullptr
@@ -173,6 +182,8 @@ class GbtsGeometry final {
 
   /// Bin groups
   std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> m_binGroups;
+  /// Offsets of the stages in the bin groups
+  std::vector<std::size_t> m_binGroupStages;
 };
 
 }  // namespace Acts::Experimental
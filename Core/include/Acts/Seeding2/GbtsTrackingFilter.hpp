@@ -13,6 +13,7 @@
 #include "Acts/Seeding2/GbtsGeometry.hpp"
 
 #include <cstring>
+#include <span>
 #include <vector>
 
 namespace Acts::Experimental {
@@ -27,8 +28,9 @@ struct GbtsEdgeState final {
   explicit GbtsEdgeState(bool f) : initialized(f) {}
 
   /// Initialize from edge
+  /// @param nodes Nodes indexed by the edge
   /// @param pS Edge to initialize from
-  void initialize(const GbtsEdge& pS);
+  void initialize(std::span<const GbtsNode> nodes, const GbtsEdge& pS);
 
   /// Initialization flag
   bool initialized{false};
@@ -114,11 +116,12 @@ class GbtsTrackingFilter final {
 
   /// Follow track starting from edge
   /// @param state Tracking filter state
+  /// @param nodes Nodes indexed by the edges
   /// @param sb Edge storage
   /// @param pS Starting edge
   /// @return Final edge state after following the track
-  GbtsEdgeState followTrack(State& state, std::vector<GbtsEdge>& sb,
-                            GbtsEdge& pS) const;
+  GbtsEdgeState followTrack(State& state, std::span<const GbtsNode> nodes,
+                            std::vector<GbtsEdge>& sb, GbtsEdge& pS) const;
 
  private:
   /// Configuration for the tracking filter.
@@ -129,17 +132,21 @@ class GbtsTrackingFilter final {
 
   /// Propagate edge state
   /// @param state Tracking filter state
+  /// @param nodes Nodes indexed by the edges
   /// @param sb Edge storage
   /// @param pS Edge to propagate from
   /// @param ts Edge state to update
-  void propagate(State& state, std::vector<GbtsEdge>& sb, GbtsEdge& pS,
+  void propagate(State& state, std::span<const GbtsNode> nodes,
+                 std::vector<GbtsEdge>& sb, GbtsEdge& pS,
                  GbtsEdgeState& ts) const;
 
   /// Update edge state with edge
+  /// @param nodes Nodes indexed by the edge
   /// @param pS Edge to update with
   /// @param ts Edge state to update
   /// @return Success flag
-  bool update(const GbtsEdge& pS, GbtsEdgeState& ts) const;
+  bool update(std::span<const GbtsNode> nodes, const GbtsEdge& pS,
+              GbtsEdgeState& ts) const;
 
   /// Get layer type from layer index
   /// @param layerIndex Layer index
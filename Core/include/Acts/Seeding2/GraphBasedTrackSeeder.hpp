@@ -16,9 +16,11 @@
 #include "Acts/Seeding2/GbtsRoiDescriptor.hpp"
 #include "Acts/Seeding2/GbtsTrackingFilter.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -78,6 +80,17 @@ class GraphBasedTrackSeeder {
     bool doubletFilterRZ = true;
     /// Maximum number of Gbts edges/doublets.
     std::uint32_t nMaxEdges = 2000000;
+    /// Number of threads used to build the graph and to propagate the edge
+    /// levels. The seeds do not depend on the number of threads.
+    ///
+    /// Without an executor, the threads are started for every call in
+    /// addition to the calling thread.
+    std::uint32_t numThreads = 1;
+    /// Optional executor for the parallel stages if numThreads is larger
+    /// than 1. Running them in the task arena which processes the events
+    /// shares its threads with the other events instead of oversubscribing
+    /// the cores.
+    ParallelExecutor executor;
     /// Minimum delta radius between layers.
     float minDeltaRadius = 2.0 * Acts::UnitConstants::mm;
     /// Maximum d0 impact parameter when validating edge connection triplet
@@ -208,9 +221,11 @@ class GraphBasedTrackSeeder {
   /// Create graph nodes from space points.
   /// @param spacePoints Space point container
   /// @param maxLayers Maximum number of layers
-  /// @return Vector of node vectors organized by layer
-  std::vector<std::vector<GbtsNode>> createNodes(
-      const SpacePointContainer2& spacePoints, std::uint32_t maxLayers) const;
+  /// @param layerOffsets Output offsets of the layers in the node vector
+  /// @return Nodes of all layers in one vector, grouped by layer
+  std::vector<GbtsNode> createNodes(
+      const SpacePointContainer2& spacePoints, std::uint32_t maxLayers,
+      std::vector<std::uint32_t>& layerOffsets) const;
 
   /// Parse machine learning lookup table from file.
   /// @param lutInputFile Path to the lookup table input file
@@ -238,11 +253,13 @@ class GraphBasedTrackSeeder {
   /// @param maxLevel Maximum level in the graph
   /// @param nEdges Number of edges
   /// @param nHits Number of hits
+  /// @param nodes Nodes indexed by the edges
   /// @param edgeStorage Storage containing edges
   /// @param vOutputSeeds Output vector for seed candidates
   /// @param filter Tracking filter to be applied
   void extractSeedsFromTheGraph(std::uint32_t maxLevel, std::uint32_t nEdges,
                                 std::int32_t nHits,
+                                std::span<const GbtsNode> nodes,
                                 std::vector<GbtsEdge>& edgeStorage,
                                 std::vector<OutputSeedProperties>& vOutputSeeds,
                                 const GbtsTrackingFilter& filter) const;
@@ -15,6 +15,9 @@
 #include "Acts/Seeding2/TripletSeedFinder.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstdint>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -40,6 +43,56 @@ class TripletSeeder {
     TripletTopCandidates tripletTopCandidates;
   };
 
+  /// Doublets and triplet top candidates of a sequence of middle space points,
+  /// recorded before any seed filtering.
+  ///
+  /// Finding the doublets and triplet candidates does not depend on the seed
+  /// filter, so it can run concurrently for different middle space point
+  /// groups, with one cache and one record per group. The filter, which may
+  /// carry state from one middle space point to the next, is then applied to
+  /// the records in the original order which gives the same seeds as
+  /// `createSeedsFromGroups`.
+  struct CandidateRecord {
+    /// Recorded middle space point
+    struct Middle {
+      /// Index of the middle space point
+      SpacePointIndex2 spacePoint{};
+      /// Range of its top doublets in `topDoublets`
+      DoubletsForMiddleSp::IndexRange topDoublets{};
+      /// Range of its bottom doublets in `bottoms`
+      std::pair<std::uint32_t, std::uint32_t> bottoms{};
+    };
+
+    /// Recorded bottom doublet in the order it is filtered
+    struct Bottom {
+      /// Index of the doublet in `bottomDoublets`
+      DoubletsForMiddleSp::Index doublet{};
+      /// Range of its triplet candidates in `tripletTopCandidates`
+      std::pair<TripletTopCandidates::Index, TripletTopCandidates::Index>
+          tripletTopCandidates{};
+    };
+
+    /// Middle space points with at least one top doublet
+    std::vector<Middle> middles;
+    /// Bottom doublets of all middle space points
+    std::vector<Bottom> bottoms;
+    /// Top doublets of all middle space points
+    DoubletsForMiddleSp topDoublets;
+    /// Bottom doublet parameters of all middle space points
+    DoubletsForMiddleSp bottomDoublets;
+    /// Triplet top candidates of all bottom doublets
+    TripletTopCandidates tripletTopCandidates;
+
+    /// Remove all recorded candidates, but keep the memory
+    void clear() {
+      middles.clear();
+      bottoms.clear();
+      topDoublets.clear();
+      bottomDoublets.clear();
+      tripletTopCandidates.clear();
+    }
+  };
+
   /// Construct a TripletSeeder with optional logger.
   /// @param logger Logger instance for debug output (defaults to INFO level)
   explicit TripletSeeder(std::unique_ptr<const Logger> logger =
@@ -92,6 +145,49 @@ class TripletSeeder {
       const std::pair<float, float>& radiusRangeForMiddle,
       SeedContainer2& outputSeeds) const;
 
+  /// Find the doublets and triplet top candidates for a group of middle space
+  /// points without filtering them.
+  ///
+  /// This is the filter independent part of `createSeedsFromGroups`. It only
+  /// modifies the cache, the space point groups and the record, so it can be
+  /// called concurrently for different groups.
+  ///
+  /// @param cache Cache object to store intermediate results
+  /// @param bottomFinder Finder for bottom doublets
+  /// @param topFinder Finder for top doublets
+  /// @param tripletFinder Finder for triplet space points
+  /// @param spacePoints space point container
+  /// @param bottomSpGroups Groups of space points to be used as innermost SP in a seed
+  /// @param middleSpGroup Group of space points to be used as middle SP in a seed
+  /// @param topSpGroups Groups of space points to be used as outermost SP in a seed
+  /// @param radiusRangeForMiddle Range of radii for the middle space points
+  /// @param record Record the candidates are appended to
+  void recordCandidatesFromGroups(
+      Cache& cache, const DoubletSeedFinder& bottomFinder,
+      const DoubletSeedFinder& topFinder,
+      const TripletSeedFinder& tripletFinder,
+      const SpacePointContainer2& spacePoints,
+      const std::span<SpacePointContainer2::ConstRange>& bottomSpGroups,
+      const SpacePointContainer2::ConstRange& middleSpGroup,
+      const std::span<SpacePointContainer2::ConstRange>& topSpGroups,
+      const std::pair<float, float>& radiusRangeForMiddle,
+      CandidateRecord& record) const;
+
+  /// Filter recorded candidates and create the seeds.
+  ///
+  /// Calling this for the records of all groups in the original group order
+  /// gives the same seeds as calling `createSeedsFromGroups` for the groups.
+  ///
+  /// @param cache Cache object to store intermediate results
+  /// @param filter Triplet seed filter that defines the filtering criteria
+  /// @param spacePoints space point container
+  /// @param record Recorded candidates
+  /// @param outputSeeds Output container for the seeds
+  void filterRecordedCandidates(Cache& cache, const ITripletSeedFilter& filter,
+                                const SpacePointContainer2& spacePoints,
+                                const CandidateRecord& record,
+                                SeedContainer2& outputSeeds) const;
+
  private:
   std::unique_ptr<const Logger> m_logger;
 
@@ -27,16 +27,32 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <span>
+#include <system_error>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
 /// @addtogroup track_finding
 /// @{
 
+/// Order in which the combinatorial Kalman filter explores the branches of a
+/// track candidate.
+enum class CombinatorialKalmanFilterTraversal {
+  /// Follow one branch until it is stopped, then re-initialize the
+  /// propagation at the next pending branch.
+  DepthFirst,
+  /// Advance all branches in lockstep from one surface to the next and run the
+  /// filter steps of all branches on a surface together.
+  BreadthFirst,
+};
+
 /// Combined options for the combinatorial Kalman filter.
 ///
 /// @tparam source_link_iterator_t Type of the source link iterator
@@ -102,6 +118,10 @@ struct CombinatorialKalmanFilterOptions {
   /// Skip the pre propagation call. This effectively skips the first surface
   /// @note This is useful if the first surface should not be considered in a second reverse pass
   bool skipPrePropagationUpdate = false;
+
+  /// Order in which the branches of a track candidate are explored.
+  CombinatorialKalmanFilterTraversal traversal =
+      CombinatorialKalmanFilterTraversal::DepthFirst;
 };
 
 /// Result container for the combinatorial Kalman filter actor.
@@ -135,6 +155,13 @@ struct CombinatorialKalmanFilterResult {
   /// Indicator if track finding has been done
   bool finished = false;
 
+  /// Surface on which the propagation was suspended to defer the filter step
+  /// to the caller. Only used for the breadth-first traversal.
+  const Surface* suspendedSurface = nullptr;
+
+  /// Indicator that the propagation is resumed after a deferred filter step
+  bool resumed = false;
+
   /// Path limit aborter
   PathLimitReached pathLimitReached;
 };
@@ -215,6 +242,10 @@ class CombinatorialKalmanFilter {
     /// Skip the pre propagation call. This effectively skips the first surface
     bool skipPrePropagationUpdate = false;
 
+    /// Suspend the propagation on every surface which requires a filter step
+    /// instead of filtering directly. Used for the breadth-first traversal.
+    bool suspendOnSurface = false;
+
     /// Calibration context for the finding run
     const CalibrationContext* calibrationContextPtr{nullptr};
 
@@ -251,7 +282,11 @@ class CombinatorialKalmanFilter {
 
       assert(result.trackStates && "No MultiTrajectory set");
 
-      if (state.stage == PropagatorStage::prePropagation &&
+      // The filter step on the current surface was already performed by the
+      // caller if the propagation is resumed after a suspension
+      const bool resumed = std::exchange(result.resumed, false);
+
+      if (!resumed && state.stage == PropagatorStage::prePropagation &&
           skipPrePropagationUpdate) {
         ACTS_VERBOSE("Skip pre-propagation update (first surface)");
         return Result<void>::success();
@@ -276,7 +311,7 @@ class CombinatorialKalmanFilter {
       // Update:
       // - Waiting for a current surface
       if (const Surface* surface = navigator.currentSurface(state.navigation);
-          surface != nullptr) {
+          surface != nullptr && !resumed) {
         // There are three scenarios:
         // 1) The surface is in the measurement map
         // -> Select source links
@@ -291,6 +326,14 @@ class CombinatorialKalmanFilter {
         // -> Call branch stopper to justify the branch
         // 3) The surface is neither in the measurement map nor with material
         // -> Do nothing
+        if (suspendOnSurface && (surface->isSensitive() ||
+                                 surface->surfaceMaterial() != nullptr)) {
+          ACTS_VERBOSE("Suspend propagation on surface "
+                       << surface->geometryId());
+          result.suspendedSurface = surface;
+          return Result<void>::success();
+        }
+
         ACTS_VERBOSE("Perform filter step");
         auto res = filter(*surface, state, stepper, navigator, result);
         if (!res.ok()) {
@@ -364,7 +407,7 @@ class CombinatorialKalmanFilter {
     bool checkAbort(propagator_state_t& /*state*/, const stepper_t& /*stepper*/,
                     const navigator_t& /*navigator*/, const result_type& result,
                     const Logger& /*logger*/) const {
-      return result.finished;
+      return result.finished || result.suspendedSurface != nullptr;
     }
 
     /// @brief CombinatorialKalmanFilter actor operation: reset propagation
@@ -798,6 +841,280 @@ class CombinatorialKalmanFilter {
     }
   };
 
+  /// Propagator options type used for the track finding
+  using PropagatorOptions =
+      typename propagator_t::template Options<ActorList<Actor>>;
+
+  /// Create the propagator options and configure the actor
+  ///
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  ///                  finding
+  /// @return the propagator options including the configured actor
+  PropagatorOptions makePropagatorOptions(
+      const CombinatorialKalmanFilterOptions<track_container_t>& tfOptions)
+      const {
+    PropagatorOptions propOptions(tfOptions.geoContext,
+                                  tfOptions.magFieldContext);
+
+    // Set the trivial propagator options
+    propOptions.setPlainOptions(tfOptions.propagatorPlainOptions);
+
+    // Catch the actor
+    auto& combKalmanActor = propOptions.actorList.template get<Actor>();
+    combKalmanActor.targetReached.surface = tfOptions.targetSurface;
+    combKalmanActor.multipleScattering = tfOptions.multipleScattering;
+    combKalmanActor.energyLoss = tfOptions.energyLoss;
+    combKalmanActor.skipPrePropagationUpdate =
+        tfOptions.skipPrePropagationUpdate;
+    combKalmanActor.suspendOnSurface =
+        tfOptions.traversal == CombinatorialKalmanFilterTraversal::BreadthFirst;
+    combKalmanActor.actorLogger = m_actorLogger.get();
+    combKalmanActor.updaterLogger = m_updaterLogger.get();
+    combKalmanActor.calibrationContextPtr = &tfOptions.calibrationContext.get();
+
+    // copy delegates to calibrator, updater, branch stopper
+    combKalmanActor.extensions = tfOptions.extensions;
+
+    return propOptions;
+  }
+
+  /// Breadth-first track finding for a set of seeds
+  ///
+  /// @param initialParameters The initial track parameters, one per seed
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  ///                  finding
+  /// @param trackContainer Track container in which to store the results
+  /// @param rootBranches The tracks to be used as root branches, one per seed
+  ///
+  /// @return the track finding result for each seed
+  std::vector<Result<std::vector<TrackProxy>>> findTracksBreadthFirst(
+      std::span<const BoundTrackParameters> initialParameters,
+      const CombinatorialKalmanFilterOptions<track_container_t>& tfOptions,
+      track_container_t& trackContainer,
+      std::span<const TrackProxy> rootBranches) const {
+    using ResultType = CombinatorialKalmanFilterResult<track_container_t>;
+
+    assert(initialParameters.size() == rootBranches.size() &&
+           "Need one root branch per seed");
+
+    PropagatorOptions propOptions = makePropagatorOptions(tfOptions);
+    const Actor& actor = propOptions.actorList.template get<Actor>();
+
+    const auto& stepper = m_propagator.stepper();
+    const auto& navigator = m_propagator.navigator();
+
+    using PropagatorState =
+        decltype(m_propagator.template makeState<PropagatorOptions,
+                                                 StubPathLimitReached>(
+            propOptions));
+
+    // A lane is the propagation of exactly one active branch
+    struct Lane {
+      PropagatorState state;
+      std::size_t seed;
+    };
+
+    const std::size_t nSeeds = initialParameters.size();
+    std::vector<std::vector<TrackProxy>> collectedTracks(nSeeds);
+    std::vector<std::error_code> errors(nSeeds);
+
+    auto collect = [&](Lane& lane) {
+      auto& r = lane.state.template get<ResultType>();
+      auto& tracks = collectedTracks[lane.seed];
+      tracks.insert(tracks.end(), r.collectedTracks.begin(),
+                    r.collectedTracks.end());
+      r.collectedTracks.clear();
+    };
+
+    // All branches of a seed draw from one step budget, as they do in the
+    // depth-first traversal where a single propagation follows them
+    std::vector<std::size_t> seedSteps(nSeeds, 0);
+
+    // Continue the propagation after the filter step performed here
+    auto resume = [&](Lane& lane) {
+      auto& state = lane.state;
+      state.template get<ResultType>().resumed = true;
+      state.position = stepper.position(state.stepping);
+      state.direction =
+          state.options.direction * stepper.direction(state.stepping);
+    };
+
+    std::vector<Lane> lanes;
+    lanes.reserve(nSeeds);
+    for (std::size_t iSeed = 0; iSeed < nSeeds; ++iSeed) {
+      auto propState =
+          m_propagator
+              .template makeState<PropagatorOptions, StubPathLimitReached>(
+                  propOptions);
+
+      auto initResult =
+          m_propagator
+              .template initialize<decltype(propState), StubPathLimitReached>(
+                  propState, initialParameters[iSeed]);
+      if (!initResult.ok()) {
+        ACTS_DEBUG("Propagation initialization failed: "
+                   << initResult.error());
+        errors[iSeed] = initResult.error();
+        continue;
+      }
+
+      auto& r = propState.template get<ResultType>();
+      r.tracks = &trackContainer;
+      r.trackStates = &trackContainer.trackStateContainer();
+
+      // make sure the right particle hypothesis is set on the root branch
+      TrackProxy rootBranch = rootBranches[iSeed];
+      rootBranch.setParticleHypothesis(
+          initialParameters[iSeed].particleHypothesis());
+
+      r.activeBranches.push_back(rootBranch);
+
+      lanes.push_back(Lane{std::move(propState), iSeed});
+    }
+
+    std::vector<Lane> nextLanes;
+    std::vector<std::size_t> suspended;
+    while (!lanes.empty()) {
+      ACTS_VERBOSE("Propagate " << lanes.size() << " branches");
+
+      // Propagate every branch to the next surface with a filter step
+      suspended.clear();
+      for (std::size_t iLane = 0; iLane < lanes.size(); ++iLane) {
+        Lane& lane = lanes[iLane];
+        if (errors[lane.seed]) {
+          continue;
+        }
+
+        auto& state = lane.state;
+        state.steps = seedSteps[lane.seed];
+        const double pathLength = state.pathLength;
+
+        auto propagationResult = m_propagator.propagate(state);
+        if (!propagationResult.ok()) {
+          ACTS_DEBUG("Propagation failed: "
+                     << propagationResult.error() << " "
+                     << propagationResult.error().message()
+                     << " with the initial parameters: \n"
+                     << initialParameters[lane.seed].parameters());
+          errors[lane.seed] = propagationResult.error();
+          continue;
+        }
+
+        // An abort leaves the stepping loop before the step which reached
+        // the surface is counted, unless the propagation stopped before
+        // stepping at all
+        seedSteps[lane.seed] =
+            state.steps + (state.pathLength != pathLength ? 1 : 0);
+
+        collect(lane);
+        const auto& r = state.template get<ResultType>();
+        if (r.suspendedSurface != nullptr) {
+          suspended.push_back(iLane);
+          continue;
+        }
+
+        // The propagation of this branch ended without a filter step. As in
+        // the depth-first traversal, this is an error unless the track
+        // finding finished properly.
+        auto result = m_propagator.makeResult(
+            std::move(state), propagationResult, propOptions, false);
+        if (!result.ok()) {
+          ACTS_DEBUG("Propagation failed: "
+                     << result.error() << " " << result.error().message()
+                     << " with the initial parameters: \n"
+                     << initialParameters[lane.seed].parameters());
+          errors[lane.seed] = result.error();
+        } else if (!result->template get<ResultType>().finished) {
+          ACTS_DEBUG("CombinatorialKalmanFilter failed: "
+                     << "Propagation reached max steps "
+                     << "with the initial parameters: "
+                     << initialParameters[lane.seed].parameters().transpose());
+          errors[lane.seed] =
+              CombinatorialKalmanFilterError::PropagationReachesMaxSteps;
+        }
+      }
+
+      // Group the branches by surface so the measurement selection and the
+      // Kalman updates on one surface are run back-to-back
+      std::ranges::stable_sort(suspended, {}, [&](std::size_t iLane) {
+        return lanes[iLane]
+            .state.template get<ResultType>()
+            .suspendedSurface->geometryId()
+            .value();
+      });
+
+      nextLanes.clear();
+      for (std::size_t iLane : suspended) {
+        Lane& lane = lanes[iLane];
+        if (errors[lane.seed]) {
+          continue;
+        }
+
+        auto& state = lane.state;
+        auto& r = state.template get<ResultType>();
+        const Surface& surface = *std::exchange(r.suspendedSurface, nullptr);
+
+        auto filterResult = actor.filter(surface, state, stepper, navigator, r);
+        if (!filterResult.ok()) {
+          ACTS_DEBUG("Error in filter: " << filterResult.error().message());
+          errors[lane.seed] = filterResult.error();
+          continue;
+        }
+
+        collect(lane);
+        if (r.finished) {
+          continue;
+        }
+
+        // The stepper follows the last branch. All other branches continue
+        // from a copy of the propagation state instead of re-initializing it.
+        const TrackProxy lastBranch = r.activeBranches.back();
+        for (std::size_t iBranch = 0; iBranch + 1 < r.activeBranches.size();
+             ++iBranch) {
+          Lane fork{state, lane.seed};
+          auto& forkState = fork.state;
+          auto& forkResult = forkState.template get<ResultType>();
+          forkResult.activeBranches.assign(1, r.activeBranches[iBranch]);
+
+          auto trackState =
+              forkResult.activeBranches.back().outermostTrackState();
+          stepper.update(forkState.stepping,
+                         MultiTrajectoryHelpers::freeFiltered(
+                             forkState.options.geoContext, trackState),
+                         trackState.filtered(),
+                         trackState.filteredCovariance(), surface);
+          detail::performMaterialInteraction(
+              forkState, stepper, surface,
+              detail::determineMaterialUpdateMode(
+                  forkState, navigator, MaterialUpdateMode::PostUpdate),
+              NoiseUpdateMode::addNoise, actor.multipleScattering,
+              actor.energyLoss, logger());
+
+          resume(fork);
+          nextLanes.push_back(std::move(fork));
+        }
+        r.activeBranches.assign(1, lastBranch);
+
+        resume(lane);
+        nextLanes.push_back(std::move(lane));
+      }
+
+      std::swap(lanes, nextLanes);
+    }
+
+    std::vector<Result<std::vector<TrackProxy>>> results;
+    results.reserve(nSeeds);
+    for (std::size_t iSeed = 0; iSeed < nSeeds; ++iSeed) {
+      if (errors[iSeed]) {
+        results.push_back(
+            Result<std::vector<TrackProxy>>::failure(errors[iSeed]));
+      } else {
+        results.push_back(std::move(collectedTracks[iSeed]));
+      }
+    }
+    return results;
+  }
+
  public:
   /// Combinatorial Kalman Filter implementation, calls the Kalman filter
   ///
@@ -820,32 +1137,14 @@ class CombinatorialKalmanFilter {
       typename track_container_t::TrackProxy rootBranch) const
       -> Result<std::vector<
           typename std::decay_t<decltype(trackContainer)>::TrackProxy>> {
-    // Create the ActorList
-    using CombinatorialKalmanFilterActor = Actor;
-    using Actors = ActorList<CombinatorialKalmanFilterActor>;
-
-    // Create relevant options for the propagation options
-    using PropagatorOptions = typename propagator_t::template Options<Actors>;
-    PropagatorOptions propOptions(tfOptions.geoContext,
-                                  tfOptions.magFieldContext);
-
-    // Set the trivial propagator options
-    propOptions.setPlainOptions(tfOptions.propagatorPlainOptions);
-
-    // Catch the actor
-    auto& combKalmanActor =
-        propOptions.actorList.template get<CombinatorialKalmanFilterActor>();
-    combKalmanActor.targetReached.surface = tfOptions.targetSurface;
-    combKalmanActor.multipleScattering = tfOptions.multipleScattering;
-    combKalmanActor.energyLoss = tfOptions.energyLoss;
-    combKalmanActor.skipPrePropagationUpdate =
-        tfOptions.skipPrePropagationUpdate;
-    combKalmanActor.actorLogger = m_actorLogger.get();
-    combKalmanActor.updaterLogger = m_updaterLogger.get();
-    combKalmanActor.calibrationContextPtr = &tfOptions.calibrationContext.get();
+    if (tfOptions.traversal ==
+        CombinatorialKalmanFilterTraversal::BreadthFirst) {
+      return std::move(findTracksBreadthFirst(
+          std::span(&initialParameters, 1), tfOptions, trackContainer,
+          std::span<const TrackProxy>(&rootBranch, 1))[0]);
+    }
 
-    // copy delegates to calibrator, updater, branch stopper
-    combKalmanActor.extensions = tfOptions.extensions;
+    PropagatorOptions propOptions = makePropagatorOptions(tfOptions);
 
     auto propState =
         m_propagator
@@ -925,6 +1224,47 @@ class CombinatorialKalmanFilter {
     auto rootBranch = trackContainer.makeTrack();
     return findTracks(initialParameters, tfOptions, trackContainer, rootBranch);
   }
+
+  /// Combinatorial Kalman Filter for several seeds at once
+  ///
+  /// With the breadth-first traversal all branches of all seeds are advanced
+  /// in lockstep from one surface to the next. The filter steps are grouped
+  /// by surface and new branches continue from a copy of the propagation
+  /// state instead of re-stepping from the reset branch point. Otherwise the
+  /// seeds are processed one after the other.
+  ///
+  /// @param initialParameters The initial track parameters, one per seed
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  ///                  finding
+  /// @param trackContainer Track container in which to store the results
+  ///
+  /// @return the track finding result for each seed
+  auto findTracks(
+      std::span<const BoundTrackParameters> initialParameters,
+      const CombinatorialKalmanFilterOptions<track_container_t>& tfOptions,
+      track_container_t& trackContainer) const
+      -> std::vector<Result<std::vector<
+          typename std::decay_t<decltype(trackContainer)>::TrackProxy>>> {
+    std::vector<TrackProxy> rootBranches;
+    rootBranches.reserve(initialParameters.size());
+    for (std::size_t i = 0; i < initialParameters.size(); ++i) {
+      rootBranches.push_back(trackContainer.makeTrack());
+    }
+
+    if (tfOptions.traversal ==
+        CombinatorialKalmanFilterTraversal::BreadthFirst) {
+      return findTracksBreadthFirst(initialParameters, tfOptions,
+                                    trackContainer, rootBranches);
+    }
+
+    std::vector<Result<std::vector<TrackProxy>>> results;
+    results.reserve(initialParameters.size());
+    for (std::size_t i = 0; i < initialParameters.size(); ++i) {
+      results.push_back(findTracks(initialParameters[i], tfOptions,
+                                   trackContainer, rootBranches[i]));
+    }
+    return results;
+  }
 };  // namespace Acts
 
 /// @}
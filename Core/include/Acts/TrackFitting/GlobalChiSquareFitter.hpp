@@ -112,6 +112,18 @@ struct Gx2FitterExtensions {
   }
 };
 
+/// Linear algebra backend used to solve the GX2F equation system
+enum class Gx2fSolver {
+  /// Accumulate and solve the full extended system as a dense matrix. The
+  /// cost grows cubically with the number of material surfaces.
+  eDense,
+  /// Exploit the sequential structure of the scattering angles. The system
+  /// is accumulated in track segments between material surfaces and solved
+  /// by eliminating one pair of scattering angles at a time. The cost grows
+  /// linearly with the number of material surfaces.
+  eStructured,
+};
+
 /// Combined options for the Global-Chi-Square fitter.
 ///
 /// @tparam traj_t The trajectory type
@@ -187,6 +199,9 @@ struct Gx2FitterOptions {
 
   /// Check for convergence (abort condition). Set to 0 to skip.
   double relChi2changeCutOff = 1e-7;
+
+  /// Linear algebra backend to solve the equation system
+  Gx2fSolver solver = Gx2fSolver::eDense;
 };
 
 /// Result container for a global chi-square fit.
@@ -288,24 +303,69 @@ struct ScatteringProperties {
   bool m_materialIsValid;
 };
 
+/// @brief Contributions to the gx2f system from one track segment
+///
+/// Used by the structured solver. A segment starts at the start of the track
+/// or at a material surface and ends at the next material surface. Its
+/// measurement contributions are expressed in the bound parameters at the
+/// start of the segment. They are kept in square-root information form, i.e.
+/// as an upper triangular matrix R and a vector z with the aMatrix
+/// contribution R^T * R and the bVector contribution R^T * z. This avoids
+/// the loss of precision when eliminating the scattering angles.
+struct Gx2fSegment {
+  /// Transport Jacobian from the start of the previous segment to the start
+  /// of this segment. Unused for the first segment.
+  BoundMatrix transport = BoundMatrix::Identity();
+
+  /// Square root of the measurement contributions to the matrix of the
+  /// segment parameters
+  BoundMatrix rMatrix = BoundMatrix::Zero();
+
+  /// Measurement contributions to the vector of the segment parameters,
+  /// transformed with the inverse transpose of rMatrix
+  BoundVector zVector = BoundVector::Zero();
+
+  /// Material contributions to the matrix of the scattering angles at the
+  /// start of the segment. Unused for the first segment.
+  SquareMatrix<2> scatteringAMatrix = SquareMatrix<2>::Zero();
+
+  /// Material contributions to the vector of the scattering angles at the
+  /// start of the segment. Unused for the first segment.
+  Vector2 scatteringBVector = Vector2::Zero();
+};
+
 /// @brief A container to manage all properties of a gx2f system
 ///
-/// This struct manages the mathematical infrastructure for the gx2f. It
-/// initializes and maintains the extended aMatrix and extended bVector.
+/// This struct manages the mathematical infrastructure for the gx2f. With
+/// the dense solver, it initializes and maintains the extended aMatrix and
+/// extended bVector. With the structured solver, it maintains one
+/// @ref Gx2fSegment per material surface instead.
 struct Gx2fSystem {
  public:
   /// @brief Constructor to initialize matrices and vectors to zero based on specified dimensions.
   ///
   /// @param nDims Number of dimensions for the extended matrix and vector.
-  explicit Gx2fSystem(std::size_t nDims)
-      : m_nDims{nDims},
-        m_aMatrix{Eigen::MatrixXd::Zero(nDims, nDims)},
-        m_bVector{Eigen::VectorXd::Zero(nDims)} {}
+  /// @param solver Linear algebra backend used to solve the system
+  explicit Gx2fSystem(std::size_t nDims,
+                      Gx2fSolver solver = Gx2fSolver::eDense)
+      : m_nDims{nDims}, m_solver{solver} {
+    if (m_solver == Gx2fSolver::eDense) {
+      m_aMatrix = Eigen::MatrixXd::Zero(nDims, nDims);
+      m_bVector = Eigen::VectorXd::Zero(nDims);
+    } else {
+      m_segments.reserve((nDims - eBoundSize) / 2 + 1);
+      m_segments.emplace_back();
+    }
+  }
 
   /// @brief Accessor for the number of dimensions of the extended system
   /// @return Number of dimensions for the aMatrix and bVector (bound parameters + scattering angles)
   std::size_t nDims() const { return m_nDims; }
 
+  /// @brief Accessor for the linear algebra backend
+  /// @return The solver used for this system
+  Gx2fSolver solver() const { return m_solver; }
+
   /// @brief Accessor for the accumulated chi-squared value (const version)
   /// @return Current sum of chi-squared contributions from measurements and material
   double chi2() const { return m_chi2; }
@@ -315,6 +375,7 @@ struct Gx2fSystem {
   double& chi2() { return m_chi2; }
 
   /// @brief Accessor for the extended system matrix (const version)
+  /// @note Only filled with the dense solver
   /// @return Const reference to the aMatrix containing measurement and material contributions
   const Eigen::MatrixXd& aMatrix() const { return m_aMatrix; }
 
@@ -323,6 +384,7 @@ struct Gx2fSystem {
   Eigen::MatrixXd& aMatrix() { return m_aMatrix; }
 
   /// @brief Accessor for the extended system vector (const version)
+  /// @note Only filled with the dense solver
   /// @return Const reference to the bVector containing measurement and material contributions
   const Eigen::VectorXd& bVector() const { return m_bVector; }
 
@@ -330,6 +392,16 @@ struct Gx2fSystem {
   /// @return Mutable reference to the bVector for adding measurement and material contributions
   Eigen::VectorXd& bVector() { return m_bVector; }
 
+  /// @brief Accessor for the track segments (const version)
+  /// @note Only filled with the structured solver
+  /// @return Const reference to the segments, one more than material surfaces
+  const std::vector<Gx2fSegment>& segments() const { return m_segments; }
+
+  /// @brief Accessor for the track segments (mutable version)
+  /// @note Only filled with the structured solver
+  /// @return Mutable reference to the segments
+  std::vector<Gx2fSegment>& segments() { return m_segments; }
+
   /// @brief Accessor for the number of degrees of freedom (const version)
   /// @return Current number of degrees of freedom from processed measurements
   std::size_t ndf() const { return m_ndf; }
@@ -348,10 +420,11 @@ struct Gx2fSystem {
   ///
   /// @return Required NDF based on which parameters can be fitted
   std::size_t findRequiredNdf() {
+    const BoundVector diagonal = trackParametersDiagonal();
     std::size_t ndfSystem = 0;
-    if (m_aMatrix(4, 4) == 0) {
+    if (diagonal[4] == 0) {
       ndfSystem = 4;
-    } else if (m_aMatrix(5, 5) == 0) {
+    } else if (diagonal[5] == 0) {
       ndfSystem = 5;
     } else {
       ndfSystem = 6;
@@ -364,10 +437,17 @@ struct Gx2fSystem {
   /// @return True if NDF exceeds the minimum required for the parameter configuration
   bool isWellDefined() { return m_ndf > findRequiredNdf(); }
 
+  /// @brief Diagonal of the track parameter block of the extended matrix
+  /// @return Diagonal entries of aMatrix belonging to the bound parameters
+  BoundVector trackParametersDiagonal() const;
+
  private:
   /// Number of dimensions of the (extended) system
   std::size_t m_nDims;
 
+  /// Linear algebra backend
+  Gx2fSolver m_solver;
+
   /// Sum of chi-squared values.
   double m_chi2 = 0.;
 
@@ -377,6 +457,9 @@ struct Gx2fSystem {
   /// Extended vector for accumulation.
   Eigen::VectorXd m_bVector;
 
+  /// Track segments for accumulation with the structured solver
+  std::vector<Gx2fSegment> m_segments;
+
   /// Number of degrees of freedom of the system
   std::size_t m_ndf = 0u;
 };
@@ -476,18 +559,36 @@ void addMaterialToGx2fSums(
 
   const double invCov = scatteringMapId->second.invCovarianceMaterial();
 
+  // With the structured solver, the scattering angles belong to the segment
+  // starting at this material surface
+  const bool structured = extendedSystem.solver() == Gx2fSolver::eStructured;
+  assert((!structured ||
+          extendedSystem.segments().size() == nMaterialsHandled + 2) &&
+         "No segment started at material surface.");
+
   // Phi contribution
-  extendedSystem.aMatrix()(deltaPosition, deltaPosition) +=
-      invCov * sinThetaLoc * sinThetaLoc;
-  extendedSystem.bVector()(deltaPosition, 0) -=
-      invCov * scatteringAngles[eBoundPhi] * sinThetaLoc;
+  const double aPhi = invCov * sinThetaLoc * sinThetaLoc;
+  const double bPhi = -invCov * scatteringAngles[eBoundPhi] * sinThetaLoc;
+  if (structured) {
+    extendedSystem.segments().back().scatteringAMatrix(0, 0) += aPhi;
+    extendedSystem.segments().back().scatteringBVector[0] += bPhi;
+  } else {
+    extendedSystem.aMatrix()(deltaPosition, deltaPosition) += aPhi;
+    extendedSystem.bVector()(deltaPosition, 0) += bPhi;
+  }
   extendedSystem.chi2() += invCov * scatteringAngles[eBoundPhi] * sinThetaLoc *
                            scatteringAngles[eBoundPhi] * sinThetaLoc;
 
   // Theta Contribution
-  extendedSystem.aMatrix()(deltaPosition + 1, deltaPosition + 1) += invCov;
-  extendedSystem.bVector()(deltaPosition + 1, 0) -=
-      invCov * scatteringAngles[eBoundTheta];
+  const double aTheta = invCov;
+  const double bTheta = -invCov * scatteringAngles[eBoundTheta];
+  if (structured) {
+    extendedSystem.segments().back().scatteringAMatrix(1, 1) += aTheta;
+    extendedSystem.segments().back().scatteringBVector[1] += bTheta;
+  } else {
+    extendedSystem.aMatrix()(deltaPosition + 1, deltaPosition + 1) += aTheta;
+    extendedSystem.bVector()(deltaPosition + 1, 0) += bTheta;
+  }
   extendedSystem.chi2() +=
       invCov * scatteringAngles[eBoundTheta] * scatteringAngles[eBoundTheta];
 
@@ -570,9 +671,15 @@ void fillGx2fSystem(
       continue;
     }
 
-    // update all Jacobians from start
-    for (auto& jac : jacobianFromStart) {
-      jac = trackState.jacobian() * jac;
+    // update all Jacobians from start. The structured solver only needs the
+    // Jacobian from the start of the current segment.
+    if (extendedSystem.solver() == Gx2fSolver::eStructured) {
+      jacobianFromStart.back() =
+          trackState.jacobian() * jacobianFromStart.back();
+    } else {
+      for (auto& jac : jacobianFromStart) {
+        jac = trackState.jacobian() * jac;
+      }
     }
 
     // Handle measurement
@@ -599,6 +706,13 @@ void fillGx2fSystem(
     // Handle material
     if (doMaterial) {
       ACTS_DEBUG("    Handle material");
+      // Start a new segment at this surface. Its transport is the Jacobian
+      // from the start of the previous segment.
+      if (extendedSystem.solver() == Gx2fSolver::eStructured) {
+        extendedSystem.segments().emplace_back().transport =
+            jacobianFromStart.back();
+      }
+
       // Add for this material a new Jacobian, starting from this surface.
       jacobianFromStart.emplace_back(BoundMatrix::Identity());
 
@@ -660,8 +774,11 @@ std::size_t countMaterialStates(
 /// @brief Solve the gx2f system to get the delta parameters for the update
 ///
 /// This function computes the delta parameters for the GX2F Actor fitting
-/// process by solving the linear equation system [a] * delta = b. It uses the
-/// column-pivoting Householder QR decomposition for numerical stability.
+/// process by solving the linear equation system [a] * delta = b. The dense
+/// solver uses the column-pivoting Householder QR decomposition for numerical
+/// stability. The structured solver eliminates the scattering angles segment
+/// by segment from the back of the track, which gives the same solution in
+/// linear time.
 ///
 /// @param extendedSystem All parameters of the current equation system
 /// @return Delta parameters for the GX2F update
@@ -1335,7 +1452,7 @@ class Gx2Fitter {
 
       // System that we fill with the information gathered by the actor and
       // evaluate later
-      Gx2fSystem extendedSystem{dimsExtendedParams};
+      Gx2fSystem extendedSystem{dimsExtendedParams, gx2fOptions.solver};
 
       // This vector stores the IDs for each visited material in order. We use
       // it later for updating the scattering angles. We cannot use
@@ -1501,7 +1618,7 @@ class Gx2Fitter {
 
       // System that we fill with the information gathered by the actor and
       // evaluate later
-      Gx2fSystem extendedSystem{dimsExtendedParams};
+      Gx2fSystem extendedSystem{dimsExtendedParams, gx2fOptions.solver};
 
       // This vector stores the IDs for each visited material in order. We use
       // it later for updating the scattering angles. We cannot use
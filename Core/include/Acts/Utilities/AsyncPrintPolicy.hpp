@@ -0,0 +1,193 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+
+namespace Logging {
+
+/// @addtogroup logging
+/// @{
+
+/// @brief Background sink for asynchronous debug output
+///
+/// Every thread that logs into the sink gets its own single-producer
+/// single-consumer ring buffer of preformatted records. Logging a message only
+/// copies it into a free slot of this buffer. A background thread drains all
+/// buffers and writes the records to the output stream in the order in which
+/// they were logged, so that the logging threads never contend on the stream.
+class AsyncLogSink {
+ public:
+  /// What to do with a message if the buffer of the logging thread is full
+  enum class OverflowPolicy {
+    /// Discard the message and count it as dropped
+    Drop,
+    /// Wait until the background thread has made space in the buffer
+    Block,
+  };
+
+  /// Configuration of the sink
+  struct Config {
+    /// Destination stream, it has to outlive the sink
+    std::ostream* out = &std::cout;
+    /// Number of records buffered per thread, rounded up to a power of two
+    std::size_t bufferSize = 1024;
+    /// Behaviour if a buffer is full
+    OverflowPolicy overflowPolicy = OverflowPolicy::Block;
+    /// Time the background thread sleeps when all buffers are empty
+    std::chrono::microseconds idleInterval{500};
+  };
+
+  /// @brief constructor, starts the background thread
+  ///
+  /// @param [in] cfg configuration of the sink
+  explicit AsyncLogSink(const Config& cfg);
+
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+  /// @brief destructor, writes all pending records and stops the background
+  /// thread
+  ///
+  /// @pre No other thread is logging into this sink anymore.
+  ~AsyncLogSink();
+
+  /// @brief queue a preformatted record from the calling thread
+  ///
+  /// @param [in] input text of the message
+  ///
+  /// @return @c false if the message was dropped, otherwise @c true
+  bool push(const std::string& input);
+
+  /// @brief wait until all records queued so far have been written and the
+  /// output stream has been flushed
+  void flush();
+
+  /// Get the number of messages dropped because a buffer was full
+  /// @return the number of dropped messages
+  std::size_t droppedMessages() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /// Get the configuration of the sink
+  /// @return the configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  struct Buffer;
+
+  /// Find or register the buffer of the calling thread
+  Buffer& localBuffer();
+
+  /// Body of the background thread
+  void run();
+
+  /// configuration of the sink
+  Config m_cfg;
+
+  /// unique identifier of this sink for the thread-local buffer lookup
+  std::uint64_t m_id;
+
+  /// guards the registration of new buffers only
+  std::mutex m_buffersMutex;
+  /// buffers of all threads which logged into this sink
+  std::vector<std::shared_ptr<Buffer>> m_buffers;
+  /// number of registered buffers, checked by the background thread
+  std::atomic<std::size_t> m_nBuffers{0};
+
+  /// sequence number of the next queued record
+  std::atomic<std::uint64_t> m_queued{0};
+  /// number of records which have been written and flushed
+  std::atomic<std::uint64_t> m_flushed{0};
+  /// request to flush the output stream as soon as possible
+  std::atomic<bool> m_flushRequested{false};
+  /// number of dropped messages
+  std::atomic<std::size_t> m_dropped{0};
+
+  /// request to stop the background thread once all records are written
+  std::atomic<bool> m_stop{false};
+  /// the background thread
+  std::thread m_thread;
+};
+
+/// @brief asynchronous print policy for debug messages
+///
+/// The debug messages are handed over to an @c AsyncLogSink, which writes
+/// them from a background thread. All clones of the policy share the sink.
+class AsyncPrintPolicy final : public OutputPrintPolicy {
+ public:
+  /// @brief constructor
+  ///
+  /// @param [in] sink the sink writing the debug messages
+  explicit AsyncPrintPolicy(std::shared_ptr<AsyncLogSink> sink);
+
+  /// @brief queue the debug message for the background sink
+  ///
+  /// @param [in] lvl   debug level of debug message
+  /// @param [in] input text of debug message
+  ///
+  /// @note Messages exceeding the failure threshold are written out before
+  ///       the exception is thrown.
+  void flush(const Level& lvl, const std::string& input) final;
+
+  /// Fulfill @c OutputPrintPolicy interface. Like the default print policy,
+  /// this policy doesn't have a name.
+  /// @note This method will throw an exception
+  /// @return the name, but it never returns
+  const std::string& name() const override;
+
+  /// Make a copy of this print policy with a new name
+  /// @return the copy, which writes into the same sink
+  std::unique_ptr<OutputPrintPolicy> clone(
+      const std::string& /*name*/) const override {
+    return std::make_unique<AsyncPrintPolicy>(m_sink);
+  }
+
+  /// Get the sink of this print policy
+  /// @return the sink
+  AsyncLogSink& sink() const { return *m_sink; }
+
+ private:
+  /// the sink writing the debug messages
+  std::shared_ptr<AsyncLogSink> m_sink;
+};
+
+/// @}
+
+}  // namespace Logging
+
+/// @brief get an asynchronous debug output logger
+///
+/// @param [in] name name of the logger instance
+/// @param [in] lvl  debug threshold level
+/// @param [in] sink background sink used for writing the debug messages
+///
+/// The logger has the same decorations as the one returned by
+/// @c getDefaultLogger. The decorations are applied on the logging thread, so
+/// the time stamps refer to the time of logging.
+///
+/// @return pointer to logging instance
+std::unique_ptr<const Logger> getAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::shared_ptr<Logging::AsyncLogSink> sink);
+
+}  // namespace Acts
@@ -165,39 +165,39 @@ class Grid final : public IGrid {
   ///
   /// @param axes
   explicit Grid(const std::tuple<Axes...>& axes) : m_axes(axes) {
-    m_values.resize(size());
+    initialize();
   }
 
   /// @brief Move constructor from axis tuple
   /// @param axes
   explicit Grid(std::tuple<Axes...>&& axes) : m_axes(std::move(axes)) {
-    m_values.resize(size());
+    initialize();
   }
 
   /// @brief constructor from parameters pack of axes
   /// @param axes
   explicit Grid(Axes&&... axes) : m_axes(std::forward_as_tuple(axes...)) {
-    m_values.resize(size());
+    initialize();
   }
 
   /// @brief constructor from parameters pack of axes
   /// @param axes
   explicit Grid(const Axes&... axes) : m_axes(std::tuple(axes...)) {
-    m_values.resize(size());
+    initialize();
   }
 
   /// @brief constructor from parameters pack of axes and type tag
   /// @param axes
   explicit Grid(TypeTag<T> /*tag*/, Axes&&... axes)
       : m_axes(std::forward_as_tuple(axes...)) {
-    m_values.resize(size());
+    initialize();
   }
 
   /// @brief constructor from parameters pack of axes and type tag
   /// @param axes
   explicit Grid(TypeTag<T> /*tag*/, const Axes&... axes)
       : m_axes(std::tuple(axes...)) {
-    m_values.resize(size());
+    initialize();
   }
 
   // Grid(TypeTag<T> /*tag*/, Axes&... axes) = delete;
@@ -218,7 +218,7 @@ class Grid final : public IGrid {
   //
   template <class Point>
   reference atPosition(const Point& point) {
-    return m_values.at(globalBinFromPosition(point));
+    return m_values[globalBinFromPosition(point)];
   }
 
   /// @brief access value stored in bin for a given point
@@ -237,7 +237,7 @@ class Grid final : public IGrid {
   ///       Therefore, the look-up will never fail.
   template <class Point>
   const_reference atPosition(const Point& point) const {
-    return m_values.at(globalBinFromPosition(point));
+    return m_values[globalBinFromPosition(point)];
   }
 
   /// @brief access value stored in bin with given global bin number
@@ -254,6 +254,24 @@ class Grid final : public IGrid {
   ///         point
   const_reference at(std::size_t bin) const { return m_values.at(bin); }
 
+  /// @brief access value stored in bin with given global bin number without
+  ///        bounds check
+  ///
+  /// @param  [in] bin global bin number
+  /// @return reference to value stored in bin
+  ///
+  /// @pre @c bin must be smaller than the total number of bins.
+  reference atUnchecked(std::size_t bin) { return m_values[bin]; }
+
+  /// @brief access value stored in bin with given global bin number without
+  ///        bounds check
+  ///
+  /// @param  [in] bin global bin number
+  /// @return const-reference to value stored in bin
+  ///
+  /// @pre @c bin must be smaller than the total number of bins.
+  const_reference atUnchecked(std::size_t bin) const { return m_values[bin]; }
+
   /// @brief access value stored in bin with given local bin numbers
   ///
   /// @param  [in] localBins local bin indices along each axis
@@ -288,6 +306,18 @@ class Grid final : public IGrid {
     return &atLocalBins(toIndexType(indices));
   }
 
+  /// @brief access value stored in bin with given local bin numbers without
+  ///        bounds check
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return const-reference to value stored in bin
+  ///
+  /// @pre All local bin indices must be a valid index for the corresponding
+  ///      axis (including the under-/overflow bin for this axis).
+  const_reference atLocalBinsUnchecked(const index_t& localBins) const {
+    return m_values[globalBinFromLocalBins(localBins)];
+  }
+
   /// @brief get global bin indices for closest points on grid
   ///
   /// @tparam Point any type with point semantics supporting component access
@@ -352,7 +382,11 @@ class Grid final : public IGrid {
   /// @pre All local bin indices must be a valid index for the corresponding
   ///      axis (including the under-/overflow bin for this axis).
   std::size_t globalBinFromLocalBins(const index_t& localBins) const {
-    return detail::grid_helper::getGlobalBin(localBins, m_axes);
+    std::size_t bin = 0;
+    for (std::size_t i = 0; i < DIM; ++i) {
+      bin += localBins[i] * m_strides[i];
+    }
+    return bin;
   }
 
   /// @brief  determine global bin index of the bin with the lower left edge
@@ -527,25 +561,41 @@ class Grid final : public IGrid {
     // there are 2^DIM corner points used during the interpolation
     constexpr std::size_t nCorners = 1 << DIM;
 
-    // construct vector of pairs of adjacent bin centers and values
-    std::array<value_type, nCorners> neighbors{};
-
-    // get local indices for current bin
-    // value of bin is interpreted as being the field value at its lower left
-    // corner
-    const auto& llIndices = localBinsFromPosition(point);
-
-    // get global indices for all surrounding corner points
-    const auto& closestIndices = rawClosestPointsIndices(llIndices);
-
-    // get values on grid points
-    std::size_t i = 0;
-    for (std::size_t index : closestIndices) {
-      neighbors.at(i++) = at(index);
+    // The value of a bin is interpreted as the field value at its lower left
+    // corner, the upper corner along each axis is the next bin (wrapped for
+    // closed axes). The global bin offsets of both are taken from the
+    // precomputed strides, so that no neighborhood has to be constructed.
+    point_t lowerLeft{};
+    point_t upperRight{};
+    index_t lowerOffset{};
+    index_t upperOffset{};
+    auto fillAxis = [&]<std::size_t index>(
+                        std::integral_constant<std::size_t, index>) {
+      const auto& axis = std::get<index>(m_axes);
+      const std::size_t bin = axis.getBin(point[index]);
+      const std::size_t upperBin = axis.wrapBin(static_cast<int>(bin) + 1);
+      lowerLeft[index] = axis.getBinLowerBound(bin);
+      upperRight[index] = axis.getBinUpperBound(bin);
+      lowerOffset[index] = bin * m_strides[index];
+      upperOffset[index] = upperBin * m_strides[index];
+    };
+    [&]<std::size_t... Is>(std::index_sequence<Is...> /*s*/) {
+      (fillAxis(std::integral_constant<std::size_t, Is>()), ...);
+    }(std::make_index_sequence<DIM>());
+
+    // gather the corner values in the canonical order of Acts::interpolate,
+    // where the first axis corresponds to the most significant bit
+    std::array<value_type, nCorners> neighbors;
+    for (std::size_t corner = 0; corner < nCorners; ++corner) {
+      std::size_t bin = 0;
+      for (std::size_t i = 0; i < DIM; ++i) {
+        const bool upper = ((corner >> (DIM - 1 - i)) & 1u) != 0;
+        bin += upper ? upperOffset[i] : lowerOffset[i];
+      }
+      neighbors[corner] = m_values[bin];
     }
 
-    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
-                             upperRightBinEdge(llIndices), neighbors);
+    return Acts::interpolate(point, lowerLeft, upperRight, neighbors);
   }
 
   /// @brief check whether given point is inside grid limits
@@ -721,6 +771,20 @@ class Grid final : public IGrid {
   std::tuple<Axes...> m_axes;
   /// linear value store for each bin
   std::vector<T> m_values;
+  /// global bin offset between adjacent local bins along each axis
+  index_t m_strides{};
+
+  /// allocate the value store and compute the strides of the local bins
+  void initialize() {
+    m_values.resize(size());
+    // the last axis is contiguous, under-/overflow bins count along all axes
+    std::size_t stride = 1;
+    index_t nBins = numLocalBins();
+    for (std::size_t i = DIM; i-- > 0;) {
+      m_strides[i] = stride;
+      stride *= nBins[i] + 2;
+    }
+  }
 
   // Part of closestPointsIndices that goes after local bins resolution.
   // Used as an interpolation performance optimization, but not exposed as it
@@ -12,11 +12,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <functional>
-#include <memory>
+#include <limits>
+#include <span>
+#include <utility>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Acts {
 /// @brief A general k-d tree with fast range search.
 ///
@@ -29,8 +35,12 @@ namespace Acts {
 /// orthogonal hyperplane in one of the k dimensions. This allows us to
 /// efficiently look up points within certain k-dimensional ranges.
 ///
-/// This particular class is mostly a wrapper class around an underlying node
-/// class which does all the actual work.
+/// The nodes are stored in a flat array, the children of a node are adjacent
+/// and all searches traverse the tree without recursion. Up to `LeafSize`
+/// elements are bucketed in a leaf. The coordinates are additionally stored
+/// as a structure of arrays in element order, such that a leaf is filtered
+/// one dimension at a time over contiguous memory, which the compiler can
+/// vectorize. Larger leaf sizes trade tree depth for wider leaf scans.
 ///
 /// @note This type is completely immutable after construction.
 ///
@@ -75,7 +85,7 @@ class KDTree {
   ///
   /// @param d The vector of position-value pairs to construct the k-d tree
   /// from.
-  explicit KDTree(vector_t &&d) : m_elems(d) {
+  explicit KDTree(vector_t &&d) : m_elems(std::move(d)) {
     // To start out, we need to check whether we need to construct a leaf node
     // or an internal node. We create a leaf only if we have at most as many
     // elements as the number of elements that can fit into a leaf node.
@@ -83,14 +93,38 @@ class KDTree {
     // elements!
     //
     // One interesting thing to note is that all of the nodes in the k-d tree
-    // have a range in the element vector of the outermost node. They simply
-    // make in-place changes to this array, and they hold no memory of their
-    // own.
-    m_root = std::make_unique<KDTreeNode>(m_elems.begin(), m_elems.end(),
-                                          m_elems.size() > LeafSize
-                                              ? KDTreeNode::NodeType::Internal
-                                              : KDTreeNode::NodeType::Leaf,
-                                          0UL);
+    // have a range in the element vector of the tree. They simply make
+    // in-place changes to this array, and they hold no memory of their own.
+    m_nodes.push_back(KDTreeNode{boundingBox(0, m_elems.size()), 0,
+                                 m_elems.size(), 0});
+
+    // The nodes are split depth-first with an explicit list of the nodes that
+    // still have to be processed, together with their pivot dimension and
+    // their depth in the tree.
+    std::vector<std::array<std::size_t, 3>> todo = {{0, 0, 0}};
+
+    while (!todo.empty()) {
+      auto [node, dim, depth] = todo.back();
+      todo.pop_back();
+
+      m_depth = std::max(m_depth, depth);
+
+      if (m_nodes[node].size() > LeafSize) {
+        split(node, dim);
+        std::size_t next = (dim + 1) % Dims;
+        todo.push_back({m_nodes[node].lhs + 1, next, depth + 1});
+        todo.push_back({m_nodes[node].lhs, next, depth + 1});
+      }
+    }
+
+    // Finally, copy the coordinates into one contiguous array per dimension
+    // for the leaf scans.
+    for (std::size_t j = 0; j < Dims; ++j) {
+      m_coords[j].resize(m_elems.size());
+      for (std::size_t i = 0; i < m_elems.size(); ++i) {
+        m_coords[j][i] = m_elems[i].first[j];
+      }
+    }
   }
 
   /// @brief Perform an orthogonal range search within the k-d tree.
@@ -252,15 +286,265 @@ class KDTree {
   /// @param f The mapping function to apply to key-value pairs.
   template <typename Callable>
   void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-    m_root->rangeSearchMapDiscard(r, std::forward<Callable>(f));
+    // The search always descends into the left-hand child first, the
+    // right-hand siblings that still have to be visited are kept on a stack
+    // which can never grow deeper than the tree itself.
+    NodeStack stack(m_depth, boost::container::default_init);
+    std::size_t top = 0;
+    std::size_t current = 0;
+
+    while (true) {
+      const KDTreeNode &node = m_nodes[current];
+
+      // Determine whether the range completely covers the bounding box of
+      // this node. If that is the case, we know for certain that any value
+      // contained below this node should end up in the output, and we can
+      // stop looking for them.
+      if (r >= node.range) {
+        for (std::size_t i = node.begin; i != node.end; ++i) {
+          f(m_elems[i].first, m_elems[i].second);
+        }
+      } else if (node.isLeaf()) {
+        filterLeaf(r, node, f);
+      } else {
+        // Only descend into the children whose bounding box overlaps with
+        // the target range.
+        bool lhs = m_nodes[node.lhs].range && r;
+        bool rhs = m_nodes[node.lhs + 1].range && r;
+        if (lhs) {
+          if (rhs) {
+            stack[top++] = node.lhs + 1;
+          }
+          current = node.lhs;
+          continue;
+        } else if (rhs) {
+          current = node.lhs + 1;
+          continue;
+        }
+      }
+
+      if (top == 0) {
+        break;
+      }
+      current = stack[--top];
+    }
   }
 
-  /// @brief Return the number of elements in the k-d tree.
+  /// @brief Perform many orthogonal range searches within the k-d tree in a
+  /// single traversal.
+  ///
+  /// The tree is traversed once for all ranges, every node is only visited
+  /// for the ranges that overlap with it. For each range, the elements are
+  /// reported in the same order as by the single range search.
+  ///
+  /// @param ranges The ranges to search for.
+  ///
+  /// @return The vector of values that lie within each of the ranges.
+  std::vector<std::vector<Type>> rangeSearchBatch(
+      std::span<const range_t> ranges) const {
+    std::vector<std::vector<Type>> out(ranges.size());
+
+    rangeSearchMapDiscardBatch(
+        ranges, [&out](std::size_t q, const coordinate_t &, const Type &v) {
+          out[q].push_back(v);
+        });
+
+    return out;
+  }
+
+  /// @brief Perform many orthogonal range searches within the k-d tree in a
+  /// single traversal, applying a void-returning function with side-effects
+  /// to each match.
+  ///
+  /// @param ranges The ranges to search for.
+  /// @param f The function to apply, it is called with the index of the
+  /// range as well as the key and value of the matching element.
+  template <typename Callable>
+  void rangeSearchMapDiscardBatch(std::span<const range_t> ranges,
+                                  Callable &&f) const {
+    // The ranges which are still active below a node are stored in one
+    // scratch buffer. Each stack entry refers to a section of it, sections of
+    // nodes deeper in the stack are always further down in the buffer.
+    struct Entry {
+      std::size_t node;
+      std::size_t begin;
+      std::size_t end;
+    };
+
+    std::vector<std::size_t> active(ranges.size());
+    for (std::size_t q = 0; q < ranges.size(); ++q) {
+      active[q] = q;
+    }
+
+    boost::container::small_vector<Entry, 64> stack = {
+        {0, 0, ranges.size()}};
+
+    while (!stack.empty()) {
+      Entry entry = stack.back();
+      stack.pop_back();
+      // Everything above this section belongs to nodes already processed
+      active.resize(entry.end);
+
+      const KDTreeNode &node = m_nodes[entry.node];
+      std::size_t partial = active.size();
+
+      for (std::size_t a = entry.begin; a != entry.end; ++a) {
+        std::size_t q = active[a];
+        auto report = [&f, q](const coordinate_t &c, const Type &v) {
+          f(q, c, v);
+        };
+
+        if (ranges[q] >= node.range) {
+          for (std::size_t i = node.begin; i != node.end; ++i) {
+            report(m_elems[i].first, m_elems[i].second);
+          }
+        } else if (node.isLeaf()) {
+          filterLeaf(ranges[q], node, report);
+        } else {
+          active.push_back(q);
+        }
+      }
+
+      if (partial == active.size()) {
+        continue;
+      }
+
+      // Split the partially overlapping ranges over the children, the
+      // right-hand section goes first so that it stays valid while the
+      // left-hand child is processed.
+      std::size_t rhsBegin = active.size();
+      for (std::size_t a = partial; a != rhsBegin; ++a) {
+        if (m_nodes[node.lhs + 1].range && ranges[active[a]]) {
+          active.push_back(active[a]);
+        }
+      }
+      std::size_t lhsBegin = active.size();
+      for (std::size_t a = partial; a != rhsBegin; ++a) {
+        if (m_nodes[node.lhs].range && ranges[active[a]]) {
+          active.push_back(active[a]);
+        }
+      }
+
+      if (rhsBegin != lhsBegin) {
+        stack.push_back({node.lhs + 1, rhsBegin, lhsBegin});
+      }
+      if (lhsBegin != active.size()) {
+        stack.push_back({node.lhs, lhsBegin, active.size()});
+      }
+    }
+  }
+
+  /// @brief Find the k elements closest to a point.
+  ///
+  /// The elements are reported in order of increasing euclidean distance,
+  /// elements at the same distance in the order in which they are stored in
+  /// the tree.
+  ///
+  /// @tparam Point The type of the point, it needs to be indexable.
+  ///
+  /// @param p The point to search around.
+  /// @param k The number of neighbours to find.
+  ///
+  /// @return The vector of at most k key-value pairs closest to the point.
+  template <typename Point>
+  std::vector<pair_t> knnSearch(const Point &p, std::size_t k) const {
+    std::vector<pair_t> out;
+
+    knnSearchMapDiscard(p, k,
+                        [&out](const coordinate_t &c, const Type &v, Scalar) {
+                          out.emplace_back(c, v);
+                        });
+
+    return out;
+  }
+
+  /// @brief Find the k elements closest to a point, applying a void-returning
+  /// function with side-effects to each of them.
   ///
-  /// We simply defer this method to the root node of the k-d tree.
+  /// @tparam Point The type of the point, it needs to be indexable.
+  ///
+  /// @param p The point to search around.
+  /// @param k The number of neighbours to find.
+  /// @param f The function to apply, it is called with the key and value of
+  /// each neighbour as well as its squared distance to the point, in order of
+  /// increasing distance.
+  template <typename Point, typename Callable>
+  void knnSearchMapDiscard(const Point &p, std::size_t k, Callable &&f) const {
+    if (k == 0 || m_elems.empty()) {
+      return;
+    }
+
+    // The best candidates found so far as a max-heap of squared distance and
+    // element index, such that the worst candidate is always at the front.
+    std::vector<std::pair<Scalar, std::size_t>> best;
+    best.reserve(k + 1);
+
+    // The nodes still to be visited, together with the squared distance
+    // between the point and their bounding box.
+    boost::container::small_vector<std::pair<std::size_t, Scalar>, 64> stack =
+        {{0, boxDistance(m_nodes[0].range, p)}};
+
+    std::array<Scalar, LeafSize> distances{};
+
+    while (!stack.empty()) {
+      auto [index, nodeDistance] = stack.back();
+      stack.pop_back();
+
+      // Nodes further away than the k-th candidate can not contribute
+      if (best.size() == k && nodeDistance > best.front().first) {
+        continue;
+      }
+
+      const KDTreeNode &node = m_nodes[index];
+
+      if (node.isLeaf()) {
+        std::size_t n = node.size();
+        distances.fill(0);
+        for (std::size_t j = 0; j < Dims; ++j) {
+          const Scalar *c = m_coords[j].data() + node.begin;
+          const Scalar pj = p[j];
+          for (std::size_t i = 0; i < n; ++i) {
+            distances[i] += (c[i] - pj) * (c[i] - pj);
+          }
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+          std::pair<Scalar, std::size_t> candidate{distances[i],
+                                                   node.begin + i};
+          if (best.size() < k) {
+            best.push_back(candidate);
+            std::push_heap(best.begin(), best.end());
+          } else if (candidate < best.front()) {
+            std::pop_heap(best.begin(), best.end());
+            best.back() = candidate;
+            std::push_heap(best.begin(), best.end());
+          }
+        }
+      } else {
+        // Visit the closer child first, it is pushed last.
+        Scalar lhsDistance = boxDistance(m_nodes[node.lhs].range, p);
+        Scalar rhsDistance = boxDistance(m_nodes[node.lhs + 1].range, p);
+        if (lhsDistance <= rhsDistance) {
+          stack.emplace_back(node.lhs + 1, rhsDistance);
+          stack.emplace_back(node.lhs, lhsDistance);
+        } else {
+          stack.emplace_back(node.lhs, lhsDistance);
+          stack.emplace_back(node.lhs + 1, rhsDistance);
+        }
+      }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+
+    for (const auto &[distance, i] : best) {
+      f(m_elems[i].first, m_elems[i].second, distance);
+    }
+  }
+
+  /// @brief Return the number of elements in the k-d tree.
   ///
   /// @return The number of elements in the k-d tree.
-  std::size_t size(void) const { return m_root->size(); }
+  std::size_t size(void) const { return m_elems.size(); }
 
   /// Get iterator to first element
   /// @return Const iterator to the beginning of the tree elements
@@ -285,7 +569,7 @@ class KDTree {
     }
   }
 
-  static range_t boundingBox(iterator_t b, iterator_t e) {
+  range_t boundingBox(std::size_t b, std::size_t e) const {
     // Firstly, we find the minimum and maximum value in each dimension to
     // construct a bounding box around this node's values.
     std::array<Scalar, Dims> min_v{}, max_v{};
@@ -295,10 +579,10 @@ class KDTree {
       max_v[i] = std::numeric_limits<Scalar>::lowest();
     }
 
-    for (iterator_t i = b; i != e; ++i) {
+    for (std::size_t i = b; i != e; ++i) {
       for (std::size_t j = 0; j < Dims; ++j) {
-        min_v[j] = std::min(min_v[j], i->first[j]);
-        max_v[j] = std::max(max_v[j], i->first[j]);
+        min_v[j] = std::min(min_v[j], m_elems[i].first[j]);
+        max_v[j] = std::max(max_v[j], m_elems[i].first[j]);
       }
     }
 
@@ -313,194 +597,164 @@ class KDTree {
     return r;
   }
 
-  /// @brief An abstract class containing common features of k-d tree node
-  /// types.
-  ///
-  /// A k-d tree consists of two different node types: leaf nodes and inner
-  /// nodes. These nodes have some common functionality, which is captured by
-  /// this common parent node type.
-  class KDTreeNode {
-   public:
-    /// @brief Enumeration type for the possible node types (internal and leaf).
-    enum class NodeType { Internal, Leaf };
-
-    /// @brief Construct the common data for all node types.
-    ///
-    /// The node types share a few concepts, like an n-dimensional range, and a
-    /// begin and end of the range of elements managed. This constructor
-    /// calculates these things so that the individual child constructors don't
-    /// have to.
-    KDTreeNode(iterator_t _b, iterator_t _e, NodeType _t, std::size_t _d)
-        : m_type(_t),
-          m_begin_it(_b),
-          m_end_it(_e),
-          m_range(boundingBox(m_begin_it, m_end_it)) {
-      if (m_type == NodeType::Internal) {
-        // This constant determines the maximum number of elements where we
-        // still
-        // calculate the exact median of the values for the purposes of
-        // splitting. In general, the closer the pivot value is to the true
-        // median, the more balanced the tree will be. However, calculating the
-        // median exactly is an O(n log n) operation, while approximating it is
-        // an O(1) time.
-        constexpr std::size_t max_exact_median = 128;
-
-        iterator_t pivot;
-
-        // Next, we need to determine the pivot point of this node, that is to
-        // say the point in the selected pivot dimension along which point we
-        // will split the range. To do this, we check how large the set of
-        // elements is. If it is sufficiently small, we use the median.
-        // Otherwise we use the mean.
-        if (size() > max_exact_median) {
-          // In this case, we have a lot of elements, and sorting the range to
-          // find the true median might be too expensive. Therefore, we will
-          // just use the middle value between the minimum and maximum. This is
-          // not nearly as accurate as using the median, but it's a nice cheat.
-          Scalar mid = static_cast<Scalar>(0.5) *
-                       (m_range[_d].max() + m_range[_d].min());
-
-          pivot = std::partition(m_begin_it, m_end_it, [=](const pair_t &i) {
-            return i.first[_d] < mid;
-          });
-        } else {
-          // If the number of elements is fairly small, we will just calculate
-          // the median exactly. We do this by finding the values in the
-          // dimension, sorting it, and then taking the middle one.
-          std::sort(m_begin_it, m_end_it,
-                    [_d](const typename iterator_t::value_type &a,
-                         const typename iterator_t::value_type &b) {
-                      return a.first[_d] < b.first[_d];
-                    });
-
-          pivot = m_begin_it + (std::distance(m_begin_it, m_end_it) / 2);
-        }
-
-        // This should never really happen, but in very select cases where there
-        // are a lot of equal values in the range, the pivot can end up all the
-        // way at the end of the array and we end up in an infinite loop. We
-        // check for pivot points which would not split the range, and fix them
-        // if they occur.
-        if (pivot == m_begin_it || pivot == std::prev(m_end_it)) {
-          pivot = std::next(m_begin_it, LeafSize);
-        }
+  /// @brief Calculate the squared distance between a point and a bounding
+  /// box, which is zero for points inside of it.
+  template <typename Point>
+  static Scalar boxDistance(const range_t &r, const Point &p) {
+    Scalar d = 0;
 
-        // Calculate the number of elements on the left-hand side, as well as
-        // the right-hand side. We do this by calculating the difference from
-        // the begin and end of the array to the pivot point.
-        std::size_t lhs_size = std::distance(m_begin_it, pivot);
-        std::size_t rhs_size = std::distance(pivot, m_end_it);
-
-        // Next, we check whether the left-hand node should be another internal
-        // node or a leaf node, and we construct the node recursively.
-        m_lhs = std::make_unique<KDTreeNode>(
-            m_begin_it, pivot,
-            lhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
-
-        // Same on the right hand side.
-        m_rhs = std::make_unique<KDTreeNode>(
-            pivot, m_end_it,
-            rhs_size > LeafSize ? NodeType::Internal : NodeType::Leaf,
-            (_d + 1) % Dims);
+    for (std::size_t j = 0; j < Dims; ++j) {
+      Scalar delta = 0;
+      if (p[j] < r[j].min()) {
+        delta = r[j].min() - p[j];
+      } else if (p[j] > r[j].max()) {
+        delta = p[j] - r[j].max();
       }
+      d += delta * delta;
     }
 
-    /// @brief Perform a range search in the k-d tree, mapping the key-value
-    /// pairs to a side-effecting function.
-    ///
-    /// This is the most powerful range search method we have, assuming that we
-    /// can use arbitrary side effects, which we can. All other range search
-    /// methods are implemented in terms of this particular function.
-    ///
-    /// @param r The range to search for.
-    /// @param f The mapping function to apply to matching elements.
-    template <typename Callable>
-    void rangeSearchMapDiscard(const range_t &r, Callable &&f) const {
-      // Determine whether the range completely covers the bounding box of
-      // this leaf node. If it is, we can copy all values without having to
-      // check for them being inside the range again.
-      bool contained = r >= m_range;
-
-      if (m_type == NodeType::Internal) {
-        // Firstly, we can check if the range completely contains the bounding
-        // box of this node. If that is the case, we know for certain that any
-        // value contained below this node should end up in the output, and we
-        // can stop recursively looking for them.
-        if (contained) {
-          // We can also pre-allocate space for the number of elements, since we
-          // are inserting all of them anyway.
-          for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-            f(i->first, i->second);
-          }
+    return d;
+  }
 
-          return;
-        }
+  /// @brief A node of the k-d tree.
+  ///
+  /// Every node manages a contiguous section of the element vector. Internal
+  /// nodes split their section in two, the left-hand child is stored at index
+  /// `lhs` in the node vector and the right-hand child directly behind it.
+  struct KDTreeNode {
+    /// @brief The axis-aligned bounding box of the coordinates under this
+    /// node.
+    range_t range;
 
-        assert(m_lhs && m_rhs && "Did not find lhs and rhs");
+    /// @brief The start and end of the range of coordinate-value pairs under
+    /// this node.
+    std::size_t begin;
+    std::size_t end;
 
-        // If we have a left-hand node (which we should!), then we check if
-        // there is any overlap between the target range and the bounding box of
-        // the left-hand node. If there is, we recursively search in that node.
-        if (m_lhs->range() && r) {
-          m_lhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
-        }
+    /// @brief The index of the left-hand child, zero for leaf nodes as the
+    /// root can never be a child.
+    std::size_t lhs;
 
-        // Then, we perform exactly the same procedure for the right hand side.
-        if (m_rhs->range() && r) {
-          m_rhs->rangeSearchMapDiscard(r, std::forward<Callable>(f));
-        }
-      } else {
-        // Iterate over all the elements in this leaf node. This should be a
-        // relatively small number (the LeafSize template parameter).
-        for (iterator_t i = m_begin_it; i != m_end_it; ++i) {
-          // We need to check whether the element is actually inside the range.
-          // In case this node's bounding box is fully contained within the
-          // range, we don't actually need to check this.
-          if (contained || r.contains(i->first)) {
-            f(i->first, i->second);
-          }
-        }
-      }
+    bool isLeaf() const { return lhs == 0; }
+
+    std::size_t size() const { return end - begin; }
+  };
+
+  /// @brief Stack of node indices for the tree traversal.
+  using NodeStack = boost::container::small_vector<std::size_t, 64>;
+
+  /// @brief Split an internal node into two children.
+  ///
+  /// @param node The index of the node to split.
+  /// @param dim The dimension along which to split.
+  void split(std::size_t node, std::size_t dim) {
+    // This constant determines the maximum number of elements where we still
+    // calculate the exact median of the values for the purposes of splitting.
+    // In general, the closer the pivot value is to the true median, the more
+    // balanced the tree will be. However, calculating the median exactly is
+    // an O(n log n) operation, while approximating it is an O(1) time.
+    constexpr std::size_t max_exact_median = 128;
+
+    const std::size_t begin = m_nodes[node].begin;
+    const std::size_t end = m_nodes[node].end;
+    iterator_t begin_it = std::next(m_elems.begin(), begin);
+    iterator_t end_it = std::next(m_elems.begin(), end);
+
+    iterator_t pivot;
+
+    // Next, we need to determine the pivot point of this node, that is to say
+    // the point in the selected pivot dimension along which point we will
+    // split the range. To do this, we check how large the set of elements is.
+    // If it is sufficiently small, we use the median. Otherwise we use the
+    // mean.
+    if (end - begin > max_exact_median) {
+      // In this case, we have a lot of elements, and sorting the range to
+      // find the true median might be too expensive. Therefore, we will just
+      // use the middle value between the minimum and maximum. This is not
+      // nearly as accurate as using the median, but it's a nice cheat.
+      Scalar mid = static_cast<Scalar>(0.5) *
+                   (m_nodes[node].range[dim].max() +
+                    m_nodes[node].range[dim].min());
+
+      pivot = std::partition(begin_it, end_it, [=](const pair_t &i) {
+        return i.first[dim] < mid;
+      });
+    } else {
+      // If the number of elements is fairly small, we will just calculate
+      // the median exactly. We do this by finding the values in the
+      // dimension, sorting it, and then taking the middle one.
+      std::sort(begin_it, end_it, [dim](const pair_t &a, const pair_t &b) {
+        return a.first[dim] < b.first[dim];
+      });
+
+      pivot = begin_it + (std::distance(begin_it, end_it) / 2);
     }
 
-    /// @brief Determine the number of elements managed by this node.
-    ///
-    /// Conveniently, this number is always equal to the distance between the
-    /// begin iterator and the end iterator, so we can simply delegate to the
-    /// relevant standard library method.
-    ///
-    /// @return The number of elements below this node.
-    std::size_t size() const { return std::distance(m_begin_it, m_end_it); }
+    // This should never really happen, but in very select cases where there
+    // are a lot of equal values in the range, the pivot can end up all the
+    // way at the end of the array and we end up in an infinite loop. We check
+    // for pivot points which would not split the range, and fix them if they
+    // occur.
+    if (pivot == begin_it || pivot == std::prev(end_it)) {
+      pivot = std::next(begin_it, LeafSize);
+    }
 
-    /// @brief The axis-aligned bounding box containing all elements in this
-    /// node.
-    ///
-    /// @return The minimal axis-aligned bounding box that contains all the
-    /// elements under this node.
-    const range_t &range() const { return m_range; }
+    std::size_t mid = std::distance(m_elems.begin(), pivot);
 
-   protected:
-    NodeType m_type;
+    // The children are appended next to each other, note that this may
+    // invalidate references into the node vector.
+    std::size_t lhs = m_nodes.size();
+    m_nodes.push_back(KDTreeNode{boundingBox(begin, mid), begin, mid, 0});
+    m_nodes.push_back(KDTreeNode{boundingBox(mid, end), mid, end, 0});
+    m_nodes[node].lhs = lhs;
+  }
 
-    /// @brief The start and end of the range of coordinate-value pairs under
-    /// this node.
-    const iterator_t m_begin_it, m_end_it;
+  /// @brief Apply a function to the elements of a leaf inside a range.
+  ///
+  /// The range check is first evaluated for the whole bucket, one dimension
+  /// at a time over the contiguous coordinates, before the matching elements
+  /// are reported in order.
+  ///
+  /// @param r The range to search for.
+  /// @param node The leaf node to filter.
+  /// @param f The mapping function to apply to matching elements.
+  template <typename Callable>
+  void filterLeaf(const range_t &r, const KDTreeNode &node,
+                  Callable &&f) const {
+    std::size_t n = node.size();
+    assert(n <= LeafSize && "Leaf node exceeds the leaf size");
 
-    /// @brief The axis-aligned bounding box of the coordinates under this
-    /// node.
-    const range_t m_range;
+    std::array<std::uint8_t, LeafSize> mask{};
+    mask.fill(1);
 
-    /// @brief Pointers to the left and right children.
-    std::unique_ptr<KDTreeNode> m_lhs;
-    std::unique_ptr<KDTreeNode> m_rhs;
-  };
+    for (std::size_t j = 0; j < Dims; ++j) {
+      const Scalar *c = m_coords[j].data() + node.begin;
+      const Scalar lo = r[j].min();
+      const Scalar hi = r[j].max();
+      for (std::size_t i = 0; i < n; ++i) {
+        mask[i] &= static_cast<std::uint8_t>((lo <= c[i]) & (c[i] < hi));
+      }
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+      if (mask[i] != 0) {
+        f(m_elems[node.begin + i].first, m_elems[node.begin + i].second);
+      }
+    }
+  }
 
   /// @brief Vector containing all of the elements in this k-d tree, including
   /// the elements managed by the nodes inside of it.
   vector_t m_elems;
 
-  /// @brief Pointer to the root node of this k-d tree.
-  std::unique_ptr<KDTreeNode> m_root;
+  /// @brief The coordinates of the elements, one vector per dimension in the
+  /// same order as the element vector.
+  std::array<std::vector<Scalar>, Dims> m_coords;
+
+  /// @brief The nodes of the k-d tree, the root node comes first.
+  std::vector<KDTreeNode> m_nodes;
+
+  /// @brief The depth of the deepest leaf, which bounds the traversal stacks.
+  std::size_t m_depth = 0;
 };
 }  // namespace Acts
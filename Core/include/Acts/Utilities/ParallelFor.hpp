@@ -0,0 +1,94 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace Acts {
+
+/// Function running the tasks of a parallel loop
+///
+/// It is called with the number of tasks and has to call the task function
+/// once for every index in [0, numTasks), on any thread and in any order. It
+/// returns after all calls have finished and rethrows an exception thrown by
+/// one of them. This allows to run the loops on an existing thread pool, e.g.
+/// a TBB task arena, instead of threads started for every loop.
+using ParallelExecutor =
+    std::function<void(std::size_t numTasks,
+                       const std::function<void(std::size_t)>& task)>;
+
+/// Run a sequence of parallel loops
+///
+/// The tasks [0, @p numTasks) of a phase are run concurrently. After all of
+/// them are done, @p nextPhase runs on a single thread and returns the number
+/// of tasks of the next phase, or zero to stop.
+///
+/// Without an executor, @p numThreads - 1 threads are started and kept for
+/// all phases, the tasks are handed out dynamically to them and the calling
+/// thread. With an executor, every phase is handed to it and the concurrency
+/// is up to the executor. Everything runs in the calling thread if
+/// @p numThreads is at most 1.
+///
+/// The first exception thrown by a task or by @p nextPhase stops the loops
+/// and is rethrown in the calling thread once all threads are done.
+///
+/// @param numTasks The number of tasks of the first phase
+/// @param numThreads The number of threads including the calling one
+/// @param task The function running a single task of the current phase
+/// @param nextPhase The function preparing the next phase
+/// @param executor Optional executor for the tasks of the phases
+void parallelPhases(std::size_t numTasks, std::size_t numThreads,
+                    const std::function<void(std::size_t)>& task,
+                    const std::function<std::size_t()>& nextPhase,
+                    const ParallelExecutor& executor = {});
+
+/// Call @p task for every index in [0, @p numTasks)
+///
+/// See @ref parallelPhases for the threading and the exception handling.
+///
+/// @param numTasks The number of tasks
+/// @param numThreads The number of threads including the calling one
+/// @param task The function running a single task
+/// @param executor Optional executor for the tasks
+void parallelFor(std::size_t numTasks, std::size_t numThreads,
+                 const std::function<void(std::size_t)>& task,
+                 const ParallelExecutor& executor = {});
+
+/// Call @p func(begin, end) for chunks of the index range [0, @p n)
+///
+/// The chunks of @p grainSize indices are handed out dynamically, so that
+/// threads that got cheap chunks continue with the next ones.
+///
+/// @param n The size of the index range
+/// @param grainSize The number of indices per chunk
+/// @param numThreads The number of threads including the calling one
+/// @param func The function processing a chunk
+/// @param executor Optional executor for the chunks
+template <typename func_t>
+void parallelForChunks(std::size_t n, std::size_t grainSize,
+                       std::size_t numThreads, const func_t& func,
+                       const ParallelExecutor& executor = {}) {
+  if (numThreads <= 1) {
+    if (n > 0) {
+      func(std::size_t{0}, n);
+    }
+    return;
+  }
+  grainSize = std::max<std::size_t>(grainSize, 1);
+  parallelFor(
+      (n + grainSize - 1) / grainSize, numThreads,
+      [&](std::size_t chunk) {
+        func(chunk * grainSize, std::min(n, (chunk + 1) * grainSize));
+      },
+      executor);
+}
+
+}  // namespace Acts
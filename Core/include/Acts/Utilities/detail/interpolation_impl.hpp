@@ -115,7 +115,7 @@ struct interpolate_impl {
 
     std::array<T, (N >> 1)> newFields{};
     for (std::size_t i = 0; i < N / 2; ++i) {
-      newFields.at(i) = (1 - f) * fields.at(2 * i) + f * fields.at(2 * i + 1);
+      newFields[i] = (1 - f) * fields[2 * i] + f * fields[2 * i + 1];
     }
 
     return interpolate_impl<T, Point1, Point2, Point3, D - 1, (N >> 1)>::run(
@@ -131,7 +131,7 @@ struct interpolate_impl<T, Point1, Point2, Point3, D, 2u> {
     // get distance to lower boundary relative to total bin width
     const double f = (pos[D] - lowerLeft[D]) / (upperRight[D] - lowerLeft[D]);
 
-    return (1 - f) * fields.at(0) + f * fields.at(1);
+    return (1 - f) * fields[0] + f * fields[1];
   }
 };
 /// @endcond
@@ -0,0 +1,217 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @class AdaptiveGridDensityMap
+/// @brief Sparse map from z-t bins to track densities.
+///
+/// The bins are stored in tiles of `kTileSize` consecutive z bins which share
+/// the same t bin. Tiles are located through an open-addressing hash table and
+/// the densities of a tile are contiguous, such that adding or subtracting
+/// the density of a track runs over whole tiles instead of inserting bin by
+/// bin into a sorted map. An occupancy mask per tile keeps track of the bins
+/// which are part of the map. A bin stays part of the map once it is inserted,
+/// even if its density drops to zero again.
+///
+/// The bin with the highest density is cached per tile and only searched
+/// again in tiles modified since the previous query. This keeps repeated
+/// maximum searches in between track removals cheap.
+class AdaptiveGridDensityMap {
+ public:
+  /// The first (second) integer indicates the bin's z (t) position
+  using Bin = std::pair<std::int32_t, std::int32_t>;
+  /// Bin and corresponding density
+  using value_type = std::pair<Bin, float>;
+
+  /// Number of consecutive z bins stored together
+  static constexpr std::int32_t kTileSize = 16;
+
+ private:
+  struct Tile {
+    std::int32_t zTile = 0;
+    std::int32_t tBin = 0;
+    /// Bit i is set if z bin `zTile * kTileSize + i` is part of the map
+    std::uint32_t mask = 0;
+    /// Lane of the cached maximum, negative if it has to be searched again
+    mutable std::int32_t maxLane = -1;
+    std::array<float, kTileSize> densities{};
+  };
+
+ public:
+  /// Iterator over the bins of the map and their densities.
+  ///
+  /// The order of the bins is unspecified. Modifying the map invalidates all
+  /// iterators.
+  class const_iterator {
+   public:
+    /// Iterator category
+    using iterator_category = std::forward_iterator_tag;
+    /// Bin and corresponding density
+    using value_type = AdaptiveGridDensityMap::value_type;
+    /// Iterator difference type
+    using difference_type = std::ptrdiff_t;
+    /// Pointer to the current entry
+    using pointer = const value_type*;
+    /// Reference to the current entry
+    using reference = const value_type&;
+
+    const_iterator() = default;
+
+    /// @return The current bin and its density
+    reference operator*() const { return m_entry; }
+    /// @return Pointer to the current bin and its density
+    pointer operator->() const { return &m_entry; }
+
+    /// Advance to the next bin
+    /// @return This iterator
+    const_iterator& operator++() {
+      ++m_lane;
+      seek();
+      return *this;
+    }
+    /// Advance to the next bin
+    /// @return Copy of the iterator before advancing
+    const_iterator operator++(int) {
+      const_iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    /// @param other Iterator to compare with
+    /// @return True if both iterators point to the same bin
+    bool operator==(const const_iterator& other) const {
+      return m_tile == other.m_tile && m_lane == other.m_lane;
+    }
+
+   private:
+    friend class AdaptiveGridDensityMap;
+
+    const_iterator(const std::vector<Tile>* tiles, std::size_t tile,
+                   std::int32_t lane)
+        : m_tiles(tiles), m_tile(tile), m_lane(lane) {
+      seek();
+    }
+
+    /// Moves to the first occupied bin at or after the current position
+    void seek() {
+      while (m_tile < m_tiles->size()) {
+        const Tile& tile = (*m_tiles)[m_tile];
+        std::uint32_t remaining =
+            m_lane < kTileSize ? tile.mask >> m_lane : 0u;
+        if (remaining != 0) {
+          m_lane += std::countr_zero(remaining);
+          m_entry = {{tile.zTile * kTileSize + m_lane, tile.tBin},
+                     tile.densities[m_lane]};
+          return;
+        }
+        ++m_tile;
+        m_lane = 0;
+      }
+      m_lane = 0;
+    }
+
+    const std::vector<Tile>* m_tiles = nullptr;
+    std::size_t m_tile = 0;
+    std::int32_t m_lane = 0;
+    value_type m_entry;
+  };
+
+  /// @return True if the map does not contain any bin
+  bool empty() const { return m_size == 0; }
+  /// @return Number of bins in the map
+  std::size_t size() const { return m_size; }
+
+  /// @return Iterator to the first bin
+  const_iterator begin() const { return {&m_tiles, 0, 0}; }
+  /// @return Iterator past the last bin
+  const_iterator end() const { return {&m_tiles, m_tiles.size(), 0}; }
+
+  /// Access the density of a bin, inserting it with zero density if it is
+  /// not yet part of the map.
+  ///
+  /// @param bin The bin to access
+  /// @return Reference to the density of the bin
+  float& operator[](const Bin& bin);
+
+  /// Access the density of a bin.
+  ///
+  /// @param bin The bin to access
+  /// @throws std::out_of_range if the bin is not part of the map
+  /// @return The density of the bin
+  float at(const Bin& bin) const;
+
+  /// @param bin The bin to look up
+  /// @return Iterator to the bin, or `end()` if it is not part of the map
+  const_iterator find(const Bin& bin) const;
+
+  /// @param bin The bin to look up
+  /// @return True if the bin is part of the map
+  bool contains(const Bin& bin) const;
+
+  /// Add the densities of another map bin by bin. Bins which are not yet
+  /// part of this map are inserted.
+  ///
+  /// @param other The densities to add
+  void add(const AdaptiveGridDensityMap& other);
+
+  /// Subtract the densities of another map bin by bin. Bins which are not
+  /// yet part of this map are inserted.
+  ///
+  /// @param other The densities to subtract
+  void subtract(const AdaptiveGridDensityMap& other);
+
+  /// Find the bin with the highest density. If several bins share the
+  /// highest density the smallest of them is returned.
+  ///
+  /// @return Iterator to the bin, or `end()` if the map is empty
+  const_iterator highestDensityEntry() const;
+
+  /// Remove all bins
+  void clear();
+
+ private:
+  static constexpr std::uint32_t kNoTile = 0;
+
+  /// Tiles in the order of insertion
+  std::vector<Tile> m_tiles;
+  /// Open-addressing hash table holding tile index + 1, or `kNoTile`
+  std::vector<std::uint32_t> m_slots;
+  std::size_t m_size = 0;
+
+  /// Tile holding the highest density, valid if `m_maxUpToDate` is set
+  mutable std::size_t m_maxTile = 0;
+  mutable bool m_maxUpToDate = false;
+
+  static std::int32_t zTileOf(std::int32_t zBin);
+  static std::int32_t laneOf(std::int32_t zBin);
+
+  /// @return Index of the slot holding the tile or the empty slot where it
+  /// has to be inserted
+  std::size_t slotOf(std::int32_t zTile, std::int32_t tBin) const;
+  /// @return Index of the tile, or `m_tiles.size()` if there is none
+  std::size_t findTile(std::int32_t zTile, std::int32_t tBin) const;
+  /// @return Index of the tile, which is inserted if needed
+  std::size_t findOrInsertTile(std::int32_t zTile, std::int32_t tBin);
+  void rehash(std::size_t nSlots);
+
+  /// Mark a tile as modified and insert the bins of `mask` into it
+  void touch(Tile& tile, std::uint32_t mask);
+};
+
+}  // namespace Acts
@@ -12,9 +12,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/BoundTrackParameters.hpp"
 #include "Acts/Utilities/Result.hpp"
-
-#include <boost/container/flat_map.hpp>  // TODO use flat unordered map
-#include <boost/functional/hash.hpp>
+#include "Acts/Vertexing/AdaptiveGridDensityMap.hpp"
 
 namespace Acts {
 
@@ -29,12 +27,13 @@ namespace Acts {
 /// Single tracks can be cached and removed from the overall density.
 /// Unlike in the GaussianGridTrackDensity, the overall density map
 /// grows adaptively when tracks densities are added to the grid.
+/// The track densities are evaluated for whole rows of z bins at once.
 class AdaptiveGridTrackDensity {
  public:
   /// The first (second) integer indicates the bin's z (t) position
-  using Bin = std::pair<std::int32_t, std::int32_t>;
+  using Bin = AdaptiveGridDensityMap::Bin;
   /// Mapping between bins and track densities
-  using DensityMap = boost::container::flat_map<Bin, float>;
+  using DensityMap = AdaptiveGridDensityMap;
   /// Coordinates in the z-t plane; the t value will be set to 0 if time
   /// vertex seeding is disabled
   using ZTPosition = std::pair<double, double>;
@@ -189,13 +188,6 @@ class AdaptiveGridTrackDensity {
   /// @return Grid size
   std::uint32_t getTemporalTrkGridSize(double sigma) const;
 
-  /// @brief Finds the maximum density of a DensityMap
-  /// @param densityMap Map between bins and corresponding density
-  /// values
-  /// @return Iterator of the map entry with the highest density
-  DensityMap::const_iterator highestDensityEntry(
-      const DensityMap& densityMap) const;
-
   /// @brief Function that creates a track density map, i.e., a map from bins
   /// to the corresponding density values for a single track.
   ///
@@ -18,6 +18,8 @@
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <functional>
+
 namespace Acts {
 
 /// @brief Implements an iterative vertex finder
@@ -154,6 +156,32 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
 
     /// Function to extract parameters from InputTrack
     InputTrack::Extractor extractParameters;
+
+    /// Maximum number of vertex candidates seeded and fitted per iteration.
+    /// If larger than one, further candidates are seeded speculatively after
+    /// the first one, excluding the seed tracks close in z to the candidates
+    /// found before. Each candidate counts as one iteration towards
+    /// maxIterations.
+    ///
+    /// Note: The speculative candidates are fitted before the tracks of the
+    /// other candidates of the same iteration are removed from the seed
+    /// tracks, so the vertices differ from the ones found with a single
+    /// candidate per iteration. They do not depend on how the candidates are
+    /// executed.
+    std::size_t maxParallelCandidates = 1;
+
+    /// Minimum z distance between the candidates of one iteration. Tracks
+    /// closer than this to a candidate are not used for seeding the further
+    /// candidates. Has to be at least twice tracksMaxZinterval, such that the
+    /// candidates do not compete for the same tracks.
+    double parallelCandidateSeparation = 10. * Acts::UnitConstants::mm;
+
+    /// Runs `task(i)` for all candidates `i < n` of one iteration, possibly
+    /// concurrently. The tasks only share read access to the finder and the
+    /// fitter state. If unset, the candidates are processed sequentially.
+    std::function<void(std::size_t n,
+                       const std::function<void(std::size_t)>& task)>
+        forEachCandidate;
   };
 
   /// State struct for fulfilling interface
@@ -186,6 +214,20 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
           "AdaptiveMultiVertexFinder: "
           "No vertex fitter provided.");
     }
+
+    if (m_cfg.maxParallelCandidates == 0) {
+      throw std::invalid_argument(
+          "AdaptiveMultiVertexFinder: "
+          "At least one vertex candidate per iteration is required.");
+    }
+
+    if (m_cfg.maxParallelCandidates > 1 &&
+        m_cfg.parallelCandidateSeparation < 2 * m_cfg.tracksMaxZinterval) {
+      throw std::invalid_argument(
+          "AdaptiveMultiVertexFinder: "
+          "Parallel candidate separation must be at least twice the "
+          "maximum track z interval.");
+    }
   }
 
   /// @brief Function that performs the adaptive
@@ -223,6 +265,68 @@ class AdaptiveMultiVertexFinder final : public IVertexFinder {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
+  /// Vertex candidate of an iteration with several candidates
+  struct Candidate {
+    /// The candidate vertex, owned until it is added to the output
+    std::unique_ptr<Vertex> vertex;
+    /// Vertex constraint after seeding the candidate
+    Vertex constraint;
+    /// Vertices which are fitted together with the candidate
+    std::vector<Vertex*> fitGroup;
+  };
+
+  /// @brief Vertex finding with up to `maxParallelCandidates` vertex
+  /// candidates per iteration
+  ///
+  /// @param allTracks Input track collection
+  /// @param vertexingOptions Vertexing options
+  /// @param state The finder state
+  ///
+  /// @return Vector of all reconstructed vertices
+  Result<std::vector<Vertex>> findWithParallelCandidates(
+      const std::vector<InputTrack>& allTracks,
+      const VertexingOptions& vertexingOptions, State& state) const;
+
+  /// @brief Seeds the vertex candidates of one iteration
+  ///
+  /// The first candidates are seeded with the seed finder state, the further
+  /// ones with a copy of it from which the tracks close to the previous
+  /// candidates are removed.
+  ///
+  /// @param seedTracks All tracks to be used for seeding
+  /// @param vertexingOptions Vertexing options
+  /// @param seedFinderState The seed finder state
+  /// @param removedSeedTracks Seed track that have been removed
+  /// from seed track collection in last iteration
+  /// @param maxCandidates Maximum number of candidates
+  ///
+  /// @return The vertex candidates, ordered as seeded
+  Result<std::vector<Candidate>> seedCandidates(
+      const std::vector<InputTrack>& seedTracks,
+      const VertexingOptions& vertexingOptions,
+      IVertexFinder::State& seedFinderState,
+      const std::vector<InputTrack>& removedSeedTracks,
+      std::size_t maxCandidates) const;
+
+  /// @brief Runs `task(i)` for all `i < n` with the configured executor
+  ///
+  /// @param n Number of tasks
+  /// @param task The task
+  void forEachCandidate(std::size_t n,
+                        const std::function<void(std::size_t)>& task) const;
+
+  /// @brief Method that deletes a candidate vertex from the list of all
+  /// vertices and refits the vertices of its fit group afterwards
+  ///
+  /// @param candidate The candidate whose vertex will be removed
+  /// @param allVerticesPtr Vector containing the actual addresses
+  /// @param fitterState The current vertex fitter state
+  /// @param vertexingOptions Vertexing options
+  Result<void> deleteCandidateVertex(
+      Candidate& candidate, std::vector<Vertex*>& allVerticesPtr,
+      VertexFitterState& fitterState,
+      const VertexingOptions& vertexingOptions) const;
+
   /// @brief Calls the seed finder and sets constraints on the found seed
   /// vertex if desired
   ///
@@ -9,11 +9,122 @@
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
 
 namespace Acts {
 
 namespace {
 
+/// Compares two tracks in order to find the one which should be evicted.
+/// First we compare the relative amount of shared measurements. If that is
+/// indecisive we use the chi2.
+bool compareTracks(const GreedyAmbiguityResolution::State& state,
+                   std::size_t a, std::size_t b) {
+  /// Helper to calculate the relative amount of shared measurements.
+  auto relativeSharedMeasurements = [&state](std::size_t i) {
+    return 1.0 * state.sharedMeasurementsPerTrack[i] /
+           state.measurementsPerTrack[i].size();
+  };
+
+  if (relativeSharedMeasurements(a) != relativeSharedMeasurements(b)) {
+    return relativeSharedMeasurements(a) < relativeSharedMeasurements(b);
+  }
+  if (state.measurementsPerTrack[a].size() ==
+      state.measurementsPerTrack[b].size()) {
+    // chi2 comparison only makes sense if the number of measurements is the
+    // same. Note that this is still not fully correct, as the measurement
+    // dimensions might differ i.e. pixel and strip measurements are treated
+    // the same here.
+    return state.trackChi2[a] < state.trackChi2[b];
+  }
+  // If the number of measurements is different, we compare the number of
+  // measurements. As mentioned above, this is not fully correct, but
+  // should be sufficient for now.
+  return state.measurementsPerTrack[a].size() >
+         state.measurementsPerTrack[b].size();
+}
+
+/// Binary heap of track indices which knows the heap position of every track
+/// so that a track can be moved after its priority changed.
+///
+/// @tparam before_t Callable returning true if the first track has to be
+///         evicted before the second one
+template <typename before_t>
+class IndexedTrackHeap {
+ public:
+  IndexedTrackHeap(std::size_t nTracks, before_t before)
+      : m_before(std::move(before)), m_positions(nTracks, kNoPosition) {}
+
+  bool empty() const { return m_heap.empty(); }
+
+  std::size_t top() const { return m_heap.front(); }
+
+  void push(std::size_t iTrack) {
+    m_positions[iTrack] = m_heap.size();
+    m_heap.push_back(iTrack);
+    siftUp(m_heap.size() - 1);
+  }
+
+  void pop() {
+    swapPositions(0, m_heap.size() - 1);
+    m_positions[m_heap.back()] = kNoPosition;
+    m_heap.pop_back();
+    if (!m_heap.empty()) {
+      siftDown(0);
+    }
+  }
+
+  /// Restores the heap order after the priority of a track changed.
+  void update(std::size_t iTrack) {
+    siftUp(m_positions[iTrack]);
+    siftDown(m_positions[iTrack]);
+  }
+
+ private:
+  static constexpr std::size_t kNoPosition =
+      std::numeric_limits<std::size_t>::max();
+
+  before_t m_before;
+  std::vector<std::size_t> m_heap;
+  std::vector<std::size_t> m_positions;
+
+  void swapPositions(std::size_t i, std::size_t j) {
+    std::swap(m_heap[i], m_heap[j]);
+    m_positions[m_heap[i]] = i;
+    m_positions[m_heap[j]] = j;
+  }
+
+  void siftUp(std::size_t i) {
+    while (i > 0) {
+      std::size_t parent = (i - 1) / 2;
+      if (!m_before(m_heap[i], m_heap[parent])) {
+        break;
+      }
+      swapPositions(i, parent);
+      i = parent;
+    }
+  }
+
+  void siftDown(std::size_t i) {
+    while (true) {
+      std::size_t first = i;
+      for (std::size_t child : {2 * i + 1, 2 * i + 2}) {
+        if (child < m_heap.size() && m_before(m_heap[child], m_heap[first])) {
+          first = child;
+        }
+      }
+      if (first == i) {
+        break;
+      }
+      swapPositions(i, first);
+      i = first;
+    }
+  }
+};
+
 /// Removes a track from the state which has to be done for multiple properties
 /// because of redundancy.
 static void removeTrack(GreedyAmbiguityResolution::State& state,
@@ -33,6 +144,11 @@ static void removeTrack(GreedyAmbiguityResolution::State& state,
 }  // namespace
 
 void GreedyAmbiguityResolution::resolve(State& state) const {
+  if (m_cfg.useSharedHitGraph) {
+    resolveWithSharedHitGraph(state);
+    return;
+  }
+
   /// Compares two tracks based on the number of shared measurements in order to
   /// decide if we already met the final state.
   auto sharedMeasurementsComperator = [&state](std::size_t a, std::size_t b) {
@@ -40,32 +156,8 @@ void GreedyAmbiguityResolution::resolve(State& state) const {
            state.sharedMeasurementsPerTrack[b];
   };
 
-  /// Compares two tracks in order to find the one which should be evicted.
-  /// First we compare the relative amount of shared measurements. If that is
-  /// indecisive we use the chi2.
   auto trackComperator = [&state](std::size_t a, std::size_t b) {
-    /// Helper to calculate the relative amount of shared measurements.
-    auto relativeSharedMeasurements = [&state](std::size_t i) {
-      return 1.0 * state.sharedMeasurementsPerTrack[i] /
-             state.measurementsPerTrack[i].size();
-    };
-
-    if (relativeSharedMeasurements(a) != relativeSharedMeasurements(b)) {
-      return relativeSharedMeasurements(a) < relativeSharedMeasurements(b);
-    }
-    if (state.measurementsPerTrack[a].size() ==
-        state.measurementsPerTrack[b].size()) {
-      // chi2 comparison only makes sense if the number of measurements is the
-      // same. Note that this is still not fully correct, as the measurement
-      // dimensions might differ i.e. pixel and strip measurements are treated
-      // the same here.
-      return state.trackChi2[a] < state.trackChi2[b];
-    }
-    // If the number of measurements is different, we compare the number of
-    // measurements. As mentioned above, this is not fully correct, but
-    // should be sufficient for now.
-    return state.measurementsPerTrack[a].size() >
-           state.measurementsPerTrack[b].size();
+    return compareTracks(state, a, b);
   };
 
   for (std::size_t i = 0; i < m_cfg.maximumIterations; ++i) {
@@ -99,4 +191,142 @@ void GreedyAmbiguityResolution::resolve(State& state) const {
   }
 }
 
+void GreedyAmbiguityResolution::resolveWithSharedHitGraph(State& state) const {
+  const std::size_t nTracks = state.measurementsPerTrack.size();
+  std::size_t nMeasurements = 0;
+  if (!state.tracksPerMeasurement.empty()) {
+    nMeasurements = state.tracksPerMeasurement.rbegin()->first + 1;
+  }
+  for (std::size_t iTrack : state.selectedTracks) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      nMeasurements = std::max(nMeasurements, iMeasurement + 1);
+    }
+  }
+
+  // Compressed sparse row representation of the bipartite graph between the
+  // selected tracks and their measurements in both directions
+  std::vector<std::size_t> trackOffsets(nMeasurements + 1, 0);
+  for (const auto& [iMeasurement, tracks] : state.tracksPerMeasurement) {
+    trackOffsets[iMeasurement + 1] = tracks.size();
+  }
+  std::partial_sum(trackOffsets.begin(), trackOffsets.end(),
+                   trackOffsets.begin());
+  std::vector<std::size_t> tracksOfMeasurement(trackOffsets.back());
+  for (const auto& [iMeasurement, tracks] : state.tracksPerMeasurement) {
+    std::ranges::copy(tracks,
+                      tracksOfMeasurement.begin() + trackOffsets[iMeasurement]);
+  }
+
+  // Number of selected tracks per measurement and the last evicted track
+  // which used the measurement, to visit duplicated measurements of a track
+  // only once
+  std::vector<std::size_t> nTracksPerMeasurement(nMeasurements);
+  for (std::size_t iMeasurement = 0; iMeasurement < nMeasurements;
+       ++iMeasurement) {
+    nTracksPerMeasurement[iMeasurement] =
+        trackOffsets[iMeasurement + 1] - trackOffsets[iMeasurement];
+  }
+  std::vector<std::size_t> lastEvictedTrack(nMeasurements, nTracks);
+
+  std::vector<bool> isSelected(nTracks, false);
+  std::vector<std::size_t> nTracksPerSharedMeasurements;
+  for (std::size_t iTrack : state.selectedTracks) {
+    isSelected[iTrack] = true;
+    std::size_t nShared = state.sharedMeasurementsPerTrack[iTrack];
+    if (nShared >= nTracksPerSharedMeasurements.size()) {
+      nTracksPerSharedMeasurements.resize(nShared + 1, 0);
+    }
+    ++nTracksPerSharedMeasurements[nShared];
+  }
+  std::size_t maximumSharedMeasurements =
+      nTracksPerSharedMeasurements.empty()
+          ? 0
+          : nTracksPerSharedMeasurements.size() - 1;
+
+  // Ties are broken by the track index which gives the same order as the
+  // first maximum element found by the linear scan
+  auto evictBefore = [&state](std::size_t a, std::size_t b) {
+    if (compareTracks(state, b, a)) {
+      return true;
+    }
+    if (compareTracks(state, a, b)) {
+      return false;
+    }
+    return a < b;
+  };
+  IndexedTrackHeap<decltype(evictBefore)> queue(nTracks, evictBefore);
+  for (std::size_t iTrack : state.selectedTracks) {
+    queue.push(iTrack);
+  }
+
+  std::vector<std::size_t> evictedTracks;
+  for (std::size_t i = 0; i < m_cfg.maximumIterations; ++i) {
+    // Lazy out if there is nothing to filter on.
+    if (queue.empty()) {
+      ACTS_VERBOSE("no tracks left - exit loop");
+      break;
+    }
+
+    // Shared measurements only decrease so the maximum is found by walking
+    // down the histogram
+    while (maximumSharedMeasurements > 0 &&
+           nTracksPerSharedMeasurements[maximumSharedMeasurements] == 0) {
+      --maximumSharedMeasurements;
+    }
+    ACTS_VERBOSE("maximum shared measurements " << maximumSharedMeasurements);
+    if (maximumSharedMeasurements < m_cfg.maximumSharedHits) {
+      break;
+    }
+
+    // The "worst" track is on top of the queue
+    std::size_t badTrack = queue.top();
+    ACTS_VERBOSE("remove track "
+                 << badTrack << " nMeas "
+                 << state.measurementsPerTrack[badTrack].size() << " nShared "
+                 << state.sharedMeasurementsPerTrack[badTrack] << " chi2 "
+                 << state.trackChi2[badTrack]);
+    queue.pop();
+    isSelected[badTrack] = false;
+    --nTracksPerSharedMeasurements
+        [state.sharedMeasurementsPerTrack[badTrack]];
+    evictedTracks.push_back(badTrack);
+
+    // Only the tracks which are left alone on a measurement change
+    for (auto iMeasurement : state.measurementsPerTrack[badTrack]) {
+      if (lastEvictedTrack[iMeasurement] == badTrack) {
+        continue;
+      }
+      lastEvictedTrack[iMeasurement] = badTrack;
+      if (--nTracksPerMeasurement[iMeasurement] != 1) {
+        continue;
+      }
+      auto tracks = std::span(tracksOfMeasurement)
+                        .subspan(trackOffsets[iMeasurement],
+                                 trackOffsets[iMeasurement + 1] -
+                                     trackOffsets[iMeasurement]);
+      auto jTrack = *std::ranges::find_if(
+          tracks, [&isSelected](std::size_t j) { return isSelected[j]; });
+      --nTracksPerSharedMeasurements[state.sharedMeasurementsPerTrack[jTrack]];
+      --state.sharedMeasurementsPerTrack[jTrack];
+      ++nTracksPerSharedMeasurements[state.sharedMeasurementsPerTrack[jTrack]];
+      queue.update(jTrack);
+    }
+  }
+
+  // Bring the remaining state in sync with the evicted tracks
+  for (std::size_t iTrack : evictedTracks) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      state.tracksPerMeasurement[iMeasurement].erase(iTrack);
+    }
+  }
+  if (!evictedTracks.empty()) {
+    state.selectedTracks.clear();
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      if (isSelected[iTrack]) {
+        state.selectedTracks.insert(state.selectedTracks.end(), iTrack);
+      }
+    }
+  }
+}
+
 }  // namespace Acts
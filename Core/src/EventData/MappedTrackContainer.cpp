@@ -0,0 +1,536 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/MappedTrackContainer.hpp"
+
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Acts {
+
+namespace {
+
+using namespace Acts::HashedStringLiteral;
+using namespace detail_mtc;
+
+constexpr std::array<std::size_t, kNumSections> kElementSizes = {
+    sizeof(StateRecord),
+    eBoundSize * sizeof(double),
+    eBoundSize * eBoundSize * sizeof(double),
+    eBoundSize * eBoundSize * sizeof(double),
+    sizeof(double),
+    sizeof(double),
+    sizeof(TrackRecord),
+    eBoundSize * sizeof(double),
+    eBoundSize * eBoundSize * sizeof(double),
+    16 * sizeof(double),
+};
+
+std::size_t index(Section section) {
+  return static_cast<std::size_t>(section);
+}
+
+/// Default constructed record with all bytes zeroed first, so that no
+/// uninitialised memory can end up in the file
+template <typename T>
+T makeRecord() {
+  T rec;
+  std::memset(static_cast<void*>(&rec), 0, sizeof(T));
+  ::new (static_cast<void*>(&rec)) T;
+  return rec;
+}
+
+[[noreturn]] void fail(const std::filesystem::path& path,
+                       const std::string& what) {
+  throw std::runtime_error("MappedTrackFile " + path.string() + ": " + what);
+}
+
+/// Collects the sections in memory and writes them to disk in one go
+class SectionWriter {
+ public:
+  template <typename T>
+  void append(Section section, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto& buffer = m_buffers[index(section)];
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  void appendDoubles(Section section, const double* data, std::size_t n) {
+    auto& buffer = m_buffers[index(section)];
+    const auto* bytes = reinterpret_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + n * sizeof(double));
+  }
+
+  std::size_t count(Section section) const {
+    return m_buffers[index(section)].size() / kElementSizes[index(section)];
+  }
+
+  void write(const std::filesystem::path& path) const {
+    auto header = makeRecord<FileHeader>();
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.byteOrderMark = kByteOrderMark;
+    header.headerSize = sizeof(FileHeader);
+
+    std::size_t offset = sizeof(FileHeader);
+    for (std::size_t i = 0; i < kNumSections; ++i) {
+      offset = alignUp(offset);
+      header.offsets[i] = offset;
+      header.counts[i] = m_buffers[i].size() / kElementSizes[i];
+      offset += m_buffers[i].size();
+    }
+    header.fileSize = offset;
+
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) {
+      fail(path, "cannot open for writing");
+    }
+    os.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+    static constexpr std::array<char, kSectionAlignment> zeros{};
+    std::size_t written = sizeof(FileHeader);
+    for (std::size_t i = 0; i < kNumSections; ++i) {
+      os.write(zeros.data(),
+               static_cast<std::streamsize>(header.offsets[i] - written));
+      os.write(m_buffers[i].data(),
+               static_cast<std::streamsize>(m_buffers[i].size()));
+      written = header.offsets[i] + m_buffers[i].size();
+    }
+    if (!os) {
+      fail(path, "write failed");
+    }
+  }
+
+ private:
+  static std::size_t alignUp(std::size_t offset) {
+    return (offset + kSectionAlignment - 1) / kSectionAlignment *
+           kSectionAlignment;
+  }
+
+  std::array<std::vector<char>, kNumSections> m_buffers;
+};
+
+/// Maps surfaces to their stored reference
+class SurfaceEncoder {
+ public:
+  SurfaceEncoder(const GeometryContext& gctx, SectionWriter& writer)
+      : m_gctx{&gctx}, m_writer{&writer} {}
+
+  void encode(const Surface* surface, std::uint32_t& flags,
+              std::uint64_t& value) {
+    if (surface == nullptr) {
+      return;
+    }
+    if (surface->geometryId() != GeometryIdentifier{}) {
+      flags |= HasGeometrySurface;
+      value = surface->geometryId().value();
+      return;
+    }
+    if (surface->type() != Surface::Perigee) {
+      throw std::invalid_argument(
+          "Reference surfaces without geometry identifier must be perigee "
+          "surfaces");
+    }
+    auto [it, inserted] =
+        m_perigees.try_emplace(surface, m_writer->count(Section::Perigees));
+    if (inserted) {
+      const Transform3& transform = surface->localToGlobalTransform(*m_gctx);
+      m_writer->appendDoubles(Section::Perigees, transform.matrix().data(), 16);
+    }
+    flags |= HasPerigeeSurface;
+    value = it->second;
+  }
+
+ private:
+  const GeometryContext* m_gctx;
+  SectionWriter* m_writer;
+  std::unordered_map<const Surface*, std::size_t> m_perigees;
+};
+
+/// Assigns consecutive output indices to the input component indices so that
+/// shared components stay shared
+class IndexRemapper {
+ public:
+  template <typename F>
+  IndexType remap(IndexType input, F&& store) {
+    if (input == kInvalid) {
+      return kInvalid;
+    }
+    if (input >= m_map.size()) {
+      m_map.resize(input + 1, kInvalid);
+    }
+    if (m_map[input] == kInvalid) {
+      m_map[input] = m_next++;
+      store();
+    }
+    return m_map[input];
+  }
+
+ private:
+  std::vector<IndexType> m_map;
+  IndexType m_next = 0;
+};
+
+}  // namespace
+
+void writeMappedTrackFile(
+    const std::filesystem::path& path, const GeometryContext& gctx,
+    const VectorTrackContainer& tracks,
+    const VectorMultiTrajectory& trackStates,
+    const Delegate<std::uint64_t(const SourceLink&)>& sourceLinkEncoder) {
+  SectionWriter writer;
+  SurfaceEncoder surfaces{gctx, writer};
+  IndexRemapper params;
+  // The vector backend does not expose the jacobian index, shared jacobians
+  // are identified by their storage instead
+  std::unordered_map<const double*, IndexType> jacobianIndices;
+
+  for (IndexType i = 0; i < trackStates.size(); ++i) {
+    auto ts = trackStates.getTrackState(i);
+    // Raw indices are read directly as they are invalid for absent components
+    auto index = [&](HashedString key) {
+      return *std::any_cast<const IndexType*>(
+          trackStates.component_impl(key, i));
+    };
+
+    auto rec = makeRecord<StateRecord>();
+    rec.previous = ts.previous();
+    rec.next = index("next"_hash);
+
+    auto storeParams = [&](IndexType idx) {
+      writer.appendDoubles(Section::Parameters,
+                           trackStates.parameters_impl(idx).data(), eBoundSize);
+      writer.appendDoubles(Section::Covariances,
+                           trackStates.covariance_impl(idx).data(),
+                           eBoundSize * eBoundSize);
+    };
+    auto remapParams = [&](IndexType idx) {
+      return params.remap(idx, [&] { storeParams(idx); });
+    };
+    rec.ipredicted = remapParams(index("predicted"_hash));
+    rec.ifiltered = remapParams(index("filtered"_hash));
+    rec.ismoothed = remapParams(index("smoothed"_hash));
+    if (ts.hasJacobian()) {
+      const double* jacobian = trackStates.jacobian_impl(i).data();
+      auto [it, inserted] = jacobianIndices.try_emplace(
+          jacobian, static_cast<IndexType>(jacobianIndices.size()));
+      if (inserted) {
+        writer.appendDoubles(Section::Jacobians, jacobian,
+                             eBoundSize * eBoundSize);
+      }
+      rec.ijacobian = it->second;
+    }
+
+    if (ts.hasCalibrated()) {
+      rec.measdim = static_cast<IndexType>(ts.calibratedSize());
+      rec.measOffset = writer.count(Section::Measurements);
+      rec.measCovOffset = writer.count(Section::MeasurementCovariances);
+      writer.appendDoubles(Section::Measurements,
+                           ts.effectiveCalibrated().data(), rec.measdim);
+      writer.appendDoubles(Section::MeasurementCovariances,
+                           ts.effectiveCalibratedCovariance().data(),
+                           rec.measdim * rec.measdim);
+    }
+
+    rec.chi2 = ts.chi2();
+    rec.pathLength = ts.pathLength();
+    rec.typeFlags =
+        ts.template component<TrackStateType::raw_type, "typeFlags"_hash>();
+    if (ts.hasProjector()) {
+      rec.flags |= HasProjector;
+      rec.projector =
+          ts.template component<SerializedSubspaceIndices, "projector"_hash>();
+    }
+    if (sourceLinkEncoder.connected() && ts.hasUncalibratedSourceLink()) {
+      rec.flags |= HasSourceLink;
+      rec.sourceLink = sourceLinkEncoder(ts.getUncalibratedSourceLink());
+    }
+    surfaces.encode(trackStates.referenceSurface_impl(i), rec.flags,
+                    rec.surface);
+
+    writer.append(Section::States, rec);
+  }
+
+  auto column = [&]<typename T>(HashedString key, IndexType itrack) {
+    return *std::any_cast<const T*>(tracks.component_impl(key, itrack));
+  };
+
+  for (IndexType i = 0; i < tracks.size(); ++i) {
+    auto rec = makeRecord<TrackRecord>();
+    rec.tipIndex = column.template operator()<IndexType>("tipIndex"_hash, i);
+    rec.stemIndex = column.template operator()<IndexType>("stemIndex"_hash, i);
+    rec.nMeasurements =
+        column.template operator()<unsigned int>("nMeasurements"_hash, i);
+    rec.nHoles = column.template operator()<unsigned int>("nHoles"_hash, i);
+    rec.ndf = column.template operator()<unsigned int>("ndf"_hash, i);
+    rec.nOutliers =
+        column.template operator()<unsigned int>("nOutliers"_hash, i);
+    rec.nSharedHits =
+        column.template operator()<unsigned int>("nSharedHits"_hash, i);
+    rec.chi2 = column.template operator()<float>("chi2"_hash, i);
+
+    ParticleHypothesis hypothesis = tracks.particleHypothesis_impl(i);
+    rec.absPdg = static_cast<std::int32_t>(hypothesis.absolutePdg());
+    rec.mass = hypothesis.mass();
+    rec.absCharge = hypothesis.absoluteCharge();
+
+    surfaces.encode(tracks.referenceSurface_impl(i), rec.flags, rec.surface);
+
+    writer.append(Section::Tracks, rec);
+    writer.appendDoubles(Section::TrackParameters, tracks.parameters(i).data(),
+                         eBoundSize);
+    writer.appendDoubles(Section::TrackCovariances,
+                         tracks.covariance(i).data(), eBoundSize * eBoundSize);
+  }
+
+  writer.write(path);
+}
+
+MappedTrackFile::MappedTrackFile(const std::filesystem::path& path)
+    : MappedTrackFile(path, Config{}) {}
+
+MappedTrackFile::MappedTrackFile(const std::filesystem::path& path,
+                                 const Config& cfg)
+    : m_cfg{cfg} {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    fail(path, std::strerror(errno));
+  }
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    int err = errno;
+    ::close(fd);
+    fail(path, std::strerror(err));
+  }
+  m_size = static_cast<std::size_t>(st.st_size);
+  if (m_size < sizeof(FileHeader)) {
+    ::close(fd);
+    fail(path, "file too small");
+  }
+  void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid after the descriptor is closed
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    fail(path, std::strerror(errno));
+  }
+  m_data = static_cast<const std::byte*>(addr);
+
+  try {
+    FileHeader header;
+    std::memcpy(&header, m_data, sizeof(FileHeader));
+    if (header.magic != kMagic) {
+      fail(path, "not a mapped track file");
+    }
+    if (header.byteOrderMark != kByteOrderMark) {
+      fail(path, "byte order mismatch");
+    }
+    if (header.version != kVersion) {
+      fail(path, "unsupported version " + std::to_string(header.version));
+    }
+    if (header.headerSize != sizeof(FileHeader) || header.fileSize != m_size) {
+      fail(path, "inconsistent header");
+    }
+    for (std::size_t i = 0; i < kNumSections; ++i) {
+      std::uint64_t offset = header.offsets[i];
+      std::uint64_t count = header.counts[i];
+      if (offset % kSectionAlignment != 0 || offset > m_size ||
+          count > (m_size - offset) / kElementSizes[i]) {
+        fail(path, "section " + std::to_string(i) + " out of bounds");
+      }
+      m_doubles[i] = reinterpret_cast<const double*>(m_data + offset);
+    }
+
+    m_states = {reinterpret_cast<const StateRecord*>(
+                    m_data + header.offsets[index(Section::States)]),
+                header.counts[index(Section::States)]};
+    m_tracks = {reinterpret_cast<const TrackRecord*>(
+                    m_data + header.offsets[index(Section::Tracks)]),
+                header.counts[index(Section::Tracks)]};
+    // Only sections of doubles are accessed through m_doubles
+    m_doubles[index(Section::States)] = nullptr;
+    m_doubles[index(Section::Tracks)] = nullptr;
+
+    m_numPerigees = header.counts[index(Section::Perigees)];
+  } catch (...) {
+    ::munmap(const_cast<std::byte*>(m_data), m_size);
+    throw;
+  }
+}
+
+MappedTrackFile::~MappedTrackFile() {
+  ::munmap(const_cast<std::byte*>(m_data), m_size);
+}
+
+const Surface* MappedTrackFile::surface(std::uint32_t flags,
+                                        std::uint64_t surface) const {
+  if ((flags & HasPerigeeSurface) != 0) {
+    if (surface >= m_numPerigees) {
+      throw std::out_of_range("Perigee surface index out of range");
+    }
+    std::lock_guard lock{m_perigeeMutex};
+    auto& perigee = m_perigees[surface];
+    if (perigee == nullptr) {
+      Transform3 transform;
+      transform.matrix() = Eigen::Map<const SquareMatrix4>(
+          m_doubles[index(Section::Perigees)] + 16 * surface);
+      perigee = Surface::makeShared<PerigeeSurface>(transform);
+    }
+    return perigee.get();
+  }
+  if ((flags & HasGeometrySurface) != 0 && m_cfg.trackingGeometry != nullptr) {
+    return m_cfg.trackingGeometry->findSurface(GeometryIdentifier{surface});
+  }
+  return nullptr;
+}
+
+bool MappedMultiTrajectory::has_impl(HashedString key,
+                                     IndexType istate) const {
+  const StateRecord& state = m_states[istate];
+  switch (key) {
+    case "predicted"_hash:
+      return state.ipredicted != kInvalid;
+    case "filtered"_hash:
+      return state.ifiltered != kInvalid;
+    case "smoothed"_hash:
+      return state.ismoothed != kInvalid;
+    case "calibrated"_hash:
+      return state.measOffset != detail_mtc::kInvalidOffset;
+    case "calibratedCov"_hash:
+      return state.measCovOffset != detail_mtc::kInvalidOffset;
+    case "jacobian"_hash:
+      return state.ijacobian != kInvalid;
+    case "projector"_hash:
+      return (state.flags & HasProjector) != 0;
+    case "uncalibratedSourceLink"_hash:
+      return (state.flags & HasSourceLink) != 0 &&
+             m_file->config().sourceLinkDecoder.connected();
+    case "previous"_hash:
+    case "next"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::any MappedMultiTrajectory::component_impl(HashedString key,
+                                               IndexType istate) const {
+  const StateRecord& state = m_states[istate];
+  switch (key) {
+    case "previous"_hash:
+      return &state.previous;
+    case "next"_hash:
+      return &state.next;
+    case "predicted"_hash:
+      return &state.ipredicted;
+    case "filtered"_hash:
+      return &state.ifiltered;
+    case "smoothed"_hash:
+      return &state.ismoothed;
+    case "projector"_hash:
+      return &state.projector;
+    case "measdim"_hash:
+      return &state.measdim;
+    case "chi2"_hash:
+      return &state.chi2;
+    case "pathLength"_hash:
+      return &state.pathLength;
+    case "typeFlags"_hash:
+      return &state.typeFlags;
+    default:
+      throw std::runtime_error("Unable to handle this component");
+  }
+}
+
+bool MappedMultiTrajectory::hasColumn_impl(HashedString key) const {
+  switch (key) {
+    case "predicted"_hash:
+    case "filtered"_hash:
+    case "smoothed"_hash:
+    case "calibrated"_hash:
+    case "calibratedCov"_hash:
+    case "jacobian"_hash:
+    case "projector"_hash:
+    case "previous"_hash:
+    case "next"_hash:
+    case "uncalibratedSourceLink"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::any MappedTrackContainer::component_impl(HashedString key,
+                                              IndexType itrack) const {
+  const TrackRecord& track = m_tracks[itrack];
+  switch (key) {
+    case "tipIndex"_hash:
+      return &track.tipIndex;
+    case "stemIndex"_hash:
+      return &track.stemIndex;
+    case "nMeasurements"_hash:
+      return &track.nMeasurements;
+    case "nHoles"_hash:
+      return &track.nHoles;
+    case "chi2"_hash:
+      return &track.chi2;
+    case "ndf"_hash:
+      return &track.ndf;
+    case "nOutliers"_hash:
+      return &track.nOutliers;
+    case "nSharedHits"_hash:
+      return &track.nSharedHits;
+    default:
+      throw std::runtime_error("Unable to handle this component");
+  }
+}
+
+bool MappedTrackContainer::hasColumn_impl(HashedString key) const {
+  switch (key) {
+    case "tipIndex"_hash:
+    case "stemIndex"_hash:
+    case "nMeasurements"_hash:
+    case "nHoles"_hash:
+    case "chi2"_hash:
+    case "ndf"_hash:
+    case "nOutliers"_hash:
+    case "nSharedHits"_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace Acts
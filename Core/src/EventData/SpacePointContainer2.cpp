@@ -37,6 +37,13 @@ SpacePointContainer2::SpacePointContainer2(SpacePointColumns columns) noexcept {
   createColumns(columns);
 }
 
+SpacePointContainer2::SpacePointContainer2(
+    SpacePointColumns columns,
+    std::pmr::memory_resource *memoryResource) noexcept
+    : m_memoryResource(memoryResource), m_sourceLinks(memoryResource) {
+  createColumns(columns);
+}
+
 SpacePointContainer2::SpacePointContainer2(
     const SpacePointContainer2 &other) noexcept
     : m_size(other.m_size), m_sourceLinks(other.m_sourceLinks) {
@@ -45,7 +52,9 @@ SpacePointContainer2::SpacePointContainer2(
 
 SpacePointContainer2::SpacePointContainer2(
     SpacePointContainer2 &&other) noexcept
-    : m_size(other.m_size), m_sourceLinks(std::move(other.m_sourceLinks)) {
+    : m_memoryResource(other.m_memoryResource),
+      m_size(other.m_size),
+      m_sourceLinks(std::move(other.m_sourceLinks)) {
   moveColumns(other);
 
   other.m_size = 0;
@@ -87,7 +96,13 @@ void SpacePointContainer2::copyColumns(const SpacePointContainer2 &other) {
       [&]<typename T>(std::string_view name,
                       std::optional<ColumnHolder<T>> &column,
                       const std::optional<ColumnHolder<T>> &otherColumn) {
-        column = otherColumn;
+        if (!otherColumn.has_value()) {
+          column.reset();
+        } else if (column.has_value()) {
+          *column = *otherColumn;
+        } else {
+          column.emplace(*otherColumn, m_memoryResource);
+        }
         if (column.has_value()) {
           m_allColumns.try_emplace(std::string(name), &column.value());
         }
@@ -102,7 +117,8 @@ void SpacePointContainer2::copyColumns(const SpacePointContainer2 &other) {
   m_knownColumns = other.m_knownColumns;
 
   for (auto &[name, column] : other.m_dynamicColumns) {
-    std::unique_ptr<ColumnHolderBase> columnCopy = column->copy();
+    std::unique_ptr<ColumnHolderBase> columnCopy =
+        column->copy(m_memoryResource);
     m_allColumns.try_emplace(name, columnCopy.get());
     m_dynamicColumns.try_emplace(name, std::move(columnCopy));
   }
@@ -116,7 +132,13 @@ void SpacePointContainer2::moveColumns(SpacePointContainer2 &other) noexcept {
       [&]<typename T>(std::string_view name,
                       std::optional<ColumnHolder<T>> &column,
                       std::optional<ColumnHolder<T>> &otherColumn) {
-        column = std::move(otherColumn);
+        if (!otherColumn.has_value()) {
+          column.reset();
+        } else if (column.has_value()) {
+          *column = std::move(*otherColumn);
+        } else {
+          column.emplace(std::move(*otherColumn), m_memoryResource);
+        }
         if (column.has_value()) {
           m_allColumns.try_emplace(std::string(name), &column.value());
         }
@@ -131,6 +153,11 @@ void SpacePointContainer2::moveColumns(SpacePointContainer2 &other) noexcept {
   m_knownColumns = other.m_knownColumns;
 
   for (auto &[name, column] : other.m_dynamicColumns) {
+    // dynamic columns can only be taken over if they use the same memory
+    // resource, otherwise they are copied
+    if (*m_memoryResource != *other.m_memoryResource) {
+      column = column->copy(m_memoryResource);
+    }
     m_allColumns.try_emplace(name, column.get());
     m_dynamicColumns.try_emplace(name, std::move(column));
   }
@@ -224,7 +251,7 @@ void SpacePointContainer2::createColumns(SpacePointColumns columns) noexcept {
       [&]<typename T>(SpacePointColumns mask, std::string_view name,
                       T defaultValue, std::optional<ColumnHolder<T>> &column) {
         if (ACTS_CHECK_BIT(columns, mask) && !column.has_value()) {
-          column = ColumnHolder<T>(std::move(defaultValue));
+          column.emplace(std::move(defaultValue), m_memoryResource);
           column->resize(size());
           m_allColumns.try_emplace(std::string(name), &column.value());
           m_knownColumns = m_knownColumns | mask;
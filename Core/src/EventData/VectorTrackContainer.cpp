@@ -17,6 +17,21 @@ namespace Acts {
 
 namespace detail_vtc {
 
+VectorTrackContainerBase::VectorTrackContainerBase(
+    std::pmr::memory_resource* memoryResource)
+    : m_tipIndex{memoryResource},
+      m_stemIndex{memoryResource},
+      m_particleHypothesis{memoryResource},
+      m_params{memoryResource},
+      m_cov{memoryResource},
+      m_referenceSurfaces{memoryResource},
+      m_nMeasurements{memoryResource},
+      m_nHoles{memoryResource},
+      m_chi2{memoryResource},
+      m_ndf{memoryResource},
+      m_nOutliers{memoryResource},
+      m_nSharedHits{memoryResource} {}
+
 VectorTrackContainerBase::VectorTrackContainerBase(
     const VectorTrackContainerBase& other)
     : m_tipIndex{other.m_tipIndex},
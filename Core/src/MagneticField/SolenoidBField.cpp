@@ -10,6 +10,9 @@
 
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cmath>
 #include <numbers>
 
@@ -21,6 +24,42 @@
 
 namespace Acts {
 
+namespace {
+
+/// Number of lookup positions processed together in the batched lookup
+constexpr std::size_t kBatchBlockSize = 16;
+
+/// Number of arithmetic-geometric mean iterations. Convergence is quadratic,
+/// this is sufficient for double precision down to `1 - k^2 ~ 1e-100`.
+constexpr std::size_t kAgmIterations = 10;
+
+/// Complete elliptic integrals of the first and second kind for the modulus
+/// @p k, computed with the arithmetic-geometric mean. The fixed number of
+/// iterations and the absence of branches allow vectorization over the
+/// callers' loop.
+///
+/// @param k the modulus, equivalent to the argument of boost::math::ellint_1
+/// @param ellint1 the integral of the first kind
+/// @param ellint2 the integral of the second kind
+inline void ellipticIntegrals(double k, double& ellint1, double& ellint2) {
+  double a = 1.;
+  double b = std::sqrt(1. - k * k);
+  double weight = 0.5;
+  double sum = weight * k * k;
+  for (std::size_t i = 0; i < kAgmIterations; ++i) {
+    const double c = 0.5 * (a - b);
+    const double aNext = 0.5 * (a + b);
+    b = std::sqrt(a * b);
+    a = aNext;
+    weight *= 2.;
+    sum += weight * c * c;
+  }
+  ellint1 = std::numbers::pi / (2. * a);
+  ellint2 = ellint1 * (1. - sum);
+}
+
+}  // namespace
+
 SolenoidBField::SolenoidBField(Config config) : m_cfg(config) {
   m_dz = m_cfg.length / m_cfg.nCoils;
   m_R2 = m_cfg.radius * m_cfg.radius;
@@ -55,6 +94,74 @@ Result<Vector3> SolenoidBField::getField(
   return Result<Vector3>::success(getField(position));
 }
 
+Result<void> SolenoidBField::getFields(
+    PositionBatchView positions, FieldBatchView fields,
+    MagneticFieldProvider::Cache& /*cache*/) const {
+  assert(positions.rows() == fields.rows());
+
+  const double R = m_cfg.radius;
+  const double fourPi = 4. * std::numbers::pi;
+  const auto nPositions = static_cast<std::size_t>(positions.rows());
+
+  for (std::size_t start = 0; start < nPositions; start += kBatchBlockSize) {
+    const std::size_t size = std::min(kBatchBlockSize, nPositions - start);
+
+    // unused lanes are padded with on-axis positions
+    std::array<double, kBatchBlockSize> r{};
+    std::array<double, kBatchBlockSize> z{};
+    for (std::size_t lane = 0; lane < size; ++lane) {
+      const auto row = static_cast<Eigen::Index>(start + lane);
+      r[lane] = std::sqrt(positions(row, 0) * positions(row, 0) +
+                          positions(row, 1) * positions(row, 1));
+      z[lane] = positions(row, 2);
+    }
+
+    std::array<double, kBatchBlockSize> bR{};
+    std::array<double, kBatchBlockSize> bZ{};
+    for (std::size_t coil = 0; coil < m_cfg.nCoils; coil++) {
+      const double zShift = m_cfg.length * 0.5 - m_dz * (coil + 0.5);
+      for (std::size_t lane = 0; lane < kBatchBlockSize; ++lane) {
+        // see B_r and B_z for the formulas. On the axis, a dummy radius is
+        // used which keeps k^2 away from 1 and the result is discarded.
+        const bool onAxis = r[lane] == 0.;
+        const double rl = onAxis ? 2. * R : r[lane];
+        const double zl = z[lane] + zShift;
+
+        const double k_2 = 4 * R * rl / ((R + rl) * (R + rl) + zl * zl);
+        const double k = std::sqrt(k_2);
+        double ellint1 = 0.;
+        double ellint2 = 0.;
+        ellipticIntegrals(k_2, ellint1, ellint2);
+
+        const double coilR =
+            m_scale * k * zl / (fourPi * std::sqrt(R * rl * rl * rl)) *
+            ((2. - k_2) / (2. - 2. * k_2) * ellint2 - ellint1);
+        const double coilZ =
+            m_scale * k / (fourPi * std::sqrt(R * rl)) *
+            (((R + rl) * k_2 - 2. * rl) / (2. * rl * (1. - k_2)) * ellint2 +
+             ellint1);
+        const double axisZ =
+            m_scale / 2. * m_R2 /
+            (std::sqrt(m_R2 + zl * zl) * (m_R2 + zl * zl));
+
+        bR[lane] += onAxis ? 0. : coilR;
+        bZ[lane] += onAxis ? axisZ : coilZ;
+      }
+    }
+
+    for (std::size_t lane = 0; lane < size; ++lane) {
+      const auto row = static_cast<Eigen::Index>(start + lane);
+      // add xy field component, radially symmetric
+      const double scaleXY = r[lane] != 0. ? bR[lane] / r[lane] : 0.;
+      fields(row, 0) = positions(row, 0) * scaleXY;
+      fields(row, 1) = positions(row, 1) * scaleXY;
+      fields(row, 2) = bZ[lane];
+    }
+  }
+
+  return Result<void>::success();
+}
+
 Vector2 SolenoidBField::getField(const Vector2& position) const {
   return multiCoilField(position, m_scale);
 }
@@ -58,6 +58,34 @@ void Acts::AccumulatedMaterialSlab::trackAverage(bool useEmptyTrack) {
   m_trackAverage = MaterialSlab();
 }
 
+void Acts::AccumulatedMaterialSlab::merge(
+    const AccumulatedMaterialSlab& other) {
+  m_trackAverage = detail::combineSlabs(m_trackAverage, other.m_trackAverage);
+  if (other.m_totalCount == 0u) {
+    return;
+  }
+  if (m_totalCount == 0u) {
+    m_totalAverage = other.m_totalAverage;
+    m_totalVariance = other.m_totalVariance;
+    m_totalCount = other.m_totalCount;
+    return;
+  }
+  double totalCount = m_totalCount + other.m_totalCount;
+  double weightThis = m_totalCount / totalCount;
+  double weightOther = other.m_totalCount / totalCount;
+  // average such that each track of both stores contributes equally.
+  MaterialSlab fromThis(m_totalAverage.material(),
+                        static_cast<float>(weightThis *
+                                           m_totalAverage.thickness()));
+  MaterialSlab fromOther(other.m_totalAverage.material(),
+                         static_cast<float>(weightOther *
+                                            other.m_totalAverage.thickness()));
+  m_totalAverage = detail::combineSlabs(fromThis, fromOther);
+  m_totalVariance = static_cast<float>(weightThis * m_totalVariance +
+                                       weightOther * other.m_totalVariance);
+  m_totalCount += other.m_totalCount;
+}
+
 std::pair<Acts::MaterialSlab, unsigned int>
 Acts::AccumulatedMaterialSlab::totalAverage() const {
   return {m_totalAverage, m_totalCount};
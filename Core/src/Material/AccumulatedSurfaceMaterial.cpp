@@ -12,6 +12,7 @@
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Utilities/ProtoAxisHelpers.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -130,6 +131,38 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+std::array<std::size_t, 3> Acts::AccumulatedSurfaceMaterial::binTriple(
+    const Vector3& gp) const {
+  if (m_binUtility.dimensions() == 0) {
+    return {0, 0, 0};
+  }
+  return m_binUtility.binTriple(gp);
+}
+
+void Acts::AccumulatedSurfaceMaterial::merge(
+    std::size_t bin0, std::size_t bin1, const AccumulatedMaterialSlab& slab) {
+  m_accumulatedMaterial.at(bin1).at(bin0).merge(slab);
+}
+
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  if (other.m_accumulatedMaterial.size() != m_accumulatedMaterial.size()) {
+    throw std::invalid_argument(
+        "Accumulated material can only be merged with identical binning.");
+  }
+  for (std::size_t ib1 = 0; ib1 < m_accumulatedMaterial.size(); ++ib1) {
+    auto& matVec = m_accumulatedMaterial[ib1];
+    const auto& otherVec = other.m_accumulatedMaterial[ib1];
+    if (otherVec.size() != matVec.size()) {
+      throw std::invalid_argument(
+          "Accumulated material can only be merged with identical binning.");
+    }
+    for (std::size_t ib0 = 0; ib0 < matVec.size(); ++ib0) {
+      matVec[ib0].merge(otherVec[ib0]);
+    }
+  }
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
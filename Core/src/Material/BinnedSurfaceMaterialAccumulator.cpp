@@ -85,11 +85,55 @@ Acts::BinnedSurfaceMaterialAccumulator::createState(
   return state;
 }
 
+std::unique_ptr<Acts::ISurfaceMaterialAccumulator::State>
+Acts::BinnedSurfaceMaterialAccumulator::createPartialState(
+    const ISurfaceMaterialAccumulator::State& state) const {
+  const State* cState = dynamic_cast<const State*>(&state);
+  if (cState == nullptr) {
+    throw std::invalid_argument(
+        "Partial states can only be created from a full state.");
+  }
+  auto pState = std::make_unique<PartialState>();
+  pState->fullState = cState;
+  return pState;
+}
+
+void Acts::BinnedSurfaceMaterialAccumulator::mergeState(
+    ISurfaceMaterialAccumulator::State& state,
+    ISurfaceMaterialAccumulator::State& partialState) const {
+  State* cState = dynamic_cast<State*>(&state);
+  PartialState* pState = dynamic_cast<PartialState*>(&partialState);
+  if (cState == nullptr || pState == nullptr) {
+    throw std::invalid_argument(
+        "Invalid state objects provided, can only merge a partial state into "
+        "a full state.");
+  }
+  if (pState->fullState != cState) {
+    throw std::invalid_argument(
+        "Partial state has been created from a different full state.");
+  }
+
+  // The maps are ordered, the merge sequence is hence reproducible
+  for (const auto& [geoID, bins] : pState->accumulatedMaterial) {
+    auto& accMaterial = cState->accumulatedMaterial.at(geoID);
+    for (const auto& [bin, slab] : bins) {
+      accMaterial.merge(bin[0], bin[1], slab);
+    }
+  }
+  pState->accumulatedMaterial.clear();
+}
+
 void Acts::BinnedSurfaceMaterialAccumulator::accumulate(
     ISurfaceMaterialAccumulator::State& state, const GeometryContext& /*gctx*/,
     const std::vector<MaterialInteraction>& interactions,
     const std::vector<IAssignmentFinder::SurfaceAssignment>&
         surfacesWithoutAssignment) const {
+  // Partial states are filled sparsely, the full state is only read
+  if (auto pState = dynamic_cast<PartialState*>(&state); pState != nullptr) {
+    accumulatePartial(*pState, interactions, surfacesWithoutAssignment);
+    return;
+  }
+
   // Cast into the right state object (guaranteed by upstream algorithm)
   State* cState = static_cast<State*>(&state);
   if (cState == nullptr) {
@@ -142,6 +186,57 @@ void Acts::BinnedSurfaceMaterialAccumulator::accumulate(
   }
 }
 
+void Acts::BinnedSurfaceMaterialAccumulator::accumulatePartial(
+    PartialState& pState, const std::vector<MaterialInteraction>& interactions,
+    const std::vector<IAssignmentFinder::SurfaceAssignment>&
+        surfacesWithoutAssignment) const {
+  if (pState.fullState == nullptr) {
+    throw std::invalid_argument(
+        "Partial state is not attached to a full state, something is "
+        "seriously wrong.");
+  }
+
+  // Only the binning is read from the full state, which allows other threads
+  // to merge into it concurrently
+  const auto& fullMaterial = pState.fullState->accumulatedMaterial;
+  auto findBinning = [&](const GeometryIdentifier& geoID)
+      -> const AccumulatedSurfaceMaterial& {
+    auto accMaterial = fullMaterial.find(geoID);
+    if (accMaterial == fullMaterial.end()) {
+      throw std::invalid_argument(
+          "Surface material is not found, inconsistent configuration.");
+    }
+    return accMaterial->second;
+  };
+
+  // Same bookkeeping as for the full state: one touched bin per surface
+  std::map<GeometryIdentifier, AccumulatedMaterialSlab*> touchedSlabs;
+
+  // Assign the hits
+  for (const auto& mi : interactions) {
+    GeometryIdentifier geoID = mi.surface->geometryId();
+    auto tBin = findBinning(geoID).binTriple(mi.intersection);
+    auto& slab = pState.accumulatedMaterial[geoID][{tBin[0], tBin[1]}];
+    slab.accumulate(mi.materialSlab, mi.pathCorrection);
+    touchedSlabs.try_emplace(geoID, &slab);
+  }
+
+  // After mapping this track, average the touched bins
+  for (const auto& [geoID, slab] : touchedSlabs) {
+    slab->trackAverage(true);
+  }
+
+  // Empty bin correction
+  if (m_cfg.emptyBinCorrection) {
+    for (const auto& [surface, position, direction] :
+         surfacesWithoutAssignment) {
+      GeometryIdentifier geoID = surface->geometryId();
+      auto tBin = findBinning(geoID).binTriple(position);
+      pState.accumulatedMaterial[geoID][{tBin[0], tBin[1]}].trackAverage(true);
+    }
+  }
+}
+
 std::map<Acts::GeometryIdentifier,
          std::shared_ptr<const Acts::ISurfaceMaterial>>
 Acts::BinnedSurfaceMaterialAccumulator::finalizeMaterial(
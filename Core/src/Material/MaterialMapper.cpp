@@ -30,6 +30,22 @@ std::unique_ptr<Acts::MaterialMapper::State> Acts::MaterialMapper::createState(
   return state;
 }
 
+std::unique_ptr<Acts::MaterialMapper::State>
+Acts::MaterialMapper::createPartialState(const State& state) const {
+  auto partialState = std::make_unique<State>();
+  partialState->surfaceMaterialAccumulatorState =
+      m_cfg.surfaceMaterialAccumulator->createPartialState(
+          *state.surfaceMaterialAccumulatorState);
+  return partialState;
+}
+
+void Acts::MaterialMapper::mergeState(State& state,
+                                      State& partialState) const {
+  m_cfg.surfaceMaterialAccumulator->mergeState(
+      *state.surfaceMaterialAccumulatorState,
+      *partialState.surfaceMaterialAccumulatorState);
+}
+
 std::pair<Acts::RecordedMaterialTrack, Acts::RecordedMaterialTrack>
 Acts::MaterialMapper::mapMaterial(State& state, const GeometryContext& gctx,
                                   const MagneticFieldContext& mctx,
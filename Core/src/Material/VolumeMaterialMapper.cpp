@@ -250,28 +250,9 @@ void VolumeMaterialMapper::createExtraHits(
   for (int extraStep = 0; extraStep < volumeStep; extraStep++) {
     Vector3 extraPosition = position + extraStep * direction;
     // Create additional extrapolated points for the grid mapping
-
-    if (currentBinning.second.dimensions() == 2) {
-      auto grid = mState.grid2D.find(currentBinning.first);
-      if (grid != mState.grid2D.end()) {
-        // Find which grid bin the material fall into then accumulate
-        Grid2D::index_t index = grid->second.localBinsFromLowerLeftEdge(
-            mState.transform2D[currentBinning.first](extraPosition));
-        grid->second.atLocalBins(index).accumulate(properties);
-      } else {
-        throw std::domain_error("No grid 2D was found");
-      }
-    } else if (currentBinning.second.dimensions() == 3) {
-      auto grid = mState.grid3D.find(currentBinning.first);
-      if (grid != mState.grid3D.end()) {
-        // Find which grid bin the material fall into then accumulate
-        Grid3D::index_t index = grid->second.localBinsFromLowerLeftEdge(
-            mState.transform3D[currentBinning.first](extraPosition));
-        grid->second.atLocalBins(index).accumulate(properties);
-      } else {
-        throw std::domain_error("No grid 3D was found");
-      }
-    }
+    accumulateGridHit(mState, currentBinning.first,
+                      currentBinning.second.dimensions(), properties,
+                      extraPosition);
   }
 
   if (remainder > 0) {
@@ -279,28 +260,86 @@ void VolumeMaterialMapper::createExtraHits(
     // the thickness of the last extrapolated step
     properties.scaleThickness(remainder / properties.thickness());
     Vector3 extraPosition = position + volumeStep * direction;
-    if (currentBinning.second.dimensions() == 2) {
-      auto grid = mState.grid2D.find(currentBinning.first);
-      if (grid != mState.grid2D.end()) {
-        // Find which grid bin the material fall into then accumulate
-        Grid2D::index_t index = grid->second.localBinsFromLowerLeftEdge(
-            mState.transform2D[currentBinning.first](extraPosition));
-        grid->second.atLocalBins(index).accumulate(properties);
-      } else {
-        throw std::domain_error("No grid 2D was found");
-      }
-    } else if (currentBinning.second.dimensions() == 3) {
-      auto grid = mState.grid3D.find(currentBinning.first);
-      if (grid != mState.grid3D.end()) {
-        // Find which grid bin the material fall into then accumulate
-        Grid3D::index_t index = grid->second.localBinsFromLowerLeftEdge(
-            mState.transform3D[currentBinning.first](extraPosition));
-        grid->second.atLocalBins(index).accumulate(properties);
-      } else {
-        throw std::domain_error("No grid 3D was found");
+    accumulateGridHit(mState, currentBinning.first,
+                      currentBinning.second.dimensions(), properties,
+                      extraPosition);
+  }
+}
+
+void VolumeMaterialMapper::accumulateGridHit(State& mState,
+                                             const GeometryIdentifier& geoID,
+                                             std::size_t dimensions,
+                                             const MaterialSlab& properties,
+                                             const Vector3& position) const {
+  // Partial states only read the grids of the full state
+  const State& layout =
+      (mState.fullState != nullptr) ? *mState.fullState : mState;
+  // Find which grid bin the material falls into
+  std::size_t globalBin = 0;
+  if (dimensions == 2) {
+    auto grid = layout.grid2D.find(geoID);
+    if (grid == layout.grid2D.end()) {
+      throw std::domain_error("No grid 2D was found");
+    }
+    globalBin = grid->second.globalBinFromFromLowerLeftEdge(
+        layout.transform2D.at(geoID)(position));
+  } else if (dimensions == 3) {
+    auto grid = layout.grid3D.find(geoID);
+    if (grid == layout.grid3D.end()) {
+      throw std::domain_error("No grid 3D was found");
+    }
+    globalBin = grid->second.globalBinFromFromLowerLeftEdge(
+        layout.transform3D.at(geoID)(position));
+  } else {
+    return;
+  }
+  // Then accumulate
+  if (mState.fullState != nullptr) {
+    mState.partialGrid[geoID][globalBin].accumulate(properties);
+  } else if (dimensions == 2) {
+    mState.grid2D.at(geoID).at(globalBin).accumulate(properties);
+  } else {
+    mState.grid3D.at(geoID).at(globalBin).accumulate(properties);
+  }
+}
+
+VolumeMaterialMapper::State VolumeMaterialMapper::createPartialState(
+    const State& mState) const {
+  if (mState.fullState != nullptr) {
+    throw std::invalid_argument(
+        "Partial states can only be created from a full state.");
+  }
+  State partialState(mState.geoContext, mState.magFieldContext);
+  partialState.fullState = &mState;
+  // The binning is needed to steer the mapping, the grids are read from the
+  // full state
+  partialState.materialBin = mState.materialBin;
+  return partialState;
+}
+
+void VolumeMaterialMapper::mergeState(State& mState,
+                                      State& partialState) const {
+  if (partialState.fullState != &mState) {
+    throw std::invalid_argument(
+        "Partial state has been created from a different state.");
+  }
+  // The maps are ordered, the merge sequence is hence reproducible
+  for (const auto& [geoID, accMaterial] : partialState.homogeneousGrid) {
+    mState.homogeneousGrid[geoID].merge(accMaterial);
+  }
+  for (const auto& [geoID, bins] : partialState.partialGrid) {
+    auto grid2D = mState.grid2D.find(geoID);
+    auto grid3D = mState.grid3D.find(geoID);
+    for (const auto& [globalBin, accMaterial] : bins) {
+      if (grid2D != mState.grid2D.end()) {
+        grid2D->second.at(globalBin).merge(accMaterial);
+      } else if (grid3D != mState.grid3D.end()) {
+        grid3D->second.at(globalBin).merge(accMaterial);
       }
     }
   }
+  partialState.homogeneousGrid.clear();
+  partialState.partialGrid.clear();
 }
 
 void VolumeMaterialMapper::finalizeMaps(State& mState) const {
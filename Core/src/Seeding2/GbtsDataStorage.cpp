@@ -25,17 +25,18 @@ GbtsEtaBin::GbtsEtaBin() {
   vNumEdges.reserve(1000);
 }
 
-void GbtsEtaBin::sortByPhi() {
+void GbtsEtaBin::sortByPhi(std::span<const GbtsNode> nodes) {
   // TODO config
-  std::array<std::vector<std::pair<float, const GbtsNode*>>, 32> phiBuckets;
+  std::array<std::vector<std::pair<float, std::uint32_t>>, 32> phiBuckets;
 
   // TODO config
   const std::uint32_t nBuckets = 31;
 
-  for (const GbtsNode* n : vn) {
+  for (const std::uint32_t nIdx : vn) {
+    const float phi = nodes[nIdx].phi;
     const auto bIdx = static_cast<std::uint32_t>(
-        0.5 * nBuckets * (n->phi / std::numbers::pi_v<float> + 1.0f));
-    phiBuckets[bIdx].emplace_back(n->phi, n);
+        0.5 * nBuckets * (phi / std::numbers::pi_v<float> + 1.0f));
+    phiBuckets[bIdx].emplace_back(phi, nIdx);
   }
 
   for (auto& b : phiBuckets) {
@@ -51,7 +52,7 @@ void GbtsEtaBin::sortByPhi() {
   }
 }
 
-void GbtsEtaBin::initializeNodes() {
+void GbtsEtaBin::initializeNodes(std::span<const GbtsNode> nodes) {
   if (vn.empty()) {
     return;
   }
@@ -62,15 +63,15 @@ void GbtsEtaBin::initializeNodes() {
   vNumEdges.resize(vn.size(), 0);
   vIsConnected.resize(vn.size(), 0);
 
-  std::ranges::transform(
-      vn.begin(), vn.end(), params.begin(), [](const GbtsNode* pN) {
-        return std::array<float, 5>{-100.0, 100.0, pN->phi, pN->r, pN->z};
-      });
+  std::ranges::transform(vn, params.begin(), [&](std::uint32_t nIdx) {
+    const GbtsNode& n = nodes[nIdx];
+    return std::array<float, 5>{-100.0, 100.0, n.phi, n.r, n.z};
+  });
 
   const auto [minIter, maxIter] = std::ranges::minmax_element(
-      vn, {}, [](const GbtsNode* s) { return s->r; });
-  minRadius = (*minIter)->r;
-  maxRadius = (*maxIter)->r;
+      vn, {}, [&](std::uint32_t nIdx) { return nodes[nIdx].r; });
+  minRadius = nodes[*minIter].r;
+  maxRadius = nodes[*maxIter].r;
 }
 
 void GbtsEtaBin::generatePhiIndexing(float dphi) {
@@ -97,21 +98,26 @@ void GbtsEtaBin::generatePhiIndexing(float dphi) {
 }
 
 GbtsNodeStorage::GbtsNodeStorage(std::shared_ptr<const GbtsGeometry> geometry,
-                                 GbtsMlLookupTable mlLut)
-    : m_geometry(std::move(geometry)), m_mlLut(std::move(mlLut)) {
+                                 GbtsMlLookupTable mlLut,
+                                 std::span<const GbtsNode> nodes)
+    : m_geometry(std::move(geometry)),
+      m_mlLut(std::move(mlLut)),
+      m_nodes(nodes) {
   m_etaBins.resize(m_geometry->numBins());
 }
 
 std::uint32_t GbtsNodeStorage::loadPixelGraphNodes(
-    const std::uint16_t layerIndex, const std::span<const GbtsNode> coll,
-    const bool useMl, const float maxEndcapClusterWidth) {
+    const std::uint16_t layerIndex, const std::uint32_t begin,
+    const std::uint32_t end, const bool useMl,
+    const float maxEndcapClusterWidth) {
   std::uint32_t nLoaded = 0;
 
   const GbtsLayer& pL = m_geometry->layerByIndex(layerIndex);
 
   const bool isBarrel = pL.layerDescription().type == GbtsLayerType::Barrel;
 
-  for (const GbtsNode& node : coll) {
+  for (std::uint32_t nIdx = begin; nIdx < end; ++nIdx) {
+    const GbtsNode& node = m_nodes[nIdx];
     const std::int32_t binIndex = pL.getEtaBin(node.z, node.r);
 
     if (binIndex == -1) {
@@ -119,7 +125,7 @@ std::uint32_t GbtsNodeStorage::loadPixelGraphNodes(
     }
 
     if (isBarrel) {
-      m_etaBins.at(binIndex).vn.push_back(&node);
+      m_etaBins.at(binIndex).vn.push_back(nIdx);
     } else {
       if (useMl) {
         const float clusterWidth = node.pcw;
@@ -127,7 +133,7 @@ std::uint32_t GbtsNodeStorage::loadPixelGraphNodes(
           continue;
         }
       }
-      m_etaBins.at(binIndex).vn.push_back(&node);
+      m_etaBins.at(binIndex).vn.push_back(nIdx);
     }
 
     nLoaded++;
@@ -137,19 +143,21 @@ std::uint32_t GbtsNodeStorage::loadPixelGraphNodes(
 }
 
 std::uint32_t GbtsNodeStorage::loadStripGraphNodes(
-    const std::uint16_t layerIndex, const std::span<const GbtsNode> coll) {
+    const std::uint16_t layerIndex, const std::uint32_t begin,
+    const std::uint32_t end) {
   std::uint32_t nLoaded = 0;
 
   const GbtsLayer& pL = m_geometry->layerByIndex(layerIndex);
 
-  for (const GbtsNode& node : coll) {
+  for (std::uint32_t nIdx = begin; nIdx < end; ++nIdx) {
+    const GbtsNode& node = m_nodes[nIdx];
     const std::int32_t binIndex = pL.getEtaBin(node.z, node.r);
 
     if (binIndex == -1) {
       continue;
     }
 
-    m_etaBins.at(binIndex).vn.push_back(&node);
+    m_etaBins.at(binIndex).vn.push_back(nIdx);
     nLoaded++;
   }
 
@@ -167,15 +175,15 @@ std::uint32_t GbtsNodeStorage::numberOfNodes() const {
 
 void GbtsNodeStorage::sortByPhi() {
   for (GbtsEtaBin& b : m_etaBins) {
-    b.sortByPhi();
+    b.sortByPhi(m_nodes);
   }
 }
 
 void GbtsNodeStorage::initializeNodes(const bool useMl) {
   for (GbtsEtaBin& b : m_etaBins) {
-    b.initializeNodes();
+    b.initializeNodes(m_nodes);
     if (!b.vn.empty()) {
-      b.layerId = m_geometry->layerIdByIndex((b.vn.front())->layer);
+      b.layerId = m_geometry->layerIdByIndex(m_nodes[b.vn.front()].layer);
     }
   }
 
@@ -214,8 +222,9 @@ void GbtsNodeStorage::initializeNodes(const bool useMl) {
       }
 
       for (std::uint32_t nIdx = 0; nIdx < B.vn.size(); ++nIdx) {
-        const float clusterWidth = B.vn[nIdx]->pcw;
-        const float locPosY = B.vn[nIdx]->locPosY;
+        const GbtsNode& node = m_nodes[B.vn[nIdx]];
+        const float clusterWidth = node.pcw;
+        const float locPosY = node.locPosY;
 
         // lut bin width is 0.05 mm, check if this is actually what we want with
         // float conversion
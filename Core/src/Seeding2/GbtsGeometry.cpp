@@ -466,6 +466,7 @@ GbtsGeometry::GbtsGeometry(
   // 3. Refill binGroups with staged bin pair collections.
 
   m_binGroups.clear();
+  m_binGroupStages.assign(1, 0);
 
   // number of stages:
   const std::size_t nStages = stageOffsets.size() - 1;
@@ -489,6 +490,10 @@ GbtsGeometry::GbtsGeometry(
       // store the group
       m_binGroups.emplace_back(bin1Idx, std::vector<std::uint32_t>(bin2List));
     }
+
+    if (m_binGroups.size() > m_binGroupStages.back()) {
+      m_binGroupStages.push_back(m_binGroups.size());
+    }
   }
 }
 
@@ -10,18 +10,51 @@
 
 #include "Acts/Seeding2/GbtsTrackingFilter.hpp"
 #include "Acts/Utilities/MathHelpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <memory>
 #include <numbers>
+#include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
 namespace Acts::Experimental {
 
+namespace {
+
+using GbtsBinGroup = std::pair<std::uint32_t, std::vector<std::uint32_t>>;
+
+/// Connection of a new edge to an incoming edge of its n2 node
+struct EdgeLink {
+  /// global index of the incoming edge of n2
+  std::uint32_t inEdge{};
+  /// index of the new edge in its bin group
+  std::uint32_t outEdge{};
+  /// index of n1 in its eta bin
+  std::uint32_t n1Idx{};
+  /// z0 histogram bin of the new edge
+  std::uint32_t z0Bin{};
+};
+
+/// Edges created for the n1 nodes of one bin group before they are merged
+/// into the edge storage. Edges are referenced by index only.
+struct BinGroupEdges {
+  /// new edges in creation order, if they are not created in the edge storage
+  std::vector<GbtsEdge> edges;
+  /// first new edge of each n1 node, followed by the total number of edges
+  std::vector<std::uint32_t> firstEdge;
+  /// connections of the new edges in creation order
+  std::vector<EdgeLink> links;
+};
+
+}  // namespace
+
 GraphBasedTrackSeeder::DerivedConfig::DerivedConfig(const Config& config)
     : Config(config) {
   phiSliceWidth = 2 * std::numbers::pi_v<float> / config.nMaxPhiSlice;
@@ -47,17 +80,20 @@ void GraphBasedTrackSeeder::createSeeds(const SpacePointContainer2& spacePoints,
                                         const GbtsTrackingFilter& filter,
                                         const Options& options,
                                         SeedContainer2& outputSeeds) const {
-  GbtsNodeStorage nodeStorage(m_geometry, m_mlLut);
+  std::vector<std::uint32_t> layerOffsets;
+  const std::vector<GbtsNode> allNodes =
+      createNodes(spacePoints, maxLayers, layerOffsets);
+
+  GbtsNodeStorage nodeStorage(m_geometry, m_mlLut, allNodes);
 
-  std::vector<std::vector<GbtsNode>> nodesPerLayer =
-      createNodes(spacePoints, maxLayers);
   std::uint32_t nPixelLoaded = 0;
   std::uint32_t nStripLoaded = 0;
 
-  for (std::uint16_t l = 0; l < nodesPerLayer.size(); l++) {
-    const std::vector<GbtsNode>& nodes = nodesPerLayer[l];
+  for (std::uint16_t l = 0; l < maxLayers; l++) {
+    const std::uint32_t begin = layerOffsets[l];
+    const std::uint32_t end = layerOffsets[l + 1];
 
-    if (nodes.empty()) {
+    if (begin == end) {
       continue;
     }
 
@@ -65,9 +101,9 @@ void GraphBasedTrackSeeder::createSeeds(const SpacePointContainer2& spacePoints,
     // placeholder for now until strip hits are added in
     if (isPixel) {
       nPixelLoaded += nodeStorage.loadPixelGraphNodes(
-          l, nodes, m_cfg.useMl, m_cfg.maxEndcapClusterWidth);
+          l, begin, end, m_cfg.useMl, m_cfg.maxEndcapClusterWidth);
     } else {
-      nStripLoaded += nodeStorage.loadStripGraphNodes(l, nodes);
+      nStripLoaded += nodeStorage.loadStripGraphNodes(l, begin, end);
     }
   }
   ACTS_DEBUG("Loaded " << nPixelLoaded << " pixel space points and "
@@ -97,7 +133,7 @@ void GraphBasedTrackSeeder::createSeeds(const SpacePointContainer2& spacePoints,
 
   std::vector<OutputSeedProperties> vOutputSeeds;
   extractSeedsFromTheGraph(maxLevel, graphStats.first, spacePoints.size(),
-                           edgeStorage, vOutputSeeds, filter);
+                           allNodes, edgeStorage, vOutputSeeds, filter);
 
   ACTS_DEBUG("GBTS created " << vOutputSeeds.size() << " seeds");
   if (vOutputSeeds.empty()) {
@@ -146,18 +182,25 @@ GbtsMlLookupTable GraphBasedTrackSeeder::parseGbtsMlLookupTable(
   return mlLut;
 }
 
-std::vector<std::vector<GbtsNode>> GraphBasedTrackSeeder::createNodes(
-    const SpacePointContainer2& spacePoints,
-    const std::uint32_t maxLayers) const {
+std::vector<GbtsNode> GraphBasedTrackSeeder::createNodes(
+    const SpacePointContainer2& spacePoints, const std::uint32_t maxLayers,
+    std::vector<std::uint32_t>& layerOffsets) const {
   auto layerColumn = spacePoints.column<std::uint32_t>("layerId");
   auto clusterWidthColumn = spacePoints.column<float>("clusterWidth");
   auto localPositionColumn = spacePoints.column<float>("localPositionY");
 
-  std::vector<std::vector<GbtsNode>> nodesPerLayer(maxLayers);
-  // reserve for better efficiency
-  for (auto& v : nodesPerLayer) {
-    v.reserve(10000);
+  // count the space points per layer to place all layers in one vector
+  layerOffsets.assign(maxLayers + 1, 0);
+  for (const auto& sp : spacePoints) {
+    const std::uint16_t layer = sp.extra(layerColumn);
+    ++layerOffsets[layer + 1];
   }
+  std::partial_sum(layerOffsets.begin(), layerOffsets.end(),
+                   layerOffsets.begin());
+
+  std::vector<GbtsNode> nodes(spacePoints.size(), GbtsNode(0));
+  std::vector<std::uint32_t> nextNode(layerOffsets.begin(),
+                                      layerOffsets.end() - 1);
 
   for (const auto& sp : spacePoints) {
     // for every sp in container,
@@ -165,10 +208,11 @@ std::vector<std::vector<GbtsNode>> GraphBasedTrackSeeder::createNodes(
     const std::uint16_t layer = sp.extra(layerColumn);
 
     // add node to storage
-    GbtsNode& node = nodesPerLayer[layer].emplace_back(layer);
+    GbtsNode& node = nodes[nextNode[layer]++];
 
     // fill the node with space point variables
 
+    node.layer = layer;
     node.x = sp.x();
     node.y = sp.y();
     node.z = sp.z();
@@ -179,7 +223,7 @@ std::vector<std::vector<GbtsNode>> GraphBasedTrackSeeder::createNodes(
     node.locPosY = sp.extra(localPositionColumn);
   }
 
-  return nodesPerLayer;
+  return nodes;
 }
 
 std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
@@ -239,14 +283,31 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
   const std::uint32_t zBins = 16;
   const float z0HistoCoeff = zBins / (maxZ0 - minZ0 + 1e-6);
 
-  // loop over bin groups
-  for (const auto& bg : m_geometry->binGroups()) {
-    GbtsEtaBin& B1 = nodeStorage.getEtaBin(bg.first);
+  // a single thread creates the edges directly in the edge storage
+  const bool inStorage = m_cfg.numThreads <= 1;
 
-    if (B1.empty()) {
-      continue;
+  const std::span<const GbtsNode> nodes = nodeStorage.nodes();
+
+  // creates the edges of a bin group: a single n1 bin and multiple n2 bins.
+  // Only the edges of earlier stages are read, the new edges are appended to
+  // newEdges and their connections are kept in the bin group buffer. The
+  // cut values are captured by value so that they stay in registers.
+  auto createEdges = [=, this, &nodeStorage, &edgeStorage, &nEdges](
+                         const GbtsBinGroup& bg,
+                         std::vector<GbtsEdge>& newEdges, BinGroupEdges& out) {
+    out.firstEdge.clear();
+    out.links.clear();
+
+    const GbtsEtaBin& B1 = nodeStorage.getEtaBin(bg.first);
+
+    // no more edges are kept once the maximum is reached
+    if (B1.empty() || nEdges >= m_cfg.nMaxEdges) {
+      out.firstEdge.assign(B1.vn.size() + 1, 0);
+      return;
     }
 
+    const std::size_t edgeOffset = newEdges.size();
+
     const float rb1 = B1.minRadius;
 
     const std::uint32_t layerId1 = B1.layerId;
@@ -295,17 +356,11 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
       ++winIdx;
     }
 
+    out.firstEdge.reserve(B1.vn.size() + 1);
+
     // in GBTSv3 the outer loop goes over n1 nodes in the Layer 1 bin
     for (std::uint32_t n1Idx = 0; n1Idx < B1.vn.size(); ++n1Idx) {
-      // initialization using the top watermark of the edge storage
-      B1.vFirstEdge[n1Idx] = nEdges;
-
-      // the counter for the incoming graph edges created for n1
-      std::uint16_t numCreatedEdges = 0;
-
-      bool isConnected = false;
-
-      std::array<std::uint8_t, 16> z0Histo = {};
+      out.firstEdge.push_back(newEdges.size() - edgeOffset);
 
       const std::array<float, 5>& n1pars = B1.params[n1Idx];
 
@@ -458,127 +513,188 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
           const float dPhi2 = curv * r2;
           const float dPhi1 = curv * r1;
 
-          if (nEdges < m_cfg.nMaxEdges) {
-            edgeStorage.emplace_back(B1.vn[n1Idx], B2.vn[n2Idx], expEta, curv,
-                                     phi1 + dPhi1);
-
-            ++numCreatedEdges;
+          newEdges.emplace_back(B1.vn[n1Idx], B2.vn[n2Idx], expEta, curv,
+                                phi1 + dPhi1);
 
-            const std::uint32_t outEdgeIdx = nEdges;
+          const std::uint32_t outEdgeIdx = newEdges.size() - edgeOffset - 1;
 
-            const float uat2 = 1.f / expEta;
-            const float phi2u = phi2 + dPhi2;
-            const float curv2 = curv;
+          const float uat2 = 1.f / expEta;
+          const float phi2u = phi2 + dPhi2;
+          const float curv2 = curv;
 
-            // looking for neighbours of the new edge
-            for (std::uint32_t inEdgeIdx = n2FirstEdge; inEdgeIdx < n2LastEdge;
-                 ++inEdgeIdx) {
-              GbtsEdge* pS = &(edgeStorage.at(inEdgeIdx));
+          // looking for neighbours of the new edge
+          for (std::uint32_t inEdgeIdx = n2FirstEdge; inEdgeIdx < n2LastEdge;
+               ++inEdgeIdx) {
+            const GbtsEdge* pS = &(edgeStorage.at(inEdgeIdx));
 
-              if (pS->nNei >= gbtsNumSegConns) {
-                continue;
-              }
+            // edges of this stage may still be connected to pS, the final
+            // check is done when merging
+            if (pS->nNei >= gbtsNumSegConns) {
+              continue;
+            }
 
-              const std::uint32_t lk3 =
-                  m_geometry->layerIdByIndex(pS->n2->layer);
+            const std::uint32_t lk3 =
+                m_geometry->layerIdByIndex(nodes[pS->n2].layer);
 
-              const bool isBarrel3 = (lk3 / 10000) == 8;
+            const bool isBarrel3 = (lk3 / 10000) == 8;
 
-              const float absTauRatio = std::abs(pS->p[0] * uat2 - 1.0f);
-              float addTauRatioCorr = 0;
+            const float absTauRatio = std::abs(pS->p[0] * uat2 - 1.0f);
+            float addTauRatioCorr = 0;
 
-              if (m_cfg.useAdaptiveCuts) {
-                if (isBarrel1 && isBarrel2 && isBarrel3) {
-                  const bool noGap =
-                      ((lk3 - lk2) == 1000) && ((lk2 - layerId1) == 1000);
+            if (m_cfg.useAdaptiveCuts) {
+              if (isBarrel1 && isBarrel2 && isBarrel3) {
+                const bool noGap =
+                    ((lk3 - lk2) == 1000) && ((lk2 - layerId1) == 1000);
 
-                  // assume more scattering due to the layer in between
-                  if (!noGap) {
-                    addTauRatioCorr = m_cfg.tauRatioCorr;
-                  }
-                } else {
-                  bool mixedTriplet = isBarrel1 && isBarrel2 && !isBarrel3;
-                  if (mixedTriplet) {
-                    addTauRatioCorr = m_cfg.tauRatioCorr;
-                  }
+                // assume more scattering due to the layer in between
+                if (!noGap) {
+                  addTauRatioCorr = m_cfg.tauRatioCorr;
+                }
+              } else {
+                bool mixedTriplet = isBarrel1 && isBarrel2 && !isBarrel3;
+                if (mixedTriplet) {
+                  addTauRatioCorr = m_cfg.tauRatioCorr;
                 }
               }
-              // bad match
-              if (absTauRatio > cutTauRatioMax + addTauRatioCorr) {
-                continue;
-              }
+            }
+            // bad match
+            if (absTauRatio > cutTauRatioMax + addTauRatioCorr) {
+              continue;
+            }
 
-              float dPhi = phi2u - pS->p[2];
+            float dPhi = phi2u - pS->p[2];
 
-              if (dPhi < -std::numbers::pi_v<float>) {
-                dPhi += 2 * std::numbers::pi_v<float>;
-              } else if (dPhi > std::numbers::pi_v<float>) {
-                dPhi -= 2 * std::numbers::pi_v<float>;
-              }
+            if (dPhi < -std::numbers::pi_v<float>) {
+              dPhi += 2 * std::numbers::pi_v<float>;
+            } else if (dPhi > std::numbers::pi_v<float>) {
+              dPhi -= 2 * std::numbers::pi_v<float>;
+            }
 
-              if (std::abs(dPhi) > cutDPhiMax) {
-                continue;
-              }
+            if (std::abs(dPhi) > cutDPhiMax) {
+              continue;
+            }
 
-              const float dcurv = curv2 - pS->p[1];
+            const float dcurv = curv2 - pS->p[1];
 
-              if (dcurv < -cutDCurvMax || dcurv > cutDCurvMax) {
-                continue;
-              }
+            if (dcurv < -cutDCurvMax || dcurv > cutDCurvMax) {
+              continue;
+            }
 
-              // final check: cuts on pT and d0
-              if (m_cfg.validateTriplets) {
-                // Pixel barrel
-                if (isBarrel1 && isBarrel2 && isBarrel3) {
-                  const std::array<const GbtsNode*, 3> candidateTriplet = {
-                      B1.vn[n1Idx], B2.vn[n2Idx], pS->n2};
-
-                  if (!validateTriplet(candidateTriplet, tripletPtMin,
-                                       absTauRatio, cutTauRatioMax, options)) {
-                    continue;
-                  }
+            // final check: cuts on pT and d0
+            if (m_cfg.validateTriplets) {
+              // Pixel barrel
+              if (isBarrel1 && isBarrel2 && isBarrel3) {
+                const std::array<const GbtsNode*, 3> candidateTriplet = {
+                    &nodes[B1.vn[n1Idx]], &nodes[B2.vn[n2Idx]],
+                    &nodes[pS->n2]};
+
+                if (!validateTriplet(candidateTriplet, tripletPtMin,
+                                     absTauRatio, cutTauRatioMax, options)) {
+                  continue;
                 }
               }
+            }
+
+            const std::uint32_t z0BinIndex =
+                static_cast<std::uint32_t>(z0HistoCoeff * (z0 - minZ0));
 
-              pS->vNei[pS->nNei] = outEdgeIdx;
-              ++pS->nNei;
+            out.links.push_back({inEdgeIdx, outEdgeIdx, n1Idx, z0BinIndex});
+          }
+        }  // loop over n2 (outer) nodes inside a sliding window on n2 bin
+      }  // loop over sliding windows associated with n2 bins
+    }  // loop over n1 (inner) nodes
 
-              isConnected = true;  // there is at least one good match
+    out.firstEdge.push_back(newEdges.size() - edgeOffset);
+  };
 
-              // edge confirmed - update z0 histogram
+  // moves the edges of a bin group to the edge storage, unless they were
+  // created there, and connects them. Merging the groups in their original
+  // order gives the same graph as building it one group after the other.
+  auto mergeEdges = [&](const GbtsBinGroup& bg, const BinGroupEdges& in) {
+    GbtsEtaBin& B1 = nodeStorage.getEtaBin(bg.first);
 
-              const std::uint32_t z0BinIndex =
-                  static_cast<std::uint32_t>(z0HistoCoeff * (z0 - minZ0));
+    if (B1.empty()) {
+      return;
+    }
 
-              ++z0Histo[z0BinIndex];
+    // edges beyond the maximum are dropped
+    const std::uint32_t firstEdge = nEdges;
+    const std::uint32_t nKept =
+        std::min(in.firstEdge.back(), m_cfg.nMaxEdges - firstEdge);
 
-              nConnections++;
-            }
-            nEdges++;
-          }
-        }  // loop over n2 (outer) nodes inside a sliding window on n2 bin
-      }  // loop over sliding windows associated with n2 bins
+    // updating the n1 node attributes
+    for (std::uint32_t n1Idx = 0; n1Idx < B1.vn.size(); ++n1Idx) {
+      const std::uint32_t begin = std::min(in.firstEdge[n1Idx], nKept);
+      const std::uint32_t end = std::min(in.firstEdge[n1Idx + 1], nKept);
+      B1.vFirstEdge[n1Idx] = firstEdge + begin;
+      B1.vNumEdges[n1Idx] = static_cast<std::uint16_t>(end - begin);
+    }
 
-      // updating the n1 node attributes
+    if (!inStorage) {
+      edgeStorage.insert(edgeStorage.end(), in.edges.begin(),
+                         in.edges.begin() + nKept);
+    } else if (nKept < in.firstEdge.back()) {
+      // the following groups of the stage are dropped as well
+      edgeStorage.resize(firstEdge + nKept);
+    }
+    nEdges += nKept;
 
-      B1.vNumEdges[n1Idx] = numCreatedEdges;
-      if (isConnected) {
-        std::uint16_t z0BitMask = 0x0;
+    for (const EdgeLink& link : in.links) {
+      // the links are ordered by the new edge
+      if (link.outEdge >= nKept) {
+        break;
+      }
 
-        for (std::uint32_t bIdx = 0; bIdx < 16; ++bIdx) {
-          if (z0Histo[bIdx] == 0) {
-            continue;
-          }
+      GbtsEdge& pS = edgeStorage[link.inEdge];
 
-          z0BitMask |= (1 << bIdx);
-        }
+      if (pS.nNei >= gbtsNumSegConns) {
+        continue;
+      }
+
+      pS.vNei[pS.nNei] = firstEdge + link.outEdge;
+      ++pS.nNei;
 
-        // non-zero mask indicates that there is at least one connected edge
-        B1.vIsConnected[n1Idx] = z0BitMask;
+      // edge confirmed - update the z0 bit mask of n1, a non-zero mask
+      // indicates that there is at least one connected edge
+      if (link.z0Bin < zBins) {
+        B1.vIsConnected[link.n1Idx] |=
+            static_cast<std::uint16_t>(1u << link.z0Bin);
       }
 
-    }  // loop over n1 (inner) nodes
-  }  // loop over bin groups: a single n1 bin and multiple n2 bins
+      nConnections++;
+    }
+  };
+
+  // the bin groups of a stage only read edges of the previous stages, so
+  // they can be built in parallel and merged at the end of the stage
+  const std::vector<GbtsBinGroup>& binGroups = m_geometry->binGroups();
+  const std::vector<std::size_t>& stages = m_geometry->binGroupStages();
+  const std::size_t nStages = stages.size() - 1;
+
+  std::size_t maxStageSize = 0;
+  for (std::size_t s = 0; s < nStages; ++s) {
+    maxStageSize = std::max(maxStageSize, stages[s + 1] - stages[s]);
+  }
+  std::vector<BinGroupEdges> stageEdges(maxStageSize);
+
+  std::size_t stage = 0;
+
+  parallelPhases(
+      nStages > 0 ? stages[1] : 0, m_cfg.numThreads,
+      [&](const std::size_t i) {
+        BinGroupEdges& groupEdges = stageEdges[i];
+        groupEdges.edges.clear();
+        createEdges(binGroups[stages[stage] + i],
+                    inStorage ? edgeStorage : groupEdges.edges, groupEdges);
+      },
+      [&]() -> std::size_t {
+        for (std::size_t i = stages[stage]; i < stages[stage + 1]; ++i) {
+          mergeEdges(binGroups[i], stageEdges[i - stages[stage]]);
+        }
+        ++stage;
+        return stage < nStages ? stages[stage + 1] - stages[stage] : 0;
+      },
+      m_cfg.executor);
 
   if (nEdges >= m_cfg.nMaxEdges) {
     ACTS_WARNING(
@@ -612,21 +728,29 @@ std::int32_t GraphBasedTrackSeeder::runCCA(
   std::vector<GbtsEdge*> vNew;
   vNew.reserve(vOld.size());
 
-  // generate proposals
-  for (; iter < maxIter; iter++) {
-    vNew.clear();
+  // flags the edges in vOld which get a new level
+  std::vector<std::uint8_t> isRaised(vOld.size(), 0);
 
-    for (GbtsEdge* pS : vOld) {
+  constexpr std::size_t chunkSize = 1024;
+  auto numChunks = [&]() { return (vOld.size() + chunkSize - 1) / chunkSize; };
+
+  // generate proposals, which only read the levels of the edges
+  auto propose = [&](const std::size_t chunk) {
+    const std::size_t end = std::min(vOld.size(), (chunk + 1) * chunkSize);
+
+    for (std::size_t i = chunk * chunkSize; i < end; ++i) {
+      GbtsEdge* pS = vOld[i];
       std::int32_t nextLevel = pS->level;
+      isRaised[i] = 0;
 
       for (std::uint32_t nIdx = 0; nIdx < pS->nNei; ++nIdx) {
         const std::uint32_t nextEdgeIdx = pS->vNei[nIdx];
 
-        GbtsEdge* pN = &(edgeStorage[nextEdgeIdx]);
+        const GbtsEdge* pN = &(edgeStorage[nextEdgeIdx]);
 
         if (pS->level == pN->level) {
           nextLevel = pS->level + 1;
-          vNew.push_back(pS);
+          isRaised[i] = 1;
           break;
         }
       }
@@ -634,8 +758,17 @@ std::int32_t GraphBasedTrackSeeder::runCCA(
       // proposal
       pS->next = static_cast<std::int8_t>(nextLevel);
     }
+  };
 
-    // update
+  // update, returns the number of chunks for the next iteration
+  auto update = [&]() -> std::size_t {
+    vNew.clear();
+
+    for (std::size_t i = 0; i < vOld.size(); ++i) {
+      if (isRaised[i] != 0) {
+        vNew.push_back(vOld[i]);
+      }
+    }
 
     std::uint32_t nChanges = 0;
 
@@ -649,20 +782,23 @@ std::int32_t GraphBasedTrackSeeder::runCCA(
       }
     }
 
-    if (nChanges == 0) {
-      break;
+    if (nChanges == 0 || ++iter >= maxIter) {
+      return 0;
     }
 
     vOld.swap(vNew);
-    vNew.clear();
-  }
+    return numChunks();
+  };
+
+  parallelPhases(numChunks(), m_cfg.numThreads, propose, update,
+                 m_cfg.executor);
 
   return maxLevel;
 }
 
 void GraphBasedTrackSeeder::extractSeedsFromTheGraph(
     std::uint32_t maxLevel, std::uint32_t nEdges, std::int32_t nHits,
-    std::vector<GbtsEdge>& edgeStorage,
+    std::span<const GbtsNode> nodes, std::vector<GbtsEdge>& edgeStorage,
     std::vector<OutputSeedProperties>& vOutputSeeds,
     const GbtsTrackingFilter& filter) const {
   // a triplet + 2 confirmation
@@ -717,7 +853,8 @@ void GraphBasedTrackSeeder::extractSeedsFromTheGraph(
       continue;
     }
 
-    GbtsEdgeState rs = filter.followTrack(filterState, edgeStorage, *pS);
+    GbtsEdgeState rs =
+        filter.followTrack(filterState, nodes, edgeStorage, *pS);
 
     if (!rs.initialized) {
       continue;
@@ -738,10 +875,10 @@ void GraphBasedTrackSeeder::extractSeedsFromTheGraph(
       }
 
       if (sIt == rs.vs.rbegin()) {
-        vN.push_back((*sIt)->n1);
+        vN.push_back(&nodes[(*sIt)->n1]);
       }
 
-      vN.push_back((*sIt)->n2);
+      vN.push_back(&nodes[(*sIt)->n2]);
     }
 
     if (vN.size() < 3) {
@@ -107,44 +107,127 @@ void createSeedsFromGroupsImpl(
   filter.filterTripletsMiddleFixed(spacePoints, outputSeeds);
 }
 
-}  // namespace
+template <typename DoubletCollections>
+void recordTriplets(TripletSeeder::Cache& cache,
+                    const TripletSeedFinder& tripletFinder,
+                    const SpacePointContainer2& spacePoints,
+                    DoubletCollections bottomDoublets,
+                    const ConstSpacePointProxy2& spM,
+                    DoubletCollections topDoublets,
+                    DoubletsForMiddleSp::Index bottomOffset,
+                    TripletSeeder::CandidateRecord& record) {
+  // Same as `createAndFilterTriplets` with the filter calls replaced by
+  // recording the candidates
+  for (auto bottomDoublet : bottomDoublets) {
+    if (topDoublets.empty()) {
+      break;
+    }
 
-TripletSeeder::TripletSeeder(std::unique_ptr<const Logger> logger_)
-    : m_logger(std::move(logger_)) {
-  if (m_logger == nullptr) {
-    throw std::invalid_argument("TripletSeeder: logger cannot be null");
+    cache.tripletTopCandidates.clear();
+    tripletFinder.createTripletTopCandidates(spacePoints, spM, bottomDoublet,
+                                             topDoublets,
+                                             cache.tripletTopCandidates);
+
+    auto& bottom = record.bottoms.emplace_back();
+    bottom.doublet = bottomOffset + bottomDoublet.index();
+    bottom.tripletTopCandidates.first = record.tripletTopCandidates.size();
+    for (auto candidate : cache.tripletTopCandidates) {
+      record.tripletTopCandidates.emplace_back(candidate.spacePoint(),
+                                               candidate.curvature(),
+                                               candidate.impactParameter());
+    }
+    bottom.tripletTopCandidates.second = record.tripletTopCandidates.size();
   }
 }
 
-void TripletSeeder::createSeedsFromGroup(
-    Cache& cache, const DoubletSeedFinder& bottomFinder,
-    const DoubletSeedFinder& topFinder, const TripletSeedFinder& tripletFinder,
-    const ITripletSeedFilter& filter, const SpacePointContainer2& spacePoints,
-    SpacePointContainer2::ConstSubset& bottomSps,
-    const ConstSpacePointProxy2& middleSp,
-    SpacePointContainer2::ConstSubset& topSps,
-    SeedContainer2& outputSeeds) const {
-  assert((bottomFinder.config().spacePointsSortedByRadius ==
-          topFinder.config().spacePointsSortedByRadius) &&
-         "Inconsistent space point sorting");
+void appendDoublets(const DoubletsForMiddleSp::Range& doublets,
+                    DoubletsForMiddleSp& output) {
+  for (auto doublet : doublets) {
+    output.emplace_back(doublet.spacePointIndex(), doublet.cotTheta(),
+                        doublet.iDeltaR(), doublet.er(), doublet.u(),
+                        doublet.v(), doublet.x(), doublet.y());
+  }
+}
 
-  std::array<SpacePointContainer2::ConstSubset, 1> bottomSpGroups{bottomSps};
-  std::array<SpacePointContainer2::ConstSubset, 1> topSpGroups{topSps};
+template <typename SpacePointCollections>
+void recordCandidatesFromGroupsImpl(
+    const Logger& logger, TripletSeeder::Cache& cache,
+    const DoubletSeedFinder& bottomFinder, const DoubletSeedFinder& topFinder,
+    const TripletSeedFinder& tripletFinder,
+    const SpacePointContainer2& spacePoints,
+    SpacePointCollections& bottomSpGroups,
+    const ConstSpacePointProxy2& middleSp, SpacePointCollections& topSpGroups,
+    TripletSeeder::CandidateRecord& record) {
+  MiddleSpInfo middleSpInfo = DoubletSeedFinder::computeMiddleSpInfo(middleSp);
 
-  createSeedsFromGroupsImpl(*m_logger, cache, bottomFinder, topFinder,
-                            tripletFinder, filter, spacePoints, bottomSpGroups,
-                            middleSp, topSpGroups, outputSeeds);
+  // create middle-top doublets
+  cache.topDoublets.clear();
+  for (auto& topSpGroup : topSpGroups) {
+    topFinder.createDoublets(middleSp, middleSpInfo, topSpGroup,
+                             cache.topDoublets);
+  }
+
+  // no top SP found -> the filter is never called for this middle SP
+  if (cache.topDoublets.empty()) {
+    ACTS_VERBOSE("No compatible Tops, returning");
+    return;
+  }
+
+  auto& middle = record.middles.emplace_back();
+  middle.spacePoint = middleSp.index();
+  middle.topDoublets.first = record.topDoublets.size();
+  appendDoublets(cache.topDoublets.range(), record.topDoublets);
+  middle.topDoublets.second = record.topDoublets.size();
+  middle.bottoms.first = record.bottoms.size();
+  middle.bottoms.second = record.bottoms.size();
+
+  // create middle-bottom doublets
+  cache.bottomDoublets.clear();
+  for (auto& bottomSpGroup : bottomSpGroups) {
+    bottomFinder.createDoublets(middleSp, middleSpInfo, bottomSpGroup,
+                                cache.bottomDoublets);
+  }
+
+  // no bottom SP found -> cannot form any triplet
+  if (cache.bottomDoublets.empty()) {
+    ACTS_VERBOSE("No compatible Bottoms, returning");
+    return;
+  }
+
+  const DoubletsForMiddleSp::Index bottomOffset = record.bottomDoublets.size();
+  appendDoublets(cache.bottomDoublets.range(), record.bottomDoublets);
+
+  // combine doublets to triplets
+  if (tripletFinder.config().sortedByCotTheta) {
+    cache.bottomDoublets.sortByCotTheta({0, cache.bottomDoublets.size()},
+                                        cache.sortedBottoms);
+    cache.topDoublets.sortByCotTheta({0, cache.topDoublets.size()},
+                                     cache.sortedTops);
+
+    recordTriplets(cache, tripletFinder, spacePoints,
+                   cache.bottomDoublets.subset(cache.sortedBottoms), middleSp,
+                   cache.topDoublets.subset(cache.sortedTops), bottomOffset,
+                   record);
+  } else {
+    recordTriplets(cache, tripletFinder, spacePoints,
+                   cache.bottomDoublets.range(), middleSp,
+                   cache.topDoublets.range(), bottomOffset, record);
+  }
+
+  record.middles.back().bottoms.second = record.bottoms.size();
 }
 
-void TripletSeeder::createSeedsFromGroups(
-    Cache& cache, const DoubletSeedFinder& bottomFinder,
-    const DoubletSeedFinder& topFinder, const TripletSeedFinder& tripletFinder,
-    const ITripletSeedFilter& filter, const SpacePointContainer2& spacePoints,
+/// Calls `function(spM)` for all middle space points of a group which are in
+/// the radial range, after moving the beginning of the sorted bottom and top
+/// groups to the first compatible space point.
+template <typename function_t>
+void forEachMiddleSp(
+    const DoubletSeedFinder& bottomFinder, const DoubletSeedFinder& topFinder,
     const std::span<SpacePointContainer2::ConstRange>& bottomSpGroups,
     const SpacePointContainer2::ConstRange& middleSpGroup,
     const std::span<SpacePointContainer2::ConstRange>& topSpGroups,
     const std::pair<float, float>& radiusRangeForMiddle,
-    SeedContainer2& outputSeeds) const {
+    function_t&& function) {
   assert((bottomFinder.config().spacePointsSortedByRadius ==
           topFinder.config().spacePointsSortedByRadius) &&
          "Inconsistent space point sorting");
@@ -195,9 +278,115 @@ void TripletSeeder::createSeedsFromGroups(
       }
     }
 
-    createSeedsFromGroupsImpl(*m_logger, cache, bottomFinder, topFinder,
-                              tripletFinder, filter, spacePoints,
-                              bottomSpGroups, spM, topSpGroups, outputSeeds);
+    function(spM);
+  }
+}
+
+}  // namespace
+
+TripletSeeder::TripletSeeder(std::unique_ptr<const Logger> logger_)
+    : m_logger(std::move(logger_)) {
+  if (m_logger == nullptr) {
+    throw std::invalid_argument("TripletSeeder: logger cannot be null");
+  }
+}
+
+void TripletSeeder::createSeedsFromGroup(
+    Cache& cache, const DoubletSeedFinder& bottomFinder,
+    const DoubletSeedFinder& topFinder, const TripletSeedFinder& tripletFinder,
+    const ITripletSeedFilter& filter, const SpacePointContainer2& spacePoints,
+    SpacePointContainer2::ConstSubset& bottomSps,
+    const ConstSpacePointProxy2& middleSp,
+    SpacePointContainer2::ConstSubset& topSps,
+    SeedContainer2& outputSeeds) const {
+  assert((bottomFinder.config().spacePointsSortedByRadius ==
+          topFinder.config().spacePointsSortedByRadius) &&
+         "Inconsistent space point sorting");
+
+  std::array<SpacePointContainer2::ConstSubset, 1> bottomSpGroups{bottomSps};
+  std::array<SpacePointContainer2::ConstSubset, 1> topSpGroups{topSps};
+
+  createSeedsFromGroupsImpl(*m_logger, cache, bottomFinder, topFinder,
+                            tripletFinder, filter, spacePoints, bottomSpGroups,
+                            middleSp, topSpGroups, outputSeeds);
+}
+
+void TripletSeeder::createSeedsFromGroups(
+    Cache& cache, const DoubletSeedFinder& bottomFinder,
+    const DoubletSeedFinder& topFinder, const TripletSeedFinder& tripletFinder,
+    const ITripletSeedFilter& filter, const SpacePointContainer2& spacePoints,
+    const std::span<SpacePointContainer2::ConstRange>& bottomSpGroups,
+    const SpacePointContainer2::ConstRange& middleSpGroup,
+    const std::span<SpacePointContainer2::ConstRange>& topSpGroups,
+    const std::pair<float, float>& radiusRangeForMiddle,
+    SeedContainer2& outputSeeds) const {
+  forEachMiddleSp(bottomFinder, topFinder, bottomSpGroups, middleSpGroup,
+                  topSpGroups, radiusRangeForMiddle,
+                  [&](const ConstSpacePointProxy2& spM) {
+                    createSeedsFromGroupsImpl(
+                        *m_logger, cache, bottomFinder, topFinder,
+                        tripletFinder, filter, spacePoints, bottomSpGroups,
+                        spM, topSpGroups, outputSeeds);
+                  });
+}
+
+void TripletSeeder::recordCandidatesFromGroups(
+    Cache& cache, const DoubletSeedFinder& bottomFinder,
+    const DoubletSeedFinder& topFinder, const TripletSeedFinder& tripletFinder,
+    const SpacePointContainer2& spacePoints,
+    const std::span<SpacePointContainer2::ConstRange>& bottomSpGroups,
+    const SpacePointContainer2::ConstRange& middleSpGroup,
+    const std::span<SpacePointContainer2::ConstRange>& topSpGroups,
+    const std::pair<float, float>& radiusRangeForMiddle,
+    CandidateRecord& record) const {
+  forEachMiddleSp(bottomFinder, topFinder, bottomSpGroups, middleSpGroup,
+                  topSpGroups, radiusRangeForMiddle,
+                  [&](const ConstSpacePointProxy2& spM) {
+                    recordCandidatesFromGroupsImpl(
+                        *m_logger, cache, bottomFinder, topFinder,
+                        tripletFinder, spacePoints, bottomSpGroups, spM,
+                        topSpGroups, record);
+                  });
+}
+
+void TripletSeeder::filterRecordedCandidates(
+    Cache& cache, const ITripletSeedFilter& filter,
+    const SpacePointContainer2& spacePoints, const CandidateRecord& record,
+    SeedContainer2& outputSeeds) const {
+  // Replays the filter calls of `createSeedsFromGroupsImpl` in the same order
+  for (const CandidateRecord::Middle& middle : record.middles) {
+    const ConstSpacePointProxy2 spM = spacePoints[middle.spacePoint];
+
+    cache.topDoublets.clear();
+    appendDoublets(record.topDoublets.range(middle.topDoublets),
+                   cache.topDoublets);
+    if (!filter.sufficientTopDoublets(spacePoints, spM, cache.topDoublets)) {
+      continue;
+    }
+
+    if (middle.bottoms.first == middle.bottoms.second) {
+      continue;
+    }
+
+    for (std::uint32_t i = middle.bottoms.first; i < middle.bottoms.second;
+         ++i) {
+      const CandidateRecord::Bottom& bottom = record.bottoms[i];
+
+      cache.tripletTopCandidates.clear();
+      for (auto j = bottom.tripletTopCandidates.first;
+           j < bottom.tripletTopCandidates.second; ++j) {
+        auto candidate = record.tripletTopCandidates[j];
+        cache.tripletTopCandidates.emplace_back(candidate.spacePoint(),
+                                                candidate.curvature(),
+                                                candidate.impactParameter());
+      }
+
+      filter.filterTripletTopCandidates(spacePoints, spM,
+                                        record.bottomDoublets[bottom.doublet],
+                                        cache.tripletTopCandidates);
+    }
+
+    filter.filterTripletsMiddleFixed(spacePoints, outputSeeds);
   }
 }
 
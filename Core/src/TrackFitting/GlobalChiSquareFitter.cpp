@@ -10,6 +10,138 @@
 
 #include "Acts/Definitions/TrackParametrization.hpp"
 
+#include <algorithm>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Experimental;
+
+/// Quantities of the elimination of one pair of scattering angles, which are
+/// needed to recover the angles from the parameters of the previous segment
+struct Gx2fEliminationStep {
+  /// Inverse of the triangular factor of the scattering angles
+  SquareMatrix<2> invScatteringMatrix;
+  /// Coupling between the scattering angles and the previous segment
+  Matrix<2, eBoundSize> coupling;
+  /// Right hand side of the scattering angles
+  Vector2 scatteringVector;
+};
+
+/// Bring stacked square-root information rows [R | z] into upper triangular
+/// form. The Householder reflections leave the least squares problem
+/// unchanged, so the first eBoundSize rows of the result replace the input.
+/// Unlike Eigen::HouseholderQR, this works in place without heap allocations
+/// for the small fixed-size matrices used here.
+template <typename rows_t>
+void triangularize(rows_t& rows) {
+  Eigen::Matrix<double, rows_t::ColsAtCompileTime, 1, 0,
+                rows_t::MaxColsAtCompileTime, 1>
+      workspace(rows.cols());
+  const Eigen::Index nRows = rows.rows();
+  const Eigen::Index nSteps = std::min(nRows - 1, rows.cols());
+  for (Eigen::Index i = 0; i < nSteps; ++i) {
+    double tau = 0.;
+    double beta = 0.;
+    auto column = rows.col(i).tail(nRows - i);
+    column.makeHouseholderInPlace(tau, beta);
+    rows.bottomRightCorner(nRows - i, rows.cols() - i - 1)
+        .applyHouseholderOnTheLeft(column.tail(nRows - i - 1), tau,
+                                   workspace.data());
+    column(0) = beta;
+    column.tail(nRows - i - 1).setZero();
+  }
+}
+
+/// Eliminate all scattering angles from the structured system, starting with
+/// the last segment. Each step is a Schur complement over one pair of
+/// scattering angles. It is evaluated with orthogonal transformations of the
+/// square-root information, which only involve fixed-size matrices.
+///
+/// @param extendedSystem The structured equation system
+/// @param zVector Filled with the vector of the track parameters
+/// @param steps If given, filled with the elimination steps in segment order
+///
+/// @return The square root of the matrix of the track parameters, i.e. of the
+///         Schur complement of all scattering angles in the extended matrix
+BoundMatrix eliminateScatteringAngles(
+    const Gx2fSystem& extendedSystem, BoundVector& zVector,
+    std::vector<Gx2fEliminationStep>* steps) {
+  const std::vector<Gx2fSegment>& segments = extendedSystem.segments();
+  assert(!segments.empty() && "Structured system without segments.");
+
+  if (steps != nullptr) {
+    steps->resize(segments.size() - 1);
+  }
+
+  BoundMatrix rMatrix = segments.back().rMatrix;
+  zVector = segments.back().zVector;
+  for (std::size_t iSegment = segments.size() - 1; iSegment > 0; --iSegment) {
+    const Gx2fSegment& segment = segments[iSegment];
+    const Gx2fSegment& previous = segments[iSegment - 1];
+
+    // Rows of the scattering angles and the parameters of the previous
+    // segment, with the right hand side in the last column
+    Matrix<eBoundSize + 2, eBoundSize + 3> rows =
+        Matrix<eBoundSize + 2, eBoundSize + 3>::Zero();
+    const SquareMatrix<2> sqrtScattering =
+        segment.scatteringAMatrix.llt().matrixU();
+    rows.topLeftCorner<2, 2>() = sqrtScattering;
+    rows.block<2, 1>(0, eBoundSize + 2) =
+        sqrtScattering.transpose().inverse() * segment.scatteringBVector;
+    rows.block<eBoundSize, 2>(2, 0) =
+        rMatrix * Gx2fConstants::phiThetaProjector;
+    rows.block<eBoundSize, eBoundSize>(2, 2) = rMatrix * segment.transport;
+    rows.block<eBoundSize, 1>(2, eBoundSize + 2) = zVector;
+    triangularize(rows);
+
+    if (steps != nullptr) {
+      (*steps)[iSegment - 1] = {
+          rows.topLeftCorner<2, 2>().inverse(),
+          rows.block<2, eBoundSize>(0, 2),
+          rows.block<2, 1>(0, eBoundSize + 2),
+      };
+    }
+
+    // Merge with the measurements of the previous segment
+    Matrix<2 * eBoundSize, eBoundSize + 1> merged;
+    merged.topLeftCorner<eBoundSize, eBoundSize>() =
+        rows.block<eBoundSize, eBoundSize>(2, 2);
+    merged.block<eBoundSize, 1>(0, eBoundSize) =
+        rows.block<eBoundSize, 1>(2, eBoundSize + 2);
+    merged.bottomLeftCorner<eBoundSize, eBoundSize>() = previous.rMatrix;
+    merged.block<eBoundSize, 1>(eBoundSize, eBoundSize) = previous.zVector;
+    triangularize(merged);
+
+    rMatrix = merged.topLeftCorner<eBoundSize, eBoundSize>();
+    zVector = merged.block<eBoundSize, 1>(0, eBoundSize);
+  }
+
+  return rMatrix;
+}
+
+}  // namespace
+
+Acts::BoundVector Acts::Experimental::Gx2fSystem::trackParametersDiagonal()
+    const {
+  if (m_solver == Gx2fSolver::eDense) {
+    return m_aMatrix.diagonal().head<eBoundSize>();
+  }
+
+  // Transport the measurement contributions of all segments to the start
+  BoundMatrix aMatrix =
+      m_segments.back().rMatrix.transpose() * m_segments.back().rMatrix;
+  for (std::size_t iSegment = m_segments.size() - 1; iSegment > 0;
+       --iSegment) {
+    const BoundMatrix& transport = m_segments[iSegment].transport;
+    const BoundMatrix& rMatrix = m_segments[iSegment - 1].rMatrix;
+    aMatrix = (rMatrix.transpose() * rMatrix +
+               transport.transpose() * aMatrix * transport)
+                  .eval();
+  }
+  return aMatrix.diagonal();
+}
+
 void Acts::Experimental::updateGx2fParams(
     BoundTrackParameters& params, const Eigen::VectorXd& deltaParamsExtended,
     const std::size_t nMaterialSurfaces,
@@ -36,6 +168,29 @@ void Acts::Experimental::updateGx2fParams(
 
 void Acts::Experimental::updateGx2fCovarianceParams(
     BoundMatrix& fullCovariancePredicted, Gx2fSystem& extendedSystem) {
+  if (extendedSystem.solver() == Gx2fSolver::eStructured) {
+    // The track parameter block of the inverse extended matrix is the inverse
+    // of the Schur complement of the scattering angles
+    BoundVector zVector;
+    const BoundMatrix rMatrix =
+        eliminateScatteringAngles(extendedSystem, zVector, nullptr);
+    BoundMatrix aMatrix = rMatrix.transpose() * rMatrix;
+
+    // make invertible
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      if (aMatrix(i, i) == 0.) {
+        aMatrix(i, i) = 1.;
+      }
+    }
+
+    visit_measurement(extendedSystem.findRequiredNdf(), [&](auto N) {
+      fullCovariancePredicted.topLeftCorner<N, N>() =
+          aMatrix.inverse().topLeftCorner<N, N>();
+    });
+
+    return;
+  }
+
   // make invertible
   for (std::size_t i = 0; i < extendedSystem.nDims(); ++i) {
     if (extendedSystem.aMatrix()(i, i) == 0.) {
@@ -66,31 +221,42 @@ void Acts::Experimental::addMeasurementToGx2fSumsBackend(
     return;
   }
 
+  const bool structured = extendedSystem.solver() == Gx2fSolver::eStructured;
+
   // Create an extended Jacobian. This one contains only eBoundSize rows,
   // because the rest is irrelevant. We fill it in the next steps.
   // TODO make dimsExtendedParams template with unrolling
-  Eigen::MatrixXd extendedJacobian =
-      Eigen::MatrixXd::Zero(eBoundSize, extendedSystem.nDims());
+  Eigen::MatrixXd extendedJacobian;
 
-  // This part of the Jacobian comes from the material-less propagation
-  extendedJacobian.topLeftCorner<eBoundSize, eBoundSize>() =
-      jacobianFromStart[0];
+  if (structured) {
+    // The structured system only needs the Jacobian from the start of the
+    // current segment
+    extendedJacobian = jacobianFromStart.back();
+  } else {
+    extendedJacobian =
+        Eigen::MatrixXd::Zero(eBoundSize, extendedSystem.nDims());
 
-  // If we have material, loop here over all Jacobians. We add extra columns for
-  // their phi-theta projections. These parts account for the propagation of the
-  // scattering angles.
-  for (std::size_t matSurface = 1; matSurface < jacobianFromStart.size();
-       matSurface++) {
-    const BoundMatrix jac = jacobianFromStart[matSurface];
+    // This part of the Jacobian comes from the material-less propagation
+    extendedJacobian.topLeftCorner<eBoundSize, eBoundSize>() =
+        jacobianFromStart[0];
+
+    // If we have material, loop here over all Jacobians. We add extra columns
+    // for their phi-theta projections. These parts account for the
+    // propagation of the scattering angles.
+    for (std::size_t matSurface = 1; matSurface < jacobianFromStart.size();
+         matSurface++) {
+      const BoundMatrix jac = jacobianFromStart[matSurface];
 
-    const Matrix<eBoundSize, 2> jacPhiTheta =
-        jac * Gx2fConstants::phiThetaProjector;
+      const Matrix<eBoundSize, 2> jacPhiTheta =
+          jac * Gx2fConstants::phiThetaProjector;
 
-    // The position, where we need to insert the values in the extended Jacobian
-    const std::size_t deltaPosition = eBoundSize + 2 * (matSurface - 1);
+      // The position, where we need to insert the values in the extended
+      // Jacobian
+      const std::size_t deltaPosition = eBoundSize + 2 * (matSurface - 1);
 
-    extendedJacobian.template block<eBoundSize, 2>(0, deltaPosition) =
-        jacPhiTheta;
+      extendedJacobian.template block<eBoundSize, 2>(0, deltaPosition) =
+          jacPhiTheta;
+    }
   }
 
   const Eigen::MatrixXd projJacobian = projector * extendedJacobian;
@@ -103,14 +269,40 @@ void Acts::Experimental::addMeasurementToGx2fSumsBackend(
   extendedSystem.chi2() +=
       (residual.transpose() * (*safeInvCovMeasurement) * residual)(0, 0);
 
-  extendedSystem.aMatrix() +=
-      (projJacobian.transpose() * (*safeInvCovMeasurement) * projJacobian)
-          .eval();
+  if (structured) {
+    assert(extendedSystem.segments().size() == jacobianFromStart.size() &&
+           "Segments and Jacobians are out of sync.");
+    Gx2fSegment& segment = extendedSystem.segments().back();
+
+    // Append the whitened measurement rows to the square-root information.
+    // The fixed maximum sizes keep the matrices on the stack.
+    using SqrtMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0,
+                                     eBoundSize, eBoundSize>;
+    using Rows = Eigen::Matrix<double, Eigen::Dynamic, eBoundSize + 1, 0,
+                               2 * eBoundSize, eBoundSize + 1>;
+    const SqrtMatrix sqrtInvCovMeasurement =
+        SqrtMatrix(*safeInvCovMeasurement).llt().matrixU();
+    Rows rows(eBoundSize + residual.size(), eBoundSize + 1);
+    rows.topLeftCorner<eBoundSize, eBoundSize>() = segment.rMatrix;
+    rows.block<eBoundSize, 1>(0, eBoundSize) = segment.zVector;
+    rows.bottomLeftCorner(residual.size(), eBoundSize) =
+        sqrtInvCovMeasurement * projJacobian;
+    rows.bottomRightCorner(residual.size(), 1) =
+        sqrtInvCovMeasurement * residual;
+    triangularize(rows);
+
+    segment.rMatrix = rows.topLeftCorner<eBoundSize, eBoundSize>();
+    segment.zVector = rows.block<eBoundSize, 1>(0, eBoundSize);
+  } else {
+    extendedSystem.aMatrix() +=
+        (projJacobian.transpose() * (*safeInvCovMeasurement) * projJacobian)
+            .eval();
 
-  extendedSystem.bVector() +=
-      (residual.transpose() * (*safeInvCovMeasurement) * projJacobian)
-          .eval()
-          .transpose();
+    extendedSystem.bVector() +=
+        (residual.transpose() * (*safeInvCovMeasurement) * projJacobian)
+            .eval()
+            .transpose();
+  }
 
   ACTS_VERBOSE(
       "Contributions in addMeasurementToGx2fSums:\n"
@@ -142,6 +334,37 @@ void Acts::Experimental::addMeasurementToGx2fSumsBackend(
 
 Eigen::VectorXd Acts::Experimental::computeGx2fDeltaParams(
     const Acts::Experimental::Gx2fSystem& extendedSystem) {
-  return extendedSystem.aMatrix().colPivHouseholderQr().solve(
-      extendedSystem.bVector());
+  if (extendedSystem.solver() == Gx2fSolver::eDense) {
+    return extendedSystem.aMatrix().colPivHouseholderQr().solve(
+        extendedSystem.bVector());
+  }
+
+  const std::vector<Gx2fSegment>& segments = extendedSystem.segments();
+  assert(extendedSystem.nDims() == eBoundSize + 2 * (segments.size() - 1) &&
+         "Number of segments does not match the system dimensions.");
+
+  // Backward pass: reduce the system to the track parameters
+  std::vector<Gx2fEliminationStep> steps;
+  BoundVector zVector;
+  const BoundMatrix rMatrix =
+      eliminateScatteringAngles(extendedSystem, zVector, &steps);
+
+  Eigen::VectorXd deltaParamsExtended(extendedSystem.nDims());
+  BoundVector deltaParams = rMatrix.colPivHouseholderQr().solve(zVector);
+  deltaParamsExtended.head<eBoundSize>() = deltaParams;
+
+  // Forward pass: recover the scattering angles segment by segment
+  for (std::size_t iSegment = 1; iSegment < segments.size(); ++iSegment) {
+    const Gx2fEliminationStep& step = steps[iSegment - 1];
+    const Vector2 deltaAngles =
+        step.invScatteringMatrix *
+        (step.scatteringVector - step.coupling * deltaParams);
+    deltaParamsExtended.segment<2>(eBoundSize + 2 * (iSegment - 1)) =
+        deltaAngles;
+    deltaParams = (segments[iSegment].transport * deltaParams +
+                   Gx2fConstants::phiThetaProjector * deltaAngles)
+                      .eval();
+  }
+
+  return deltaParamsExtended;
 }
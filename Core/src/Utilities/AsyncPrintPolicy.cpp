@@ -0,0 +1,225 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/AsyncPrintPolicy.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace Acts {
+
+namespace Logging {
+
+namespace {
+std::atomic<std::uint64_t> s_nextSinkId{0};
+}  // namespace
+
+/// Single-producer single-consumer ring buffer of the records of one thread
+struct AsyncLogSink::Buffer {
+  struct Record {
+    std::uint64_t sequence = 0;
+    std::string text;
+  };
+
+  explicit Buffer(std::size_t size) : records(size), mask(size - 1) {}
+
+  std::vector<Record> records;
+  std::size_t mask;
+
+  /// next record to be read, only advanced by the background thread
+  alignas(64) std::atomic<std::size_t> head{0};
+  /// next record to be written, only advanced by the owning thread
+  alignas(64) std::atomic<std::size_t> tail{0};
+};
+
+AsyncLogSink::AsyncLogSink(const Config& cfg)
+    : m_cfg(cfg), m_id(s_nextSinkId.fetch_add(1)) {
+  if (m_cfg.out == nullptr) {
+    throw std::invalid_argument("AsyncLogSink: missing output stream");
+  }
+  m_cfg.bufferSize =
+      std::bit_ceil(std::max<std::size_t>(m_cfg.bufferSize, 1u));
+  m_thread = std::thread([this] { run(); });
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  m_stop.store(true, std::memory_order_release);
+  m_thread.join();
+}
+
+AsyncLogSink::Buffer& AsyncLogSink::localBuffer() {
+  // The buffers are shared with the sink, entries of sinks which no longer
+  // exist are cleaned up whenever a new buffer is registered.
+  thread_local std::vector<std::pair<std::uint64_t, std::shared_ptr<Buffer>>>
+      t_buffers;
+
+  for (const auto& [id, buffer] : t_buffers) {
+    if (id == m_id) {
+      return *buffer;
+    }
+  }
+
+  std::erase_if(t_buffers, [](const auto& entry) {
+    return entry.second.use_count() == 1;
+  });
+
+  auto buffer = std::make_shared<Buffer>(m_cfg.bufferSize);
+  {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    m_buffers.push_back(buffer);
+    m_nBuffers.store(m_buffers.size(), std::memory_order_release);
+  }
+  t_buffers.emplace_back(m_id, buffer);
+  return *buffer;
+}
+
+bool AsyncLogSink::push(const std::string& input) {
+  Buffer& buffer = localBuffer();
+  const std::size_t tail = buffer.tail.load(std::memory_order_relaxed);
+
+  while (tail - buffer.head.load(std::memory_order_acquire) ==
+         buffer.records.size()) {
+    if (m_cfg.overflowPolicy == OverflowPolicy::Drop) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    std::this_thread::yield();
+  }
+
+  // The sequence number is only taken once the slot is secured, so that the
+  // background thread never waits for a record which does not arrive.
+  Buffer::Record& record = buffer.records[tail & buffer.mask];
+  record.text.assign(input);
+  record.sequence = m_queued.fetch_add(1, std::memory_order_relaxed);
+  buffer.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+void AsyncLogSink::flush() {
+  const std::uint64_t target = m_queued.load(std::memory_order_acquire);
+  while (m_flushed.load(std::memory_order_acquire) < target) {
+    m_flushRequested.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(m_cfg.idleInterval);
+  }
+}
+
+void AsyncLogSink::run() {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::ostream& out = *m_cfg.out;
+  std::uint64_t written = 0;
+
+  while (true) {
+    if (m_nBuffers.load(std::memory_order_acquire) != buffers.size()) {
+      std::lock_guard<std::mutex> lock(m_buffersMutex);
+      buffers = m_buffers;
+    }
+
+    // Find the buffer holding the oldest record
+    Buffer* next = nullptr;
+    std::uint64_t nextSequence = std::numeric_limits<std::uint64_t>::max();
+    for (const auto& buffer : buffers) {
+      const std::size_t head = buffer->head.load(std::memory_order_relaxed);
+      if (head != buffer->tail.load(std::memory_order_acquire)) {
+        const std::uint64_t sequence =
+            buffer->records[head & buffer->mask].sequence;
+        if (sequence < nextSequence) {
+          next = buffer.get();
+          nextSequence = sequence;
+        }
+      }
+    }
+
+    if (next == nullptr) {
+      // All buffers are empty, which is the time to flush the stream
+      if (m_flushed.load(std::memory_order_relaxed) != written) {
+        out.flush();
+        m_flushed.store(written, std::memory_order_release);
+      }
+      if (m_stop.load(std::memory_order_acquire) &&
+          written == m_queued.load(std::memory_order_acquire)) {
+        break;
+      }
+      std::this_thread::sleep_for(m_cfg.idleInterval);
+      continue;
+    }
+
+    if (nextSequence != written) {
+      // Another thread has taken an older sequence number but not yet
+      // published its record, which will happen momentarily.
+      std::this_thread::yield();
+      continue;
+    }
+
+    // Write the consecutive records of this buffer without searching again
+    std::size_t head = next->head.load(std::memory_order_relaxed);
+    const std::size_t tail = next->tail.load(std::memory_order_acquire);
+    while (head != tail) {
+      const Buffer::Record& record = next->records[head & next->mask];
+      if (record.sequence != written) {
+        break;
+      }
+      out << record.text << '\n';
+      ++head;
+      ++written;
+      next->head.store(head, std::memory_order_release);
+    }
+
+    // Explicit flushes have to be served even if the buffers never run empty
+    if (m_flushRequested.exchange(false, std::memory_order_acq_rel)) {
+      out.flush();
+      m_flushed.store(written, std::memory_order_release);
+    }
+  }
+}
+
+AsyncPrintPolicy::AsyncPrintPolicy(std::shared_ptr<AsyncLogSink> sink)
+    : m_sink(std::move(sink)) {
+  if (m_sink == nullptr) {
+    throw std::invalid_argument("AsyncPrintPolicy: missing sink");
+  }
+}
+
+void AsyncPrintPolicy::flush(const Level& lvl, const std::string& input) {
+  m_sink->push(input);
+  if (lvl >= getFailureThreshold()) {
+    m_sink->flush();
+    throw ThresholdFailure(
+        "Previous debug message exceeds the "
+        "ACTS_LOG_FAILURE_THRESHOLD=" +
+        std::string{levelName(getFailureThreshold())} +
+        " configuration, bailing out. See "
+        "https://acts.readthedocs.io/en/latest/core/misc/"
+        "logging.html#logging-thresholds");
+  }
+}
+
+const std::string& AsyncPrintPolicy::name() const {
+  throw std::runtime_error{
+      "Async print policy doesn't have a name. Is there no named output in "
+      "the decorator chain?"};
+}
+
+}  // namespace Logging
+
+std::unique_ptr<const Logger> getAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::shared_ptr<Logging::AsyncLogSink> sink) {
+  using namespace Logging;
+  auto output = std::make_unique<LevelOutputDecorator>(
+      std::make_unique<NamedOutputDecorator>(
+          std::make_unique<TimedOutputDecorator>(
+              std::make_unique<AsyncPrintPolicy>(std::move(sink))),
+          name));
+  auto print = std::make_unique<DefaultFilterPolicy>(lvl);
+  return std::make_unique<const Logger>(std::move(output), std::move(print));
+}
+
+}  // namespace Acts
@@ -0,0 +1,102 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <atomic>
+#include <barrier>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+
+void parallelPhases(std::size_t numTasks, std::size_t numThreads,
+                    const std::function<void(std::size_t)>& task,
+                    const std::function<std::size_t()>& nextPhase,
+                    const ParallelExecutor& executor) {
+  if (numThreads <= 1) {
+    for (; numTasks > 0; numTasks = nextPhase()) {
+      for (std::size_t i = 0; i < numTasks; ++i) {
+        task(i);
+      }
+    }
+    return;
+  }
+
+  if (executor) {
+    for (; numTasks > 0; numTasks = nextPhase()) {
+      executor(numTasks, task);
+    }
+    return;
+  }
+
+  // an exception must not leave a thread or the barrier completion, it is
+  // kept and rethrown in the calling thread
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  std::atomic<bool> failed{false};
+  auto keepError = [&]() {
+    std::lock_guard lock(errorMutex);
+    if (!error) {
+      error = std::current_exception();
+    }
+    failed.store(true, std::memory_order_relaxed);
+  };
+
+  std::atomic<std::size_t> nextTask{0};
+  auto onPhaseDone = [&]() noexcept {
+    try {
+      numTasks = failed.load(std::memory_order_relaxed) ? 0 : nextPhase();
+    } catch (...) {
+      keepError();
+      numTasks = 0;
+    }
+    nextTask.store(0, std::memory_order_relaxed);
+  };
+  std::barrier sync(static_cast<std::ptrdiff_t>(numThreads), onPhaseDone);
+
+  auto worker = [&]() {
+    while (numTasks > 0) {
+      try {
+        for (std::size_t i = nextTask.fetch_add(1, std::memory_order_relaxed);
+             i < numTasks && !failed.load(std::memory_order_relaxed);
+             i = nextTask.fetch_add(1, std::memory_order_relaxed)) {
+          task(i);
+        }
+      } catch (...) {
+        keepError();
+      }
+      sync.arrive_and_wait();
+    }
+  };
+
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t i = 1; i < numThreads; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void parallelFor(std::size_t numTasks, std::size_t numThreads,
+                 const std::function<void(std::size_t)>& task,
+                 const ParallelExecutor& executor) {
+  parallelPhases(
+      numTasks, std::min(numThreads, numTasks), task,
+      []() -> std::size_t { return 0; }, executor);
+}
+
+}  // namespace Acts
@@ -0,0 +1,198 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Vertexing/AdaptiveGridDensityMap.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Acts {
+
+static_assert(std::has_single_bit(
+                  static_cast<std::uint32_t>(AdaptiveGridDensityMap::kTileSize)),
+              "The tile size must be a power of two");
+static_assert(AdaptiveGridDensityMap::kTileSize <= 32,
+              "The occupancy mask of a tile has 32 bits");
+
+std::int32_t AdaptiveGridDensityMap::zTileOf(std::int32_t zBin) {
+  // Arithmetic shift, rounds towards negative infinity
+  return zBin >> std::countr_zero(static_cast<std::uint32_t>(kTileSize));
+}
+
+std::int32_t AdaptiveGridDensityMap::laneOf(std::int32_t zBin) {
+  return zBin & (kTileSize - 1);
+}
+
+std::size_t AdaptiveGridDensityMap::slotOf(std::int32_t zTile,
+                                           std::int32_t tBin) const {
+  std::uint64_t key =
+      (static_cast<std::uint64_t>(static_cast<std::uint32_t>(zTile)) << 32) |
+      static_cast<std::uint32_t>(tBin);
+  // Fibonacci hashing, the slot count is a power of two
+  std::size_t slotMask = m_slots.size() - 1;
+  std::size_t slot = ((key * 0x9E3779B97F4A7C15ull) >> 32) & slotMask;
+  while (m_slots[slot] != kNoTile) {
+    const Tile& tile = m_tiles[m_slots[slot] - 1];
+    if (tile.zTile == zTile && tile.tBin == tBin) {
+      break;
+    }
+    slot = (slot + 1) & slotMask;
+  }
+  return slot;
+}
+
+std::size_t AdaptiveGridDensityMap::findTile(std::int32_t zTile,
+                                             std::int32_t tBin) const {
+  if (m_slots.empty()) {
+    return m_tiles.size();
+  }
+  std::uint32_t index = m_slots[slotOf(zTile, tBin)];
+  return index == kNoTile ? m_tiles.size() : index - 1;
+}
+
+std::size_t AdaptiveGridDensityMap::findOrInsertTile(std::int32_t zTile,
+                                                     std::int32_t tBin) {
+  // Keep the load factor of the hash table at most 1/2
+  if (2 * (m_tiles.size() + 1) > m_slots.size()) {
+    rehash(std::max<std::size_t>(64, 2 * m_slots.size()));
+  }
+  std::size_t slot = slotOf(zTile, tBin);
+  if (m_slots[slot] == kNoTile) {
+    Tile& tile = m_tiles.emplace_back();
+    tile.zTile = zTile;
+    tile.tBin = tBin;
+    m_slots[slot] = static_cast<std::uint32_t>(m_tiles.size());
+  }
+  return m_slots[slot] - 1;
+}
+
+void AdaptiveGridDensityMap::rehash(std::size_t nSlots) {
+  m_slots.assign(nSlots, kNoTile);
+  for (std::size_t i = 0; i < m_tiles.size(); ++i) {
+    m_slots[slotOf(m_tiles[i].zTile, m_tiles[i].tBin)] =
+        static_cast<std::uint32_t>(i + 1);
+  }
+}
+
+void AdaptiveGridDensityMap::touch(Tile& tile, std::uint32_t mask) {
+  m_size += std::popcount(mask & ~tile.mask);
+  tile.mask |= mask;
+  tile.maxLane = -1;
+  m_maxUpToDate = false;
+}
+
+float& AdaptiveGridDensityMap::operator[](const Bin& bin) {
+  Tile& tile = m_tiles[findOrInsertTile(zTileOf(bin.first), bin.second)];
+  std::int32_t lane = laneOf(bin.first);
+  touch(tile, 1u << lane);
+  return tile.densities[lane];
+}
+
+float AdaptiveGridDensityMap::at(const Bin& bin) const {
+  const_iterator it = find(bin);
+  if (it == end()) {
+    throw std::out_of_range("AdaptiveGridDensityMap: bin not found");
+  }
+  return it->second;
+}
+
+AdaptiveGridDensityMap::const_iterator AdaptiveGridDensityMap::find(
+    const Bin& bin) const {
+  std::size_t index = findTile(zTileOf(bin.first), bin.second);
+  std::int32_t lane = laneOf(bin.first);
+  if (index == m_tiles.size() || (m_tiles[index].mask >> lane & 1u) == 0) {
+    return end();
+  }
+  return {&m_tiles, index, lane};
+}
+
+bool AdaptiveGridDensityMap::contains(const Bin& bin) const {
+  return find(bin) != end();
+}
+
+void AdaptiveGridDensityMap::add(const AdaptiveGridDensityMap& other) {
+  for (const Tile& otherTile : other.m_tiles) {
+    Tile& tile = m_tiles[findOrInsertTile(otherTile.zTile, otherTile.tBin)];
+    touch(tile, otherTile.mask);
+    // Bins outside of the mask hold zero density
+    for (std::int32_t lane = 0; lane < kTileSize; ++lane) {
+      tile.densities[lane] += otherTile.densities[lane];
+    }
+  }
+}
+
+void AdaptiveGridDensityMap::subtract(const AdaptiveGridDensityMap& other) {
+  for (const Tile& otherTile : other.m_tiles) {
+    Tile& tile = m_tiles[findOrInsertTile(otherTile.zTile, otherTile.tBin)];
+    touch(tile, otherTile.mask);
+    // Bins outside of the mask hold zero density
+    for (std::int32_t lane = 0; lane < kTileSize; ++lane) {
+      tile.densities[lane] -= otherTile.densities[lane];
+    }
+  }
+}
+
+AdaptiveGridDensityMap::const_iterator
+AdaptiveGridDensityMap::highestDensityEntry() const {
+  if (empty()) {
+    return end();
+  }
+  if (m_maxUpToDate) {
+    return {&m_tiles, m_maxTile, m_tiles[m_maxTile].maxLane};
+  }
+
+  // Only the lanes of modified tiles are searched again, the others only
+  // contribute their cached maximum
+  bool found = false;
+  for (std::size_t i = 0; i < m_tiles.size(); ++i) {
+    const Tile& tile = m_tiles[i];
+    if (tile.mask == 0) {
+      continue;
+    }
+    if (tile.maxLane < 0) {
+      std::uint32_t remaining = tile.mask;
+      std::int32_t maxLane = std::countr_zero(remaining);
+      remaining &= remaining - 1;
+      while (remaining != 0) {
+        std::int32_t lane = std::countr_zero(remaining);
+        remaining &= remaining - 1;
+        if (tile.densities[lane] > tile.densities[maxLane]) {
+          maxLane = lane;
+        }
+      }
+      tile.maxLane = maxLane;
+    }
+
+    if (!found) {
+      m_maxTile = i;
+      found = true;
+      continue;
+    }
+    const Tile& maxTile = m_tiles[m_maxTile];
+    float density = tile.densities[tile.maxLane];
+    float maxDensity = maxTile.densities[maxTile.maxLane];
+    // Ties are resolved to the smallest bin independent of the tile order
+    if (density > maxDensity ||
+        (density == maxDensity &&
+         Bin{tile.zTile * kTileSize + tile.maxLane, tile.tBin} <
+             Bin{maxTile.zTile * kTileSize + maxTile.maxLane, maxTile.tBin})) {
+      m_maxTile = i;
+    }
+  }
+  m_maxUpToDate = true;
+  return {&m_tiles, m_maxTile, m_tiles[m_maxTile].maxLane};
+}
+
+void AdaptiveGridDensityMap::clear() {
+  m_tiles.clear();
+  m_slots.clear();
+  m_size = 0;
+  m_maxUpToDate = false;
+}
+
+}  // namespace Acts
@@ -11,32 +11,10 @@
 #include "Acts/Utilities/AlgebraHelpers.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
-#include <algorithm>
+#include <cmath>
 
 namespace Acts {
 
-namespace {
-
-/// @brief Helper to retrieve values of an nDim-dimensional normal
-/// distribution
-/// @note The constant prefactor (2 * pi)^(- nDim / 2) is discarded
-///
-/// @param args Coordinates where the Gaussian should be evaluated
-/// @note args must be in a coordinate system with origin at the mean
-/// values of the Gaussian
-/// @param cov Covariance matrix
-///
-/// @return Multivariate Gaussian evaluated at args
-template <unsigned int nDim>
-double multivariateGaussian(const Vector<nDim>& args,
-                            const SquareMatrix<nDim>& cov) {
-  double exponent = -0.5 * args.transpose().dot(cov.inverse() * args);
-  double gaussianDensity = safeExp(exponent) / std::sqrt(cov.determinant());
-  return gaussianDensity;
-}
-
-}  // namespace
-
 double AdaptiveGridTrackDensity::getBinCenter(std::int32_t bin,
                                               double binExtent) {
   return bin * binExtent;
@@ -128,15 +106,6 @@ AdaptiveGridTrackDensity::AdaptiveGridTrackDensity(const Config& cfg)
   }
 }
 
-AdaptiveGridTrackDensity::DensityMap::const_iterator
-AdaptiveGridTrackDensity::highestDensityEntry(
-    const DensityMap& densityMap) const {
-  auto maxEntry = std::max_element(
-      std::begin(densityMap), std::end(densityMap),
-      [](const auto& a, const auto& b) { return a.second < b.second; });
-  return maxEntry;
-}
-
 Result<AdaptiveGridTrackDensity::ZTPosition>
 AdaptiveGridTrackDensity::getMaxZTPosition(DensityMap& densityMap) const {
   if (densityMap.empty()) {
@@ -145,7 +114,7 @@ AdaptiveGridTrackDensity::getMaxZTPosition(DensityMap& densityMap) const {
 
   Bin bin;
   if (!m_cfg.useHighestSumZPosition) {
-    bin = highestDensityEntry(densityMap)->first;
+    bin = densityMap.highestDensityEntry()->first;
   } else {
     // Get z position with highest density sum
     // of surrounding bins
@@ -206,18 +175,14 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::addTrack(
   DensityMap trackDensityMap = createTrackGrid(
       impactParams, centralBin, cov, spatialTrkGridSize, temporalTrkGridSize);
 
-  for (const auto& [bin, density] : trackDensityMap) {
-    mainDensityMap[bin] += density;
-  }
+  mainDensityMap.add(trackDensityMap);
 
   return trackDensityMap;
 }
 
 void AdaptiveGridTrackDensity::subtractTrack(const DensityMap& trackDensityMap,
                                              DensityMap& mainDensityMap) const {
-  for (const auto& [bin, density] : trackDensityMap) {
-    mainDensityMap[bin] -= density;
-  }
+  mainDensityMap.subtract(trackDensityMap);
 }
 
 AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
@@ -228,11 +193,34 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
 
   std::uint32_t halfSpatialTrkGridSize = (spatialTrkGridSize - 1) / 2;
   std::int32_t firstZBin = centralBin.first - halfSpatialTrkGridSize;
+  std::int32_t lastZBin = centralBin.first + halfSpatialTrkGridSize;
 
   // If we don't do time vertex seeding, firstTBin will be 0.
   std::uint32_t halfTemporalTrkGridSize = (temporalTrkGridSize - 1) / 2;
   std::int32_t firstTBin = centralBin.second - halfTemporalTrkGridSize;
 
+  // The Gaussian is evaluated at d = 0. Without time vertex seeding the
+  // time entries of the inverse covariance stay zero, which reduces it to
+  // the Gaussian in the d-z plane.
+  SquareMatrix3 invCov = SquareMatrix3::Zero();
+  double norm = 0;
+  if (m_cfg.useTime) {
+    invCov = cov.inverse();
+    norm = 1. / std::sqrt(cov.determinant());
+  } else {
+    invCov.topLeftCorner<2, 2>() = cov.topLeftCorner<2, 2>().inverse();
+    norm = 1. / std::sqrt(cov.topLeftCorner<2, 2>().determinant());
+  }
+  const double dD = -impactParams(0);
+
+  // Distances of the bin centers to the track in z direction
+  Eigen::ArrayXd dZ =
+      Eigen::ArrayXd::LinSpaced(spatialTrkGridSize, firstZBin, lastZBin) *
+          m_cfg.spatialBinExtent -
+      impactParams(1);
+  Eigen::ArrayXd exponent(spatialTrkGridSize);
+  Eigen::ArrayXd density(spatialTrkGridSize);
+
   // Loop over bins
   for (std::uint32_t i = 0; i < temporalTrkGridSize; i++) {
     std::int32_t tBin = firstTBin + i;
@@ -240,27 +228,29 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
     if (t < m_cfg.temporalWindow.first || t > m_cfg.temporalWindow.second) {
       continue;
     }
+    const double dT = t - impactParams(2);
+
+    // The exponent is a quadratic polynomial in dZ along a row of z bins,
+    // which is evaluated for all bins of the row at once
+    const double linear = 2. * (invCov(0, 1) * dD + invCov(1, 2) * dT);
+    const double constant = invCov(0, 0) * dD * dD +
+                            2. * invCov(0, 2) * dD * dT +
+                            invCov(2, 2) * dT * dT;
+    exponent = -0.5 * ((invCov(1, 1) * dZ + linear) * dZ + constant);
+    // Clamping before the exponential avoids FPEs in vectorized evaluation
+    density = (exponent < -ExpSafeLimit<double>::value)
+                  .select(0., exponent.max(-ExpSafeLimit<double>::value).exp() *
+                                  norm);
+
     for (std::uint32_t j = 0; j < spatialTrkGridSize; j++) {
       std::int32_t zBin = firstZBin + j;
       double z = getSpatialBinCenter(zBin);
       if (z < m_cfg.spatialWindow.first || z > m_cfg.spatialWindow.second) {
         continue;
       }
-      // Bin coordinates in the d-z-t plane
-      Vector3 binCoords(0., z, t);
-      // Transformation to coordinate system with origin at the track center
-      binCoords -= impactParams;
-      Bin bin = {zBin, tBin};
-      double density = 0;
-      if (m_cfg.useTime) {
-        density = multivariateGaussian<3>(binCoords, cov);
-      } else {
-        density = multivariateGaussian<2>(binCoords.head<2>(),
-                                          cov.topLeftCorner<2, 2>());
-      }
       // Only add density if it is positive (otherwise it is 0)
-      if (density > 0) {
-        trackDensityMap[bin] = density;
+      if (density(j) > 0) {
+        trackDensityMap[{zBin, tBin}] = static_cast<float>(density(j));
       }
     }
   }
@@ -337,7 +327,7 @@ Result<double> AdaptiveGridTrackDensity::estimateSeedWidth(
 AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
     DensityMap& densityMap) const {
   // The global maximum
-  auto firstMax = highestDensityEntry(densityMap);
+  auto firstMax = densityMap.highestDensityEntry();
   Bin binFirstMax = firstMax->first;
   double valueFirstMax = firstMax->second;
   double firstSum = getDensitySum(densityMap, binFirstMax);
@@ -347,7 +337,7 @@ AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
 
   // Get the second highest maximum
   densityMap[binFirstMax] = 0;
-  auto secondMax = highestDensityEntry(densityMap);
+  auto secondMax = densityMap.highestDensityEntry();
   Bin binSecondMax = secondMax->first;
   double valueSecondMax = secondMax->second;
   double secondSum = 0;
@@ -362,7 +352,7 @@ AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
 
   // Get the third highest maximum
   densityMap[binSecondMax] = 0;
-  auto thirdMax = highestDensityEntry(densityMap);
+  auto thirdMax = densityMap.highestDensityEntry();
   Bin binThirdMax = thirdMax->first;
   double valueThirdMax = thirdMax->second;
   double thirdSum = 0;
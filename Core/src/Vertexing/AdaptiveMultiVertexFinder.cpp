@@ -13,6 +13,7 @@
 #include "Acts/Vertexing/VertexingError.hpp"
 
 #include <algorithm>
+#include <optional>
 
 namespace Acts {
 
@@ -26,6 +27,10 @@ Result<std::vector<Vertex>> AdaptiveMultiVertexFinder::find(
   }
 
   State& state = anyState.template as<State>();
+  if (m_cfg.maxParallelCandidates > 1) {
+    return findWithParallelCandidates(allTracks, vertexingOptions, state);
+  }
+
   IVertexFinder::State& seedFinderState = state.seedFinderState;
   VertexFitterState fitterState(*m_cfg.bField,
                                 vertexingOptions.magFieldContext);
@@ -158,6 +163,335 @@ Result<std::vector<Vertex>> AdaptiveMultiVertexFinder::find(
   return getVertexOutputList(allVerticesPtr, fitterState);
 }
 
+Result<std::vector<Vertex>>
+AdaptiveMultiVertexFinder::findWithParallelCandidates(
+    const std::vector<InputTrack>& allTracks,
+    const VertexingOptions& vertexingOptions, State& state) const {
+  IVertexFinder::State& seedFinderState = state.seedFinderState;
+  VertexFitterState fitterState(*m_cfg.bField,
+                                vertexingOptions.magFieldContext);
+
+  std::vector<InputTrack> seedTracks = allTracks;
+  std::vector<std::unique_ptr<Vertex>> allVertices;
+  std::vector<Vertex*> allVerticesPtr;
+
+  int iteration = 0;
+  std::vector<InputTrack> removedSeedTracks;
+  while (!seedTracks.empty() && iteration < m_cfg.maxIterations &&
+         (m_cfg.addSingleTrackVertices || seedTracks.size() >= 2)) {
+    std::size_t maxCandidates = std::min<std::size_t>(
+        m_cfg.maxParallelCandidates, m_cfg.maxIterations - iteration);
+    auto candidatesResult =
+        seedCandidates(seedTracks, vertexingOptions, seedFinderState,
+                       removedSeedTracks, maxCandidates);
+    if (!candidatesResult.ok()) {
+      return candidatesResult.error();
+    }
+    std::vector<Candidate>& candidates = *candidatesResult;
+
+    if (candidates.empty()) {
+      ACTS_DEBUG(
+          "No seed found anymore. Break and stop primary vertex finding.");
+      break;
+    }
+    ACTS_DEBUG("Fitting " << candidates.size() << " vertex candidates");
+
+    // Clear the seed track collection that has been removed in last iteration
+    // now after seed finding is done
+    removedSeedTracks.clear();
+
+    // Tracks that are used for searching compatible tracks near a vertex
+    // candidate
+    const std::vector<InputTrack>& searchTracks =
+        m_cfg.doRealMultiVertex ? allTracks : seedTracks;
+
+    // Search the compatible tracks of each candidate with its own fitter
+    // state, the states are merged afterwards in candidate order
+    std::vector<std::optional<VertexFitterState>> candidateStates(
+        candidates.size());
+    std::vector<std::optional<Result<bool>>> prepResults(candidates.size());
+    forEachCandidate(candidates.size(), [&](std::size_t i) {
+      VertexFitterState& candidateState = candidateStates[i].emplace(
+          *m_cfg.bField, vertexingOptions.magFieldContext);
+      prepResults[i].emplace(canPrepareVertexForFit(
+          searchTracks, seedTracks, *candidates[i].vertex,
+          candidates[i].constraint, candidateState, vertexingOptions));
+    });
+
+    std::vector<Candidate> preparedCandidates;
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+      Result<bool>& prepResult = *prepResults[i];
+      if (!prepResult.ok()) {
+        return prepResult.error();
+      }
+      if (!(*prepResult)) {
+        ACTS_DEBUG("Could not prepare for fit. Discarding vertex candidate "
+                   << i << ".");
+        continue;
+      }
+      VertexFitterState& candidateState = *candidateStates[i];
+      Vertex* vtxPtr = candidates[i].vertex.get();
+      fitterState.vtxInfoMap[vtxPtr] =
+          std::move(candidateState.vtxInfoMap[vtxPtr]);
+      for (auto& [key, trkAtVtx] : candidateState.tracksAtVerticesMap) {
+        fitterState.tracksAtVerticesMap.insert_or_assign(key,
+                                                         std::move(trkAtVtx));
+      }
+      // Update fitter state with all vertices
+      fitterState.addVertexToMultiMap(*vtxPtr);
+      allVerticesPtr.push_back(vtxPtr);
+      preparedCandidates.push_back(std::move(candidates[i]));
+    }
+    if (preparedCandidates.empty()) {
+      ACTS_DEBUG("Could not prepare any vertex candidate for the fit.");
+      if (m_cfg.doNotBreakWhileSeeding) {
+        continue;
+      } else {
+        break;
+      }
+    }
+
+    // Candidates which are connected via shared tracks, directly or through
+    // previously found vertices, have to be fitted together. The groups are
+    // disjoint and can be fitted concurrently.
+    std::vector<std::vector<std::size_t>> fitGroups;
+    std::vector<bool> isGrouped(preparedCandidates.size(), false);
+    for (std::size_t i = 0; i < preparedCandidates.size(); ++i) {
+      if (isGrouped[i]) {
+        continue;
+      }
+      std::vector<Vertex*>& fitGroup = preparedCandidates[i].fitGroup;
+      fitGroup.push_back(preparedCandidates[i].vertex.get());
+      for (std::size_t k = 0; k < fitGroup.size(); ++k) {
+        const VertexInfo& vtxInfo = fitterState.vtxInfoMap.at(fitGroup[k]);
+        for (const auto& trk : vtxInfo.trackLinks) {
+          auto [begin, end] =
+              fitterState.trackToVerticesMultiMap.equal_range(trk);
+          for (auto it = begin; it != end; ++it) {
+            if (!rangeContainsValue(fitGroup, it->second)) {
+              fitGroup.push_back(it->second);
+            }
+          }
+        }
+      }
+      std::vector<std::size_t>& members = fitGroups.emplace_back();
+      for (std::size_t j = i; j < preparedCandidates.size(); ++j) {
+        if (rangeContainsValue(fitGroup, preparedCandidates[j].vertex.get())) {
+          members.push_back(j);
+          isGrouped[j] = true;
+          preparedCandidates[j].fitGroup = fitGroup;
+        }
+      }
+    }
+
+    // Fit each group on a copy of the fitter state restricted to its vertices
+    std::vector<std::optional<VertexFitterState>> groupStates(
+        fitGroups.size());
+    std::vector<Result<void>> fitResults(fitGroups.size());
+    forEachCandidate(fitGroups.size(), [&](std::size_t g) {
+      const std::vector<Vertex*>& fitGroup =
+          preparedCandidates[fitGroups[g].front()].fitGroup;
+      VertexFitterState& groupState = groupStates[g].emplace(
+          *m_cfg.bField, vertexingOptions.magFieldContext);
+      for (Vertex* vtx : fitGroup) {
+        const VertexInfo& vtxInfo = fitterState.vtxInfoMap.at(vtx);
+        groupState.vtxInfoMap.emplace(vtx, vtxInfo);
+        for (const auto& trk : vtxInfo.trackLinks) {
+          groupState.trackToVerticesMultiMap.emplace(trk, vtx);
+          groupState.tracksAtVerticesMap.emplace(
+              std::make_pair(trk, vtx),
+              fitterState.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
+        }
+      }
+      std::vector<Vertex*> newVertices;
+      for (std::size_t i : fitGroups[g]) {
+        newVertices.push_back(preparedCandidates[i].vertex.get());
+      }
+      fitResults[g] = m_cfg.vertexFitter.addVtxToFit(groupState, newVertices,
+                                                     vertexingOptions);
+    });
+
+    for (std::size_t g = 0; g < fitGroups.size(); ++g) {
+      if (!fitResults[g].ok()) {
+        return fitResults[g].error();
+      }
+      VertexFitterState& groupState = *groupStates[g];
+      for (auto& [vtx, vtxInfo] : groupState.vtxInfoMap) {
+        fitterState.vtxInfoMap[vtx] = std::move(vtxInfo);
+      }
+      for (auto& [key, trkAtVtx] : groupState.tracksAtVerticesMap) {
+        fitterState.tracksAtVerticesMap.insert_or_assign(key,
+                                                         std::move(trkAtVtx));
+      }
+    }
+
+    // Reconcile the candidates sequentially in seeding order
+    for (Candidate& candidate : preparedCandidates) {
+      Vertex& vtxCandidate = *candidate.vertex;
+
+      ACTS_DEBUG("Position of vertex candidate after the fit: "
+                 << vtxCandidate.fullPosition().transpose());
+      // Check if vertex is good vertex
+      auto [nCompatibleTracks, isGoodVertex] =
+          checkVertexAndCompatibleTracks(vtxCandidate, seedTracks, fitterState,
+                                         vertexingOptions.useConstraintInFit);
+
+      ACTS_DEBUG("Vertex is good vertex: " << isGoodVertex);
+      if (nCompatibleTracks > 0) {
+        removeCompatibleTracksFromSeedTracks(vtxCandidate, seedTracks,
+                                             fitterState, removedSeedTracks);
+      } else {
+        auto removedIncompatibleTrack = removeTrackIfIncompatible(
+            vtxCandidate, seedTracks, fitterState, removedSeedTracks,
+            vertexingOptions.geoContext);
+        if (!removedIncompatibleTrack.ok()) {
+          return removedIncompatibleTrack.error();
+        }
+      }
+      auto keepNewVertexResult =
+          keepNewVertex(vtxCandidate, allVerticesPtr, fitterState);
+      if (!keepNewVertexResult.ok()) {
+        return keepNewVertexResult.error();
+      }
+      bool keepVertex = isGoodVertex && *keepNewVertexResult;
+      ACTS_DEBUG("New vertex will be saved: " << keepVertex);
+
+      if (keepVertex) {
+        allVertices.push_back(std::move(candidate.vertex));
+        continue;
+      }
+      auto deleteVertexResult = deleteCandidateVertex(
+          candidate, allVerticesPtr, fitterState, vertexingOptions);
+      if (!deleteVertexResult.ok()) {
+        return deleteVertexResult.error();
+      }
+    }
+
+    iteration += static_cast<int>(preparedCandidates.size());
+  }  // end while loop
+
+  return getVertexOutputList(allVerticesPtr, fitterState);
+}
+
+Result<std::vector<AdaptiveMultiVertexFinder::Candidate>>
+AdaptiveMultiVertexFinder::seedCandidates(
+    const std::vector<InputTrack>& seedTracks,
+    const VertexingOptions& vertexingOptions,
+    IVertexFinder::State& seedFinderState,
+    const std::vector<InputTrack>& removedSeedTracks,
+    std::size_t maxCandidates) const {
+  std::vector<Candidate> candidates;
+
+  auto addCandidates = [&](std::vector<Vertex>& seedVector,
+                           const Vertex& constraint) {
+    for (Vertex& seedVertex : seedVector) {
+      if (candidates.size() == maxCandidates) {
+        break;
+      }
+      candidates.push_back(
+          {std::make_unique<Vertex>(seedVertex), constraint, {}});
+    }
+  };
+
+  Vertex currentConstraint = vertexingOptions.constraint;
+  auto seedResult = doSeeding(seedTracks, currentConstraint, vertexingOptions,
+                              seedFinderState, removedSeedTracks);
+  if (!seedResult.ok()) {
+    return seedResult.error();
+  }
+  addCandidates(*seedResult, currentConstraint);
+
+  // Speculative seeding does not touch the seed finder state of the finding
+  // loop, the tracks of the candidates are only removed from it once they
+  // have been fitted
+  std::optional<IVertexFinder::State> speculativeState;
+  std::vector<InputTrack> remainingTracks = seedTracks;
+  while (!candidates.empty() && candidates.size() < maxCandidates) {
+    auto isClose = [&](double z) {
+      return std::ranges::any_of(candidates, [&](const Candidate& candidate) {
+        return std::abs(z - candidate.vertex->position()[eZ]) <
+               m_cfg.parallelCandidateSeparation;
+      });
+    };
+
+    // Exclude the tracks close to the candidates from further seeding
+    std::vector<InputTrack> excludedTracks;
+    std::erase_if(remainingTracks, [&](const InputTrack& trk) {
+      auto pos =
+          m_cfg.extractParameters(trk).position(vertexingOptions.geoContext);
+      if (!isClose(pos[eZ])) {
+        return false;
+      }
+      excludedTracks.push_back(trk);
+      return true;
+    });
+    if (excludedTracks.empty() || remainingTracks.empty() ||
+        (!m_cfg.addSingleTrackVertices && remainingTracks.size() < 2)) {
+      break;
+    }
+
+    if (!speculativeState.has_value()) {
+      speculativeState.emplace(seedFinderState);
+    }
+    Vertex speculativeConstraint = vertexingOptions.constraint;
+    auto speculativeResult =
+        doSeeding(remainingTracks, speculativeConstraint, vertexingOptions,
+                  *speculativeState, excludedTracks);
+    if (!speculativeResult.ok()) {
+      return speculativeResult.error();
+    }
+    std::vector<Vertex>& speculativeSeeds = *speculativeResult;
+    if (speculativeSeeds.empty() ||
+        std::ranges::any_of(speculativeSeeds, [&](const Vertex& seedVertex) {
+          return isClose(seedVertex.position()[eZ]);
+        })) {
+      break;
+    }
+    addCandidates(speculativeSeeds, speculativeConstraint);
+  }
+
+  return candidates;
+}
+
+void AdaptiveMultiVertexFinder::forEachCandidate(
+    std::size_t n, const std::function<void(std::size_t)>& task) const {
+  if (m_cfg.forEachCandidate) {
+    m_cfg.forEachCandidate(n, task);
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    task(i);
+  }
+}
+
+Result<void> AdaptiveMultiVertexFinder::deleteCandidateVertex(
+    Candidate& candidate, std::vector<Vertex*>& allVerticesPtr,
+    VertexFitterState& fitterState,
+    const VertexingOptions& vertexingOptions) const {
+  Vertex* vtx = candidate.vertex.get();
+  std::erase(allVerticesPtr, vtx);
+
+  // Update fitter state with removed vertex candidate
+  fitterState.removeVertexFromMultiMap(*vtx);
+  // The vertex is destroyed below, so its entries must not outlive it
+  fitterState.vtxInfoMap.erase(vtx);
+  std::erase_if(fitterState.tracksAtVerticesMap,
+                [vtx](const auto& entry) { return entry.first.second == vtx; });
+
+  // Refit the remaining vertices of the fit group, which may include other
+  // candidates of this iteration that have been deleted before
+  std::erase(candidate.fitGroup, vtx);
+  std::erase_if(candidate.fitGroup, [&](Vertex* other) {
+    return !fitterState.vtxInfoMap.contains(other);
+  });
+  candidate.vertex.reset();
+  if (candidate.fitGroup.empty()) {
+    return {};
+  }
+  fitterState.vertexCollection = candidate.fitGroup;
+  return m_cfg.vertexFitter.fit(fitterState, vertexingOptions);
+}
+
 Result<std::vector<Vertex>> AdaptiveMultiVertexFinder::doSeeding(
     const std::vector<InputTrack>& trackVector, Vertex& currentConstraint,
     const VertexingOptions& vertexingOptions,
@@ -54,6 +54,9 @@ class ActsSolverFromMille final : public IAlgorithm {
     std::shared_ptr<const Acts::MagneticFieldProvider> magneticField;
     // modules to fix in the alignment to suppress global movements
     std::set<Acts::GeometryIdentifier> fixModules;
+    // options for solving the alignment equation, the sparse solvers scale
+    // to large numbers of modules
+    ActsAlignment::AlignmentSolverOptions solverOptions;
   };
 
   /// Constructor of the sandbox algorithm
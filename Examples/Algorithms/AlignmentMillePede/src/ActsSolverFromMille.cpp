@@ -19,6 +19,7 @@
 #include "ActsAlignment/Kernel/Alignment.hpp"
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsPlugins/Mille/ActsToMille.hpp"
 
 #include <memory>
@@ -31,6 +32,11 @@ ActsSolverFromMille::ActsSolverFromMille(
     Config cfg, std::unique_ptr<const Acts::Logger> logger)
     : IAlgorithm("ActsSolverFromMille", std::move(logger)),
       m_cfg(std::move(cfg)) {
+  // the solver threads are taken from TBB if it is enabled
+  if (!m_cfg.solverOptions.executor) {
+    m_cfg.solverOptions.executor = tbbWrap::parallelExecutor();
+  }
+
   // retrieve tracking geo
   m_trackingGeometry = m_cfg.trackingGeometry;
 
@@ -113,7 +119,12 @@ ProcessCode ActsSolverFromMille::finalize() {
   /// to calculate approximate track parameter & residual updates
   /// and then repeat the solution. As in Millepede, probably
   /// safe to keep the "big matrix" and only update the right hand side.
-  m_align->calculateAlignmentParameters(alignmentStates, alignResult);
+  m_align->calculateAlignmentParameters(alignmentStates, alignResult,
+                                        m_cfg.solverOptions);
+  if (!alignResult.result.ok()) {
+    ACTS_FATAL("Alignment fit failed: " << alignResult.result.error());
+    return ProcessCode::ABORT;
+  }
 
   /// in a real experiment, the results would be written out
   /// and stored e.g. in a DB file for further use / validation.
@@ -130,13 +141,22 @@ ProcessCode ActsSolverFromMille::finalize() {
   for (auto [surface, index] : alignResult.idxedAlignSurfaces) {
     ACTS_INFO(std::setw(20)
               << " Surface with geo ID " << surface->geometryId() << ": ");
+    // The covariance blocks are only filled if the solver computed them
+    const bool hasCovariance =
+        index < alignResult.alignmentCovarianceBlocks.size();
     for (std::size_t i = 0; i < Acts::eAlignmentSize; ++i) {
       std::size_t row = Acts::eAlignmentSize * index + i;
-      ACTS_INFO(std::setw(20)
-                << parLabels[i] << " = " << std::setw(10)
-                << alignResult.deltaAlignmentParameters(row) << std::setw(6)
-                << " +/- " << std::setw(10)
-                << std::sqrt(alignResult.alignmentCovariance(row, row)));
+      if (hasCovariance) {
+        const Acts::AlignmentMatrix& covariance =
+            alignResult.alignmentCovarianceBlocks[index];
+        ACTS_INFO(std::setw(20)
+                  << parLabels[i] << " = " << std::setw(10)
+                  << alignResult.deltaAlignmentParameters(row) << std::setw(6)
+                  << " +/- " << std::setw(10) << std::sqrt(covariance(i, i)));
+      } else {
+        ACTS_INFO(std::setw(20) << parLabels[i] << " = " << std::setw(10)
+                                << alignResult.deltaAlignmentParameters(row));
+      }
     }
   }
 
@@ -46,6 +46,10 @@ class GreedyAmbiguityResolutionAlgorithm final : public IAlgorithm {
 
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+
+    /// Resolve on the shared hit graph with a priority queue. This gives the
+    /// same tracks and scales better with the number of tracks.
+    bool useSharedHitGraph = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
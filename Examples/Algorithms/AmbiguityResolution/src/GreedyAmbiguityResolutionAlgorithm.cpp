@@ -29,6 +29,7 @@ Acts::GreedyAmbiguityResolution::Config transformConfig(
   result.maximumSharedHits = cfg.maximumSharedHits;
   result.maximumIterations = cfg.maximumIterations;
   result.nMeasurementsMin = cfg.nMeasurementsMin;
+  result.useSharedHitGraph = cfg.useSharedHitGraph;
   return result;
 }
 
@@ -13,11 +13,11 @@
 #include "ActsExamples/Digitization/MeasurementCreation.hpp"
 #include "ActsExamples/EventData/SimHit.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdlib>
 #include <limits>
-#include <map>
 #include <stdexcept>
 
 namespace ActsExamples {
@@ -86,27 +86,35 @@ void clusterAddCell(std::vector<ModuleValue>& cl, const ModuleValue& ce) {
 }
 
 std::vector<ModuleValue> ModuleClusters::createCellCollection() {
-  std::map<ActsFatras::Segmentizer::Bin2D, ModuleValue> uniqueCells;
+  std::vector<ModuleValue> cells;
   for (const ModuleValue& mval : m_moduleValues) {
-    if (!std::holds_alternative<Cluster::Cell>(mval.value)) {
-      continue;
+    if (std::holds_alternative<Cluster::Cell>(mval.value)) {
+      cells.push_back(mval);
     }
-    const auto& cell = std::get<Cluster::Cell>(mval.value).bin;
+  }
 
-    if (const auto it = uniqueCells.find(cell); it != uniqueCells.end()) {
-      // Cell already exists, so merge the hit sources
-      std::get<Cluster::Cell>(it->second.value).activation +=
-          std::get<Cluster::Cell>(mval.value).activation;
-    } else {
-      // New cell
-      uniqueCells[cell] = mval;
+  // Sort column-wise as required by the sorted clustering, keeping the
+  // insertion order of duplicate cells
+  auto bin = [](const ModuleValue& mval) {
+    const auto& cell = std::get<Cluster::Cell>(mval.value).bin;
+    return std::pair(cell[1], cell[0]);
+  };
+  std::ranges::stable_sort(cells, {}, bin);
+
+  // Merge the activations of duplicate cells into the first occurrence
+  std::size_t nUnique = 0;
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    if (nUnique > 0 && bin(cells[i]) == bin(cells[nUnique - 1])) {
+      std::get<Cluster::Cell>(cells[nUnique - 1].value).activation +=
+          std::get<Cluster::Cell>(cells[i].value).activation;
+      continue;
     }
+    if (i != nUnique) {
+      cells[nUnique] = std::move(cells[i]);
+    }
+    ++nUnique;
   }
-  std::vector<ModuleValue> cells;
-  cells.reserve(uniqueCells.size());
-  for (const auto& [_, mval] : uniqueCells) {
-    cells.push_back(mval);
-  }
+  cells.erase(cells.begin() + nUnique, cells.end());
   return cells;
 }
 
@@ -116,11 +124,12 @@ void ModuleClusters::merge() {
   std::vector<ModuleValue> newVals;
 
   if (!cells.empty()) {
-    // Case where we actually have geometric clusters
-    Acts::Ccl::ClusteringData data;
+    // Case where we actually have geometric clusters. The clustering
+    // buffers are reused across the modules processed by this thread.
+    static thread_local Acts::Ccl::SortedClusteringData data;
     std::vector<std::vector<ModuleValue>> merged;
-    Acts::Ccl::createClusters<std::vector<ModuleValue>,
-                              std::vector<std::vector<ModuleValue>>>(
+    Acts::Ccl::createSortedClusters<std::vector<ModuleValue>,
+                                    std::vector<std::vector<ModuleValue>>>(
         data, cells, merged,
         Acts::Ccl::DefaultConnect<ModuleValue>(m_commonCorner));
 
@@ -21,8 +21,14 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/task_arena.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 /// Fast track simulation using the Acts propagation and navigation.
@@ -73,6 +79,15 @@ class FatrasSimulation final : public IAlgorithm {
     /// algorithm function. It is used to guess the amount of memory to
     /// pre-allocate to avoid allocation during event simulation.
     std::size_t averageHitsPerParticle = 16u;
+
+    /// Use a separate random stream for each input particle, derived from the
+    /// event seed and the particle id, instead of one stream for the event.
+    /// The output then does not depend on the order in which the particles
+    /// are simulated. Always enabled if `numThreads` is not 1.
+    bool perParticleRandomStreams = false;
+    /// Number of threads used to simulate the input particles of one event,
+    /// -1 uses all available threads and 1 simulates them sequentially.
+    int numThreads = 1;
   };
 
   /// Construct the algorithm from a config.
@@ -103,6 +118,7 @@ class FatrasSimulation final : public IAlgorithm {
 
   Config m_cfg;
   std::unique_ptr<Impl> m_sim;
+  mutable std::optional<tbb::task_arena> m_arena;
 };
 
 }  // namespace ActsExamples
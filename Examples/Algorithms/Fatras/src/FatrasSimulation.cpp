@@ -39,6 +39,11 @@
 #include <utility>
 #include <vector>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/parallel_for.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 namespace {
@@ -157,6 +162,33 @@ struct FatrasSimulation::Impl {
                                simulatedParticlesInitial,
                                simulatedParticlesFinal, simHits);
   }
+
+  Acts::Result<std::vector<ActsFatras::FailedParticle>> simulateIndependently(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, const RandomEngine &rng,
+      const std::vector<ActsFatras::Particle> &inputParticles,
+      std::vector<ActsFatras::Particle> &simulatedParticlesInitial,
+      std::vector<ActsFatras::Particle> &simulatedParticlesFinal,
+      std::vector<ActsFatras::Hit> &simHits,
+      tbb::task_arena *arena) const {
+    auto makeGenerator = [&rng](const ActsFatras::Particle &particle) {
+      return rng.combinedWith(particle.particleId().hash());
+    };
+    auto forEach = [arena](std::size_t n, const auto &simulateOne) {
+      if (arena == nullptr) {
+        for (std::size_t i = 0; i < n; ++i) {
+          simulateOne(i);
+        }
+        return;
+      }
+      arena->execute([&]() {
+        tbb::parallel_for(std::size_t{0}, n, std::size_t{1}, simulateOne);
+      });
+    };
+    return simulation.simulateIndependently(
+        geoCtx, magCtx, makeGenerator, inputParticles,
+        simulatedParticlesInitial, simulatedParticlesFinal, simHits, forEach);
+  }
 };
 
 FatrasSimulation::FatrasSimulation(Config cfg,
@@ -189,6 +221,14 @@ FatrasSimulation::FatrasSimulation(Config cfg,
     throw std::invalid_argument("Missing random numbers tool");
   }
 
+  if (m_cfg.numThreads == 0 || m_cfg.numThreads < -1) {
+    throw std::invalid_argument("Invalid config numThreads");
+  }
+  if (m_cfg.numThreads != 1) {
+    m_arena.emplace(m_cfg.numThreads == -1 ? tbb::task_arena::automatic
+                                           : m_cfg.numThreads);
+  }
+
   // construct the simulation for the specific magnetic field
   m_sim = std::make_unique<Impl>(m_cfg, this->logger());
 
@@ -225,9 +265,15 @@ ProcessCode FatrasSimulation::execute(const AlgorithmContext &ctx) const {
 
   // run the simulation w/ a local random generator
   auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             particlesInput, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
+  auto ret = (m_cfg.perParticleRandomStreams || m_arena.has_value())
+                 ? m_sim->simulateIndependently(
+                       ctx.geoContext, ctx.magFieldContext, rng,
+                       particlesInput, particlesInitialUnordered,
+                       particlesFinalUnordered, simHitsUnordered,
+                       m_arena.has_value() ? &*m_arena : nullptr)
+                 : m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                                   particlesInput, particlesInitialUnordered,
+                                   particlesFinalUnordered, simHitsUnordered);
   // fatal error leads to panic
   if (!ret.ok()) {
     ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
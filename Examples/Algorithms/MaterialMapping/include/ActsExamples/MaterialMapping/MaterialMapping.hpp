@@ -15,7 +15,9 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,6 +36,11 @@ namespace ActsExamples {
 ///
 /// It therefore saves the mapping state/cache as a private member variable
 /// and is designed to be executed in a single threaded mode.
+///
+/// With `concurrentMapping` enabled, every event is mapped into its own sparse
+/// partial state instead. The partial states are kept until the end of the
+/// run and then merged into the shared state in event number order, so the
+/// maps do not depend on the order in which the threads process the events.
 class MaterialMapping : public IAlgorithm {
  public:
   /// @class nested Config class
@@ -57,6 +64,11 @@ class MaterialMapping : public IAlgorithm {
 
     /// The writer of the material
     std::vector<std::shared_ptr<IMaterialWriter>> materialWriters{};
+
+    /// Map every event into its own partial state and merge them in event
+    /// order at the end of the run, this allows running the algorithm
+    /// multi-threaded
+    bool concurrentMapping = false;
   };
 
   /// Constructor
@@ -83,6 +95,13 @@ class MaterialMapping : public IAlgorithm {
 
   std::unique_ptr<Acts::MaterialMapper::State> m_mappingState{nullptr};
 
+  /// Partial states of the mapped events, merged in event number order at the
+  /// end of the run
+  mutable std::map<std::size_t, std::unique_ptr<Acts::MaterialMapper::State>>
+      m_partialStates;
+  /// Protects the partial states
+  mutable std::mutex m_partialStatesMutex;
+
   ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
 
@@ -12,8 +12,10 @@
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -25,9 +27,11 @@ MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
   m_outputMappedMaterialTracks.initialize(m_cfg.mappedMaterialTracks);
   m_outputUnmappedMaterialTracks.initialize(m_cfg.unmappedMaterialTracks);
 
-  ACTS_LOG_WITH_LOGGER(this->logger(), Acts::Logging::INFO,
-                       "This algorithm requires inter-event information, "
-                           << "run in single-threaded mode!");
+  if (!m_cfg.concurrentMapping) {
+    ACTS_LOG_WITH_LOGGER(this->logger(), Acts::Logging::INFO,
+                         "This algorithm requires inter-event information, "
+                             << "run in single-threaded mode!");
+  }
 
   if (m_cfg.materialMapper == nullptr) {
     throw std::invalid_argument("Missing material mapper");
@@ -37,6 +41,12 @@ MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
 }
 
 MaterialMapping::~MaterialMapping() {
+  // Merge the partial states in event number order, independent of the order
+  // in which the events were processed
+  for (auto& [eventNumber, partialState] : m_partialStates) {
+    m_cfg.materialMapper->mergeState(*m_mappingState, *partialState);
+  }
+  m_partialStates.clear();
   Acts::TrackingGeometryMaterial detectorMaterial =
       m_cfg.materialMapper->finalizeMaps(*m_mappingState, m_cfg.geoContext);
   // Loop over the available writers and write the maps
@@ -57,14 +67,40 @@ ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
   std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
       unmappedTrackCollection;
 
-  for (const auto& [idTrack, mTrack] : mtrackCollection) {
-    auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
-        *m_mappingState, context.geoContext, context.magFieldContext, mTrack);
-
-    mappedTrackCollection.try_emplace(mappedTrackCollection.end(), idTrack,
-                                      mapped);
-    unmappedTrackCollection.try_emplace(unmappedTrackCollection.end(), idTrack,
-                                        unmapped);
+  if (!m_cfg.concurrentMapping) {
+    for (const auto& [idTrack, mTrack] : mtrackCollection) {
+      auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
+          *m_mappingState, context.geoContext, context.magFieldContext, mTrack);
+
+      mappedTrackCollection.try_emplace(mappedTrackCollection.end(), idTrack,
+                                        mapped);
+      unmappedTrackCollection.try_emplace(unmappedTrackCollection.end(),
+                                          idTrack, unmapped);
+    }
+  } else {
+    // Map the tracks in a fixed order into a partial state of this event
+    std::vector<std::size_t> trackIds;
+    trackIds.reserve(mtrackCollection.size());
+    for (const auto& [idTrack, mTrack] : mtrackCollection) {
+      trackIds.push_back(idTrack);
+    }
+    std::ranges::sort(trackIds);
+
+    auto partialState = m_cfg.materialMapper->createPartialState(
+        *m_mappingState);
+    for (std::size_t idTrack : trackIds) {
+      auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
+          *partialState, context.geoContext, context.magFieldContext,
+          mtrackCollection.at(idTrack));
+
+      mappedTrackCollection.try_emplace(mappedTrackCollection.end(), idTrack,
+                                        mapped);
+      unmappedTrackCollection.try_emplace(unmappedTrackCollection.end(),
+                                          idTrack, unmapped);
+    }
+
+    std::lock_guard<std::mutex> lock(m_partialStatesMutex);
+    m_partialStates.emplace(context.eventNumber, std::move(partialState));
   }
 
   // Write the mapped and unmapped material tracks to the output
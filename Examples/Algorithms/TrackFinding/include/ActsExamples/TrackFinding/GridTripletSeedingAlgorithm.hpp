@@ -21,10 +21,16 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/task_arena.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 /// Construct track seeds from space points.
@@ -228,6 +234,11 @@ class GridTripletSeedingAlgorithm final : public IAlgorithm {
     /// Connect custom selections on the space points or to the doublet
     /// compatibility
     bool useExtraCuts = false;
+
+    /// Number of threads used to find the doublets and triplets of the middle
+    /// space point groups of one event, -1 uses all available threads and 1
+    /// processes the groups sequentially. The seeds do not depend on it.
+    int numGroupThreads = 1;
   };
 
   /// Construct the seeding algorithm.
@@ -255,6 +266,7 @@ class GridTripletSeedingAlgorithm final : public IAlgorithm {
   Acts::BroadTripletSeedFilter::Config m_filterConfig;
   std::unique_ptr<const Acts::Logger> m_filterLogger;
   std::optional<Acts::TripletSeeder> m_seedFinder;
+  mutable std::optional<tbb::task_arena> m_groupArena;
 
   Acts::Delegate<bool(const ConstSpacePointProxy&)> m_spacePointSelector;
 
@@ -16,6 +16,7 @@
 #include "Acts/Seeding2/GbtsLayerConnection.hpp"
 #include "Acts/Seeding2/GbtsTrackingFilter.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <cmath>
 #include <fstream>
@@ -59,6 +60,11 @@ GraphBasedSeedingAlgorithm::GraphBasedSeedingAlgorithm(
   auto geometry = std::make_shared<Acts::Experimental::GbtsGeometry>(
       layerGeometry, layerConnectionMap);
 
+  // the parallel stages of the seeder share the threads of the sequencer
+  if (!m_cfg.seedFinderConfig.executor) {
+    m_cfg.seedFinderConfig.executor = tbbWrap::parallelExecutor();
+  }
+
   m_finder = Acts::Experimental::GraphBasedTrackSeeder(
       Acts::Experimental::GraphBasedTrackSeeder::DerivedConfig(
           m_cfg.seedFinderConfig),
@@ -424,6 +430,7 @@ void GraphBasedSeedingAlgorithm::printConfig() const {
   ACTS_DEBUG("useEtaBinning: " << cfg1.useEtaBinning);
   ACTS_DEBUG("doubletFilterRZ: " << cfg1.doubletFilterRZ);
   ACTS_DEBUG("nMaxEdges: " << cfg1.nMaxEdges);
+  ACTS_DEBUG("numThreads: " << cfg1.numThreads);
   ACTS_DEBUG("minDeltaRadius: " << cfg1.minDeltaRadius);
   ACTS_DEBUG("edgeMaskMinEta: " << cfg1.edgeMaskMinEta);
   ACTS_DEBUG("hitShareThreshold: " << cfg1.hitShareThreshold);
@@ -23,6 +23,13 @@
 #include <cstddef>
 #include <stdexcept>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 namespace {
@@ -127,6 +134,15 @@ GridTripletSeedingAlgorithm::GridTripletSeedingAlgorithm(
   m_filterLogger = this->logger().cloneWithSuffix("Filter");
 
   m_seedFinder = Acts::TripletSeeder(this->logger().cloneWithSuffix("Finder"));
+
+  if (m_cfg.numGroupThreads == 0 || m_cfg.numGroupThreads < -1) {
+    throw std::invalid_argument("Invalid config numGroupThreads");
+  }
+  if (m_cfg.numGroupThreads != 1) {
+    m_groupArena.emplace(m_cfg.numGroupThreads == -1
+                             ? tbb::task_arena::automatic
+                             : m_cfg.numGroupThreads);
+  }
 }
 
 ProcessCode GridTripletSeedingAlgorithm::execute(
@@ -258,47 +274,87 @@ ProcessCode GridTripletSeedingAlgorithm::execute(
                                           filterCache, *m_filterLogger);
   static thread_local Acts::TripletSeeder::Cache cache;
 
-  std::vector<Acts::SpacePointContainer2::ConstRange> bottomSpRanges;
-  std::optional<Acts::SpacePointContainer2::ConstRange> middleSpRange;
-  std::vector<Acts::SpacePointContainer2::ConstRange> topSpRanges;
-
-  Acts::SeedContainer2 seeds;
-  seeds.assignSpacePointContainer(spacePoints);
+  struct SpacePointGroup {
+    std::vector<Acts::SpacePointContainer2::ConstRange> bottomSpRanges;
+    Acts::SpacePointContainer2::ConstRange middleSpRange;
+    std::vector<Acts::SpacePointContainer2::ConstRange> topSpRanges;
+    std::pair<float, float> radiusRangeForMiddle;
+  };
+  std::vector<SpacePointGroup> groups;
 
   for (const auto [bottom, middle, top] : grid.binnedGroup()) {
     ACTS_VERBOSE("Process middle " << middle);
 
-    bottomSpRanges.clear();
+    const Acts::SpacePointContainer2::ConstRange middleSpRange =
+        coreSpacePoints.range(gridSpacePointRanges.at(middle)).asConst();
+    if (middleSpRange.empty()) {
+      ACTS_DEBUG("No middle space points in this group, skipping");
+      continue;
+    }
+
+    std::vector<Acts::SpacePointContainer2::ConstRange> bottomSpRanges;
     for (const auto b : bottom) {
       bottomSpRanges.push_back(
           coreSpacePoints.range(gridSpacePointRanges.at(b)).asConst());
     }
-    middleSpRange =
-        coreSpacePoints.range(gridSpacePointRanges.at(middle)).asConst();
-    topSpRanges.clear();
+    std::vector<Acts::SpacePointContainer2::ConstRange> topSpRanges;
     for (const auto t : top) {
       topSpRanges.push_back(
           coreSpacePoints.range(gridSpacePointRanges.at(t)).asConst());
     }
 
-    if (middleSpRange->empty()) {
-      ACTS_DEBUG("No middle space points in this group, skipping");
-      continue;
-    }
-
     // we compute this here since all middle space point candidates belong to
     // the same z-bin
-    Acts::ConstSpacePointProxy2 firstMiddleSp = middleSpRange->front();
+    Acts::ConstSpacePointProxy2 firstMiddleSp = middleSpRange.front();
     std::pair<float, float> radiusRangeForMiddle =
         retrieveRadiusRangeForMiddle(firstMiddleSp, rMiddleSpRange);
     ACTS_VERBOSE("Validity range (radius) for the middle space point is ["
                  << radiusRangeForMiddle.first << ", "
                  << radiusRangeForMiddle.second << "]");
 
-    m_seedFinder->createSeedsFromGroups(
-        cache, *bottomDoubletFinder, *topDoubletFinder, *tripletFinder,
-        seedFilter, coreSpacePoints, bottomSpRanges, *middleSpRange,
-        topSpRanges, radiusRangeForMiddle, seeds);
+    groups.push_back({std::move(bottomSpRanges), middleSpRange,
+                      std::move(topSpRanges), radiusRangeForMiddle});
+  }
+
+  Acts::SeedContainer2 seeds;
+  seeds.assignSpacePointContainer(spacePoints);
+
+  if (!m_groupArena.has_value()) {
+    for (SpacePointGroup& group : groups) {
+      m_seedFinder->createSeedsFromGroups(
+          cache, *bottomDoubletFinder, *topDoubletFinder, *tripletFinder,
+          seedFilter, coreSpacePoints, group.bottomSpRanges,
+          group.middleSpRange, group.topSpRanges, group.radiusRangeForMiddle,
+          seeds);
+    }
+  } else {
+    // The doublets and triplets of the groups are found concurrently with one
+    // cache per thread. The seed filter carries state from one middle space
+    // point to the next, so it is applied sequentially in the group order
+    // which gives the same seeds as the sequential processing.
+    std::vector<Acts::TripletSeeder::CandidateRecord> records(groups.size());
+    tbb::enumerable_thread_specific<Acts::TripletSeeder::Cache> groupCaches;
+
+    m_groupArena->execute([&]() {
+      tbb::parallel_for(
+          tbb::blocked_range<std::size_t>(0, groups.size()),
+          [&](const tbb::blocked_range<std::size_t>& range) {
+            Acts::TripletSeeder::Cache& groupCache = groupCaches.local();
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+              SpacePointGroup& group = groups[i];
+              m_seedFinder->recordCandidatesFromGroups(
+                  groupCache, *bottomDoubletFinder, *topDoubletFinder,
+                  *tripletFinder, coreSpacePoints, group.bottomSpRanges,
+                  group.middleSpRange, group.topSpRanges,
+                  group.radiusRangeForMiddle, records[i]);
+            }
+          });
+    });
+
+    for (const Acts::TripletSeeder::CandidateRecord& record : records) {
+      m_seedFinder->filterRecordedCandidates(cache, seedFilter,
+                                             coreSpacePoints, record, seeds);
+    }
   }
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
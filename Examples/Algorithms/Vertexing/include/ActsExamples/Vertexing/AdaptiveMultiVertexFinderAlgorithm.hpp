@@ -28,9 +28,15 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/task_arena.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
@@ -90,6 +96,15 @@ class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
     double temporalBinExtent = 19. * Acts::UnitConstants::mm;
     /// Number of simultaneous seeds that should be created by the vertex seeder
     std::size_t simultaneousSeeds = 1;
+    /// Maximum number of vertex candidates seeded and fitted per finder
+    /// iteration. For more information look at `AdaptiveMultiVertexFinder.hpp`
+    std::size_t maxParallelCandidates = 1;
+    /// Minimum z distance between the candidates of one finder iteration
+    double parallelCandidateSeparation = 10. * Acts::UnitConstants::mm;
+    /// Number of threads used to process the vertex candidates of one finder
+    /// iteration, -1 uses all available threads and 1 processes them
+    /// sequentially. The found vertices do not depend on it.
+    int numCandidateThreads = 1;
   };
 
   explicit AdaptiveMultiVertexFinderAlgorithm(
@@ -117,6 +132,8 @@ class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
   Acts::ImpactPointEstimator m_ipEstimator;
   Linearizer m_linearizer;
   std::shared_ptr<Acts::IVertexFinder> m_vertexSeeder;
+  /// Arena for processing vertex candidates concurrently, if enabled
+  mutable std::optional<tbb::task_arena> m_candidateArena;
   Acts::AdaptiveMultiVertexFinder m_vertexFinder;
 
   ReadDataHandle<TrackParametersContainer> m_inputTrackParameters{
@@ -29,6 +29,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -36,6 +37,11 @@
 #include <system_error>
 #include <utility>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/parallel_for.h>
+#pragma GCC diagnostic pop
+
 #include "TruthVertexSeeder.hpp"
 #include "VertexingHelpers.hpp"
 
@@ -83,6 +89,14 @@ AdaptiveMultiVertexFinderAlgorithm::AdaptiveMultiVertexFinderAlgorithm(
       m_cfg.inputTruthVertices.empty()) {
     throw std::invalid_argument("Missing input truth vertex collection");
   }
+  if (m_cfg.numCandidateThreads == 0 || m_cfg.numCandidateThreads < -1) {
+    throw std::invalid_argument("Invalid config numCandidateThreads");
+  }
+  if (m_cfg.numCandidateThreads != 1) {
+    m_candidateArena.emplace(m_cfg.numCandidateThreads == -1
+                                 ? tbb::task_arena::automatic
+                                 : m_cfg.numCandidateThreads);
+  }
 
   // Sanitize the configuration
   if (m_cfg.seedFinder != SeedFinder::TruthSeeder &&
@@ -200,6 +214,22 @@ AdaptiveMultiVertexFinderAlgorithm::makeVertexFinder(
       m_cfg.maxMergeVertexSignificance.value_or(
           finderConfig.maxMergeVertexSignificance);
 
+  finderConfig.maxParallelCandidates = m_cfg.maxParallelCandidates;
+  finderConfig.parallelCandidateSeparation = m_cfg.parallelCandidateSeparation;
+  // The arena is created in the constructor body, after the finder
+  finderConfig.forEachCandidate =
+      [this](std::size_t n, const std::function<void(std::size_t)>& task) {
+        if (!m_candidateArena.has_value()) {
+          for (std::size_t i = 0; i < n; ++i) {
+            task(i);
+          }
+          return;
+        }
+        m_candidateArena->execute([&]() {
+          tbb::parallel_for(std::size_t{0}, n, std::size_t{1}, task);
+        });
+      };
+
   // Instantiate the finder
   return Acts::AdaptiveMultiVertexFinder(std::move(finderConfig),
                                          logger().clone());
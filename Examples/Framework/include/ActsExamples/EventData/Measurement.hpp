@@ -20,6 +20,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <memory_resource>
 #include <type_traits>
 #include <vector>
 
@@ -66,6 +67,13 @@ class MeasurementContainer {
 
   MeasurementContainer();
 
+  /// @brief Construct an empty container which allocates its storage from
+  ///        the given memory resource
+  /// @param memoryResource The memory resource, which has to outlive the
+  ///        container. Copies of the container use the default resource.
+  /// @note The geometry-ordered index is always allocated from the heap.
+  explicit MeasurementContainer(std::pmr::memory_resource* memoryResource);
+
   /// @brief Get the number of measurements
   /// @return The number of measurements
   std::size_t size() const;
@@ -167,12 +175,12 @@ class MeasurementContainer {
     std::uint8_t size{};
   };
 
-  std::vector<MeasurementEntry> m_entries;
+  std::pmr::vector<MeasurementEntry> m_entries;
 
-  std::vector<Acts::GeometryIdentifier> m_geometryIds;
-  std::vector<std::uint8_t> m_subspaceIndices;
-  std::vector<double> m_parameters;
-  std::vector<double> m_covariances;
+  std::pmr::vector<Acts::GeometryIdentifier> m_geometryIds;
+  std::pmr::vector<std::uint8_t> m_subspaceIndices;
+  std::pmr::vector<double> m_parameters;
+  std::pmr::vector<double> m_covariances;
 
   OrderedIndices m_orderedIndices;
 };
@@ -13,6 +13,8 @@
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "ActsPlugins/FpeMonitoring/FpeMonitor.hpp"
 
+#include <memory_resource>
+
 namespace ActsExamples {
 
 class WhiteBoard;
@@ -53,6 +55,12 @@ struct AlgorithmContext {
   std::size_t threadId;                   ///< Thread ID
 
   ActsPlugins::FpeMonitor* fpeMonitor = nullptr;
+
+  /// Per-event memory resource for containers which are stored on the white
+  /// board. Memory taken from it must not be used after the event has been
+  /// processed.
+  std::pmr::memory_resource* memoryResource =
+      std::pmr::get_default_resource();
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,111 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Monotonic memory arena for the data of a single event.
+///
+/// Allocations are served from a contiguous buffer and are only released as
+/// a whole by `reset()`. If an event needs more memory than the buffer
+/// provides, the surplus is taken from the heap and the buffer is enlarged to
+/// the peak usage on the next reset, so that subsequent events are served
+/// without touching the heap at all.
+///
+/// @note Memory allocated from the arena must not be used after `reset()`.
+class EventArena final : public std::pmr::memory_resource {
+ public:
+  /// @param initialSize size of the initial buffer in bytes
+  /// @param synchronized whether allocations have to be thread-safe, which
+  ///        is needed if sequence elements of one event run concurrently
+  EventArena(std::size_t initialSize, bool synchronized);
+
+  EventArena(const EventArena&) = delete;
+  EventArena& operator=(const EventArena&) = delete;
+
+  /// Release all allocations and grow the buffer to the peak usage.
+  void reset();
+
+  /// Size of the buffer in bytes
+  std::size_t capacity() const { return m_capacity; }
+
+  /// Number of bytes allocated since the last reset
+  std::size_t allocated() const { return m_allocated; }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+  std::unique_ptr<std::byte[]> m_buffer;
+  std::size_t m_capacity = 0;
+  std::size_t m_allocated = 0;
+  std::optional<std::pmr::monotonic_buffer_resource> m_resource;
+
+  bool m_synchronized;
+  std::mutex m_mutex;
+};
+
+/// Pool of event arenas which are reused across events.
+///
+/// An arena is taken by an event and handed back at its end rather than being
+/// bound to a thread, because the task scheduler may start another event on a
+/// thread which is still waiting for the sequence elements of its current
+/// event.
+class EventArenaPool {
+ public:
+  /// Exclusive access to one arena for the duration of an event. The arena is
+  /// reset and returned to the pool on destruction.
+  class Lease {
+   public:
+    Lease() = default;
+    Lease(EventArenaPool& pool, std::unique_ptr<EventArena> arena)
+        : m_pool(&pool), m_arena(std::move(arena)) {}
+    Lease(Lease&&) noexcept = default;
+    Lease& operator=(Lease&&) noexcept = delete;
+    ~Lease();
+
+    /// The leased arena, or nullptr if nothing is leased
+    EventArena* get() const { return m_arena.get(); }
+
+   private:
+    EventArenaPool* m_pool = nullptr;
+    std::unique_ptr<EventArena> m_arena;
+  };
+
+  /// @param initialSize initial buffer size of newly created arenas in bytes
+  /// @param synchronized whether the arenas have to be thread-safe
+  EventArenaPool(std::size_t initialSize, bool synchronized)
+      : m_initialSize(initialSize), m_synchronized(synchronized) {}
+
+  /// Take a free arena or create a new one if all are in use.
+  Lease acquire();
+
+  /// Number of arenas created so far
+  std::size_t size() const;
+
+ private:
+  std::size_t m_initialSize;
+  bool m_synchronized;
+
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<EventArena>> m_free;
+  std::size_t m_size = 0;
+};
+
+}  // namespace ActsExamples
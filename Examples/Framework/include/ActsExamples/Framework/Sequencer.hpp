@@ -73,6 +73,26 @@ class Sequencer {
     std::string outputDir;
     /// output name of the timing file
     std::string outputTimingFile = "timing.csv";
+    /// output name of the critical path timing file, only written if
+    /// intra-event parallelism is enabled
+    std::string outputCriticalPathFile = "timing_critical_path.csv";
+    /// If true, the sequence elements of a single event are scheduled
+    /// according to the dependency graph derived from their data handles, so
+    /// that independent elements run concurrently. The event loop remains
+    /// parallel across events as well.
+    /// @note An element that has neither read nor write handles is treated
+    ///       as a barrier, i.e. it runs after all preceding elements and
+    ///       before all following ones.
+    /// @note If an element signals to skip the event, elements which do not
+    ///       depend on it might already have been executed.
+    bool intraEventParallelism = false;
+    /// If true, every event gets a monotonic memory arena, which is exposed
+    /// to the sequence elements via `AlgorithmContext::memoryResource`. The
+    /// arenas are reset and reused between events.
+    bool useEventArena = false;
+    /// Initial size of each event arena in bytes. An arena grows to the peak
+    /// usage of the events it served.
+    std::size_t eventArenaSize = 1 << 20;
     /// Callback that is invoked in the event loop.
     /// @warning This function can be called from multiple threads and should therefore be thread-safe
     IterationCallback iterationCallback = []() {};
@@ -167,6 +187,13 @@ class Sequencer {
 
   void fpeReport() const;
 
+  /// Derive the dependency graph of the sequence elements from the keys of
+  /// their data handles.
+  ///
+  /// @return for each sequence element the sorted indices of the elements
+  ///         which have to be executed before it
+  std::vector<std::vector<std::size_t>> buildDependencyGraph() const;
+
   struct SequenceElementWithFpeResult {
     std::shared_ptr<SequenceElement> sequenceElement;
     std::unique_ptr<
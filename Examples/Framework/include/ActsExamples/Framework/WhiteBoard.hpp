@@ -15,6 +15,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -32,6 +34,9 @@ namespace ActsExamples {
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the lifetime of the white board.
+///
+/// Access to the store is synchronized, so that independent sequence elements
+/// of the same event can read and write concurrently.
 class WhiteBoard {
  public:
   struct StringHash {
@@ -58,8 +63,8 @@ class WhiteBoard {
   WhiteBoard(const WhiteBoard& other) = delete;
   WhiteBoard& operator=(const WhiteBoard&) = delete;
 
-  WhiteBoard(WhiteBoard&& other) = default;
-  WhiteBoard& operator=(WhiteBoard&& other) = default;
+  WhiteBoard(WhiteBoard&& other) noexcept;
+  WhiteBoard& operator=(WhiteBoard&& other) noexcept;
 
   bool exists(const std::string& name) const;
 
@@ -128,6 +133,8 @@ class WhiteBoard {
 
   AliasMapType m_objectAliases;
 
+  mutable std::shared_mutex m_storeMutex;
+
   const Acts::Logger& logger() const { return *m_logger; }
 
   static std::string typeMismatchMessage(const std::string& name,
@@ -142,6 +149,7 @@ inline WhiteBoard::WhiteBoard(std::unique_ptr<const Acts::Logger> logger,
 
 template <typename T>
 Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
+  std::shared_lock lock{m_storeMutex};
   auto it = m_store.find(name);
   if (it == m_store.end()) {
     const auto names = similarNames(name, 10, 3);
@@ -183,12 +191,14 @@ template <typename T>
 T WhiteBoard::pop(const std::string& name) {
   ACTS_VERBOSE("Pop object '" << name << "'");
   (void)getHolder<T>(name);  // validates type and existence
+  std::unique_lock lock{m_storeMutex};
   auto node = m_store.extract(name);
   return node.mapped().first->template take<T>();
 }
 
 inline bool WhiteBoard::exists(const std::string& name) const {
   // TODO remove this function?
+  std::shared_lock lock{m_storeMutex};
   return m_store.contains(name);
 }
 
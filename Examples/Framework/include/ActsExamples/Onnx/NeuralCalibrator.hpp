@@ -14,6 +14,7 @@
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
 #include <filesystem>
+#include <memory>
 
 namespace ActsExamples {
 
@@ -60,7 +61,8 @@ class NeuralCalibrator : public MeasurementCalibrator {
   bool needsClusters() const override { return true; }
 
  private:
-  Ort::Env m_env;
+  // Shared with all other ONNX runtime users
+  std::shared_ptr<Ort::Env> m_env;
   ActsPlugins::OnnxRuntimeBase m_model;
   std::size_t m_nComponents;
   std::size_t m_nInputs =
@@ -0,0 +1,148 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace ActsExamples {
+
+/// Bounded queue which hands records over to a dedicated consumer thread.
+///
+/// Producers only hold the lock to move a record into the queue, the
+/// potentially expensive consumption, e.g. filling and compressing a ROOT
+/// tree, runs on the consumer thread in the order in which the records were
+/// pushed. Producers block if the queue is full, which bounds the memory
+/// held by records which are not consumed yet.
+///
+/// An exception thrown by the consumer stops the consumption. It is rethrown
+/// by every following `push` and by `close`.
+///
+/// @tparam record_t Movable type of the queued records
+template <typename record_t>
+class AsyncOutputQueue {
+ public:
+  /// Callable consuming one record on the consumer thread
+  using Consumer = std::function<void(record_t&&)>;
+
+  /// Start the consumer thread.
+  ///
+  /// @param capacity Maximum number of queued records
+  /// @param consumer Callable consuming the records
+  AsyncOutputQueue(std::size_t capacity, Consumer consumer)
+      : m_capacity(capacity), m_consumer(std::move(consumer)) {
+    if (m_capacity == 0) {
+      throw std::invalid_argument("Queue capacity must be positive");
+    }
+    if (!m_consumer) {
+      throw std::invalid_argument("Missing queue consumer");
+    }
+    m_thread = std::thread([this]() { consume(); });
+  }
+
+  AsyncOutputQueue(const AsyncOutputQueue&) = delete;
+  AsyncOutputQueue& operator=(const AsyncOutputQueue&) = delete;
+
+  /// Consume the remaining records and stop the consumer thread.
+  ///
+  /// Consumer errors are dropped, call `close` to handle them.
+  ~AsyncOutputQueue() {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+
+  /// Queue a record, blocks while the queue is full. Thread-safe.
+  ///
+  /// @param record The record to consume
+  void push(record_t record) {
+    std::unique_lock lock(m_mutex);
+    m_notFull.wait(lock, [this]() {
+      return m_queue.size() < m_capacity || m_error || m_closed;
+    });
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+    if (m_closed) {
+      throw std::logic_error("Push to a closed queue");
+    }
+    m_queue.push_back(std::move(record));
+    lock.unlock();
+    m_notEmpty.notify_one();
+  }
+
+  /// Consume all queued records and stop the consumer thread.
+  ///
+  /// Rethrows the exception thrown by the consumer, if any. Calling it again
+  /// has no effect.
+  void close() {
+    {
+      std::lock_guard lock(m_mutex);
+      m_closed = true;
+    }
+    m_notEmpty.notify_one();
+    m_notFull.notify_all();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+    std::lock_guard lock(m_mutex);
+    if (m_error) {
+      std::exception_ptr error = std::exchange(m_error, nullptr);
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  std::size_t m_capacity;
+  Consumer m_consumer;
+
+  std::mutex m_mutex;
+  std::condition_variable m_notEmpty;
+  std::condition_variable m_notFull;
+  std::deque<record_t> m_queue;
+  bool m_closed = false;
+  std::exception_ptr m_error;
+
+  std::thread m_thread;
+
+  void consume() {
+    while (true) {
+      std::unique_lock lock(m_mutex);
+      m_notEmpty.wait(lock, [this]() { return !m_queue.empty() || m_closed; });
+      if (m_queue.empty()) {
+        return;
+      }
+      record_t record = std::move(m_queue.front());
+      m_queue.pop_front();
+      lock.unlock();
+      m_notFull.notify_one();
+
+      try {
+        m_consumer(std::move(record));
+      } catch (...) {
+        lock.lock();
+        m_error = std::current_exception();
+        m_queue.clear();
+        lock.unlock();
+        m_notFull.notify_all();
+        return;
+      }
+    }
+  }
+};
+
+}  // namespace ActsExamples
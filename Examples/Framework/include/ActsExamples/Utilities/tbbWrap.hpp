@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+#include <functional>
 #include <optional>
 
 #include <tbb/parallel_for.h>
@@ -110,4 +114,19 @@ class queuing_mutex {
   };
 };
 
+/// Executor for the parallel loops of the ACTS tools which runs them with
+/// tbb::parallel_for. Called from the event loop, the loops run in the task
+/// arena of the Sequencer and share its threads with the other events,
+/// otherwise they run in the default arena of TBB. Returns an empty executor
+/// if TBB is disabled, the tools then start their own threads.
+inline Acts::ParallelExecutor parallelExecutor() {
+  if (!enableTBB()) {
+    return {};
+  }
+  return [](std::size_t numTasks,
+            const std::function<void(std::size_t)>& task) {
+    tbb::parallel_for(std::size_t{0}, numTasks, task);
+  };
+}
+
 }  // namespace ActsExamples::tbbWrap
@@ -15,11 +15,20 @@ namespace ActsExamples {
 
 MeasurementContainer::MeasurementContainer() = default;
 
+MeasurementContainer::MeasurementContainer(
+    std::pmr::memory_resource* memoryResource)
+    : m_entries(memoryResource),
+      m_geometryIds(memoryResource),
+      m_subspaceIndices(memoryResource),
+      m_parameters(memoryResource),
+      m_covariances(memoryResource) {}
+
 std::size_t MeasurementContainer::size() const {
   return m_entries.size();
 }
 
 void MeasurementContainer::reserve(std::size_t size) {
+  m_entries.reserve(size);
   m_geometryIds.reserve(size);
   m_subspaceIndices.reserve(size * 2);
   m_parameters.reserve(size * 2);
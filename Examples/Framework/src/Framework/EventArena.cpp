@@ -0,0 +1,90 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/EventArena.hpp"
+
+#include <algorithm>
+
+namespace ActsExamples {
+
+EventArena::EventArena(std::size_t initialSize, bool synchronized)
+    : m_synchronized(synchronized) {
+  m_capacity = std::max<std::size_t>(initialSize, 1);
+  m_buffer = std::make_unique<std::byte[]>(m_capacity);
+  m_resource.emplace(m_buffer.get(), m_capacity,
+                     std::pmr::new_delete_resource());
+}
+
+void EventArena::reset() {
+  std::unique_lock lock{m_mutex, std::defer_lock};
+  if (m_synchronized) {
+    lock.lock();
+  }
+
+  // releases the heap blocks which were needed on top of the buffer
+  m_resource.reset();
+
+  if (m_allocated > m_capacity) {
+    // leave some room for the alignment padding of the individual allocations
+    m_capacity = m_allocated + m_allocated / 8;
+    m_buffer = std::make_unique<std::byte[]>(m_capacity);
+  }
+  m_allocated = 0;
+  m_resource.emplace(m_buffer.get(), m_capacity,
+                     std::pmr::new_delete_resource());
+}
+
+void* EventArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  std::unique_lock lock{m_mutex, std::defer_lock};
+  if (m_synchronized) {
+    lock.lock();
+  }
+
+  m_allocated += bytes;
+  return m_resource->allocate(bytes, alignment);
+}
+
+void EventArena::do_deallocate(void* /*p*/, std::size_t /*bytes*/,
+                               std::size_t /*alignment*/) {
+  // memory is only released as a whole on reset
+}
+
+bool EventArena::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+EventArenaPool::Lease::~Lease() {
+  if (m_arena == nullptr) {
+    return;
+  }
+  m_arena->reset();
+  std::lock_guard lock{m_pool->m_mutex};
+  m_pool->m_free.push_back(std::move(m_arena));
+}
+
+EventArenaPool::Lease EventArenaPool::acquire() {
+  {
+    std::lock_guard lock{m_mutex};
+    if (!m_free.empty()) {
+      auto arena = std::move(m_free.back());
+      m_free.pop_back();
+      return Lease(*this, std::move(arena));
+    }
+    ++m_size;
+  }
+  return Lease(*this,
+               std::make_unique<EventArena>(m_initialSize, m_synchronized));
+}
+
+std::size_t EventArenaPool::size() const {
+  std::lock_guard lock{m_mutex};
+  return m_size;
+}
+
+}  // namespace ActsExamples
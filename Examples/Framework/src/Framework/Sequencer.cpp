@@ -11,6 +11,7 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Table.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/EventArena.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
@@ -36,6 +37,7 @@
 #include <ratio>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #ifdef ACTS_BUILD_EXAMPLES_ROOT
 #include <TROOT.h>
@@ -43,6 +45,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
+#include <tbb/flow_graph.h>
 
 namespace ActsExamples {
 
@@ -220,6 +223,83 @@ std::vector<std::string> Sequencer::listAlgorithmNames() const {
   return names;
 }
 
+std::vector<std::vector<std::size_t>> Sequencer::buildDependencyGraph()
+    const {
+  // resolve aliases to the name of the object they point to
+  std::unordered_map<std::string, std::string> aliasTargets;
+  for (const auto& [objectName, aliasName] : m_whiteboardObjectAliases) {
+    aliasTargets.try_emplace(aliasName, objectName);
+  }
+  auto resolve = [&](const std::string& key) -> const std::string& {
+    auto it = aliasTargets.find(key);
+    return it != aliasTargets.end() ? it->second : key;
+  };
+
+  std::vector<std::vector<std::size_t>> dependencies(m_sequenceElements.size());
+
+  std::unordered_map<std::string, std::size_t> producers;
+  std::unordered_map<std::string, std::vector<std::size_t>> readers;
+  std::unordered_map<std::string, std::size_t> consumers;
+  std::optional<std::size_t> barrier;
+
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const auto& element = *m_sequenceElements[i].sequenceElement;
+    auto& deps = dependencies[i];
+
+    if (barrier.has_value()) {
+      deps.push_back(barrier.value());
+    }
+
+    // elements without any data handles might depend on anything
+    if (element.readHandles().empty() && element.writeHandles().empty()) {
+      for (std::size_t j = barrier.value_or(0); j < i; ++j) {
+        deps.push_back(j);
+      }
+      barrier = i;
+    }
+
+    for (const auto* handle : element.readHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      const std::string& key = resolve(handle->key());
+      if (auto it = producers.find(key); it != producers.end()) {
+        deps.push_back(it->second);
+      }
+      if (dynamic_cast<const ConsumeDataHandleBase*>(handle) != nullptr) {
+        // all other readers have to be done before the object is taken away
+        if (auto it = readers.find(key); it != readers.end()) {
+          std::ranges::copy_if(it->second, std::back_inserter(deps),
+                               [i](std::size_t r) { return r != i; });
+          readers.erase(it);
+        }
+        producers.erase(key);
+        consumers[key] = i;
+      } else {
+        readers[key].push_back(i);
+      }
+    }
+
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      const std::string& key = resolve(handle->key());
+      // re-adding a key is only possible after it was consumed
+      if (auto it = consumers.find(key); it != consumers.end()) {
+        deps.push_back(it->second);
+      }
+      producers[key] = i;
+    }
+
+    std::ranges::sort(deps);
+    auto [first, last] = std::ranges::unique(deps);
+    deps.erase(first, last);
+  }
+
+  return dependencies;
+}
+
 std::pair<std::size_t, std::size_t> Sequencer::determineEventsRange() const {
   constexpr auto kInvalidEventsRange =
       std::make_pair(std::numeric_limits<std::size_t>::max(),
@@ -396,6 +476,129 @@ void printTiming(const std::vector<std::string>& identifiers,
 
   ACTS_INFO("Timing breakdown:\n" << table);
 }
+
+/// Accumulated information about the critical path of the per-event
+/// dependency graph, i.e. the chain of sequence elements that determines the
+/// event latency.
+struct CriticalPath {
+  /// Time each element contributed to the critical path
+  std::vector<Duration> durations;
+  /// Number of events for which each element was on the critical path
+  std::vector<std::size_t> counts;
+  /// Sum of the critical path lengths over all events
+  Duration total = Duration::zero();
+
+  explicit CriticalPath(std::size_t size)
+      : durations(size, Duration::zero()), counts(size, 0) {}
+
+  /// Add the critical path of a single event.
+  ///
+  /// @param dependencies the predecessors of each element
+  /// @param elementDurations the execution time of each element
+  void add(const std::vector<std::vector<std::size_t>>& dependencies,
+           const std::vector<Duration>& elementDurations) {
+    if (elementDurations.empty()) {
+      return;
+    }
+
+    // predecessors always have a lower index, so the index order is a valid
+    // topological order of the graph
+    std::vector<Duration> finish(elementDurations.size(), Duration::zero());
+    for (std::size_t i = 0; i < elementDurations.size(); ++i) {
+      Duration start = Duration::zero();
+      for (std::size_t p : dependencies[i]) {
+        start = std::max(start, finish[p]);
+      }
+      finish[i] = start + elementDurations[i];
+    }
+
+    auto current = static_cast<std::size_t>(
+        std::distance(finish.begin(), std::ranges::max_element(finish)));
+    total += finish[current];
+    while (true) {
+      durations[current] += elementDurations[current];
+      counts[current] += 1;
+      const auto& deps = dependencies[current];
+      if (deps.empty()) {
+        break;
+      }
+      current = *std::ranges::max_element(
+          deps, {}, [&](std::size_t p) { return finish[p]; });
+    }
+  }
+
+  void merge(const CriticalPath& other) {
+    for (std::size_t i = 0; i < durations.size(); ++i) {
+      durations[i] += other.durations[i];
+      counts[i] += other.counts[i];
+    }
+    total += other.total;
+  }
+};
+
+void printCriticalPath(const std::vector<std::string>& identifiers,
+                       const CriticalPath& criticalPath,
+                       const std::vector<Duration>& durations,
+                       std::size_t numEvents, const Acts::Logger& logger) {
+  if (identifiers.empty() || numEvents == 0) {
+    return;
+  }
+
+  Acts::Table table;
+  using enum Acts::Table::Alignment;
+  table.addColumn("Algorithm", "{}", Left);
+  table.addColumn("Critical/Event (ms)", "{:.2f}", Right);
+  table.addColumn("Time/Event (ms)", "{:.2f}", Right);
+  table.addColumn("On Critical Path", "{:.1f}%", Right);
+  table.addColumn("Fraction", "{:.1f}%", Right);
+
+  const double nEvents = static_cast<double>(numEvents);
+  const double totalMs = durationToMs(criticalPath.total);
+
+  std::vector<std::size_t> sortedIndices(identifiers.size());
+  std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+  std::ranges::sort(sortedIndices, [&](std::size_t a, std::size_t b) {
+    return criticalPath.durations[a] > criticalPath.durations[b];
+  });
+
+  for (std::size_t idx : sortedIndices) {
+    if (criticalPath.counts[idx] == 0) {
+      continue;
+    }
+    double criticalMs = durationToMs(criticalPath.durations[idx]);
+    table.addRow(identifiers[idx], criticalMs / nEvents,
+                 durationToMs(durations[idx]) / nEvents,
+                 100.0 * static_cast<double>(criticalPath.counts[idx]) / nEvents,
+                 totalMs > 0 ? 100.0 * criticalMs / totalMs : 0.0);
+  }
+  table.addRow("TOTAL", totalMs / nEvents,
+               durationToMs(std::accumulate(durations.begin(), durations.end(),
+                                            Duration::zero())) /
+                   nEvents,
+               100.0, 100.0);
+
+  ACTS_INFO("Critical path breakdown:\n" << table);
+}
+
+void storeCriticalPath(const std::vector<std::string>& identifiers,
+                       const CriticalPath& criticalPath, std::size_t numEvents,
+                       const std::string& path) {
+  std::ofstream file(path);
+
+  file << "identifier,time_critical_total_s,time_critical_perevent_s,"
+          "critical_fraction_events\n";
+
+  for (std::size_t i = 0; i < identifiers.size(); ++i) {
+    const auto time_total_s =
+        std::chrono::duration_cast<Seconds>(criticalPath.durations[i]).count();
+    file << identifiers[i] << "," << time_total_s << ","
+         << time_total_s / static_cast<double>(numEvents) << ","
+         << static_cast<double>(criticalPath.counts[i]) /
+                static_cast<double>(numEvents)
+         << "\n";
+  }
+  file << "\n";
+}
 }  // namespace
 
 int Sequencer::run() {
@@ -469,12 +672,98 @@ int Sequencer::run() {
 
   std::atomic<std::size_t> nextEvent = firstEvent;
 
+  // the arenas have to be thread-safe if the elements of an event run
+  // concurrently
+  EventArenaPool eventArenas(m_cfg.eventArenaSize,
+                             m_cfg.intraEventParallelism);
+
+  // the dependency graph is only needed for intra-event parallelism
+  std::vector<std::vector<std::size_t>> dependencies;
+  CriticalPath criticalPath(m_sequenceElements.size());
+  if (m_cfg.intraEventParallelism) {
+    dependencies = buildDependencyGraph();
+    ACTS_INFO("Run sequence elements of each event according to their "
+              "dependency graph");
+    for (std::size_t i = 0; i < dependencies.size(); ++i) {
+      const auto& alg = m_sequenceElements[i].sequenceElement;
+      ACTS_DEBUG("  " << alg->typeName() << ": " << alg->name());
+      for (std::size_t p : dependencies[i]) {
+        const auto& dep = m_sequenceElements[p].sequenceElement;
+        ACTS_DEBUG("    <- " << dep->typeName() << ": " << dep->name());
+      }
+    }
+  }
+
+  // execute one sequence element, including the FPE bookkeeping
+  auto executeElement = [&](SequenceElementWithFpeResult& element,
+                            AlgorithmContext& elementContext) {
+    auto& [alg, fpe] = element;
+    std::optional<ActsPlugins::FpeMonitor> mon;
+    if (m_cfg.trackFpes) {
+      mon.emplace();
+      elementContext.fpeMonitor = &mon.value();
+    }
+    ProcessCode processCode = ProcessCode::SUCCESS;
+    ACTS_VERBOSE("Execute " << alg->typeName() << ": " << alg->name());
+    try {
+      processCode = alg->internalExecute(elementContext);
+      if (processCode == ProcessCode::SKIP) {
+        ACTS_VERBOSE("Skip event signal received from " << alg->typeName()
+                                                        << ": " << alg->name());
+        elementContext.fpeMonitor = nullptr;
+        return processCode;
+      } else if (processCode != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    } catch (const std::exception& e) {
+      ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
+                                      << alg->name() << "\": " << e.what());
+      throw;
+    }
+    ACTS_VERBOSE("Completed " << alg->typeName() << ": " << alg->name());
+
+    if (mon) {
+      auto& local = fpe->local();
+
+      for (const auto& info : mon->result().stackTraces()) {
+        const auto count = info.count;
+        const auto type = info.type;
+        const auto& st = *info.st;
+        auto [maskLoc, nMasked] = fpeMaskCount(st, type);
+        if (nMasked < count) {
+          std::stringstream ss;
+          ss << "FPE of type " << type
+             << " exceeded configured per-event threshold of " << nMasked
+             << " (mask: " << maskLoc << ") (seen: " << count << " FPEs)\n"
+             << ActsPlugins::FpeMonitor::stackTraceToString(
+                    st, m_cfg.fpeStackTraceLength);
+
+          m_nUnmaskedFpe += (count - nMasked);
+
+          if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
+            ACTS_ERROR(ss.str());
+            local.merge(mon->result());  // merge so we get correct
+                                         // results after throwing
+            throw FpeFailure{ss.str()};
+          } else if (m_cfg.failOnUnmaskedFpe && !local.contains(info)) {
+            ACTS_INFO(ss.str());
+          }
+        }
+      }
+
+      local.merge(mon->result());
+    }
+    elementContext.fpeMonitor = nullptr;
+    return processCode;
+  };
+
   m_taskArena.execute([&] {
     tbbWrap::parallel_for(
         tbb::blocked_range<std::size_t>(firstEvent, lastEvent),
         [&](const tbb::blocked_range<std::size_t>& r) {
           std::vector<Duration> localClocksAlgorithms(names.size(),
                                                       Duration::zero());
+          CriticalPath localCriticalPath(m_sequenceElements.size());
           std::size_t threadId = threadIds.local();
 
           for (std::size_t n = r.begin(); n != r.end(); ++n) {
@@ -491,14 +780,22 @@ int Sequencer::run() {
             ACTS_DEBUG("start processing event " << event << " on thread "
                                                  << threadId);
             m_cfg.iterationCallback();
+            // The arena is only returned to the pool after the event store,
+            // which holds the objects allocated from it, has been destroyed
+            EventArenaPool::Lease eventArena = m_cfg.useEventArena
+                                                   ? eventArenas.acquire()
+                                                   : EventArenaPool::Lease{};
             // Use per-event store
             WhiteBoard eventStore(
                 Acts::getDefaultLogger("EventStore#" + std::to_string(event),
                                        m_cfg.logLevel),
                 m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
+            // With intra-event parallelism, every sequence element gets its
+            // own copy of this context
             AlgorithmContext context(0, event, eventStore, threadId);
+            if (eventArena.get() != nullptr) {
+              context.memoryResource = eventArena.get();
+            }
             std::size_t ialgo = 0;
 
             /// Decorate the context
@@ -512,68 +809,74 @@ int Sequencer::run() {
 
             ACTS_VERBOSE("Execute sequence elements");
 
-            for (auto& [alg, fpe] : m_sequenceElements) {
-              std::optional<ActsPlugins::FpeMonitor> mon;
-              if (m_cfg.trackFpes) {
-                mon.emplace();
-                context.fpeMonitor = &mon.value();
-              }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << alg->typeName() << ": "
-                                      << alg->name());
-              try {
-                auto processCode = alg->internalExecute(++context);
-                if (processCode == ProcessCode::SKIP) {
-                  ACTS_VERBOSE("Skip event signal received from "
-                               << alg->typeName() << ": " << alg->name());
+            if (m_cfg.intraEventParallelism) {
+              std::vector<Duration> elementDurations(
+                  m_sequenceElements.size(), Duration::zero());
+              std::atomic<bool> skipEvent = false;
+
+              auto executeNode = [&](std::size_t iElement) {
+                if (skipEvent) {
+                  return;
+                }
+                // every concurrently running element needs its own context
+                AlgorithmContext elementContext = context;
+                elementContext.algorithmNumber += iElement + 1;
+                ProcessCode processCode = ProcessCode::SUCCESS;
+                {
+                  StopWatch sw(elementDurations[iElement]);
+                  processCode = executeElement(m_sequenceElements[iElement],
+                                               elementContext);
+                }
+                if (processCode == ProcessCode::SKIP &&
+                    !skipEvent.exchange(true)) {
                   m_nSkippedEvents++;
-                  break;
-                } else if (processCode != ProcessCode::SUCCESS) {
-                  throw std::runtime_error("Failed to process event data");
                 }
-              } catch (const std::exception& e) {
-                ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
-                                                << alg->name()
-                                                << "\": " << e.what());
-                throw;
-              }
-              ACTS_VERBOSE("Completed " << alg->typeName() << ": "
-                                        << alg->name());
-
-              if (mon) {
-                auto& local = fpe->local();
-
-                for (const auto& info : mon->result().stackTraces()) {
-                  const auto count = info.count;
-                  const auto type = info.type;
-                  const auto& st = *info.st;
-                  auto [maskLoc, nMasked] = fpeMaskCount(st, type);
-                  if (nMasked < count) {
-                    std::stringstream ss;
-                    ss << "FPE of type " << type
-                       << " exceeded configured per-event threshold of "
-                       << nMasked << " (mask: " << maskLoc
-                       << ") (seen: " << count << " FPEs)\n"
-                       << ActsPlugins::FpeMonitor::stackTraceToString(
-                              st, m_cfg.fpeStackTraceLength);
-
-                    m_nUnmaskedFpe += (count - nMasked);
-
-                    if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
-                      ACTS_ERROR(ss.str());
-                      local.merge(mon->result());  // merge so we get correct
-                                                   // results after throwing
-                      throw FpeFailure{ss.str()};
-                    } else if (m_cfg.failOnUnmaskedFpe &&
-                               !local.contains(info)) {
-                      ACTS_INFO(ss.str());
-                    }
+              };
+
+              if (tbbWrap::enableTBB()) {
+                using Node = tbb::flow::continue_node<tbb::flow::continue_msg>;
+                tbb::flow::graph graph;
+                std::vector<std::unique_ptr<Node>> nodes;
+                nodes.reserve(m_sequenceElements.size());
+                for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+                  nodes.push_back(std::make_unique<Node>(
+                      graph, [&executeNode, i](const tbb::flow::continue_msg&) {
+                        executeNode(i);
+                      }));
+                }
+                for (std::size_t i = 0; i < nodes.size(); ++i) {
+                  for (std::size_t p : dependencies[i]) {
+                    tbb::flow::make_edge(*nodes[p], *nodes[i]);
                   }
                 }
+                for (std::size_t i = 0; i < nodes.size(); ++i) {
+                  if (dependencies[i].empty()) {
+                    nodes[i]->try_put(tbb::flow::continue_msg{});
+                  }
+                }
+                graph.wait_for_all();
+              } else {
+                for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+                  executeNode(i);
+                }
+              }
 
-                local.merge(mon->result());
+              for (std::size_t i = 0; i < elementDurations.size(); ++i) {
+                localClocksAlgorithms[ialgo + i] += elementDurations[i];
+              }
+              localCriticalPath.add(dependencies, elementDurations);
+            } else {
+              for (auto& element : m_sequenceElements) {
+                ProcessCode processCode = ProcessCode::SUCCESS;
+                {
+                  StopWatch sw(localClocksAlgorithms[ialgo++]);
+                  processCode = executeElement(element, ++context);
+                }
+                if (processCode == ProcessCode::SKIP) {
+                  m_nSkippedEvents++;
+                  break;
+                }
               }
-              context.fpeMonitor = nullptr;
             }
 
             nProcessedEvents++;
@@ -593,6 +896,7 @@ int Sequencer::run() {
             for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
               clocksAlgorithms[i] += localClocksAlgorithms[i];
             }
+            criticalPath.merge(localCriticalPath);
           }
         });
   });
@@ -636,9 +940,27 @@ int Sequencer::run() {
 
   printTiming(names, clocksAlgorithms, numEvents, logger());
 
+  // the decorators always run serially before the sequence elements
+  const std::vector<std::string> elementNames(
+      std::next(names.begin(), m_decorators.size()), names.end());
+  const std::vector<Duration> elementClocks(
+      std::next(clocksAlgorithms.begin(), m_decorators.size()),
+      clocksAlgorithms.end());
+  if (m_cfg.intraEventParallelism) {
+    ACTS_INFO("Average critical path per event: "
+              << perEvent(criticalPath.total, numEvents));
+    printCriticalPath(elementNames, criticalPath, elementClocks, numEvents,
+                      logger());
+  }
+
   if (!m_cfg.outputDir.empty()) {
     storeTiming(names, clocksAlgorithms, numEvents,
                 joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+    if (m_cfg.intraEventParallelism) {
+      storeCriticalPath(
+          elementNames, criticalPath, numEvents,
+          joinPaths(m_cfg.outputDir, m_cfg.outputCriticalPathFile));
+    }
   }
 
   if (m_cfg.failOnUnmaskedFpe && m_nUnmaskedFpe > 0) {
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <array>
+#include <mutex>
+#include <shared_mutex>
 #include <string_view>
 
 #include <Eigen/Core>
@@ -92,7 +94,25 @@ std::string WhiteBoard::typeMismatchMessage(const std::string &name,
                      boost::core::demangle(act)};
 }
 
+WhiteBoard::WhiteBoard(WhiteBoard &&other) noexcept {
+  std::unique_lock lock{other.m_storeMutex};
+  m_logger = std::move(other.m_logger);
+  m_store = std::move(other.m_store);
+  m_objectAliases = std::move(other.m_objectAliases);
+}
+
+WhiteBoard &WhiteBoard::operator=(WhiteBoard &&other) noexcept {
+  if (this != &other) {
+    std::scoped_lock lock{m_storeMutex, other.m_storeMutex};
+    m_logger = std::move(other.m_logger);
+    m_store = std::move(other.m_store);
+    m_objectAliases = std::move(other.m_objectAliases);
+  }
+  return *this;
+}
+
 void WhiteBoard::copyFrom(const WhiteBoard &other) {
+  std::shared_lock lock{other.m_storeMutex};
   for (auto &[key, val] : other.m_store) {
     addHolder(key, val.first, val.second);
     ACTS_VERBOSE("Copied key '" << key << "' to whiteboard");
@@ -111,6 +131,7 @@ void WhiteBoard::addHolder(const std::string &name,
   }
 
   StoreValue storeVal{holder, typeHash};
+  std::unique_lock lock{m_storeMutex};
   auto [storeIt, success] = m_store.try_emplace(name, storeVal);
 
   if (!success) {
@@ -141,6 +162,7 @@ void WhiteBoard::addHolder(const std::string &name,
 
 std::vector<std::string> WhiteBoard::getKeys() const {
   std::vector<std::string> keys;
+  std::shared_lock lock{m_storeMutex};
   for (const auto &[key, val] : m_store) {
     keys.push_back(key);
   }
@@ -149,6 +171,7 @@ std::vector<std::string> WhiteBoard::getKeys() const {
 
 std::pair<Acts::AnyMoveOnly *, std::uint64_t> WhiteBoard::getHolder(
     const std::string &name) const {
+  std::shared_lock lock{m_storeMutex};
   auto it = m_store.find(name);
   if (it == m_store.end()) {
     throw std::out_of_range("Object '" + name + "' does not exists");
@@ -17,6 +17,7 @@
 #include "Acts/Utilities/detail/EigenCompat.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
 
 using namespace Acts;
 using namespace ActsPlugins;
@@ -74,8 +75,8 @@ std::size_t fillChargeMatrix(Array& arr, const Cluster& cluster,
 NeuralCalibrator::NeuralCalibrator(const std::filesystem::path& modelPath,
                                    std::size_t nComponents,
                                    std::vector<std::size_t> volumeIds)
-    : m_env(ORT_LOGGING_LEVEL_WARNING, "NeuralCalibrator"),
-      m_model(m_env, modelPath.c_str()),
+    : m_env(OnnxInferenceService::environment()),
+      m_model(*m_env, modelPath.c_str()),
       m_nComponents{nComponents},
       m_volumeIds{std::move(volumeIds)} {}
 
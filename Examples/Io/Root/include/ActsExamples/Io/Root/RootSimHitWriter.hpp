@@ -12,14 +12,11 @@
 #include "ActsExamples/EventData/SimHit.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Root/RootTreeOutput.hpp"
 
-#include <cstdint>
-#include <mutex>
+#include <memory>
 #include <string>
 
-class TFile;
-class TTree;
-
 namespace ActsExamples {
 
 /// Write out simulated hits as a flat TTree.
@@ -29,7 +26,9 @@ namespace ActsExamples {
 ///
 /// Safe to use from multiple writer threads. To avoid thread-safety issues,
 /// the writer must be the sole owner of the underlying file. Thus, the
-/// output file pointer can not be given from the outside.
+/// output file pointer can not be given from the outside. The rows of an
+/// event are built without locking and handed to the output according to
+/// the configured output mode.
 class RootSimHitWriter final : public WriterT<SimHitContainer> {
  public:
   struct Config {
@@ -41,6 +40,8 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
     std::string fileMode = "RECREATE";
     /// Name of the tree within the output file.
     std::string treeName = "hits";
+    /// How the event threads fill the output tree.
+    RootOutputMode outputMode = RootOutputMode::Locked;
   };
 
   /// Construct the particle writer.
@@ -67,36 +68,10 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
                      const SimHitContainer& hits) override;
 
  private:
+  struct Columns;
+
   Config m_cfg;
-  std::mutex m_writeMutex;
-  TFile* m_outputFile = nullptr;
-  TTree* m_outputTree = nullptr;
-  /// Event identifier.
-  std::uint32_t m_eventId = 0;
-  /// Hit surface identifier.
-  std::uint64_t m_geometryId = 0;
-  /// Decoded barcode components written as convenience columns.
-  std::uint32_t m_barcodeVertexPrimary = 0;
-  std::uint32_t m_barcodeVertexSecondary = 0;
-  std::uint32_t m_barcodeParticle = 0;
-  std::uint32_t m_barcodeGeneration = 0;
-  std::uint32_t m_barcodeSubParticle = 0;
-  /// True global hit position components in mm.
-  float m_tx = 0, m_ty = 0, m_tz = 0;
-  // True global hit time in ns.
-  float m_tt = 0;
-  /// True particle four-momentum in GeV at hit position before interaction.
-  float m_tpx = 0, m_tpy = 0, m_tpz = 0, m_te = 0;
-  /// True change in particle four-momentum in GeV due to interactions.
-  float m_deltapx = 0, m_deltapy = 0, m_deltapz = 0, m_deltae = 0;
-  /// Hit index along the particle trajectory
-  std::int32_t m_index = 0;
-  // Decoded hit surface identifier components.
-  std::uint32_t m_volumeId = 0;
-  std::uint32_t m_boundaryId = 0;
-  std::uint32_t m_layerId = 0;
-  std::uint32_t m_approachId = 0;
-  std::uint32_t m_sensitiveId = 0;
+  std::unique_ptr<RootTreeOutput<Columns>> m_output;
 };
 
 }  // namespace ActsExamples
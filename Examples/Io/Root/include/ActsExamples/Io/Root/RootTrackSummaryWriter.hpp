@@ -17,17 +17,12 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Root/RootTreeOutput.hpp"
 
-#include <cstdint>
-#include <mutex>
+#include <memory>
 #include <string>
 #include <vector>
 
-#include <TMatrixD.h>
-
-class TFile;
-class TTree;
-
 namespace ActsExamples {
 
 /// @class RootTrackSummaryWriter
@@ -36,15 +31,12 @@ namespace ActsExamples {
 /// etc., fitted track parameters and corresponding majority truth particle
 /// info) of the reconstructed tracks into a TTree.
 ///
-/// Safe to use from multiple writer threads - uses a std::mutex lock.
-///
 /// Each entry in the TTree corresponds to all reconstructed tracks in one
 /// single event. The event number is part of the written data.
 ///
-/// A common file can be provided for the writer to attach his TTree, this is
-/// done by setting the Config::rootFile pointer to an existing file.
-///
-/// Safe to use from multiple writer threads - uses a std::mutex lock.
+/// Safe to use from multiple writer threads. The row of an event is built
+/// without locking and handed to the output according to the configured
+/// output mode.
 class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
  public:
   struct Config {
@@ -70,6 +62,8 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
     bool writeGx2fSpecific = false;
     /// Write jet information
     bool writeJets = false;
+    /// How the event threads fill the output tree.
+    RootOutputMode outputMode = RootOutputMode::Locked;
   };
 
   /// Constructor
@@ -103,200 +97,9 @@ class RootTrackSummaryWriter final : public WriterT<ConstTrackContainer> {
       this, "InputTrackParticleMatching"};
   ReadDataHandle<TruthJetContainer> m_inputJets{this, "InputJets"};
 
-  /// Mutex used to protect multi-threaded writes
-  std::mutex m_writeMutex;
-  /// The output file
-  TFile* m_outputFile{nullptr};
-  /// The output tree
-  TTree* m_outputTree{nullptr};
-  /// The event number
-  std::uint32_t m_eventNr{0};
-  /// The track number in event
-  std::vector<std::uint32_t> m_trackNr;
-
-  /// The number of states
-  std::vector<unsigned int> m_nStates;
-  /// The number of measurements
-  std::vector<unsigned int> m_nMeasurements;
-  /// The number of outliers
-  std::vector<unsigned int> m_nOutliers;
-  /// The number of holes
-  std::vector<unsigned int> m_nHoles;
-  /// The number of shared hits
-  std::vector<unsigned int> m_nSharedHits;
-  /// The total chi2
-  std::vector<float> m_chi2Sum;
-  /// The number of ndf of the measurements+outliers
-  std::vector<unsigned int> m_NDF;
-  /// The chi2 on all measurement states
-  std::vector<std::vector<double>> m_measurementChi2;
-  /// The chi2 on all outlier states
-  std::vector<std::vector<double>> m_outlierChi2;
-  /// The volume id of the measurements
-  std::vector<std::vector<std::uint32_t>> m_measurementVolume;
-  /// The layer id of the measurements
-  std::vector<std::vector<std::uint32_t>> m_measurementLayer;
-  /// The volume id of the outliers
-  std::vector<std::vector<std::uint32_t>> m_outlierVolume;
-  /// The layer id of the outliers
-  std::vector<std::vector<std::uint32_t>> m_outlierLayer;
-
-  // The majority truth particle info
-  /// The number of hits from majority particle
-  std::vector<unsigned int> m_nMajorityHits;
-  /// Decoded barcode components for convenience columns
-  std::vector<std::uint32_t> m_majorityParticleVertexPrimary;
-  std::vector<std::uint32_t> m_majorityParticleVertexSecondary;
-  std::vector<std::uint32_t> m_majorityParticleParticle;
-  std::vector<std::uint32_t> m_majorityParticleGeneration;
-  std::vector<std::uint32_t> m_majorityParticleSubParticle;
-  /// The classification of the reconstructed track
-  std::vector<int> m_trackClassification;
-  /// Charge of majority particle
-  std::vector<int> m_t_charge;
-  /// Time of majority particle
-  std::vector<float> m_t_time;
-  /// Vertex x positions of majority particle
-  std::vector<float> m_t_vx;
-  /// Vertex y positions of majority particle
-  std::vector<float> m_t_vy;
-  /// Vertex z positions of majority particle
-  std::vector<float> m_t_vz;
-  /// Initial momenta px of majority particle
-  std::vector<float> m_t_px;
-  /// Initial momenta py of majority particle
-  std::vector<float> m_t_py;
-  /// Initial momenta pz of majority particle
-  std::vector<float> m_t_pz;
-  /// Initial momenta theta of majority particle
-  std::vector<float> m_t_theta;
-  /// Initial momenta phi of majority particle
-  std::vector<float> m_t_phi;
-  /// Initial abs momenta of majority particle
-  std::vector<float> m_t_p;
-  /// Initial momenta pT of majority particle
-  std::vector<float> m_t_pT;
-  /// Initial momenta eta of majority particle
-  std::vector<float> m_t_eta;
-  /// The extrapolated truth transverse impact parameter
-  std::vector<float> m_t_d0;
-  /// The extrapolated truth longitudinal impact parameter
-  std::vector<float> m_t_z0;
-  /// Production radius of majority particle
-  std::vector<float> m_t_prodR;
-
-  /// If the track has fitted parameter
-  std::vector<bool> m_hasFittedParams;
-  // The fitted parameters
-  /// Fitted parameters eBoundLoc0 of track
-  std::vector<float> m_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 of track
-  std::vector<float> m_eLOC1_fit;
-  /// Fitted parameters ePHI of track
-  std::vector<float> m_ePHI_fit;
-  /// Fitted parameters eTHETA of track
-  std::vector<float> m_eTHETA_fit;
-  /// Fitted parameters eQOP of track
-  std::vector<float> m_eQOP_fit;
-  /// Fitted parameters eT of track
-  std::vector<float> m_eT_fit;
-  // The error of fitted parameters
-  /// Fitted parameters eLOC err of track
-  std::vector<float> m_err_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 err of track
-  std::vector<float> m_err_eLOC1_fit;
-  /// Fitted parameters ePHI err of track
-  std::vector<float> m_err_ePHI_fit;
-  /// Fitted parameters eTHETA err of track
-  std::vector<float> m_err_eTHETA_fit;
-  /// Fitted parameters eQOP err of track
-  std::vector<float> m_err_eQOP_fit;
-  /// Fitted parameters eT err of track
-  std::vector<float> m_err_eT_fit;
-  // The residual of fitted parameters
-  /// Fitted parameters eLOC res of track
-  std::vector<float> m_res_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 res of track
-  std::vector<float> m_res_eLOC1_fit;
-  /// Fitted parameters ePHI res of track
-  std::vector<float> m_res_ePHI_fit;
-  /// Fitted parameters eTHETA res of track
-  std::vector<float> m_res_eTHETA_fit;
-  /// Fitted parameters eQOP res of track
-  std::vector<float> m_res_eQOP_fit;
-  /// Fitted parameters eT res of track
-  std::vector<float> m_res_eT_fit;
-  // The pull of fitted parameters
-  /// Fitted parameters eLOC pull of track
-  std::vector<float> m_pull_eLOC0_fit;
-  /// Fitted parameters eBoundLoc1 pull of track
-  std::vector<float> m_pull_eLOC1_fit;
-  /// Fitted parameters ePHI pull of track
-  std::vector<float> m_pull_ePHI_fit;
-  /// Fitted parameters eTHETA pull of track
-  std::vector<float> m_pull_eTHETA_fit;
-  /// Fitted parameters eQOP pull of track
-  std::vector<float> m_pull_eQOP_fit;
-  /// Fitted parameters eT pull of track
-  std::vector<float> m_pull_eT_fit;
-
-  // entries of the full covariance matrix. One block for every row of the
-  // matrix
-  std::vector<float> m_cov_eLOC0_eLOC0;
-  std::vector<float> m_cov_eLOC0_eLOC1;
-  std::vector<float> m_cov_eLOC0_ePHI;
-  std::vector<float> m_cov_eLOC0_eTHETA;
-  std::vector<float> m_cov_eLOC0_eQOP;
-  std::vector<float> m_cov_eLOC0_eT;
-
-  std::vector<float> m_cov_eLOC1_eLOC0;
-  std::vector<float> m_cov_eLOC1_eLOC1;
-  std::vector<float> m_cov_eLOC1_ePHI;
-  std::vector<float> m_cov_eLOC1_eTHETA;
-  std::vector<float> m_cov_eLOC1_eQOP;
-  std::vector<float> m_cov_eLOC1_eT;
-
-  std::vector<float> m_cov_ePHI_eLOC0;
-  std::vector<float> m_cov_ePHI_eLOC1;
-  std::vector<float> m_cov_ePHI_ePHI;
-  std::vector<float> m_cov_ePHI_eTHETA;
-  std::vector<float> m_cov_ePHI_eQOP;
-  std::vector<float> m_cov_ePHI_eT;
-
-  std::vector<float> m_cov_eTHETA_eLOC0;
-  std::vector<float> m_cov_eTHETA_eLOC1;
-  std::vector<float> m_cov_eTHETA_ePHI;
-  std::vector<float> m_cov_eTHETA_eTHETA;
-  std::vector<float> m_cov_eTHETA_eQOP;
-  std::vector<float> m_cov_eTHETA_eT;
-
-  std::vector<float> m_cov_eQOP_eLOC0;
-  std::vector<float> m_cov_eQOP_eLOC1;
-  std::vector<float> m_cov_eQOP_ePHI;
-  std::vector<float> m_cov_eQOP_eTHETA;
-  std::vector<float> m_cov_eQOP_eQOP;
-  std::vector<float> m_cov_eQOP_eT;
-
-  std::vector<float> m_cov_eT_eLOC0;
-  std::vector<float> m_cov_eT_eLOC1;
-  std::vector<float> m_cov_eT_ePHI;
-  std::vector<float> m_cov_eT_eTHETA;
-  std::vector<float> m_cov_eT_eQOP;
-  std::vector<float> m_cov_eT_eT;
-
-  std::vector<float> m_gsf_max_material_fwd;
-  std::vector<float> m_gsf_sum_material_fwd;
-
-  /// The number of updates (gx2f)
-  std::vector<int> m_nUpdatesGx2f;
+  struct Columns;
 
-  /// The jet information
-  std::vector<int> m_nJets;
-  std::vector<float> m_jet_pt;
-  std::vector<float> m_jet_eta;
-  std::vector<float> m_jet_phi;
-  std::vector<int> m_jet_label;
-  std::vector<std::size_t> m_ntracks_per_jets;
+  std::unique_ptr<RootTreeOutput<Columns>> m_output;
 };
 
 }  // namespace ActsExamples
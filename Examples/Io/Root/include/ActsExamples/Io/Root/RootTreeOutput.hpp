@@ -0,0 +1,267 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Utilities/AsyncOutputQueue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <TFile.h>
+#include <TFileMerger.h>
+#include <TTree.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/enumerable_thread_specific.h>
+#pragma GCC diagnostic pop
+
+namespace ActsExamples {
+
+/// How the rows of the event threads get into a ROOT output tree.
+enum class RootOutputMode {
+  /// Fill the tree from the event threads, serialised by a mutex
+  Locked,
+  /// Queue the rows of an event for a dedicated thread filling the tree
+  Async,
+  /// Fill one file per event thread and merge the files when closing
+  FilePerThread,
+};
+
+/// Configuration of a ROOT output tree.
+struct RootTreeOutputConfig {
+  /// Path to the output file.
+  std::string filePath;
+  /// Output file access mode.
+  std::string fileMode = "RECREATE";
+  /// Name of the tree within the output file.
+  std::string treeName;
+  /// How the event threads fill the tree.
+  RootOutputMode mode = RootOutputMode::Locked;
+  /// Maximum number of events waiting for the writer thread in async mode.
+  std::size_t queueCapacity = 64;
+};
+
+/// Output tree shared by the event threads of a writer.
+///
+/// The rows of the tree are described by `columns_t`, a default constructible
+/// and movable type with one member per branch. The branch function creates
+/// the branches bound to the members of a columns object. By default it calls
+/// the member function `void branch(TTree& tree)` of `columns_t`. Every tree
+/// owns one columns object and the rows are moved into it before the tree is
+/// filled.
+///
+/// The event threads build the rows of an event without any locking and pass
+/// them to `fill` as a whole. The rows of one event stay consecutive in the
+/// output. With `RootOutputMode::FilePerThread` the per-thread files are
+/// merged into the output file by `close`, and the entries are grouped by
+/// thread.
+///
+/// @tparam columns_t Row type of the tree
+template <typename columns_t>
+class RootTreeOutput {
+ public:
+  /// Function creating the branches of a tree bound to a columns object
+  using BranchFunction = std::function<void(TTree&, columns_t&)>;
+
+  /// Open the output file, or nothing yet for per-thread files.
+  ///
+  /// @param cfg The output configuration
+  /// @param branch Creates the branches of the output trees
+  explicit RootTreeOutput(
+      RootTreeOutputConfig cfg,
+      BranchFunction branch = [](TTree& tree, columns_t& columns) {
+        columns.branch(tree);
+      })
+      : m_cfg(std::move(cfg)), m_branch(std::move(branch)) {
+    if (m_cfg.filePath.empty()) {
+      throw std::invalid_argument("Missing file path");
+    }
+    if (m_cfg.treeName.empty()) {
+      throw std::invalid_argument("Missing tree name");
+    }
+
+    if (m_cfg.mode == RootOutputMode::FilePerThread) {
+      return;
+    }
+    m_tree = std::make_unique<Tree>(m_cfg.filePath, m_cfg.fileMode,
+                                    m_cfg.treeName, m_branch);
+    if (m_cfg.mode == RootOutputMode::Async) {
+      m_queue.emplace(m_cfg.queueCapacity,
+                      [this](std::vector<columns_t>&& rows) {
+                        m_tree->fill(rows);
+                      });
+    }
+  }
+
+  RootTreeOutput(const RootTreeOutput&) = delete;
+  RootTreeOutput& operator=(const RootTreeOutput&) = delete;
+
+  /// Fill the rows of one event. Thread-safe, but must not be called after
+  /// `close`.
+  ///
+  /// @param rows The rows of the event
+  void fill(std::vector<columns_t> rows) {
+    switch (m_cfg.mode) {
+      case RootOutputMode::Locked: {
+        std::lock_guard<std::mutex> lock(m_fillMutex);
+        m_tree->fill(rows);
+        break;
+      }
+      case RootOutputMode::Async:
+        m_queue->push(std::move(rows));
+        break;
+      case RootOutputMode::FilePerThread: {
+        std::unique_ptr<Tree>& tree = m_threadTrees.local();
+        if (tree == nullptr) {
+          tree = std::make_unique<Tree>(threadFilePath(m_nThreadTrees++),
+                                        "RECREATE", m_cfg.treeName, m_branch);
+        }
+        tree->fill(rows);
+        break;
+      }
+    }
+  }
+
+  /// Write the tree and close the output file.
+  ///
+  /// Waits for all queued events in async mode and merges the per-thread
+  /// files into the output file. Must not be called concurrently to `fill`.
+  void close() {
+    if (std::exchange(m_closed, true)) {
+      return;
+    }
+    if (m_queue.has_value()) {
+      m_queue->close();
+    }
+    if (m_tree != nullptr) {
+      m_tree->write();
+    }
+    if (m_cfg.mode != RootOutputMode::FilePerThread) {
+      return;
+    }
+
+    std::vector<std::string> threadFilePaths;
+    for (std::unique_ptr<Tree>& tree : m_threadTrees) {
+      if (tree != nullptr) {
+        tree->write();
+        threadFilePaths.push_back(tree->path);
+      }
+    }
+    m_threadTrees.clear();
+
+    if (threadFilePaths.empty()) {
+      // No events, still create the output with an empty tree
+      m_tree = std::make_unique<Tree>(m_cfg.filePath, m_cfg.fileMode,
+                                      m_cfg.treeName, m_branch);
+      m_tree->write();
+      return;
+    }
+
+    TFileMerger merger(false);
+    merger.SetPrintLevel(0);
+    if (!merger.OutputFile(m_cfg.filePath.c_str(), m_cfg.fileMode.c_str())) {
+      throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
+    }
+    for (const std::string& path : threadFilePaths) {
+      merger.AddFile(path.c_str(), false);
+    }
+    if (!merger.Merge()) {
+      throw std::runtime_error("Could not merge the per-thread files into '" +
+                               m_cfg.filePath + "'");
+    }
+    for (const std::string& path : threadFilePaths) {
+      std::filesystem::remove(path);
+    }
+  }
+
+  /// The output configuration
+  const RootTreeOutputConfig& config() const { return m_cfg; }
+
+ private:
+  /// A tree in its own file together with the bound branch values
+  struct Tree {
+    std::string path;
+    TFile* file = nullptr;
+    TTree* tree = nullptr;
+    columns_t columns;
+
+    Tree(std::string path_, const std::string& fileMode,
+         const std::string& treeName, const BranchFunction& branch)
+        : path(std::move(path_)) {
+      file = TFile::Open(path.c_str(), fileMode.c_str());
+      if (file == nullptr) {
+        throw std::ios_base::failure("Could not open '" + path + "'");
+      }
+      file->cd();
+      tree = new TTree(treeName.c_str(), treeName.c_str());
+      branch(*tree, columns);
+    }
+
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+
+    ~Tree() {
+      if (file != nullptr) {
+        file->Close();
+        delete file;
+      }
+    }
+
+    void fill(std::vector<columns_t>& rows) {
+      for (columns_t& row : rows) {
+        columns = std::move(row);
+        tree->Fill();
+      }
+    }
+
+    void write() {
+      if (file == nullptr) {
+        return;
+      }
+      file->cd();
+      tree->Write();
+      file->Close();
+      delete file;
+      file = nullptr;
+      tree = nullptr;
+    }
+  };
+
+  RootTreeOutputConfig m_cfg;
+  BranchFunction m_branch;
+  bool m_closed = false;
+
+  std::unique_ptr<Tree> m_tree;
+  std::mutex m_fillMutex;
+
+  std::optional<AsyncOutputQueue<std::vector<columns_t>>> m_queue;
+
+  tbb::enumerable_thread_specific<std::unique_ptr<Tree>> m_threadTrees;
+  std::atomic<std::size_t> m_nThreadTrees = 0;
+
+  std::string threadFilePath(std::size_t index) const {
+    std::filesystem::path path(m_cfg.filePath);
+    path.replace_filename(path.stem().string() + "_thread" +
+                          std::to_string(index) + path.extension().string());
+    return path.string();
+  }
+};
+
+}  // namespace ActsExamples
@@ -14,74 +14,88 @@
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
-#include <ios>
-#include <stdexcept>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
-#include <TFile.h>
 #include <TTree.h>
 
 namespace ActsExamples {
 
+/// One row of the hits tree
+struct RootSimHitWriter::Columns {
+  /// Event identifier.
+  std::uint32_t eventId = 0;
+  /// Hit surface identifier.
+  std::uint64_t geometryId = 0;
+  /// Decoded barcode components written as convenience columns.
+  std::uint32_t barcodeVertexPrimary = 0;
+  std::uint32_t barcodeVertexSecondary = 0;
+  std::uint32_t barcodeParticle = 0;
+  std::uint32_t barcodeGeneration = 0;
+  std::uint32_t barcodeSubParticle = 0;
+  /// True global hit position components in mm.
+  float tx = 0, ty = 0, tz = 0;
+  // True global hit time in ns.
+  float tt = 0;
+  /// True particle four-momentum in GeV at hit position before interaction.
+  float tpx = 0, tpy = 0, tpz = 0, te = 0;
+  /// True change in particle four-momentum in GeV due to interactions.
+  float deltapx = 0, deltapy = 0, deltapz = 0, deltae = 0;
+  /// Hit index along the particle trajectory
+  std::int32_t index = 0;
+  // Decoded hit surface identifier components.
+  std::uint32_t volumeId = 0;
+  std::uint32_t boundaryId = 0;
+  std::uint32_t layerId = 0;
+  std::uint32_t approachId = 0;
+  std::uint32_t sensitiveId = 0;
+
+  void branch(TTree& tree) {
+    tree.Branch("event_id", &eventId);
+    tree.Branch("geometry_id", &geometryId, "geometry_id/l");
+    tree.Branch("barcode_vertex_primary", &barcodeVertexPrimary);
+    tree.Branch("barcode_vertex_secondary", &barcodeVertexSecondary);
+    tree.Branch("barcode_particle", &barcodeParticle);
+    tree.Branch("barcode_generation", &barcodeGeneration);
+    tree.Branch("barcode_sub_particle", &barcodeSubParticle);
+    tree.Branch("tx", &tx);
+    tree.Branch("ty", &ty);
+    tree.Branch("tz", &tz);
+    tree.Branch("tt", &tt);
+    tree.Branch("tpx", &tpx);
+    tree.Branch("tpy", &tpy);
+    tree.Branch("tpz", &tpz);
+    tree.Branch("te", &te);
+    tree.Branch("deltapx", &deltapx);
+    tree.Branch("deltapy", &deltapy);
+    tree.Branch("deltapz", &deltapz);
+    tree.Branch("deltae", &deltae);
+    tree.Branch("index", &index);
+    tree.Branch("volume_id", &volumeId);
+    tree.Branch("boundary_id", &boundaryId);
+    tree.Branch("layer_id", &layerId);
+    tree.Branch("approach_id", &approachId);
+    tree.Branch("sensitive_id", &sensitiveId);
+  }
+};
+
 RootSimHitWriter::RootSimHitWriter(const RootSimHitWriter::Config& config,
                                    Acts::Logging::Level level)
     : WriterT(config.inputSimHits, "RootSimHitWriter", level), m_cfg(config) {
   // inputParticles is already checked by base constructor
-  if (m_cfg.filePath.empty()) {
-    throw std::invalid_argument("Missing file path");
-  }
-  if (m_cfg.treeName.empty()) {
-    throw std::invalid_argument("Missing tree name");
-  }
-
-  // open root file and create the tree
-  m_outputFile = TFile::Open(m_cfg.filePath.c_str(), m_cfg.fileMode.c_str());
-  if (m_outputFile == nullptr) {
-    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
-  }
-  m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
-  }
-
-  // setup the branches
-  m_outputTree->Branch("event_id", &m_eventId);
-  m_outputTree->Branch("geometry_id", &m_geometryId, "geometry_id/l");
-  m_outputTree->Branch("barcode_vertex_primary", &m_barcodeVertexPrimary);
-  m_outputTree->Branch("barcode_vertex_secondary", &m_barcodeVertexSecondary);
-  m_outputTree->Branch("barcode_particle", &m_barcodeParticle);
-  m_outputTree->Branch("barcode_generation", &m_barcodeGeneration);
-  m_outputTree->Branch("barcode_sub_particle", &m_barcodeSubParticle);
-  m_outputTree->Branch("tx", &m_tx);
-  m_outputTree->Branch("ty", &m_ty);
-  m_outputTree->Branch("tz", &m_tz);
-  m_outputTree->Branch("tt", &m_tt);
-  m_outputTree->Branch("tpx", &m_tpx);
-  m_outputTree->Branch("tpy", &m_tpy);
-  m_outputTree->Branch("tpz", &m_tpz);
-  m_outputTree->Branch("te", &m_te);
-  m_outputTree->Branch("deltapx", &m_deltapx);
-  m_outputTree->Branch("deltapy", &m_deltapy);
-  m_outputTree->Branch("deltapz", &m_deltapz);
-  m_outputTree->Branch("deltae", &m_deltae);
-  m_outputTree->Branch("index", &m_index);
-  m_outputTree->Branch("volume_id", &m_volumeId);
-  m_outputTree->Branch("boundary_id", &m_boundaryId);
-  m_outputTree->Branch("layer_id", &m_layerId);
-  m_outputTree->Branch("approach_id", &m_approachId);
-  m_outputTree->Branch("sensitive_id", &m_sensitiveId);
+  RootTreeOutputConfig outputCfg;
+  outputCfg.filePath = m_cfg.filePath;
+  outputCfg.fileMode = m_cfg.fileMode;
+  outputCfg.treeName = m_cfg.treeName;
+  outputCfg.mode = m_cfg.outputMode;
+  m_output = std::make_unique<RootTreeOutput<Columns>>(outputCfg);
 }
 
-RootSimHitWriter::~RootSimHitWriter() {
-  if (m_outputFile != nullptr) {
-    m_outputFile->Close();
-  }
-}
+RootSimHitWriter::~RootSimHitWriter() = default;
 
 ProcessCode RootSimHitWriter::finalize() {
-  m_outputFile->cd();
-  m_outputTree->Write();
-  m_outputFile->Close();
+  m_output->close();
 
   ACTS_VERBOSE("Wrote hits to tree '" << m_cfg.treeName << "' in '"
                                       << m_cfg.filePath << "'");
@@ -91,46 +105,46 @@ ProcessCode RootSimHitWriter::finalize() {
 
 ProcessCode RootSimHitWriter::writeT(const AlgorithmContext& ctx,
                                      const SimHitContainer& hits) {
-  // ensure exclusive access to tree/file while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
-
-  // Get the event number
-  m_eventId = ctx.eventNumber;
+  std::vector<Columns> rows;
+  rows.reserve(hits.size());
   for (const auto& hit : hits) {
-    m_geometryId = hit.geometryId().value();
+    Columns& row = rows.emplace_back();
+    // Get the event number
+    row.eventId = ctx.eventNumber;
+    row.geometryId = hit.geometryId().value();
     const auto barcode = hit.particleId();
-    m_barcodeVertexPrimary = barcode.vertexPrimary();
-    m_barcodeVertexSecondary = barcode.vertexSecondary();
-    m_barcodeParticle = barcode.particle();
-    m_barcodeGeneration = barcode.generation();
-    m_barcodeSubParticle = barcode.subParticle();
+    row.barcodeVertexPrimary = barcode.vertexPrimary();
+    row.barcodeVertexSecondary = barcode.vertexSecondary();
+    row.barcodeParticle = barcode.particle();
+    row.barcodeGeneration = barcode.generation();
+    row.barcodeSubParticle = barcode.subParticle();
     // write hit position
-    m_tx = hit.fourPosition().x() / Acts::UnitConstants::mm;
-    m_ty = hit.fourPosition().y() / Acts::UnitConstants::mm;
-    m_tz = hit.fourPosition().z() / Acts::UnitConstants::mm;
-    m_tt = hit.fourPosition().w() / Acts::UnitConstants::mm;
+    row.tx = hit.fourPosition().x() / Acts::UnitConstants::mm;
+    row.ty = hit.fourPosition().y() / Acts::UnitConstants::mm;
+    row.tz = hit.fourPosition().z() / Acts::UnitConstants::mm;
+    row.tt = hit.fourPosition().w() / Acts::UnitConstants::mm;
     // write four-momentum before interaction
-    m_tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
-    m_tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
-    m_tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
-    m_te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
+    row.tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
+    row.tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
+    row.tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
+    row.te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
     // write four-momentum change due to interaction
     const auto delta4 = hit.momentum4After() - hit.momentum4Before();
-    m_deltapx = delta4.x() / Acts::UnitConstants::GeV;
-    m_deltapy = delta4.y() / Acts::UnitConstants::GeV;
-    m_deltapz = delta4.z() / Acts::UnitConstants::GeV;
-    m_deltae = delta4.w() / Acts::UnitConstants::GeV;
+    row.deltapx = delta4.x() / Acts::UnitConstants::GeV;
+    row.deltapy = delta4.y() / Acts::UnitConstants::GeV;
+    row.deltapz = delta4.z() / Acts::UnitConstants::GeV;
+    row.deltae = delta4.w() / Acts::UnitConstants::GeV;
     // write hit index along trajectory
-    m_index = hit.index();
+    row.index = hit.index();
     // decoded geometry for simplicity
-    m_volumeId = hit.geometryId().volume();
-    m_boundaryId = hit.geometryId().boundary();
-    m_layerId = hit.geometryId().layer();
-    m_approachId = hit.geometryId().approach();
-    m_sensitiveId = hit.geometryId().sensitive();
-    // Fill the tree
-    m_outputTree->Fill();
+    row.volumeId = hit.geometryId().volume();
+    row.boundaryId = hit.geometryId().boundary();
+    row.layerId = hit.geometryId().layer();
+    row.approachId = hit.geometryId().approach();
+    row.sensitiveId = hit.geometryId().sensitive();
   }
+  // Only handing the rows over to the output is serialised
+  m_output->fill(std::move(rows));
   return ProcessCode::SUCCESS;
 }
 
@@ -26,16 +26,17 @@
 #include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
+#include <array>
 #include <cmath>
-#include <ios>
+#include <cstdint>
 #include <limits>
 #include <numbers>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
-#include <TFile.h>
 #include <TTree.h>
 
 namespace ActsExamples {
@@ -45,6 +46,355 @@ using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
 using Acts::VectorHelpers::theta;
 
+/// One row of the track states tree, holding the states of one track
+struct RootTrackStatesWriter::Columns {
+  /// the event number
+  std::uint32_t eventNr{0};
+  /// the track number
+  std::uint32_t trackNr{0};
+
+  /// number of all states
+  unsigned int nStates{0};
+  /// number of states with measurements
+  unsigned int nMeasurements{0};
+
+  /// volume identifier
+  std::vector<int> volumeID;
+  /// layer identifier
+  std::vector<int> layerID;
+  /// surface identifier
+  std::vector<int> moduleID;
+
+  /// track state type
+  std::vector<int> stateType;
+
+  /// chisq from filtering
+  std::vector<float> chi2;
+
+  /// path length
+  std::vector<float> pathLength;
+
+  /// Global truth hit position x
+  std::vector<float> t_x;
+  /// Global truth hit position y
+  std::vector<float> t_y;
+  /// Global truth hit position z
+  std::vector<float> t_z;
+  /// Global truth hit position r
+  std::vector<float> t_r;
+  /// Truth particle direction x at global hit position
+  std::vector<float> t_dx;
+  /// Truth particle direction y at global hit position
+  std::vector<float> t_dy;
+  /// Truth particle direction z at global hit position
+  std::vector<float> t_dz;
+
+  /// truth parameter eBoundLoc0
+  std::vector<float> t_eLOC0;
+  /// truth parameter eBoundLoc1
+  std::vector<float> t_eLOC1;
+  /// truth parameter ePHI
+  std::vector<float> t_ePHI;
+  /// truth parameter eTHETA
+  std::vector<float> t_eTHETA;
+  /// truth parameter eQOP
+  std::vector<float> t_eQOP;
+  /// truth parameter eT
+  std::vector<float> t_eT;
+
+  std::vector<std::vector<std::uint32_t>> particleVertexPrimary;
+  std::vector<std::vector<std::uint32_t>> particleVertexSecondary;
+  std::vector<std::vector<std::uint32_t>> particleParticle;
+  std::vector<std::vector<std::uint32_t>> particleGeneration;
+  std::vector<std::vector<std::uint32_t>> particleSubParticle;
+
+  /// dimension of measurement
+  std::vector<int> dim_hit;
+  /// uncalibrated measurement local x
+  std::vector<float> lx_hit;
+  /// uncalibrated measurement local y
+  std::vector<float> ly_hit;
+  /// uncalibrated measurement global x
+  std::vector<float> x_hit;
+  /// uncalibrated measurement global y
+  std::vector<float> y_hit;
+  /// uncalibrated measurement global z
+  std::vector<float> z_hit;
+  /// hit residual x
+  std::vector<float> res_x_hit;
+  /// hit residual y
+  std::vector<float> res_y_hit;
+  /// hit err x
+  std::vector<float> err_x_hit;
+  /// hit err y
+  std::vector<float> err_y_hit;
+  /// hit pull x
+  std::vector<float> pull_x_hit;
+  /// hit pull y
+  std::vector<float> pull_y_hit;
+
+  /// number of states which have filtered/predicted/smoothed/unbiased
+  /// parameters
+  std::array<int, eSize> nParams{};
+  /// status of the filtered/predicted/smoothed/unbiased parameters
+  std::array<std::vector<bool>, eSize> hasParams;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC0
+  std::array<std::vector<float>, eSize> eLOC0;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC1
+  std::array<std::vector<float>, eSize> eLOC1;
+  /// predicted/filtered/smoothed/unbiased parameter ePHI
+  std::array<std::vector<float>, eSize> ePHI;
+  /// predicted/filtered/smoothed/unbiased parameter eTHETA
+  std::array<std::vector<float>, eSize> eTHETA;
+  /// predicted/filtered/smoothed/unbiased parameter eQOP
+  std::array<std::vector<float>, eSize> eQOP;
+  /// predicted/filtered/smoothed/unbiased parameter eT
+  std::array<std::vector<float>, eSize> eT;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC0 residual
+  std::array<std::vector<float>, eSize> res_eLOC0;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC1 residual
+  std::array<std::vector<float>, eSize> res_eLOC1;
+  /// predicted/filtered/smoothed/unbiased parameter ePHI residual
+  std::array<std::vector<float>, eSize> res_ePHI;
+  /// predicted/filtered/smoothed/unbiased parameter eTHETA residual
+  std::array<std::vector<float>, eSize> res_eTHETA;
+  /// predicted/filtered/smoothed/unbiased parameter eQOP residual
+  std::array<std::vector<float>, eSize> res_eQOP;
+  /// predicted/filtered/smoothed/unbiased parameter eT residual
+  std::array<std::vector<float>, eSize> res_eT;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC0 error
+  std::array<std::vector<float>, eSize> err_eLOC0;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC1 error
+  std::array<std::vector<float>, eSize> err_eLOC1;
+  /// predicted/filtered/smoothed/unbiased parameter ePHI error
+  std::array<std::vector<float>, eSize> err_ePHI;
+  /// predicted/filtered/smoothed/unbiased parameter eTHETA error
+  std::array<std::vector<float>, eSize> err_eTHETA;
+  /// predicted/filtered/smoothed/unbiased parameter eQOP error
+  std::array<std::vector<float>, eSize> err_eQOP;
+  /// predicted/filtered/smoothed/unbiased parameter eT error
+  std::array<std::vector<float>, eSize> err_eT;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC0 pull
+  std::array<std::vector<float>, eSize> pull_eLOC0;
+  /// predicted/filtered/smoothed/unbiased parameter eLOC1 pull
+  std::array<std::vector<float>, eSize> pull_eLOC1;
+  /// predicted/filtered/smoothed/unbiased parameter ePHI pull
+  std::array<std::vector<float>, eSize> pull_ePHI;
+  /// predicted/filtered/smoothed/unbiased parameter eTHETA pull
+  std::array<std::vector<float>, eSize> pull_eTHETA;
+  /// predicted/filtered/smoothed/unbiased parameter eQOP pull
+  std::array<std::vector<float>, eSize> pull_eQOP;
+  /// predicted/filtered/smoothed/unbiased parameter eT pull
+  std::array<std::vector<float>, eSize> pull_eT;
+  /// predicted/filtered/smoothed/unbiased parameter global x
+  std::array<std::vector<float>, eSize> x;
+  /// predicted/filtered/smoothed/unbiased parameter global y
+  std::array<std::vector<float>, eSize> y;
+  /// predicted/filtered/smoothed/unbiased parameter global z
+  std::array<std::vector<float>, eSize> z;
+  /// predicted/filtered/smoothed/unbiased parameter px
+  std::array<std::vector<float>, eSize> px;
+  /// predicted/filtered/smoothed/unbiased parameter py
+  std::array<std::vector<float>, eSize> py;
+  /// predicted/filtered/smoothed/unbiased parameter pz
+  std::array<std::vector<float>, eSize> pz;
+  /// predicted/filtered/smoothed/unbiased parameter eta
+  std::array<std::vector<float>, eSize> eta;
+  /// predicted/filtered/smoothed/unbiased parameter pT
+  std::array<std::vector<float>, eSize> pT;
+
+  void branch(TTree& tree) {
+    // I/O parameters
+    tree.Branch("event_nr", &eventNr);
+    tree.Branch("track_nr", &trackNr);
+
+    tree.Branch("nStates", &nStates);
+    tree.Branch("nMeasurements", &nMeasurements);
+
+    tree.Branch("volume_id", &volumeID);
+    tree.Branch("layer_id", &layerID);
+    tree.Branch("module_id", &moduleID);
+
+    tree.Branch("stateType", &stateType);
+
+    tree.Branch("chi2", &chi2);
+
+    tree.Branch("pathLength", &pathLength);
+
+    tree.Branch("t_x", &t_x);
+    tree.Branch("t_y", &t_y);
+    tree.Branch("t_z", &t_z);
+    tree.Branch("t_r", &t_r);
+    tree.Branch("t_dx", &t_dx);
+    tree.Branch("t_dy", &t_dy);
+    tree.Branch("t_dz", &t_dz);
+    tree.Branch("t_eLOC0", &t_eLOC0);
+    tree.Branch("t_eLOC1", &t_eLOC1);
+    tree.Branch("t_ePHI", &t_ePHI);
+    tree.Branch("t_eTHETA", &t_eTHETA);
+    tree.Branch("t_eQOP", &t_eQOP);
+    tree.Branch("t_eT", &t_eT);
+    tree.Branch("particle_ids_vertex_primary", &particleVertexPrimary);
+    tree.Branch("particle_ids_vertex_secondary", &particleVertexSecondary);
+    tree.Branch("particle_ids_particle", &particleParticle);
+    tree.Branch("particle_ids_generation", &particleGeneration);
+    tree.Branch("particle_ids_sub_particle", &particleSubParticle);
+
+    tree.Branch("dim_hit", &dim_hit);
+    tree.Branch("l_x_hit", &lx_hit);
+    tree.Branch("l_y_hit", &ly_hit);
+    tree.Branch("g_x_hit", &x_hit);
+    tree.Branch("g_y_hit", &y_hit);
+    tree.Branch("g_z_hit", &z_hit);
+    tree.Branch("res_x_hit", &res_x_hit);
+    tree.Branch("res_y_hit", &res_y_hit);
+    tree.Branch("err_x_hit", &err_x_hit);
+    tree.Branch("err_y_hit", &err_y_hit);
+    tree.Branch("pull_x_hit", &pull_x_hit);
+    tree.Branch("pull_y_hit", &pull_y_hit);
+
+    tree.Branch("nPredicted", &nParams[ePredicted]);
+    tree.Branch("predicted", &hasParams[ePredicted]);
+    tree.Branch("eLOC0_prt", &eLOC0[ePredicted]);
+    tree.Branch("eLOC1_prt", &eLOC1[ePredicted]);
+    tree.Branch("ePHI_prt", &ePHI[ePredicted]);
+    tree.Branch("eTHETA_prt", &eTHETA[ePredicted]);
+    tree.Branch("eQOP_prt", &eQOP[ePredicted]);
+    tree.Branch("eT_prt", &eT[ePredicted]);
+    tree.Branch("res_eLOC0_prt", &res_eLOC0[ePredicted]);
+    tree.Branch("res_eLOC1_prt", &res_eLOC1[ePredicted]);
+    tree.Branch("res_ePHI_prt", &res_ePHI[ePredicted]);
+    tree.Branch("res_eTHETA_prt", &res_eTHETA[ePredicted]);
+    tree.Branch("res_eQOP_prt", &res_eQOP[ePredicted]);
+    tree.Branch("res_eT_prt", &res_eT[ePredicted]);
+    tree.Branch("err_eLOC0_prt", &err_eLOC0[ePredicted]);
+    tree.Branch("err_eLOC1_prt", &err_eLOC1[ePredicted]);
+    tree.Branch("err_ePHI_prt", &err_ePHI[ePredicted]);
+    tree.Branch("err_eTHETA_prt", &err_eTHETA[ePredicted]);
+    tree.Branch("err_eQOP_prt", &err_eQOP[ePredicted]);
+    tree.Branch("err_eT_prt", &err_eT[ePredicted]);
+    tree.Branch("pull_eLOC0_prt", &pull_eLOC0[ePredicted]);
+    tree.Branch("pull_eLOC1_prt", &pull_eLOC1[ePredicted]);
+    tree.Branch("pull_ePHI_prt", &pull_ePHI[ePredicted]);
+    tree.Branch("pull_eTHETA_prt", &pull_eTHETA[ePredicted]);
+    tree.Branch("pull_eQOP_prt", &pull_eQOP[ePredicted]);
+    tree.Branch("pull_eT_prt", &pull_eT[ePredicted]);
+    tree.Branch("g_x_prt", &x[ePredicted]);
+    tree.Branch("g_y_prt", &y[ePredicted]);
+    tree.Branch("g_z_prt", &z[ePredicted]);
+    tree.Branch("px_prt", &px[ePredicted]);
+    tree.Branch("py_prt", &py[ePredicted]);
+    tree.Branch("pz_prt", &pz[ePredicted]);
+    tree.Branch("eta_prt", &eta[ePredicted]);
+    tree.Branch("pT_prt", &pT[ePredicted]);
+
+    tree.Branch("nFiltered", &nParams[eFiltered]);
+    tree.Branch("filtered", &hasParams[eFiltered]);
+    tree.Branch("eLOC0_flt", &eLOC0[eFiltered]);
+    tree.Branch("eLOC1_flt", &eLOC1[eFiltered]);
+    tree.Branch("ePHI_flt", &ePHI[eFiltered]);
+    tree.Branch("eTHETA_flt", &eTHETA[eFiltered]);
+    tree.Branch("eQOP_flt", &eQOP[eFiltered]);
+    tree.Branch("eT_flt", &eT[eFiltered]);
+    tree.Branch("res_eLOC0_flt", &res_eLOC0[eFiltered]);
+    tree.Branch("res_eLOC1_flt", &res_eLOC1[eFiltered]);
+    tree.Branch("res_ePHI_flt", &res_ePHI[eFiltered]);
+    tree.Branch("res_eTHETA_flt", &res_eTHETA[eFiltered]);
+    tree.Branch("res_eQOP_flt", &res_eQOP[eFiltered]);
+    tree.Branch("res_eT_flt", &res_eT[eFiltered]);
+    tree.Branch("err_eLOC0_flt", &err_eLOC0[eFiltered]);
+    tree.Branch("err_eLOC1_flt", &err_eLOC1[eFiltered]);
+    tree.Branch("err_ePHI_flt", &err_ePHI[eFiltered]);
+    tree.Branch("err_eTHETA_flt", &err_eTHETA[eFiltered]);
+    tree.Branch("err_eQOP_flt", &err_eQOP[eFiltered]);
+    tree.Branch("err_eT_flt", &err_eT[eFiltered]);
+    tree.Branch("pull_eLOC0_flt", &pull_eLOC0[eFiltered]);
+    tree.Branch("pull_eLOC1_flt", &pull_eLOC1[eFiltered]);
+    tree.Branch("pull_ePHI_flt", &pull_ePHI[eFiltered]);
+    tree.Branch("pull_eTHETA_flt", &pull_eTHETA[eFiltered]);
+    tree.Branch("pull_eQOP_flt", &pull_eQOP[eFiltered]);
+    tree.Branch("pull_eT_flt", &pull_eT[eFiltered]);
+    tree.Branch("g_x_flt", &x[eFiltered]);
+    tree.Branch("g_y_flt", &y[eFiltered]);
+    tree.Branch("g_z_flt", &z[eFiltered]);
+    tree.Branch("px_flt", &px[eFiltered]);
+    tree.Branch("py_flt", &py[eFiltered]);
+    tree.Branch("pz_flt", &pz[eFiltered]);
+    tree.Branch("eta_flt", &eta[eFiltered]);
+    tree.Branch("pT_flt", &pT[eFiltered]);
+
+    tree.Branch("nSmoothed", &nParams[eSmoothed]);
+    tree.Branch("smoothed", &hasParams[eSmoothed]);
+    tree.Branch("eLOC0_smt", &eLOC0[eSmoothed]);
+    tree.Branch("eLOC1_smt", &eLOC1[eSmoothed]);
+    tree.Branch("ePHI_smt", &ePHI[eSmoothed]);
+    tree.Branch("eTHETA_smt", &eTHETA[eSmoothed]);
+    tree.Branch("eQOP_smt", &eQOP[eSmoothed]);
+    tree.Branch("eT_smt", &eT[eSmoothed]);
+    tree.Branch("res_eLOC0_smt", &res_eLOC0[eSmoothed]);
+    tree.Branch("res_eLOC1_smt", &res_eLOC1[eSmoothed]);
+    tree.Branch("res_ePHI_smt", &res_ePHI[eSmoothed]);
+    tree.Branch("res_eTHETA_smt", &res_eTHETA[eSmoothed]);
+    tree.Branch("res_eQOP_smt", &res_eQOP[eSmoothed]);
+    tree.Branch("res_eT_smt", &res_eT[eSmoothed]);
+    tree.Branch("err_eLOC0_smt", &err_eLOC0[eSmoothed]);
+    tree.Branch("err_eLOC1_smt", &err_eLOC1[eSmoothed]);
+    tree.Branch("err_ePHI_smt", &err_ePHI[eSmoothed]);
+    tree.Branch("err_eTHETA_smt", &err_eTHETA[eSmoothed]);
+    tree.Branch("err_eQOP_smt", &err_eQOP[eSmoothed]);
+    tree.Branch("err_eT_smt", &err_eT[eSmoothed]);
+    tree.Branch("pull_eLOC0_smt", &pull_eLOC0[eSmoothed]);
+    tree.Branch("pull_eLOC1_smt", &pull_eLOC1[eSmoothed]);
+    tree.Branch("pull_ePHI_smt", &pull_ePHI[eSmoothed]);
+    tree.Branch("pull_eTHETA_smt", &pull_eTHETA[eSmoothed]);
+    tree.Branch("pull_eQOP_smt", &pull_eQOP[eSmoothed]);
+    tree.Branch("pull_eT_smt", &pull_eT[eSmoothed]);
+    tree.Branch("g_x_smt", &x[eSmoothed]);
+    tree.Branch("g_y_smt", &y[eSmoothed]);
+    tree.Branch("g_z_smt", &z[eSmoothed]);
+    tree.Branch("px_smt", &px[eSmoothed]);
+    tree.Branch("py_smt", &py[eSmoothed]);
+    tree.Branch("pz_smt", &pz[eSmoothed]);
+    tree.Branch("eta_smt", &eta[eSmoothed]);
+    tree.Branch("pT_smt", &pT[eSmoothed]);
+
+    tree.Branch("nUnbiased", &nParams[eUnbiased]);
+    tree.Branch("unbiased", &hasParams[eUnbiased]);
+    tree.Branch("eLOC0_ubs", &eLOC0[eUnbiased]);
+    tree.Branch("eLOC1_ubs", &eLOC1[eUnbiased]);
+    tree.Branch("ePHI_ubs", &ePHI[eUnbiased]);
+    tree.Branch("eTHETA_ubs", &eTHETA[eUnbiased]);
+    tree.Branch("eQOP_ubs", &eQOP[eUnbiased]);
+    tree.Branch("eT_ubs", &eT[eUnbiased]);
+    tree.Branch("res_eLOC0_ubs", &res_eLOC0[eUnbiased]);
+    tree.Branch("res_eLOC1_ubs", &res_eLOC1[eUnbiased]);
+    tree.Branch("res_ePHI_ubs", &res_ePHI[eUnbiased]);
+    tree.Branch("res_eTHETA_ubs", &res_eTHETA[eUnbiased]);
+    tree.Branch("res_eQOP_ubs", &res_eQOP[eUnbiased]);
+    tree.Branch("res_eT_ubs", &res_eT[eUnbiased]);
+    tree.Branch("err_eLOC0_ubs", &err_eLOC0[eUnbiased]);
+    tree.Branch("err_eLOC1_ubs", &err_eLOC1[eUnbiased]);
+    tree.Branch("err_ePHI_ubs", &err_ePHI[eUnbiased]);
+    tree.Branch("err_eTHETA_ubs", &err_eTHETA[eUnbiased]);
+    tree.Branch("err_eQOP_ubs", &err_eQOP[eUnbiased]);
+    tree.Branch("err_eT_ubs", &err_eT[eUnbiased]);
+    tree.Branch("pull_eLOC0_ubs", &pull_eLOC0[eUnbiased]);
+    tree.Branch("pull_eLOC1_ubs", &pull_eLOC1[eUnbiased]);
+    tree.Branch("pull_ePHI_ubs", &pull_ePHI[eUnbiased]);
+    tree.Branch("pull_eTHETA_ubs", &pull_eTHETA[eUnbiased]);
+    tree.Branch("pull_eQOP_ubs", &pull_eQOP[eUnbiased]);
+    tree.Branch("pull_eT_ubs", &pull_eT[eUnbiased]);
+    tree.Branch("g_x_ubs", &x[eUnbiased]);
+    tree.Branch("g_y_ubs", &y[eUnbiased]);
+    tree.Branch("g_z_ubs", &z[eUnbiased]);
+    tree.Branch("px_ubs", &px[eUnbiased]);
+    tree.Branch("py_ubs", &py[eUnbiased]);
+    tree.Branch("pz_ubs", &pz[eUnbiased]);
+    tree.Branch("eta_ubs", &eta[eUnbiased]);
+    tree.Branch("pT_ubs", &pT[eUnbiased]);
+  }
+};
+
 RootTrackStatesWriter::RootTrackStatesWriter(
     const RootTrackStatesWriter::Config& config, Acts::Logging::Level level)
     : WriterT(config.inputTracks, "RootTrackStatesWriter", level),
@@ -63,229 +413,24 @@ RootTrackStatesWriter::RootTrackStatesWriter(
     throw std::invalid_argument(
         "Missing hit-simulated-hits map input collection");
   }
-  if (m_cfg.filePath.empty()) {
-    throw std::invalid_argument("Missing output filename");
-  }
-  if (m_cfg.treeName.empty()) {
-    throw std::invalid_argument("Missing tree name");
-  }
 
   m_inputParticles.initialize(m_cfg.inputParticles);
   m_inputTrackParticleMatching.initialize(m_cfg.inputTrackParticleMatching);
   m_inputSimHits.initialize(m_cfg.inputSimHits);
   m_inputMeasurementSimHitsMap.initialize(m_cfg.inputMeasurementSimHitsMap);
 
-  // Setup ROOT I/O
-  auto path = m_cfg.filePath;
-  m_outputFile = TFile::Open(path.c_str(), m_cfg.fileMode.c_str());
-  if (m_outputFile == nullptr) {
-    throw std::ios_base::failure("Could not open '" + path + "'");
-  }
-  m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
-  }
-
-  // I/O parameters
-  m_outputTree->Branch("event_nr", &m_eventNr);
-  m_outputTree->Branch("track_nr", &m_trackNr);
-
-  m_outputTree->Branch("nStates", &m_nStates);
-  m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-
-  m_outputTree->Branch("volume_id", &m_volumeID);
-  m_outputTree->Branch("layer_id", &m_layerID);
-  m_outputTree->Branch("module_id", &m_moduleID);
-
-  m_outputTree->Branch("stateType", &m_stateType);
-
-  m_outputTree->Branch("chi2", &m_chi2);
-
-  m_outputTree->Branch("pathLength", &m_pathLength);
-
-  m_outputTree->Branch("t_x", &m_t_x);
-  m_outputTree->Branch("t_y", &m_t_y);
-  m_outputTree->Branch("t_z", &m_t_z);
-  m_outputTree->Branch("t_r", &m_t_r);
-  m_outputTree->Branch("t_dx", &m_t_dx);
-  m_outputTree->Branch("t_dy", &m_t_dy);
-  m_outputTree->Branch("t_dz", &m_t_dz);
-  m_outputTree->Branch("t_eLOC0", &m_t_eLOC0);
-  m_outputTree->Branch("t_eLOC1", &m_t_eLOC1);
-  m_outputTree->Branch("t_ePHI", &m_t_ePHI);
-  m_outputTree->Branch("t_eTHETA", &m_t_eTHETA);
-  m_outputTree->Branch("t_eQOP", &m_t_eQOP);
-  m_outputTree->Branch("t_eT", &m_t_eT);
-  m_outputTree->Branch("particle_ids_vertex_primary", &m_particleVertexPrimary);
-  m_outputTree->Branch("particle_ids_vertex_secondary",
-                       &m_particleVertexSecondary);
-  m_outputTree->Branch("particle_ids_particle", &m_particleParticle);
-  m_outputTree->Branch("particle_ids_generation", &m_particleGeneration);
-  m_outputTree->Branch("particle_ids_sub_particle", &m_particleSubParticle);
-
-  m_outputTree->Branch("dim_hit", &m_dim_hit);
-  m_outputTree->Branch("l_x_hit", &m_lx_hit);
-  m_outputTree->Branch("l_y_hit", &m_ly_hit);
-  m_outputTree->Branch("g_x_hit", &m_x_hit);
-  m_outputTree->Branch("g_y_hit", &m_y_hit);
-  m_outputTree->Branch("g_z_hit", &m_z_hit);
-  m_outputTree->Branch("res_x_hit", &m_res_x_hit);
-  m_outputTree->Branch("res_y_hit", &m_res_y_hit);
-  m_outputTree->Branch("err_x_hit", &m_err_x_hit);
-  m_outputTree->Branch("err_y_hit", &m_err_y_hit);
-  m_outputTree->Branch("pull_x_hit", &m_pull_x_hit);
-  m_outputTree->Branch("pull_y_hit", &m_pull_y_hit);
-
-  m_outputTree->Branch("nPredicted", &m_nParams[ePredicted]);
-  m_outputTree->Branch("predicted", &m_hasParams[ePredicted]);
-  m_outputTree->Branch("eLOC0_prt", &m_eLOC0[ePredicted]);
-  m_outputTree->Branch("eLOC1_prt", &m_eLOC1[ePredicted]);
-  m_outputTree->Branch("ePHI_prt", &m_ePHI[ePredicted]);
-  m_outputTree->Branch("eTHETA_prt", &m_eTHETA[ePredicted]);
-  m_outputTree->Branch("eQOP_prt", &m_eQOP[ePredicted]);
-  m_outputTree->Branch("eT_prt", &m_eT[ePredicted]);
-  m_outputTree->Branch("res_eLOC0_prt", &m_res_eLOC0[ePredicted]);
-  m_outputTree->Branch("res_eLOC1_prt", &m_res_eLOC1[ePredicted]);
-  m_outputTree->Branch("res_ePHI_prt", &m_res_ePHI[ePredicted]);
-  m_outputTree->Branch("res_eTHETA_prt", &m_res_eTHETA[ePredicted]);
-  m_outputTree->Branch("res_eQOP_prt", &m_res_eQOP[ePredicted]);
-  m_outputTree->Branch("res_eT_prt", &m_res_eT[ePredicted]);
-  m_outputTree->Branch("err_eLOC0_prt", &m_err_eLOC0[ePredicted]);
-  m_outputTree->Branch("err_eLOC1_prt", &m_err_eLOC1[ePredicted]);
-  m_outputTree->Branch("err_ePHI_prt", &m_err_ePHI[ePredicted]);
-  m_outputTree->Branch("err_eTHETA_prt", &m_err_eTHETA[ePredicted]);
-  m_outputTree->Branch("err_eQOP_prt", &m_err_eQOP[ePredicted]);
-  m_outputTree->Branch("err_eT_prt", &m_err_eT[ePredicted]);
-  m_outputTree->Branch("pull_eLOC0_prt", &m_pull_eLOC0[ePredicted]);
-  m_outputTree->Branch("pull_eLOC1_prt", &m_pull_eLOC1[ePredicted]);
-  m_outputTree->Branch("pull_ePHI_prt", &m_pull_ePHI[ePredicted]);
-  m_outputTree->Branch("pull_eTHETA_prt", &m_pull_eTHETA[ePredicted]);
-  m_outputTree->Branch("pull_eQOP_prt", &m_pull_eQOP[ePredicted]);
-  m_outputTree->Branch("pull_eT_prt", &m_pull_eT[ePredicted]);
-  m_outputTree->Branch("g_x_prt", &m_x[ePredicted]);
-  m_outputTree->Branch("g_y_prt", &m_y[ePredicted]);
-  m_outputTree->Branch("g_z_prt", &m_z[ePredicted]);
-  m_outputTree->Branch("px_prt", &m_px[ePredicted]);
-  m_outputTree->Branch("py_prt", &m_py[ePredicted]);
-  m_outputTree->Branch("pz_prt", &m_pz[ePredicted]);
-  m_outputTree->Branch("eta_prt", &m_eta[ePredicted]);
-  m_outputTree->Branch("pT_prt", &m_pT[ePredicted]);
-
-  m_outputTree->Branch("nFiltered", &m_nParams[eFiltered]);
-  m_outputTree->Branch("filtered", &m_hasParams[eFiltered]);
-  m_outputTree->Branch("eLOC0_flt", &m_eLOC0[eFiltered]);
-  m_outputTree->Branch("eLOC1_flt", &m_eLOC1[eFiltered]);
-  m_outputTree->Branch("ePHI_flt", &m_ePHI[eFiltered]);
-  m_outputTree->Branch("eTHETA_flt", &m_eTHETA[eFiltered]);
-  m_outputTree->Branch("eQOP_flt", &m_eQOP[eFiltered]);
-  m_outputTree->Branch("eT_flt", &m_eT[eFiltered]);
-  m_outputTree->Branch("res_eLOC0_flt", &m_res_eLOC0[eFiltered]);
-  m_outputTree->Branch("res_eLOC1_flt", &m_res_eLOC1[eFiltered]);
-  m_outputTree->Branch("res_ePHI_flt", &m_res_ePHI[eFiltered]);
-  m_outputTree->Branch("res_eTHETA_flt", &m_res_eTHETA[eFiltered]);
-  m_outputTree->Branch("res_eQOP_flt", &m_res_eQOP[eFiltered]);
-  m_outputTree->Branch("res_eT_flt", &m_res_eT[eFiltered]);
-  m_outputTree->Branch("err_eLOC0_flt", &m_err_eLOC0[eFiltered]);
-  m_outputTree->Branch("err_eLOC1_flt", &m_err_eLOC1[eFiltered]);
-  m_outputTree->Branch("err_ePHI_flt", &m_err_ePHI[eFiltered]);
-  m_outputTree->Branch("err_eTHETA_flt", &m_err_eTHETA[eFiltered]);
-  m_outputTree->Branch("err_eQOP_flt", &m_err_eQOP[eFiltered]);
-  m_outputTree->Branch("err_eT_flt", &m_err_eT[eFiltered]);
-  m_outputTree->Branch("pull_eLOC0_flt", &m_pull_eLOC0[eFiltered]);
-  m_outputTree->Branch("pull_eLOC1_flt", &m_pull_eLOC1[eFiltered]);
-  m_outputTree->Branch("pull_ePHI_flt", &m_pull_ePHI[eFiltered]);
-  m_outputTree->Branch("pull_eTHETA_flt", &m_pull_eTHETA[eFiltered]);
-  m_outputTree->Branch("pull_eQOP_flt", &m_pull_eQOP[eFiltered]);
-  m_outputTree->Branch("pull_eT_flt", &m_pull_eT[eFiltered]);
-  m_outputTree->Branch("g_x_flt", &m_x[eFiltered]);
-  m_outputTree->Branch("g_y_flt", &m_y[eFiltered]);
-  m_outputTree->Branch("g_z_flt", &m_z[eFiltered]);
-  m_outputTree->Branch("px_flt", &m_px[eFiltered]);
-  m_outputTree->Branch("py_flt", &m_py[eFiltered]);
-  m_outputTree->Branch("pz_flt", &m_pz[eFiltered]);
-  m_outputTree->Branch("eta_flt", &m_eta[eFiltered]);
-  m_outputTree->Branch("pT_flt", &m_pT[eFiltered]);
-
-  m_outputTree->Branch("nSmoothed", &m_nParams[eSmoothed]);
-  m_outputTree->Branch("smoothed", &m_hasParams[eSmoothed]);
-  m_outputTree->Branch("eLOC0_smt", &m_eLOC0[eSmoothed]);
-  m_outputTree->Branch("eLOC1_smt", &m_eLOC1[eSmoothed]);
-  m_outputTree->Branch("ePHI_smt", &m_ePHI[eSmoothed]);
-  m_outputTree->Branch("eTHETA_smt", &m_eTHETA[eSmoothed]);
-  m_outputTree->Branch("eQOP_smt", &m_eQOP[eSmoothed]);
-  m_outputTree->Branch("eT_smt", &m_eT[eSmoothed]);
-  m_outputTree->Branch("res_eLOC0_smt", &m_res_eLOC0[eSmoothed]);
-  m_outputTree->Branch("res_eLOC1_smt", &m_res_eLOC1[eSmoothed]);
-  m_outputTree->Branch("res_ePHI_smt", &m_res_ePHI[eSmoothed]);
-  m_outputTree->Branch("res_eTHETA_smt", &m_res_eTHETA[eSmoothed]);
-  m_outputTree->Branch("res_eQOP_smt", &m_res_eQOP[eSmoothed]);
-  m_outputTree->Branch("res_eT_smt", &m_res_eT[eSmoothed]);
-  m_outputTree->Branch("err_eLOC0_smt", &m_err_eLOC0[eSmoothed]);
-  m_outputTree->Branch("err_eLOC1_smt", &m_err_eLOC1[eSmoothed]);
-  m_outputTree->Branch("err_ePHI_smt", &m_err_ePHI[eSmoothed]);
-  m_outputTree->Branch("err_eTHETA_smt", &m_err_eTHETA[eSmoothed]);
-  m_outputTree->Branch("err_eQOP_smt", &m_err_eQOP[eSmoothed]);
-  m_outputTree->Branch("err_eT_smt", &m_err_eT[eSmoothed]);
-  m_outputTree->Branch("pull_eLOC0_smt", &m_pull_eLOC0[eSmoothed]);
-  m_outputTree->Branch("pull_eLOC1_smt", &m_pull_eLOC1[eSmoothed]);
-  m_outputTree->Branch("pull_ePHI_smt", &m_pull_ePHI[eSmoothed]);
-  m_outputTree->Branch("pull_eTHETA_smt", &m_pull_eTHETA[eSmoothed]);
-  m_outputTree->Branch("pull_eQOP_smt", &m_pull_eQOP[eSmoothed]);
-  m_outputTree->Branch("pull_eT_smt", &m_pull_eT[eSmoothed]);
-  m_outputTree->Branch("g_x_smt", &m_x[eSmoothed]);
-  m_outputTree->Branch("g_y_smt", &m_y[eSmoothed]);
-  m_outputTree->Branch("g_z_smt", &m_z[eSmoothed]);
-  m_outputTree->Branch("px_smt", &m_px[eSmoothed]);
-  m_outputTree->Branch("py_smt", &m_py[eSmoothed]);
-  m_outputTree->Branch("pz_smt", &m_pz[eSmoothed]);
-  m_outputTree->Branch("eta_smt", &m_eta[eSmoothed]);
-  m_outputTree->Branch("pT_smt", &m_pT[eSmoothed]);
-
-  m_outputTree->Branch("nUnbiased", &m_nParams[eUnbiased]);
-  m_outputTree->Branch("unbiased", &m_hasParams[eUnbiased]);
-  m_outputTree->Branch("eLOC0_ubs", &m_eLOC0[eUnbiased]);
-  m_outputTree->Branch("eLOC1_ubs", &m_eLOC1[eUnbiased]);
-  m_outputTree->Branch("ePHI_ubs", &m_ePHI[eUnbiased]);
-  m_outputTree->Branch("eTHETA_ubs", &m_eTHETA[eUnbiased]);
-  m_outputTree->Branch("eQOP_ubs", &m_eQOP[eUnbiased]);
-  m_outputTree->Branch("eT_ubs", &m_eT[eUnbiased]);
-  m_outputTree->Branch("res_eLOC0_ubs", &m_res_eLOC0[eUnbiased]);
-  m_outputTree->Branch("res_eLOC1_ubs", &m_res_eLOC1[eUnbiased]);
-  m_outputTree->Branch("res_ePHI_ubs", &m_res_ePHI[eUnbiased]);
-  m_outputTree->Branch("res_eTHETA_ubs", &m_res_eTHETA[eUnbiased]);
-  m_outputTree->Branch("res_eQOP_ubs", &m_res_eQOP[eUnbiased]);
-  m_outputTree->Branch("res_eT_ubs", &m_res_eT[eUnbiased]);
-  m_outputTree->Branch("err_eLOC0_ubs", &m_err_eLOC0[eUnbiased]);
-  m_outputTree->Branch("err_eLOC1_ubs", &m_err_eLOC1[eUnbiased]);
-  m_outputTree->Branch("err_ePHI_ubs", &m_err_ePHI[eUnbiased]);
-  m_outputTree->Branch("err_eTHETA_ubs", &m_err_eTHETA[eUnbiased]);
-  m_outputTree->Branch("err_eQOP_ubs", &m_err_eQOP[eUnbiased]);
-  m_outputTree->Branch("err_eT_ubs", &m_err_eT[eUnbiased]);
-  m_outputTree->Branch("pull_eLOC0_ubs", &m_pull_eLOC0[eUnbiased]);
-  m_outputTree->Branch("pull_eLOC1_ubs", &m_pull_eLOC1[eUnbiased]);
-  m_outputTree->Branch("pull_ePHI_ubs", &m_pull_ePHI[eUnbiased]);
-  m_outputTree->Branch("pull_eTHETA_ubs", &m_pull_eTHETA[eUnbiased]);
-  m_outputTree->Branch("pull_eQOP_ubs", &m_pull_eQOP[eUnbiased]);
-  m_outputTree->Branch("pull_eT_ubs", &m_pull_eT[eUnbiased]);
-  m_outputTree->Branch("g_x_ubs", &m_x[eUnbiased]);
-  m_outputTree->Branch("g_y_ubs", &m_y[eUnbiased]);
-  m_outputTree->Branch("g_z_ubs", &m_z[eUnbiased]);
-  m_outputTree->Branch("px_ubs", &m_px[eUnbiased]);
-  m_outputTree->Branch("py_ubs", &m_py[eUnbiased]);
-  m_outputTree->Branch("pz_ubs", &m_pz[eUnbiased]);
-  m_outputTree->Branch("eta_ubs", &m_eta[eUnbiased]);
-  m_outputTree->Branch("pT_ubs", &m_pT[eUnbiased]);
+  RootTreeOutputConfig outputCfg;
+  outputCfg.filePath = m_cfg.filePath;
+  outputCfg.fileMode = m_cfg.fileMode;
+  outputCfg.treeName = m_cfg.treeName;
+  outputCfg.mode = m_cfg.outputMode;
+  m_output = std::make_unique<RootTreeOutput<Columns>>(outputCfg);
 }
 
-RootTrackStatesWriter::~RootTrackStatesWriter() {
-  m_outputFile->Close();
-}
+RootTrackStatesWriter::~RootTrackStatesWriter() = default;
 
 ProcessCode RootTrackStatesWriter::finalize() {
-  m_outputFile->cd();
-  m_outputTree->Write();
-  m_outputFile->Close();
+  m_output->close();
   return ProcessCode::SUCCESS;
 }
 
@@ -317,18 +462,19 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
   const auto& simHits = m_inputSimHits(ctx);
   const auto& hitSimHitsMap = m_inputMeasurementSimHitsMap(ctx);
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
-
-  // Get the event number
-  m_eventNr = ctx.eventNumber;
+  // Every track is written as one row
+  std::vector<Columns> rows;
+  rows.reserve(tracks.size());
 
   for (const auto& track : tracks) {
-    m_trackNr = track.index();
+    Columns& row = rows.emplace_back();
+    // Get the event number
+    row.eventNr = ctx.eventNumber;
+    row.trackNr = track.index();
 
     // Collect the track summary info
-    m_nMeasurements = track.nMeasurements();
-    m_nStates = track.nTrackStates();
+    row.nMeasurements = track.nMeasurements();
+    row.nStates = track.nTrackStates();
 
     // Get the majority truth particle to this track
     int truthQ = 1;
@@ -352,7 +498,7 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
     }
 
     // Get the trackStates on the trajectory
-    m_nParams = {0, 0, 0, 0};
+    row.nParams = {0, 0, 0, 0};
 
     std::vector<std::uint32_t> particleVertexPrimary;
     std::vector<std::uint32_t> particleVertexSecondary;
@@ -365,17 +511,17 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
 
       // get the geometry ID
       const Acts::GeometryIdentifier geoID = surface.geometryId();
-      m_volumeID.push_back(geoID.volume());
-      m_layerID.push_back(geoID.layer());
-      m_moduleID.push_back(geoID.sensitive());
+      row.volumeID.push_back(geoID.volume());
+      row.layerID.push_back(geoID.layer());
+      row.moduleID.push_back(geoID.sensitive());
 
-      m_stateType.push_back(Acts::toUnderlying(getStateType(state)));
+      row.stateType.push_back(Acts::toUnderlying(getStateType(state)));
 
       // get the path length
-      m_pathLength.push_back(state.pathLength());
+      row.pathLength.push_back(state.pathLength());
 
       // fill the chi2
-      m_chi2.push_back(state.chi2());
+      row.chi2.push_back(state.chi2());
 
       // the truth track parameter at this track state
       Acts::BoundVector truthParams;
@@ -387,25 +533,25 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
       particleSubParticle.clear();
 
       if (!state.hasUncalibratedSourceLink()) {
-        m_t_x.push_back(nan);
-        m_t_y.push_back(nan);
-        m_t_z.push_back(nan);
-        m_t_r.push_back(nan);
-        m_t_dx.push_back(nan);
-        m_t_dy.push_back(nan);
-        m_t_dz.push_back(nan);
-        m_t_eLOC0.push_back(nan);
-        m_t_eLOC1.push_back(nan);
-        m_t_ePHI.push_back(nan);
-        m_t_eTHETA.push_back(nan);
-        m_t_eQOP.push_back(nan);
-        m_t_eT.push_back(nan);
-
-        m_lx_hit.push_back(nan);
-        m_ly_hit.push_back(nan);
-        m_x_hit.push_back(nan);
-        m_y_hit.push_back(nan);
-        m_z_hit.push_back(nan);
+        row.t_x.push_back(nan);
+        row.t_y.push_back(nan);
+        row.t_z.push_back(nan);
+        row.t_r.push_back(nan);
+        row.t_dx.push_back(nan);
+        row.t_dy.push_back(nan);
+        row.t_dz.push_back(nan);
+        row.t_eLOC0.push_back(nan);
+        row.t_eLOC1.push_back(nan);
+        row.t_ePHI.push_back(nan);
+        row.t_eTHETA.push_back(nan);
+        row.t_eQOP.push_back(nan);
+        row.t_eT.push_back(nan);
+
+        row.lx_hit.push_back(nan);
+        row.ly_hit.push_back(nan);
+        row.x_hit.push_back(nan);
+        row.y_hit.push_back(nan);
+        row.z_hit.push_back(nan);
       } else {
         // get the truth hits corresponding to this trackState
         // Use average truth in the case of multiple contributing sim hits
@@ -441,14 +587,14 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
         }
 
         // fill the truth hit info
-        m_t_x.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos0]));
-        m_t_y.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos1]));
-        m_t_z.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos2]));
-        m_t_r.push_back(Acts::clampValue<float>(
+        row.t_x.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos0]));
+        row.t_y.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos1]));
+        row.t_z.push_back(Acts::clampValue<float>(truthPos4[Acts::ePos2]));
+        row.t_r.push_back(Acts::clampValue<float>(
             perp(truthPos4.template segment<3>(Acts::ePos0))));
-        m_t_dx.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom0]));
-        m_t_dy.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom1]));
-        m_t_dz.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom2]));
+        row.t_dx.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom0]));
+        row.t_dy.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom1]));
+        row.t_dz.push_back(Acts::clampValue<float>(truthUnitDir[Acts::eMom2]));
 
         // get the truth track parameter at this track State
         truthParams[Acts::eBoundLoc0] = truthLocal[Acts::ePos0];
@@ -458,17 +604,17 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
         truthParams[Acts::eBoundTime] = truthPos4[Acts::eTime];
 
         // fill the truth track parameter at this track State
-        m_t_eLOC0.push_back(
+        row.t_eLOC0.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundLoc0]));
-        m_t_eLOC1.push_back(
+        row.t_eLOC1.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundLoc1]));
-        m_t_ePHI.push_back(
+        row.t_ePHI.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundPhi]));
-        m_t_eTHETA.push_back(
+        row.t_eTHETA.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundTheta]));
-        m_t_eQOP.push_back(
+        row.t_eQOP.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundQOverP]));
-        m_t_eT.push_back(
+        row.t_eT.push_back(
             Acts::clampValue<float>(truthParams[Acts::eBoundTime]));
 
         // expand the local measurements into the full bound space
@@ -482,11 +628,11 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
             surface.localToGlobal(ctx.geoContext, local, truthUnitDir);
 
         // fill the measurement info
-        m_lx_hit.push_back(Acts::clampValue<float>(local[Acts::ePos0]));
-        m_ly_hit.push_back(Acts::clampValue<float>(local[Acts::ePos1]));
-        m_x_hit.push_back(Acts::clampValue<float>(global[Acts::ePos0]));
-        m_y_hit.push_back(Acts::clampValue<float>(global[Acts::ePos1]));
-        m_z_hit.push_back(Acts::clampValue<float>(global[Acts::ePos2]));
+        row.lx_hit.push_back(Acts::clampValue<float>(local[Acts::ePos0]));
+        row.ly_hit.push_back(Acts::clampValue<float>(local[Acts::ePos1]));
+        row.x_hit.push_back(Acts::clampValue<float>(global[Acts::ePos0]));
+        row.y_hit.push_back(Acts::clampValue<float>(global[Acts::ePos1]));
+        row.z_hit.push_back(Acts::clampValue<float>(global[Acts::ePos2]));
       }
 
       // lambda to get the fitted track parameters
@@ -513,72 +659,72 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
         // get the fitted track parameters
         const auto trackParamsOpt = getTrackParams(ipar);
         // fill the track parameters status
-        m_hasParams[ipar].push_back(trackParamsOpt.has_value());
+        row.hasParams[ipar].push_back(trackParamsOpt.has_value());
 
         if (!trackParamsOpt.has_value()) {
           if (ipar == ePredicted) {
             // push default values if no track parameters
-            m_res_x_hit.push_back(nan);
-            m_res_y_hit.push_back(nan);
-            m_err_x_hit.push_back(nan);
-            m_err_y_hit.push_back(nan);
-            m_pull_x_hit.push_back(nan);
-            m_pull_y_hit.push_back(nan);
-            m_dim_hit.push_back(0);
+            row.res_x_hit.push_back(nan);
+            row.res_y_hit.push_back(nan);
+            row.err_x_hit.push_back(nan);
+            row.err_y_hit.push_back(nan);
+            row.pull_x_hit.push_back(nan);
+            row.pull_y_hit.push_back(nan);
+            row.dim_hit.push_back(0);
           }
 
           // push default values if no track parameters
-          m_eLOC0[ipar].push_back(nan);
-          m_eLOC1[ipar].push_back(nan);
-          m_ePHI[ipar].push_back(nan);
-          m_eTHETA[ipar].push_back(nan);
-          m_eQOP[ipar].push_back(nan);
-          m_eT[ipar].push_back(nan);
-          m_res_eLOC0[ipar].push_back(nan);
-          m_res_eLOC1[ipar].push_back(nan);
-          m_res_ePHI[ipar].push_back(nan);
-          m_res_eTHETA[ipar].push_back(nan);
-          m_res_eQOP[ipar].push_back(nan);
-          m_res_eT[ipar].push_back(nan);
-          m_err_eLOC0[ipar].push_back(nan);
-          m_err_eLOC1[ipar].push_back(nan);
-          m_err_ePHI[ipar].push_back(nan);
-          m_err_eTHETA[ipar].push_back(nan);
-          m_err_eQOP[ipar].push_back(nan);
-          m_err_eT[ipar].push_back(nan);
-          m_pull_eLOC0[ipar].push_back(nan);
-          m_pull_eLOC1[ipar].push_back(nan);
-          m_pull_ePHI[ipar].push_back(nan);
-          m_pull_eTHETA[ipar].push_back(nan);
-          m_pull_eQOP[ipar].push_back(nan);
-          m_pull_eT[ipar].push_back(nan);
-          m_x[ipar].push_back(nan);
-          m_y[ipar].push_back(nan);
-          m_z[ipar].push_back(nan);
-          m_px[ipar].push_back(nan);
-          m_py[ipar].push_back(nan);
-          m_pz[ipar].push_back(nan);
-          m_pT[ipar].push_back(nan);
-          m_eta[ipar].push_back(nan);
+          row.eLOC0[ipar].push_back(nan);
+          row.eLOC1[ipar].push_back(nan);
+          row.ePHI[ipar].push_back(nan);
+          row.eTHETA[ipar].push_back(nan);
+          row.eQOP[ipar].push_back(nan);
+          row.eT[ipar].push_back(nan);
+          row.res_eLOC0[ipar].push_back(nan);
+          row.res_eLOC1[ipar].push_back(nan);
+          row.res_ePHI[ipar].push_back(nan);
+          row.res_eTHETA[ipar].push_back(nan);
+          row.res_eQOP[ipar].push_back(nan);
+          row.res_eT[ipar].push_back(nan);
+          row.err_eLOC0[ipar].push_back(nan);
+          row.err_eLOC1[ipar].push_back(nan);
+          row.err_ePHI[ipar].push_back(nan);
+          row.err_eTHETA[ipar].push_back(nan);
+          row.err_eQOP[ipar].push_back(nan);
+          row.err_eT[ipar].push_back(nan);
+          row.pull_eLOC0[ipar].push_back(nan);
+          row.pull_eLOC1[ipar].push_back(nan);
+          row.pull_ePHI[ipar].push_back(nan);
+          row.pull_eTHETA[ipar].push_back(nan);
+          row.pull_eQOP[ipar].push_back(nan);
+          row.pull_eT[ipar].push_back(nan);
+          row.x[ipar].push_back(nan);
+          row.y[ipar].push_back(nan);
+          row.z[ipar].push_back(nan);
+          row.px[ipar].push_back(nan);
+          row.py[ipar].push_back(nan);
+          row.pz[ipar].push_back(nan);
+          row.pT[ipar].push_back(nan);
+          row.eta[ipar].push_back(nan);
 
           continue;
         }
 
-        ++m_nParams[ipar];
+        ++row.nParams[ipar];
         const auto& [parameters, covariance] = *trackParamsOpt;
 
         // track parameters
-        m_eLOC0[ipar].push_back(
+        row.eLOC0[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundLoc0]));
-        m_eLOC1[ipar].push_back(
+        row.eLOC1[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundLoc1]));
-        m_ePHI[ipar].push_back(
+        row.ePHI[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundPhi]));
-        m_eTHETA[ipar].push_back(
+        row.eTHETA[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundTheta]));
-        m_eQOP[ipar].push_back(
+        row.eQOP[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundQOverP]));
-        m_eT[ipar].push_back(
+        row.eT[ipar].push_back(
             Acts::clampValue<float>(parameters[Acts::eBoundTime]));
 
         // track parameters error
@@ -587,40 +733,40 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
           const double variance = covariance(i, i);
           errors[i] = variance >= 0 ? std::sqrt(variance) : nan;
         }
-        m_err_eLOC0[ipar].push_back(
+        row.err_eLOC0[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundLoc0]));
-        m_err_eLOC1[ipar].push_back(
+        row.err_eLOC1[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundLoc1]));
-        m_err_ePHI[ipar].push_back(
+        row.err_ePHI[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundPhi]));
-        m_err_eTHETA[ipar].push_back(
+        row.err_eTHETA[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundTheta]));
-        m_err_eQOP[ipar].push_back(
+        row.err_eQOP[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundQOverP]));
-        m_err_eT[ipar].push_back(
+        row.err_eT[ipar].push_back(
             Acts::clampValue<float>(errors[Acts::eBoundTime]));
 
         // further track parameter info
         const Acts::FreeVector freeParams =
             Acts::transformBoundToFreeParameters(surface, gctx, parameters);
-        m_x[ipar].push_back(
+        row.x[ipar].push_back(
             Acts::clampValue<float>(freeParams[Acts::eFreePos0]));
-        m_y[ipar].push_back(
+        row.y[ipar].push_back(
             Acts::clampValue<float>(freeParams[Acts::eFreePos1]));
-        m_z[ipar].push_back(
+        row.z[ipar].push_back(
             Acts::clampValue<float>(freeParams[Acts::eFreePos2]));
         // single charge assumption
         const double p = std::abs(1 / freeParams[Acts::eFreeQOverP]);
-        m_px[ipar].push_back(
+        row.px[ipar].push_back(
             Acts::clampValue<float>(p * freeParams[Acts::eFreeDir0]));
-        m_py[ipar].push_back(
+        row.py[ipar].push_back(
             Acts::clampValue<float>(p * freeParams[Acts::eFreeDir1]));
-        m_pz[ipar].push_back(
+        row.pz[ipar].push_back(
             Acts::clampValue<float>(p * freeParams[Acts::eFreeDir2]));
-        m_pT[ipar].push_back(Acts::clampValue<float>(
+        row.pT[ipar].push_back(Acts::clampValue<float>(
             p * std::hypot(freeParams[Acts::eFreeDir0],
                            freeParams[Acts::eFreeDir1])));
-        m_eta[ipar].push_back(Acts::clampValue<float>(
+        row.eta[ipar].push_back(Acts::clampValue<float>(
             Acts::VectorHelpers::eta(freeParams.segment<3>(Acts::eFreeDir0))));
 
         if (!state.hasUncalibratedSourceLink()) {
@@ -632,17 +778,17 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
         residuals[Acts::eBoundPhi] = Acts::detail::difference_periodic(
             parameters[Acts::eBoundPhi], truthParams[Acts::eBoundPhi],
             2 * std::numbers::pi);
-        m_res_eLOC0[ipar].push_back(
+        row.res_eLOC0[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundLoc0]));
-        m_res_eLOC1[ipar].push_back(
+        row.res_eLOC1[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundLoc1]));
-        m_res_ePHI[ipar].push_back(
+        row.res_ePHI[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundPhi]));
-        m_res_eTHETA[ipar].push_back(
+        row.res_eTHETA[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundTheta]));
-        m_res_eQOP[ipar].push_back(
+        row.res_eQOP[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundQOverP]));
-        m_res_eT[ipar].push_back(
+        row.res_eT[ipar].push_back(
             Acts::clampValue<float>(residuals[Acts::eBoundTime]));
 
         // track parameters pull
@@ -652,17 +798,17 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
                          ? residuals[i] / errors[i]
                          : nan;
         }
-        m_pull_eLOC0[ipar].push_back(
+        row.pull_eLOC0[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundLoc0]));
-        m_pull_eLOC1[ipar].push_back(
+        row.pull_eLOC1[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundLoc1]));
-        m_pull_ePHI[ipar].push_back(
+        row.pull_ePHI[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundPhi]));
-        m_pull_eTHETA[ipar].push_back(
+        row.pull_eTHETA[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundTheta]));
-        m_pull_eQOP[ipar].push_back(
+        row.pull_eQOP[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundQOverP]));
-        m_pull_eT[ipar].push_back(
+        row.pull_eT[ipar].push_back(
             Acts::clampValue<float>(pulls[Acts::eBoundTime]));
 
         if (ipar == ePredicted) {
@@ -685,9 +831,9 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
                   ? resX / std::sqrt(resCov(Acts::eBoundLoc0, Acts::eBoundLoc0))
                   : nan;
 
-          m_res_x_hit.push_back(Acts::clampValue<float>(resX));
-          m_err_x_hit.push_back(Acts::clampValue<float>(errX));
-          m_pull_x_hit.push_back(Acts::clampValue<float>(pullX));
+          row.res_x_hit.push_back(Acts::clampValue<float>(resX));
+          row.err_x_hit.push_back(Acts::clampValue<float>(errX));
+          row.pull_x_hit.push_back(Acts::clampValue<float>(pullX));
 
           if (state.calibratedSize() >= 2) {
             const double resY = res[Acts::eBoundLoc1];
@@ -701,110 +847,29 @@ ProcessCode RootTrackStatesWriter::writeT(const AlgorithmContext& ctx,
                           std::sqrt(resCov(Acts::eBoundLoc1, Acts::eBoundLoc1))
                     : nan;
 
-            m_res_y_hit.push_back(Acts::clampValue<float>(resY));
-            m_err_y_hit.push_back(Acts::clampValue<float>(errY));
-            m_pull_y_hit.push_back(Acts::clampValue<float>(pullY));
+            row.res_y_hit.push_back(Acts::clampValue<float>(resY));
+            row.err_y_hit.push_back(Acts::clampValue<float>(errY));
+            row.pull_y_hit.push_back(Acts::clampValue<float>(pullY));
           } else {
-            m_res_y_hit.push_back(nan);
-            m_err_y_hit.push_back(nan);
-            m_pull_y_hit.push_back(nan);
+            row.res_y_hit.push_back(nan);
+            row.err_y_hit.push_back(nan);
+            row.pull_y_hit.push_back(nan);
           }
 
-          m_dim_hit.push_back(state.calibratedSize());
+          row.dim_hit.push_back(state.calibratedSize());
         }
       }
-      m_particleVertexPrimary.push_back(std::move(particleVertexPrimary));
-      m_particleVertexSecondary.push_back(std::move(particleVertexSecondary));
-      m_particleParticle.push_back(std::move(particleParticle));
-      m_particleGeneration.push_back(std::move(particleGeneration));
-      m_particleSubParticle.push_back(std::move(particleSubParticle));
-    }
-
-    // fill the variables for one track to tree
-    m_outputTree->Fill();
-
-    // now reset
-    m_volumeID.clear();
-    m_layerID.clear();
-    m_moduleID.clear();
-
-    m_stateType.clear();
-
-    m_chi2.clear();
-
-    m_pathLength.clear();
-
-    m_t_x.clear();
-    m_t_y.clear();
-    m_t_z.clear();
-    m_t_r.clear();
-    m_t_dx.clear();
-    m_t_dy.clear();
-    m_t_dz.clear();
-    m_t_eLOC0.clear();
-    m_t_eLOC1.clear();
-    m_t_ePHI.clear();
-    m_t_eTHETA.clear();
-    m_t_eQOP.clear();
-    m_t_eT.clear();
-    m_particleVertexPrimary.clear();
-    m_particleVertexSecondary.clear();
-    m_particleParticle.clear();
-    m_particleGeneration.clear();
-    m_particleSubParticle.clear();
-
-    m_dim_hit.clear();
-    m_lx_hit.clear();
-    m_ly_hit.clear();
-    m_x_hit.clear();
-    m_y_hit.clear();
-    m_z_hit.clear();
-    m_res_x_hit.clear();
-    m_res_y_hit.clear();
-    m_err_x_hit.clear();
-    m_err_y_hit.clear();
-    m_pull_x_hit.clear();
-    m_pull_y_hit.clear();
-
-    for (unsigned int ipar = 0; ipar < eSize; ++ipar) {
-      m_hasParams[ipar].clear();
-      m_eLOC0[ipar].clear();
-      m_eLOC1[ipar].clear();
-      m_ePHI[ipar].clear();
-      m_eTHETA[ipar].clear();
-      m_eQOP[ipar].clear();
-      m_eT[ipar].clear();
-      m_res_eLOC0[ipar].clear();
-      m_res_eLOC1[ipar].clear();
-      m_res_ePHI[ipar].clear();
-      m_res_eTHETA[ipar].clear();
-      m_res_eQOP[ipar].clear();
-      m_res_eT[ipar].clear();
-      m_err_eLOC0[ipar].clear();
-      m_err_eLOC1[ipar].clear();
-      m_err_ePHI[ipar].clear();
-      m_err_eTHETA[ipar].clear();
-      m_err_eQOP[ipar].clear();
-      m_err_eT[ipar].clear();
-      m_pull_eLOC0[ipar].clear();
-      m_pull_eLOC1[ipar].clear();
-      m_pull_ePHI[ipar].clear();
-      m_pull_eTHETA[ipar].clear();
-      m_pull_eQOP[ipar].clear();
-      m_pull_eT[ipar].clear();
-      m_x[ipar].clear();
-      m_y[ipar].clear();
-      m_z[ipar].clear();
-      m_px[ipar].clear();
-      m_py[ipar].clear();
-      m_pz[ipar].clear();
-      m_eta[ipar].clear();
-      m_pT[ipar].clear();
+      row.particleVertexPrimary.push_back(std::move(particleVertexPrimary));
+      row.particleVertexSecondary.push_back(std::move(particleVertexSecondary));
+      row.particleParticle.push_back(std::move(particleParticle));
+      row.particleGeneration.push_back(std::move(particleGeneration));
+      row.particleSubParticle.push_back(std::move(particleSubParticle));
     }
-
-    m_chi2.clear();
   }
 
+  // Only handing the rows over to the output is serialised
+  m_output->fill(std::move(rows));
+
   return ProcessCode::SUCCESS;
 }
 
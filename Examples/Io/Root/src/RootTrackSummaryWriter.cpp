@@ -26,14 +26,13 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <ios>
 #include <limits>
 #include <numbers>
 #include <optional>
 #include <ostream>
-#include <stdexcept>
+#include <utility>
+#include <vector>
 
-#include <TFile.h>
 #include <TTree.h>
 
 using Acts::VectorHelpers::eta;
@@ -43,18 +42,340 @@ using Acts::VectorHelpers::theta;
 
 namespace ActsExamples {
 
+/// One row of the track summary tree, holding all tracks of one event
+struct RootTrackSummaryWriter::Columns {
+  /// The event number
+  std::uint32_t eventNr{0};
+  /// The track number in event
+  std::vector<std::uint32_t> trackNr;
+
+  /// The number of states
+  std::vector<unsigned int> nStates;
+  /// The number of measurements
+  std::vector<unsigned int> nMeasurements;
+  /// The number of outliers
+  std::vector<unsigned int> nOutliers;
+  /// The number of holes
+  std::vector<unsigned int> nHoles;
+  /// The number of shared hits
+  std::vector<unsigned int> nSharedHits;
+  /// The total chi2
+  std::vector<float> chi2Sum;
+  /// The number of ndf of the measurements+outliers
+  std::vector<unsigned int> NDF;
+  /// The chi2 on all measurement states
+  std::vector<std::vector<double>> measurementChi2;
+  /// The chi2 on all outlier states
+  std::vector<std::vector<double>> outlierChi2;
+  /// The volume id of the measurements
+  std::vector<std::vector<std::uint32_t>> measurementVolume;
+  /// The layer id of the measurements
+  std::vector<std::vector<std::uint32_t>> measurementLayer;
+  /// The volume id of the outliers
+  std::vector<std::vector<std::uint32_t>> outlierVolume;
+  /// The layer id of the outliers
+  std::vector<std::vector<std::uint32_t>> outlierLayer;
+
+  // The majority truth particle info
+  /// The number of hits from majority particle
+  std::vector<unsigned int> nMajorityHits;
+  /// Decoded barcode components for convenience columns
+  std::vector<std::uint32_t> majorityParticleVertexPrimary;
+  std::vector<std::uint32_t> majorityParticleVertexSecondary;
+  std::vector<std::uint32_t> majorityParticleParticle;
+  std::vector<std::uint32_t> majorityParticleGeneration;
+  std::vector<std::uint32_t> majorityParticleSubParticle;
+  /// The classification of the reconstructed track
+  std::vector<int> trackClassification;
+  /// Charge of majority particle
+  std::vector<int> t_charge;
+  /// Time of majority particle
+  std::vector<float> t_time;
+  /// Vertex x positions of majority particle
+  std::vector<float> t_vx;
+  /// Vertex y positions of majority particle
+  std::vector<float> t_vy;
+  /// Vertex z positions of majority particle
+  std::vector<float> t_vz;
+  /// Initial momenta px of majority particle
+  std::vector<float> t_px;
+  /// Initial momenta py of majority particle
+  std::vector<float> t_py;
+  /// Initial momenta pz of majority particle
+  std::vector<float> t_pz;
+  /// Initial momenta theta of majority particle
+  std::vector<float> t_theta;
+  /// Initial momenta phi of majority particle
+  std::vector<float> t_phi;
+  /// Initial abs momenta of majority particle
+  std::vector<float> t_p;
+  /// Initial momenta pT of majority particle
+  std::vector<float> t_pT;
+  /// Initial momenta eta of majority particle
+  std::vector<float> t_eta;
+  /// The extrapolated truth transverse impact parameter
+  std::vector<float> t_d0;
+  /// The extrapolated truth longitudinal impact parameter
+  std::vector<float> t_z0;
+  /// Production radius of majority particle
+  std::vector<float> t_prodR;
+
+  /// If the track has fitted parameter
+  std::vector<bool> hasFittedParams;
+  // The fitted parameters
+  /// Fitted parameters eBoundLoc0 of track
+  std::vector<float> eLOC0_fit;
+  /// Fitted parameters eBoundLoc1 of track
+  std::vector<float> eLOC1_fit;
+  /// Fitted parameters ePHI of track
+  std::vector<float> ePHI_fit;
+  /// Fitted parameters eTHETA of track
+  std::vector<float> eTHETA_fit;
+  /// Fitted parameters eQOP of track
+  std::vector<float> eQOP_fit;
+  /// Fitted parameters eT of track
+  std::vector<float> eT_fit;
+  // The error of fitted parameters
+  /// Fitted parameters eLOC err of track
+  std::vector<float> err_eLOC0_fit;
+  /// Fitted parameters eBoundLoc1 err of track
+  std::vector<float> err_eLOC1_fit;
+  /// Fitted parameters ePHI err of track
+  std::vector<float> err_ePHI_fit;
+  /// Fitted parameters eTHETA err of track
+  std::vector<float> err_eTHETA_fit;
+  /// Fitted parameters eQOP err of track
+  std::vector<float> err_eQOP_fit;
+  /// Fitted parameters eT err of track
+  std::vector<float> err_eT_fit;
+  // The residual of fitted parameters
+  /// Fitted parameters eLOC res of track
+  std::vector<float> res_eLOC0_fit;
+  /// Fitted parameters eBoundLoc1 res of track
+  std::vector<float> res_eLOC1_fit;
+  /// Fitted parameters ePHI res of track
+  std::vector<float> res_ePHI_fit;
+  /// Fitted parameters eTHETA res of track
+  std::vector<float> res_eTHETA_fit;
+  /// Fitted parameters eQOP res of track
+  std::vector<float> res_eQOP_fit;
+  /// Fitted parameters eT res of track
+  std::vector<float> res_eT_fit;
+  // The pull of fitted parameters
+  /// Fitted parameters eLOC pull of track
+  std::vector<float> pull_eLOC0_fit;
+  /// Fitted parameters eBoundLoc1 pull of track
+  std::vector<float> pull_eLOC1_fit;
+  /// Fitted parameters ePHI pull of track
+  std::vector<float> pull_ePHI_fit;
+  /// Fitted parameters eTHETA pull of track
+  std::vector<float> pull_eTHETA_fit;
+  /// Fitted parameters eQOP pull of track
+  std::vector<float> pull_eQOP_fit;
+  /// Fitted parameters eT pull of track
+  std::vector<float> pull_eT_fit;
+
+  // entries of the full covariance matrix. One block for every row of the
+  // matrix
+  std::vector<float> cov_eLOC0_eLOC0;
+  std::vector<float> cov_eLOC0_eLOC1;
+  std::vector<float> cov_eLOC0_ePHI;
+  std::vector<float> cov_eLOC0_eTHETA;
+  std::vector<float> cov_eLOC0_eQOP;
+  std::vector<float> cov_eLOC0_eT;
+
+  std::vector<float> cov_eLOC1_eLOC0;
+  std::vector<float> cov_eLOC1_eLOC1;
+  std::vector<float> cov_eLOC1_ePHI;
+  std::vector<float> cov_eLOC1_eTHETA;
+  std::vector<float> cov_eLOC1_eQOP;
+  std::vector<float> cov_eLOC1_eT;
+
+  std::vector<float> cov_ePHI_eLOC0;
+  std::vector<float> cov_ePHI_eLOC1;
+  std::vector<float> cov_ePHI_ePHI;
+  std::vector<float> cov_ePHI_eTHETA;
+  std::vector<float> cov_ePHI_eQOP;
+  std::vector<float> cov_ePHI_eT;
+
+  std::vector<float> cov_eTHETA_eLOC0;
+  std::vector<float> cov_eTHETA_eLOC1;
+  std::vector<float> cov_eTHETA_ePHI;
+  std::vector<float> cov_eTHETA_eTHETA;
+  std::vector<float> cov_eTHETA_eQOP;
+  std::vector<float> cov_eTHETA_eT;
+
+  std::vector<float> cov_eQOP_eLOC0;
+  std::vector<float> cov_eQOP_eLOC1;
+  std::vector<float> cov_eQOP_ePHI;
+  std::vector<float> cov_eQOP_eTHETA;
+  std::vector<float> cov_eQOP_eQOP;
+  std::vector<float> cov_eQOP_eT;
+
+  std::vector<float> cov_eT_eLOC0;
+  std::vector<float> cov_eT_eLOC1;
+  std::vector<float> cov_eT_ePHI;
+  std::vector<float> cov_eT_eTHETA;
+  std::vector<float> cov_eT_eQOP;
+  std::vector<float> cov_eT_eT;
+
+  std::vector<float> gsf_max_material_fwd;
+  std::vector<float> gsf_sum_material_fwd;
+
+  /// The number of updates (gx2f)
+  std::vector<int> nUpdatesGx2f;
+
+  /// The jet information
+  std::vector<int> nJets;
+  std::vector<float> jet_pt;
+  std::vector<float> jet_eta;
+  std::vector<float> jet_phi;
+  std::vector<int> jet_label;
+  std::vector<std::size_t> ntracks_per_jets;
+
+  void branch(TTree& tree, const Config& cfg) {
+    // I/O parameters
+    tree.Branch("event_nr", &eventNr);
+    tree.Branch("track_nr", &trackNr);
+
+    tree.Branch("nStates", &nStates);
+    tree.Branch("nMeasurements", &nMeasurements);
+    tree.Branch("nOutliers", &nOutliers);
+    tree.Branch("nHoles", &nHoles);
+    tree.Branch("nSharedHits", &nSharedHits);
+    tree.Branch("chi2Sum", &chi2Sum);
+    tree.Branch("NDF", &NDF);
+    tree.Branch("measurementChi2", &measurementChi2);
+    tree.Branch("outlierChi2", &outlierChi2);
+    tree.Branch("measurementVolume", &measurementVolume);
+    tree.Branch("measurementLayer", &measurementLayer);
+    tree.Branch("outlierVolume", &outlierVolume);
+    tree.Branch("outlierLayer", &outlierLayer);
+
+    tree.Branch("nMajorityHits", &nMajorityHits);
+    tree.Branch("majorityParticleId_vertex_primary",
+                &majorityParticleVertexPrimary);
+    tree.Branch("majorityParticleId_vertex_secondary",
+                &majorityParticleVertexSecondary);
+    tree.Branch("majorityParticleId_particle", &majorityParticleParticle);
+    tree.Branch("majorityParticleId_generation", &majorityParticleGeneration);
+    tree.Branch("majorityParticleId_sub_particle",
+                &majorityParticleSubParticle);
+    tree.Branch("trackClassification", &trackClassification);
+    tree.Branch("t_charge", &t_charge);
+    tree.Branch("t_time", &t_time);
+    tree.Branch("t_vx", &t_vx);
+    tree.Branch("t_vy", &t_vy);
+    tree.Branch("t_vz", &t_vz);
+    tree.Branch("t_px", &t_px);
+    tree.Branch("t_py", &t_py);
+    tree.Branch("t_pz", &t_pz);
+    tree.Branch("t_theta", &t_theta);
+    tree.Branch("t_phi", &t_phi);
+    tree.Branch("t_eta", &t_eta);
+    tree.Branch("t_p", &t_p);
+    tree.Branch("t_pT", &t_pT);
+    tree.Branch("t_d0", &t_d0);
+    tree.Branch("t_z0", &t_z0);
+    tree.Branch("t_prodR", &t_prodR);
+
+    tree.Branch("hasFittedParams", &hasFittedParams);
+    tree.Branch("eLOC0_fit", &eLOC0_fit);
+    tree.Branch("eLOC1_fit", &eLOC1_fit);
+    tree.Branch("ePHI_fit", &ePHI_fit);
+    tree.Branch("eTHETA_fit", &eTHETA_fit);
+    tree.Branch("eQOP_fit", &eQOP_fit);
+    tree.Branch("eT_fit", &eT_fit);
+    tree.Branch("err_eLOC0_fit", &err_eLOC0_fit);
+    tree.Branch("err_eLOC1_fit", &err_eLOC1_fit);
+    tree.Branch("err_ePHI_fit", &err_ePHI_fit);
+    tree.Branch("err_eTHETA_fit", &err_eTHETA_fit);
+    tree.Branch("err_eQOP_fit", &err_eQOP_fit);
+    tree.Branch("err_eT_fit", &err_eT_fit);
+    tree.Branch("res_eLOC0_fit", &res_eLOC0_fit);
+    tree.Branch("res_eLOC1_fit", &res_eLOC1_fit);
+    tree.Branch("res_ePHI_fit", &res_ePHI_fit);
+    tree.Branch("res_eTHETA_fit", &res_eTHETA_fit);
+    tree.Branch("res_eQOP_fit", &res_eQOP_fit);
+    tree.Branch("res_eT_fit", &res_eT_fit);
+    tree.Branch("pull_eLOC0_fit", &pull_eLOC0_fit);
+    tree.Branch("pull_eLOC1_fit", &pull_eLOC1_fit);
+    tree.Branch("pull_ePHI_fit", &pull_ePHI_fit);
+    tree.Branch("pull_eTHETA_fit", &pull_eTHETA_fit);
+    tree.Branch("pull_eQOP_fit", &pull_eQOP_fit);
+    tree.Branch("pull_eT_fit", &pull_eT_fit);
+
+    if (cfg.writeGsfSpecific) {
+      tree.Branch("max_material_fwd", &gsf_max_material_fwd);
+      tree.Branch("sum_material_fwd", &gsf_sum_material_fwd);
+    }
+
+    if (cfg.writeCovMat) {
+      // create one branch for every entry of covariance matrix
+      // one block for every row of the matrix, every entry gets own branch
+      tree.Branch("cov_eLOC0_eLOC0", &cov_eLOC0_eLOC0);
+      tree.Branch("cov_eLOC0_eLOC1", &cov_eLOC0_eLOC1);
+      tree.Branch("cov_eLOC0_ePHI", &cov_eLOC0_ePHI);
+      tree.Branch("cov_eLOC0_eTHETA", &cov_eLOC0_eTHETA);
+      tree.Branch("cov_eLOC0_eQOP", &cov_eLOC0_eQOP);
+      tree.Branch("cov_eLOC0_eT", &cov_eLOC0_eT);
+
+      tree.Branch("cov_eLOC1_eLOC0", &cov_eLOC1_eLOC0);
+      tree.Branch("cov_eLOC1_eLOC1", &cov_eLOC1_eLOC1);
+      tree.Branch("cov_eLOC1_ePHI", &cov_eLOC1_ePHI);
+      tree.Branch("cov_eLOC1_eTHETA", &cov_eLOC1_eTHETA);
+      tree.Branch("cov_eLOC1_eQOP", &cov_eLOC1_eQOP);
+      tree.Branch("cov_eLOC1_eT", &cov_eLOC1_eT);
+
+      tree.Branch("cov_ePHI_eLOC0", &cov_ePHI_eLOC0);
+      tree.Branch("cov_ePHI_eLOC1", &cov_ePHI_eLOC1);
+      tree.Branch("cov_ePHI_ePHI", &cov_ePHI_ePHI);
+      tree.Branch("cov_ePHI_eTHETA", &cov_ePHI_eTHETA);
+      tree.Branch("cov_ePHI_eQOP", &cov_ePHI_eQOP);
+      tree.Branch("cov_ePHI_eT", &cov_ePHI_eT);
+
+      tree.Branch("cov_eTHETA_eLOC0", &cov_eTHETA_eLOC0);
+      tree.Branch("cov_eTHETA_eLOC1", &cov_eTHETA_eLOC1);
+      tree.Branch("cov_eTHETA_ePHI", &cov_eTHETA_ePHI);
+      tree.Branch("cov_eTHETA_eTHETA", &cov_eTHETA_eTHETA);
+      tree.Branch("cov_eTHETA_eQOP", &cov_eTHETA_eQOP);
+      tree.Branch("cov_eTHETA_eT", &cov_eTHETA_eT);
+
+      tree.Branch("cov_eQOP_eLOC0", &cov_eQOP_eLOC0);
+      tree.Branch("cov_eQOP_eLOC1", &cov_eQOP_eLOC1);
+      tree.Branch("cov_eQOP_ePHI", &cov_eQOP_ePHI);
+      tree.Branch("cov_eQOP_eTHETA", &cov_eQOP_eTHETA);
+      tree.Branch("cov_eQOP_eQOP", &cov_eQOP_eQOP);
+      tree.Branch("cov_eQOP_eT", &cov_eQOP_eT);
+
+      tree.Branch("cov_eT_eLOC0", &cov_eT_eLOC0);
+      tree.Branch("cov_eT_eLOC1", &cov_eT_eLOC1);
+      tree.Branch("cov_eT_ePHI", &cov_eT_ePHI);
+      tree.Branch("cov_eT_eTHETA", &cov_eT_eTHETA);
+      tree.Branch("cov_eT_eQOP", &cov_eT_eQOP);
+      tree.Branch("cov_eT_eT", &cov_eT_eT);
+    }
+
+    if (cfg.writeGx2fSpecific) {
+      tree.Branch("nUpdatesGx2f", &nUpdatesGx2f);
+    }
+
+    if (cfg.writeJets) {
+      tree.Branch("nJets", &nJets);
+      tree.Branch("jet_pt", &jet_pt);
+      tree.Branch("jet_eta", &jet_eta);
+      tree.Branch("jet_phi", &jet_phi);
+      tree.Branch("jet_label", &jet_label);
+      tree.Branch("ntracks_per_jets", &ntracks_per_jets);
+    }
+  }
+};
+
 RootTrackSummaryWriter::RootTrackSummaryWriter(
     const RootTrackSummaryWriter::Config& config, Acts::Logging::Level level)
     : WriterT(config.inputTracks, "RootTrackSummaryWriter", level),
       m_cfg(config) {
   // tracks collection name is already checked by base ctor
-  if (m_cfg.filePath.empty()) {
-    throw std::invalid_argument("Missing output filename");
-  }
-  if (m_cfg.treeName.empty()) {
-    throw std::invalid_argument("Missing tree name");
-  }
-
   m_inputParticles.maybeInitialize(m_cfg.inputParticles);
   m_inputTrackParticleMatching.maybeInitialize(
       m_cfg.inputTrackParticleMatching);
@@ -62,164 +383,21 @@ RootTrackSummaryWriter::RootTrackSummaryWriter(
     m_inputJets.maybeInitialize(m_cfg.inputJets);
   }
 
-  // Setup ROOT I/O
-  auto path = m_cfg.filePath;
-  m_outputFile = TFile::Open(path.c_str(), m_cfg.fileMode.c_str());
-  if (m_outputFile == nullptr) {
-    throw std::ios_base::failure("Could not open '" + path + "'");
-  }
-  m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
-  }
-
-  // I/O parameters
-  m_outputTree->Branch("event_nr", &m_eventNr);
-  m_outputTree->Branch("track_nr", &m_trackNr);
-
-  m_outputTree->Branch("nStates", &m_nStates);
-  m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-  m_outputTree->Branch("nOutliers", &m_nOutliers);
-  m_outputTree->Branch("nHoles", &m_nHoles);
-  m_outputTree->Branch("nSharedHits", &m_nSharedHits);
-  m_outputTree->Branch("chi2Sum", &m_chi2Sum);
-  m_outputTree->Branch("NDF", &m_NDF);
-  m_outputTree->Branch("measurementChi2", &m_measurementChi2);
-  m_outputTree->Branch("outlierChi2", &m_outlierChi2);
-  m_outputTree->Branch("measurementVolume", &m_measurementVolume);
-  m_outputTree->Branch("measurementLayer", &m_measurementLayer);
-  m_outputTree->Branch("outlierVolume", &m_outlierVolume);
-  m_outputTree->Branch("outlierLayer", &m_outlierLayer);
-
-  m_outputTree->Branch("nMajorityHits", &m_nMajorityHits);
-  m_outputTree->Branch("majorityParticleId_vertex_primary",
-                       &m_majorityParticleVertexPrimary);
-  m_outputTree->Branch("majorityParticleId_vertex_secondary",
-                       &m_majorityParticleVertexSecondary);
-  m_outputTree->Branch("majorityParticleId_particle",
-                       &m_majorityParticleParticle);
-  m_outputTree->Branch("majorityParticleId_generation",
-                       &m_majorityParticleGeneration);
-  m_outputTree->Branch("majorityParticleId_sub_particle",
-                       &m_majorityParticleSubParticle);
-  m_outputTree->Branch("trackClassification", &m_trackClassification);
-  m_outputTree->Branch("t_charge", &m_t_charge);
-  m_outputTree->Branch("t_time", &m_t_time);
-  m_outputTree->Branch("t_vx", &m_t_vx);
-  m_outputTree->Branch("t_vy", &m_t_vy);
-  m_outputTree->Branch("t_vz", &m_t_vz);
-  m_outputTree->Branch("t_px", &m_t_px);
-  m_outputTree->Branch("t_py", &m_t_py);
-  m_outputTree->Branch("t_pz", &m_t_pz);
-  m_outputTree->Branch("t_theta", &m_t_theta);
-  m_outputTree->Branch("t_phi", &m_t_phi);
-  m_outputTree->Branch("t_eta", &m_t_eta);
-  m_outputTree->Branch("t_p", &m_t_p);
-  m_outputTree->Branch("t_pT", &m_t_pT);
-  m_outputTree->Branch("t_d0", &m_t_d0);
-  m_outputTree->Branch("t_z0", &m_t_z0);
-  m_outputTree->Branch("t_prodR", &m_t_prodR);
-
-  m_outputTree->Branch("hasFittedParams", &m_hasFittedParams);
-  m_outputTree->Branch("eLOC0_fit", &m_eLOC0_fit);
-  m_outputTree->Branch("eLOC1_fit", &m_eLOC1_fit);
-  m_outputTree->Branch("ePHI_fit", &m_ePHI_fit);
-  m_outputTree->Branch("eTHETA_fit", &m_eTHETA_fit);
-  m_outputTree->Branch("eQOP_fit", &m_eQOP_fit);
-  m_outputTree->Branch("eT_fit", &m_eT_fit);
-  m_outputTree->Branch("err_eLOC0_fit", &m_err_eLOC0_fit);
-  m_outputTree->Branch("err_eLOC1_fit", &m_err_eLOC1_fit);
-  m_outputTree->Branch("err_ePHI_fit", &m_err_ePHI_fit);
-  m_outputTree->Branch("err_eTHETA_fit", &m_err_eTHETA_fit);
-  m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
-  m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
-  m_outputTree->Branch("res_eLOC0_fit", &m_res_eLOC0_fit);
-  m_outputTree->Branch("res_eLOC1_fit", &m_res_eLOC1_fit);
-  m_outputTree->Branch("res_ePHI_fit", &m_res_ePHI_fit);
-  m_outputTree->Branch("res_eTHETA_fit", &m_res_eTHETA_fit);
-  m_outputTree->Branch("res_eQOP_fit", &m_res_eQOP_fit);
-  m_outputTree->Branch("res_eT_fit", &m_res_eT_fit);
-  m_outputTree->Branch("pull_eLOC0_fit", &m_pull_eLOC0_fit);
-  m_outputTree->Branch("pull_eLOC1_fit", &m_pull_eLOC1_fit);
-  m_outputTree->Branch("pull_ePHI_fit", &m_pull_ePHI_fit);
-  m_outputTree->Branch("pull_eTHETA_fit", &m_pull_eTHETA_fit);
-  m_outputTree->Branch("pull_eQOP_fit", &m_pull_eQOP_fit);
-  m_outputTree->Branch("pull_eT_fit", &m_pull_eT_fit);
-
-  if (m_cfg.writeGsfSpecific) {
-    m_outputTree->Branch("max_material_fwd", &m_gsf_max_material_fwd);
-    m_outputTree->Branch("sum_material_fwd", &m_gsf_sum_material_fwd);
-  }
-
-  if (m_cfg.writeCovMat) {
-    // create one branch for every entry of covariance matrix
-    // one block for every row of the matrix, every entry gets own branch
-    m_outputTree->Branch("cov_eLOC0_eLOC0", &m_cov_eLOC0_eLOC0);
-    m_outputTree->Branch("cov_eLOC0_eLOC1", &m_cov_eLOC0_eLOC1);
-    m_outputTree->Branch("cov_eLOC0_ePHI", &m_cov_eLOC0_ePHI);
-    m_outputTree->Branch("cov_eLOC0_eTHETA", &m_cov_eLOC0_eTHETA);
-    m_outputTree->Branch("cov_eLOC0_eQOP", &m_cov_eLOC0_eQOP);
-    m_outputTree->Branch("cov_eLOC0_eT", &m_cov_eLOC0_eT);
-
-    m_outputTree->Branch("cov_eLOC1_eLOC0", &m_cov_eLOC1_eLOC0);
-    m_outputTree->Branch("cov_eLOC1_eLOC1", &m_cov_eLOC1_eLOC1);
-    m_outputTree->Branch("cov_eLOC1_ePHI", &m_cov_eLOC1_ePHI);
-    m_outputTree->Branch("cov_eLOC1_eTHETA", &m_cov_eLOC1_eTHETA);
-    m_outputTree->Branch("cov_eLOC1_eQOP", &m_cov_eLOC1_eQOP);
-    m_outputTree->Branch("cov_eLOC1_eT", &m_cov_eLOC1_eT);
-
-    m_outputTree->Branch("cov_ePHI_eLOC0", &m_cov_ePHI_eLOC0);
-    m_outputTree->Branch("cov_ePHI_eLOC1", &m_cov_ePHI_eLOC1);
-    m_outputTree->Branch("cov_ePHI_ePHI", &m_cov_ePHI_ePHI);
-    m_outputTree->Branch("cov_ePHI_eTHETA", &m_cov_ePHI_eTHETA);
-    m_outputTree->Branch("cov_ePHI_eQOP", &m_cov_ePHI_eQOP);
-    m_outputTree->Branch("cov_ePHI_eT", &m_cov_ePHI_eT);
-
-    m_outputTree->Branch("cov_eTHETA_eLOC0", &m_cov_eTHETA_eLOC0);
-    m_outputTree->Branch("cov_eTHETA_eLOC1", &m_cov_eTHETA_eLOC1);
-    m_outputTree->Branch("cov_eTHETA_ePHI", &m_cov_eTHETA_ePHI);
-    m_outputTree->Branch("cov_eTHETA_eTHETA", &m_cov_eTHETA_eTHETA);
-    m_outputTree->Branch("cov_eTHETA_eQOP", &m_cov_eTHETA_eQOP);
-    m_outputTree->Branch("cov_eTHETA_eT", &m_cov_eTHETA_eT);
-
-    m_outputTree->Branch("cov_eQOP_eLOC0", &m_cov_eQOP_eLOC0);
-    m_outputTree->Branch("cov_eQOP_eLOC1", &m_cov_eQOP_eLOC1);
-    m_outputTree->Branch("cov_eQOP_ePHI", &m_cov_eQOP_ePHI);
-    m_outputTree->Branch("cov_eQOP_eTHETA", &m_cov_eQOP_eTHETA);
-    m_outputTree->Branch("cov_eQOP_eQOP", &m_cov_eQOP_eQOP);
-    m_outputTree->Branch("cov_eQOP_eT", &m_cov_eQOP_eT);
-
-    m_outputTree->Branch("cov_eT_eLOC0", &m_cov_eT_eLOC0);
-    m_outputTree->Branch("cov_eT_eLOC1", &m_cov_eT_eLOC1);
-    m_outputTree->Branch("cov_eT_ePHI", &m_cov_eT_ePHI);
-    m_outputTree->Branch("cov_eT_eTHETA", &m_cov_eT_eTHETA);
-    m_outputTree->Branch("cov_eT_eQOP", &m_cov_eT_eQOP);
-    m_outputTree->Branch("cov_eT_eT", &m_cov_eT_eT);
-  }
-
-  if (m_cfg.writeGx2fSpecific) {
-    m_outputTree->Branch("nUpdatesGx2f", &m_nUpdatesGx2f);
-  }
-
-  if (m_cfg.writeJets) {
-    m_outputTree->Branch("nJets", &m_nJets);
-    m_outputTree->Branch("jet_pt", &m_jet_pt);
-    m_outputTree->Branch("jet_eta", &m_jet_eta);
-    m_outputTree->Branch("jet_phi", &m_jet_phi);
-    m_outputTree->Branch("jet_label", &m_jet_label);
-    m_outputTree->Branch("ntracks_per_jets", &m_ntracks_per_jets);
-  }
+  RootTreeOutputConfig outputCfg;
+  outputCfg.filePath = m_cfg.filePath;
+  outputCfg.fileMode = m_cfg.fileMode;
+  outputCfg.treeName = m_cfg.treeName;
+  outputCfg.mode = m_cfg.outputMode;
+  m_output = std::make_unique<RootTreeOutput<Columns>>(
+      outputCfg, [this](TTree& tree, Columns& columns) {
+        columns.branch(tree, m_cfg);
+      });
 }
 
-RootTrackSummaryWriter::~RootTrackSummaryWriter() {
-  m_outputFile->Close();
-}
+RootTrackSummaryWriter::~RootTrackSummaryWriter() = default;
 
 ProcessCode RootTrackSummaryWriter::finalize() {
-  m_outputFile->cd();
-  m_outputTree->Write();
-  m_outputFile->Close();
+  m_output->close();
 
   if (m_cfg.writeCovMat) {
     ACTS_INFO("Wrote full covariance matrix to tree");
@@ -246,11 +424,12 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
   // For each particle within a track, how many hits did it contribute
   std::vector<ParticleHitCount> particleHitCounts;
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // The event is written as a single row
+  std::vector<Columns> rows(1);
+  Columns& row = rows.front();
 
   // Get the event number
-  m_eventNr = ctx.eventNumber;
+  row.eventNr = ctx.eventNumber;
 
   std::vector<ActsExamples::TruthJet> jets;
   std::unordered_map<std::size_t, std::vector<std::int32_t>>
@@ -263,31 +442,31 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
 
     // Loop over jets and fill jet kinematic variables
     for (std::size_t ijet = 0; ijet < jets.size(); ++ijet) {
-      m_nJets.push_back(jets.size());
+      row.nJets.push_back(jets.size());
       Acts::Vector4 jet_4mom = jets[ijet].fourMomentum();
       Acts::Vector3 jet_3mom{jet_4mom[0], jet_4mom[1], jet_4mom[2]};
 
       float jet_theta = theta(jet_3mom);
 
-      m_jet_pt.push_back(perp(jet_4mom));
-      m_jet_eta.push_back(std::atanh(std::cos(jet_theta)));
-      m_jet_phi.push_back(phi(jet_4mom));
-      m_jet_label.push_back(static_cast<int>(jets[ijet].jetLabel()));
-      m_ntracks_per_jets.push_back(jets[ijet].associatedTracks().size());
+      row.jet_pt.push_back(perp(jet_4mom));
+      row.jet_eta.push_back(std::atanh(std::cos(jet_theta)));
+      row.jet_phi.push_back(phi(jet_4mom));
+      row.jet_label.push_back(static_cast<int>(jets[ijet].jetLabel()));
+      row.ntracks_per_jets.push_back(jets[ijet].associatedTracks().size());
     }
   }
 
   for (const auto& track : tracks) {
-    m_trackNr.push_back(track.index());
+    row.trackNr.push_back(track.index());
 
     // Collect the trajectory summary info
-    m_nStates.push_back(track.nTrackStates());
-    m_nMeasurements.push_back(track.nMeasurements());
-    m_nOutliers.push_back(track.nOutliers());
-    m_nHoles.push_back(track.nHoles());
-    m_nSharedHits.push_back(track.nSharedHits());
-    m_chi2Sum.push_back(track.chi2());
-    m_NDF.push_back(track.nDoF());
+    row.nStates.push_back(track.nTrackStates());
+    row.nMeasurements.push_back(track.nMeasurements());
+    row.nOutliers.push_back(track.nOutliers());
+    row.nHoles.push_back(track.nHoles());
+    row.nSharedHits.push_back(track.nSharedHits());
+    row.chi2Sum.push_back(track.chi2());
+    row.NDF.push_back(track.nDoF());
 
     {
       std::vector<double> measurementChi2;
@@ -310,12 +489,12 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
           measurementLayer.push_back(layer);
         }
       }
-      m_measurementChi2.push_back(std::move(measurementChi2));
-      m_measurementVolume.push_back(std::move(measurementVolume));
-      m_measurementLayer.push_back(std::move(measurementLayer));
-      m_outlierChi2.push_back(std::move(outlierChi2));
-      m_outlierVolume.push_back(std::move(outlierVolume));
-      m_outlierLayer.push_back(std::move(outlierLayer));
+      row.measurementChi2.push_back(std::move(measurementChi2));
+      row.measurementVolume.push_back(std::move(measurementVolume));
+      row.measurementLayer.push_back(std::move(measurementLayer));
+      row.outlierChi2.push_back(std::move(outlierChi2));
+      row.outlierVolume.push_back(std::move(outlierVolume));
+      row.outlierLayer.push_back(std::move(outlierLayer));
     }
 
     // Initialize the truth particle info
@@ -413,31 +592,31 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
 
     // Push the corresponding truth particle info for the track.
     // Always push back even if majority particle not found
-    m_majorityParticleVertexPrimary.push_back(
+    row.majorityParticleVertexPrimary.push_back(
         majorityParticleId.vertexPrimary());
-    m_majorityParticleVertexSecondary.push_back(
+    row.majorityParticleVertexSecondary.push_back(
         majorityParticleId.vertexSecondary());
-    m_majorityParticleParticle.push_back(majorityParticleId.particle());
-    m_majorityParticleGeneration.push_back(majorityParticleId.generation());
-    m_majorityParticleSubParticle.push_back(majorityParticleId.subParticle());
-    m_trackClassification.push_back(static_cast<int>(trackClassification));
-    m_nMajorityHits.push_back(nMajorityHits);
-    m_t_charge.push_back(t_charge);
-    m_t_time.push_back(t_time);
-    m_t_vx.push_back(t_vx);
-    m_t_vy.push_back(t_vy);
-    m_t_vz.push_back(t_vz);
-    m_t_px.push_back(t_px);
-    m_t_py.push_back(t_py);
-    m_t_pz.push_back(t_pz);
-    m_t_theta.push_back(t_theta);
-    m_t_phi.push_back(t_phi);
-    m_t_eta.push_back(t_eta);
-    m_t_p.push_back(t_p);
-    m_t_pT.push_back(t_pT);
-    m_t_d0.push_back(t_d0);
-    m_t_z0.push_back(t_z0);
-    m_t_prodR.push_back(t_prodR);
+    row.majorityParticleParticle.push_back(majorityParticleId.particle());
+    row.majorityParticleGeneration.push_back(majorityParticleId.generation());
+    row.majorityParticleSubParticle.push_back(majorityParticleId.subParticle());
+    row.trackClassification.push_back(static_cast<int>(trackClassification));
+    row.nMajorityHits.push_back(nMajorityHits);
+    row.t_charge.push_back(t_charge);
+    row.t_time.push_back(t_time);
+    row.t_vx.push_back(t_vx);
+    row.t_vy.push_back(t_vy);
+    row.t_vz.push_back(t_vz);
+    row.t_px.push_back(t_px);
+    row.t_py.push_back(t_py);
+    row.t_pz.push_back(t_pz);
+    row.t_theta.push_back(t_theta);
+    row.t_phi.push_back(t_phi);
+    row.t_eta.push_back(t_eta);
+    row.t_p.push_back(t_p);
+    row.t_pT.push_back(t_pT);
+    row.t_d0.push_back(t_d0);
+    row.t_z0.push_back(t_z0);
+    row.t_prodR.push_back(t_prodR);
 
     // Initialize the fitted track parameters info
     std::array<float, Acts::eBoundSize> param = {NaNfloat, NaNfloat, NaNfloat,
@@ -482,97 +661,97 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
 
     // Push the fitted track parameters.
     // Always push back even if no fitted track parameters
-    m_eLOC0_fit.push_back(param[Acts::eBoundLoc0]);
-    m_eLOC1_fit.push_back(param[Acts::eBoundLoc1]);
-    m_ePHI_fit.push_back(param[Acts::eBoundPhi]);
-    m_eTHETA_fit.push_back(param[Acts::eBoundTheta]);
-    m_eQOP_fit.push_back(param[Acts::eBoundQOverP]);
-    m_eT_fit.push_back(param[Acts::eBoundTime]);
-
-    m_res_eLOC0_fit.push_back(res[Acts::eBoundLoc0]);
-    m_res_eLOC1_fit.push_back(res[Acts::eBoundLoc1]);
-    m_res_ePHI_fit.push_back(res[Acts::eBoundPhi]);
-    m_res_eTHETA_fit.push_back(res[Acts::eBoundTheta]);
-    m_res_eQOP_fit.push_back(res[Acts::eBoundQOverP]);
-    m_res_eT_fit.push_back(res[Acts::eBoundTime]);
-
-    m_err_eLOC0_fit.push_back(error[Acts::eBoundLoc0]);
-    m_err_eLOC1_fit.push_back(error[Acts::eBoundLoc1]);
-    m_err_ePHI_fit.push_back(error[Acts::eBoundPhi]);
-    m_err_eTHETA_fit.push_back(error[Acts::eBoundTheta]);
-    m_err_eQOP_fit.push_back(error[Acts::eBoundQOverP]);
-    m_err_eT_fit.push_back(error[Acts::eBoundTime]);
-
-    m_pull_eLOC0_fit.push_back(pull[Acts::eBoundLoc0]);
-    m_pull_eLOC1_fit.push_back(pull[Acts::eBoundLoc1]);
-    m_pull_ePHI_fit.push_back(pull[Acts::eBoundPhi]);
-    m_pull_eTHETA_fit.push_back(pull[Acts::eBoundTheta]);
-    m_pull_eQOP_fit.push_back(pull[Acts::eBoundQOverP]);
-    m_pull_eT_fit.push_back(pull[Acts::eBoundTime]);
-
-    m_hasFittedParams.push_back(hasFittedParams);
+    row.eLOC0_fit.push_back(param[Acts::eBoundLoc0]);
+    row.eLOC1_fit.push_back(param[Acts::eBoundLoc1]);
+    row.ePHI_fit.push_back(param[Acts::eBoundPhi]);
+    row.eTHETA_fit.push_back(param[Acts::eBoundTheta]);
+    row.eQOP_fit.push_back(param[Acts::eBoundQOverP]);
+    row.eT_fit.push_back(param[Acts::eBoundTime]);
+
+    row.res_eLOC0_fit.push_back(res[Acts::eBoundLoc0]);
+    row.res_eLOC1_fit.push_back(res[Acts::eBoundLoc1]);
+    row.res_ePHI_fit.push_back(res[Acts::eBoundPhi]);
+    row.res_eTHETA_fit.push_back(res[Acts::eBoundTheta]);
+    row.res_eQOP_fit.push_back(res[Acts::eBoundQOverP]);
+    row.res_eT_fit.push_back(res[Acts::eBoundTime]);
+
+    row.err_eLOC0_fit.push_back(error[Acts::eBoundLoc0]);
+    row.err_eLOC1_fit.push_back(error[Acts::eBoundLoc1]);
+    row.err_ePHI_fit.push_back(error[Acts::eBoundPhi]);
+    row.err_eTHETA_fit.push_back(error[Acts::eBoundTheta]);
+    row.err_eQOP_fit.push_back(error[Acts::eBoundQOverP]);
+    row.err_eT_fit.push_back(error[Acts::eBoundTime]);
+
+    row.pull_eLOC0_fit.push_back(pull[Acts::eBoundLoc0]);
+    row.pull_eLOC1_fit.push_back(pull[Acts::eBoundLoc1]);
+    row.pull_ePHI_fit.push_back(pull[Acts::eBoundPhi]);
+    row.pull_eTHETA_fit.push_back(pull[Acts::eBoundTheta]);
+    row.pull_eQOP_fit.push_back(pull[Acts::eBoundQOverP]);
+    row.pull_eT_fit.push_back(pull[Acts::eBoundTime]);
+
+    row.hasFittedParams.push_back(hasFittedParams);
 
     if (m_cfg.writeGsfSpecific) {
       using namespace Acts::GsfConstants;
       if (tracks.hasColumn(Acts::hashString(kFwdMaxMaterialXOverX0))) {
-        m_gsf_max_material_fwd.push_back(
+        row.gsf_max_material_fwd.push_back(
             track.template component<double>(kFwdMaxMaterialXOverX0));
       } else {
-        m_gsf_max_material_fwd.push_back(NaNfloat);
+        row.gsf_max_material_fwd.push_back(NaNfloat);
       }
 
       if (tracks.hasColumn(Acts::hashString(kFwdSumMaterialXOverX0))) {
-        m_gsf_sum_material_fwd.push_back(
+        row.gsf_sum_material_fwd.push_back(
             track.template component<double>(kFwdSumMaterialXOverX0));
       } else {
-        m_gsf_sum_material_fwd.push_back(NaNfloat);
+        row.gsf_sum_material_fwd.push_back(NaNfloat);
       }
     }
 
     if (m_cfg.writeCovMat) {
       // write all entries of covariance matrix to output file
       // one branch for every entry of the matrix.
-      m_cov_eLOC0_eLOC0.push_back(getCov(0, 0));
-      m_cov_eLOC0_eLOC1.push_back(getCov(0, 1));
-      m_cov_eLOC0_ePHI.push_back(getCov(0, 2));
-      m_cov_eLOC0_eTHETA.push_back(getCov(0, 3));
-      m_cov_eLOC0_eQOP.push_back(getCov(0, 4));
-      m_cov_eLOC0_eT.push_back(getCov(0, 5));
-
-      m_cov_eLOC1_eLOC0.push_back(getCov(1, 0));
-      m_cov_eLOC1_eLOC1.push_back(getCov(1, 1));
-      m_cov_eLOC1_ePHI.push_back(getCov(1, 2));
-      m_cov_eLOC1_eTHETA.push_back(getCov(1, 3));
-      m_cov_eLOC1_eQOP.push_back(getCov(1, 4));
-      m_cov_eLOC1_eT.push_back(getCov(1, 5));
-
-      m_cov_ePHI_eLOC0.push_back(getCov(2, 0));
-      m_cov_ePHI_eLOC1.push_back(getCov(2, 1));
-      m_cov_ePHI_ePHI.push_back(getCov(2, 2));
-      m_cov_ePHI_eTHETA.push_back(getCov(2, 3));
-      m_cov_ePHI_eQOP.push_back(getCov(2, 4));
-      m_cov_ePHI_eT.push_back(getCov(2, 5));
-
-      m_cov_eTHETA_eLOC0.push_back(getCov(3, 0));
-      m_cov_eTHETA_eLOC1.push_back(getCov(3, 1));
-      m_cov_eTHETA_ePHI.push_back(getCov(3, 2));
-      m_cov_eTHETA_eTHETA.push_back(getCov(3, 3));
-      m_cov_eTHETA_eQOP.push_back(getCov(3, 4));
-      m_cov_eTHETA_eT.push_back(getCov(3, 5));
-
-      m_cov_eQOP_eLOC0.push_back(getCov(4, 0));
-      m_cov_eQOP_eLOC1.push_back(getCov(4, 1));
-      m_cov_eQOP_ePHI.push_back(getCov(4, 2));
-      m_cov_eQOP_eTHETA.push_back(getCov(4, 3));
-      m_cov_eQOP_eQOP.push_back(getCov(4, 4));
-      m_cov_eQOP_eT.push_back(getCov(4, 5));
-
-      m_cov_eT_eLOC0.push_back(getCov(5, 0));
-      m_cov_eT_eLOC1.push_back(getCov(5, 1));
-      m_cov_eT_ePHI.push_back(getCov(5, 2));
-      m_cov_eT_eTHETA.push_back(getCov(5, 3));
-      m_cov_eT_eQOP.push_back(getCov(5, 4));
-      m_cov_eT_eT.push_back(getCov(5, 5));
+      row.cov_eLOC0_eLOC0.push_back(getCov(0, 0));
+      row.cov_eLOC0_eLOC1.push_back(getCov(0, 1));
+      row.cov_eLOC0_ePHI.push_back(getCov(0, 2));
+      row.cov_eLOC0_eTHETA.push_back(getCov(0, 3));
+      row.cov_eLOC0_eQOP.push_back(getCov(0, 4));
+      row.cov_eLOC0_eT.push_back(getCov(0, 5));
+
+      row.cov_eLOC1_eLOC0.push_back(getCov(1, 0));
+      row.cov_eLOC1_eLOC1.push_back(getCov(1, 1));
+      row.cov_eLOC1_ePHI.push_back(getCov(1, 2));
+      row.cov_eLOC1_eTHETA.push_back(getCov(1, 3));
+      row.cov_eLOC1_eQOP.push_back(getCov(1, 4));
+      row.cov_eLOC1_eT.push_back(getCov(1, 5));
+
+      row.cov_ePHI_eLOC0.push_back(getCov(2, 0));
+      row.cov_ePHI_eLOC1.push_back(getCov(2, 1));
+      row.cov_ePHI_ePHI.push_back(getCov(2, 2));
+      row.cov_ePHI_eTHETA.push_back(getCov(2, 3));
+      row.cov_ePHI_eQOP.push_back(getCov(2, 4));
+      row.cov_ePHI_eT.push_back(getCov(2, 5));
+
+      row.cov_eTHETA_eLOC0.push_back(getCov(3, 0));
+      row.cov_eTHETA_eLOC1.push_back(getCov(3, 1));
+      row.cov_eTHETA_ePHI.push_back(getCov(3, 2));
+      row.cov_eTHETA_eTHETA.push_back(getCov(3, 3));
+      row.cov_eTHETA_eQOP.push_back(getCov(3, 4));
+      row.cov_eTHETA_eT.push_back(getCov(3, 5));
+
+      row.cov_eQOP_eLOC0.push_back(getCov(4, 0));
+      row.cov_eQOP_eLOC1.push_back(getCov(4, 1));
+      row.cov_eQOP_ePHI.push_back(getCov(4, 2));
+      row.cov_eQOP_eTHETA.push_back(getCov(4, 3));
+      row.cov_eQOP_eQOP.push_back(getCov(4, 4));
+      row.cov_eQOP_eT.push_back(getCov(4, 5));
+
+      row.cov_eT_eLOC0.push_back(getCov(5, 0));
+      row.cov_eT_eLOC1.push_back(getCov(5, 1));
+      row.cov_eT_ePHI.push_back(getCov(5, 2));
+      row.cov_eT_eTHETA.push_back(getCov(5, 3));
+      row.cov_eT_eQOP.push_back(getCov(5, 4));
+      row.cov_eT_eT.push_back(getCov(5, 5));
     }
 
     if (m_cfg.writeGx2fSpecific) {
@@ -580,138 +759,15 @@ ProcessCode RootTrackSummaryWriter::writeT(const AlgorithmContext& ctx,
         int nUpdate = static_cast<int>(
             track.template component<std::uint32_t,
                                      Acts::hashString("Gx2fnUpdateColumn")>());
-        m_nUpdatesGx2f.push_back(nUpdate);
+        row.nUpdatesGx2f.push_back(nUpdate);
       } else {
-        m_nUpdatesGx2f.push_back(-1);
+        row.nUpdatesGx2f.push_back(-1);
       }
     }
   }
 
-  // fill the variables
-  m_outputTree->Fill();
-
-  m_trackNr.clear();
-  m_nStates.clear();
-  m_nMeasurements.clear();
-  m_nOutliers.clear();
-  m_nHoles.clear();
-  m_nSharedHits.clear();
-  m_chi2Sum.clear();
-  m_NDF.clear();
-  m_measurementChi2.clear();
-  m_outlierChi2.clear();
-  m_measurementVolume.clear();
-  m_measurementLayer.clear();
-  m_outlierVolume.clear();
-  m_outlierLayer.clear();
-
-  m_nMajorityHits.clear();
-  m_majorityParticleVertexPrimary.clear();
-  m_majorityParticleVertexSecondary.clear();
-  m_majorityParticleParticle.clear();
-  m_majorityParticleGeneration.clear();
-  m_majorityParticleSubParticle.clear();
-  m_trackClassification.clear();
-  m_t_charge.clear();
-  m_t_time.clear();
-  m_t_vx.clear();
-  m_t_vy.clear();
-  m_t_vz.clear();
-  m_t_px.clear();
-  m_t_py.clear();
-  m_t_pz.clear();
-  m_t_theta.clear();
-  m_t_phi.clear();
-  m_t_p.clear();
-  m_t_pT.clear();
-  m_t_eta.clear();
-  m_t_d0.clear();
-  m_t_z0.clear();
-  m_t_prodR.clear();
-
-  m_hasFittedParams.clear();
-  m_eLOC0_fit.clear();
-  m_eLOC1_fit.clear();
-  m_ePHI_fit.clear();
-  m_eTHETA_fit.clear();
-  m_eQOP_fit.clear();
-  m_eT_fit.clear();
-  m_err_eLOC0_fit.clear();
-  m_err_eLOC1_fit.clear();
-  m_err_ePHI_fit.clear();
-  m_err_eTHETA_fit.clear();
-  m_err_eQOP_fit.clear();
-  m_err_eT_fit.clear();
-  m_res_eLOC0_fit.clear();
-  m_res_eLOC1_fit.clear();
-  m_res_ePHI_fit.clear();
-  m_res_eTHETA_fit.clear();
-  m_res_eQOP_fit.clear();
-  m_res_eT_fit.clear();
-  m_pull_eLOC0_fit.clear();
-  m_pull_eLOC1_fit.clear();
-  m_pull_ePHI_fit.clear();
-  m_pull_eTHETA_fit.clear();
-  m_pull_eQOP_fit.clear();
-  m_pull_eT_fit.clear();
-
-  m_gsf_max_material_fwd.clear();
-  m_gsf_sum_material_fwd.clear();
-
-  if (m_cfg.writeCovMat) {
-    m_cov_eLOC0_eLOC0.clear();
-    m_cov_eLOC0_eLOC1.clear();
-    m_cov_eLOC0_ePHI.clear();
-    m_cov_eLOC0_eTHETA.clear();
-    m_cov_eLOC0_eQOP.clear();
-    m_cov_eLOC0_eT.clear();
-
-    m_cov_eLOC1_eLOC0.clear();
-    m_cov_eLOC1_eLOC1.clear();
-    m_cov_eLOC1_ePHI.clear();
-    m_cov_eLOC1_eTHETA.clear();
-    m_cov_eLOC1_eQOP.clear();
-    m_cov_eLOC1_eT.clear();
-
-    m_cov_ePHI_eLOC0.clear();
-    m_cov_ePHI_eLOC1.clear();
-    m_cov_ePHI_ePHI.clear();
-    m_cov_ePHI_eTHETA.clear();
-    m_cov_ePHI_eQOP.clear();
-    m_cov_ePHI_eT.clear();
-
-    m_cov_eTHETA_eLOC0.clear();
-    m_cov_eTHETA_eLOC1.clear();
-    m_cov_eTHETA_ePHI.clear();
-    m_cov_eTHETA_eTHETA.clear();
-    m_cov_eTHETA_eQOP.clear();
-    m_cov_eTHETA_eT.clear();
-
-    m_cov_eQOP_eLOC0.clear();
-    m_cov_eQOP_eLOC1.clear();
-    m_cov_eQOP_ePHI.clear();
-    m_cov_eQOP_eTHETA.clear();
-    m_cov_eQOP_eQOP.clear();
-    m_cov_eQOP_eT.clear();
-
-    m_cov_eT_eLOC0.clear();
-    m_cov_eT_eLOC1.clear();
-    m_cov_eT_ePHI.clear();
-    m_cov_eT_eTHETA.clear();
-    m_cov_eT_eQOP.clear();
-    m_cov_eT_eT.clear();
-  }
-
-  m_nUpdatesGx2f.clear();
-
-  if (m_cfg.writeJets) {
-    m_nJets.clear();
-    m_jet_pt.clear();
-    m_jet_eta.clear();
-    m_jet_phi.clear();
-    m_jet_label.clear();
-    m_ntracks_per_jets.clear();
-  }
+  // Only handing the row over to the output is serialised
+  m_output->fill(std::move(rows));
 
   return ProcessCode::SUCCESS;
 }
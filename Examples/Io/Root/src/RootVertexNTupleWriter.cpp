@@ -29,15 +29,15 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <ios>
 #include <limits>
 #include <memory>
 #include <numbers>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
-#include <TFile.h>
 #include <TTree.h>
 
 namespace ActsExamples {
@@ -67,16 +67,267 @@ double pull(double diff, double variance, const std::string& variableStr,
 
 }  // namespace
 
+/// One row of the vertex tree, holding all vertices of one event
+struct RootVertexNTupleWriter::Columns {
+  /// The event number
+  std::uint32_t eventNr{0};
+
+  /// Number of reconstructed vertices
+  int nRecoVtx = -1;
+  /// Number of true vertices
+  int nTrueVtx = -1;
+  /// Number of clean vertices
+  int nCleanVtx = -1;
+  /// Number of merged vertices
+  int nMergedVtx = -1;
+  /// Number of split vertices
+  int nSplitVtx = -1;
+  /// Number of vertices in detector acceptance
+  int nVtxDetAcceptance = -1;
+  /// Max. number of reconstructable vertices (detector acceptance + tracking
+  /// efficiency)
+  int nVtxReconstructable = -1;
+
+  /// Number of tracks associated with the reconstructed vertex
+  std::vector<int> nTracksOnRecoVertex;
+
+  /// Sum of the track weights associated with the reconstructed vertex
+  std::vector<double> recoVertexTrackWeights;
+
+  // Sum pT^2 of all tracks associated with the vertex
+  std::vector<double> sumPt2;
+
+  // Reconstructed 4D vertex position
+  std::vector<double> recoX;
+  std::vector<double> recoY;
+  std::vector<double> recoZ;
+  std::vector<double> recoT;
+
+  // Vertex covariance
+  std::vector<double> covXX;
+  std::vector<double> covYY;
+  std::vector<double> covZZ;
+  std::vector<double> covTT;
+  std::vector<double> covXY;
+  std::vector<double> covXZ;
+  std::vector<double> covXT;
+  std::vector<double> covYZ;
+  std::vector<double> covYT;
+  std::vector<double> covZT;
+
+  // 4D position of the vertex seed. x and y coordinate are 0 in current
+  // implementations, we save them here as a check.
+  std::vector<double> seedX;
+  std::vector<double> seedY;
+  std::vector<double> seedZ;
+  std::vector<double> seedT;
+
+  // Truth vertex ID
+  std::vector<int> vertexPrimary;
+  std::vector<int> vertexSecondary;
+
+  /// Number of tracks associated with the truth vertex
+  std::vector<int> nTracksOnTruthVertex;
+
+  /// Truth-based primary vertex density for the reconstructed vertex
+  std::vector<double> truthPrimaryVertexDensity;
+
+  /// Sum of the track weights associated with the truth vertex
+  std::vector<double> truthVertexTrackWeights;
+  /// Fraction of track weight matched between truth and reco vertices
+  std::vector<double> truthVertexMatchRatio;
+  /// Fraction of incorrectly assigned track weight to the reco vertex
+  std::vector<double> recoVertexContamination;
+
+  /// Classification of the reconstructed vertex see RecoVertexClassification
+  std::vector<int> recoVertexClassification;
+
+  // True 4D vertex position
+  std::vector<double> truthX;
+  std::vector<double> truthY;
+  std::vector<double> truthZ;
+  std::vector<double> truthT;
+
+  // Difference of reconstructed and true vertex 4D position
+  std::vector<double> resX;
+  std::vector<double> resY;
+  std::vector<double> resZ;
+  std::vector<double> resT;
+
+  // Difference between the seed and the true vertex z and t coordinate
+  std::vector<double> resSeedZ;
+  std::vector<double> resSeedT;
+
+  // pull(X) = (X_reco - X_true)/Var(X_reco)^(1/2)
+  std::vector<double> pullX;
+  std::vector<double> pullY;
+  std::vector<double> pullZ;
+  std::vector<double> pullT;
+
+  //--------------------------------------------------------------
+  // Track-related variables are contained in a vector of vectors: The inner
+  // vectors contain the values of all tracks corresponding to one vertex. The
+  // outer vector can then have the same length as the flat vectors of
+  // vertex-related variables (see above). E.g.,
+  // truthPhi = ((truthPhi of 1st trk belonging to vtx 1,
+  //                truthPhi of 2nd trk belonging to vtx 1, ...),
+  //               (truthPhi of 1st trk belonging to vtx 2,
+  //                truthPhi of 2nd trk belonging to vtx 2, ...),
+  //                ...)
+
+  // Track weights from vertex fit, will be set to 1 if we do unweighted vertex
+  // fitting
+  std::vector<std::vector<double>> trkWeight;
+
+  // Reconstructed track momenta at the vertex before and after the vertex fit
+  std::vector<std::vector<double>> recoPhi;
+  std::vector<std::vector<double>> recoTheta;
+  std::vector<std::vector<double>> recoQOverP;
+
+  std::vector<std::vector<double>> recoPhiFitted;
+  std::vector<std::vector<double>> recoThetaFitted;
+  std::vector<std::vector<double>> recoQOverPFitted;
+
+  std::vector<std::vector<std::uint32_t>> trkParticleIdVertexPrimary;
+  std::vector<std::vector<std::uint32_t>> trkParticleIdVertexSecondary;
+  std::vector<std::vector<std::uint32_t>> trkParticleIdParticle;
+  std::vector<std::vector<std::uint32_t>> trkParticleIdGeneration;
+  std::vector<std::vector<std::uint32_t>> trkParticleIdSubParticle;
+
+  // True track momenta at the vertex
+  std::vector<std::vector<double>> truthPhi;
+  std::vector<std::vector<double>> truthTheta;
+  std::vector<std::vector<double>> truthQOverP;
+
+  // Difference between reconstructed momenta and true momenta
+  std::vector<std::vector<double>> resPhi;
+  std::vector<std::vector<double>> resTheta;
+  std::vector<std::vector<double>> resQOverP;
+  std::vector<std::vector<double>> momOverlap;
+
+  std::vector<std::vector<double>> resPhiFitted;
+  std::vector<std::vector<double>> resThetaFitted;
+  std::vector<std::vector<double>> resQOverPFitted;
+  std::vector<std::vector<double>> momOverlapFitted;
+
+  // Pulls
+  std::vector<std::vector<double>> pullPhi;
+  std::vector<std::vector<double>> pullTheta;
+  std::vector<std::vector<double>> pullQOverP;
+
+  std::vector<std::vector<double>> pullPhiFitted;
+  std::vector<std::vector<double>> pullThetaFitted;
+  std::vector<std::vector<double>> pullQOverPFitted;
+
+  void branch(TTree& tree, const Config& cfg) {
+    tree.Branch("event_nr", &eventNr);
+
+    tree.Branch("nRecoVtx", &nRecoVtx);
+    tree.Branch("nTrueVtx", &nTrueVtx);
+    tree.Branch("nCleanVtx", &nCleanVtx);
+    tree.Branch("nMergedVtx", &nMergedVtx);
+    tree.Branch("nSplitVtx", &nSplitVtx);
+    tree.Branch("nVtxDetectorAcceptance", &nVtxDetAcceptance);
+    tree.Branch("nVtxReconstructable", &nVtxReconstructable);
+
+    tree.Branch("nTracksRecoVtx", &nTracksOnRecoVertex);
+
+    tree.Branch("recoVertexTrackWeights", &recoVertexTrackWeights);
+
+    tree.Branch("sumPt2", &sumPt2);
+
+    tree.Branch("recoX", &recoX);
+    tree.Branch("recoY", &recoY);
+    tree.Branch("recoZ", &recoZ);
+    tree.Branch("recoT", &recoT);
+
+    tree.Branch("covXX", &covXX);
+    tree.Branch("covYY", &covYY);
+    tree.Branch("covZZ", &covZZ);
+    tree.Branch("covTT", &covTT);
+    tree.Branch("covXY", &covXY);
+    tree.Branch("covXZ", &covXZ);
+    tree.Branch("covXT", &covXT);
+    tree.Branch("covYZ", &covYZ);
+    tree.Branch("covYT", &covYT);
+    tree.Branch("covZT", &covZT);
+
+    tree.Branch("seedX", &seedX);
+    tree.Branch("seedY", &seedY);
+    tree.Branch("seedZ", &seedZ);
+    tree.Branch("seedT", &seedT);
+
+    tree.Branch("vertex_primary", &vertexPrimary);
+    tree.Branch("vertex_secondary", &vertexSecondary);
+
+    tree.Branch("nTracksTruthVtx", &nTracksOnTruthVertex);
+
+    tree.Branch("truthPrimaryVertexDensity", &truthPrimaryVertexDensity);
+
+    tree.Branch("truthVertexTrackWeights", &truthVertexTrackWeights);
+    tree.Branch("truthVertexMatchRatio", &truthVertexMatchRatio);
+    tree.Branch("recoVertexContamination", &recoVertexContamination);
+
+    tree.Branch("recoVertexClassification", &recoVertexClassification);
+
+    tree.Branch("truthX", &truthX);
+    tree.Branch("truthY", &truthY);
+    tree.Branch("truthZ", &truthZ);
+    tree.Branch("truthT", &truthT);
+
+    tree.Branch("resX", &resX);
+    tree.Branch("resY", &resY);
+    tree.Branch("resZ", &resZ);
+    tree.Branch("resT", &resT);
+
+    tree.Branch("resSeedZ", &resSeedZ);
+    tree.Branch("resSeedT", &resSeedT);
+
+    tree.Branch("pullX", &pullX);
+    tree.Branch("pullY", &pullY);
+    tree.Branch("pullZ", &pullZ);
+    tree.Branch("pullT", &pullT);
+
+    if (cfg.writeTrackInfo) {
+      tree.Branch("trk_weight", &trkWeight);
+
+      tree.Branch("trk_recoPhi", &recoPhi);
+      tree.Branch("trk_recoTheta", &recoTheta);
+      tree.Branch("trk_recoQOverP", &recoQOverP);
+
+      tree.Branch("trk_recoPhiFitted", &recoPhiFitted);
+      tree.Branch("trk_recoThetaFitted", &recoThetaFitted);
+      tree.Branch("trk_recoQOverPFitted", &recoQOverPFitted);
+
+      tree.Branch("trk_truthPhi", &truthPhi);
+      tree.Branch("trk_truthTheta", &truthTheta);
+      tree.Branch("trk_truthQOverP", &truthQOverP);
+
+      tree.Branch("trk_resPhi", &resPhi);
+      tree.Branch("trk_resTheta", &resTheta);
+      tree.Branch("trk_resQOverP", &resQOverP);
+      tree.Branch("trk_momOverlap", &momOverlap);
+
+      tree.Branch("trk_resPhiFitted", &resPhiFitted);
+      tree.Branch("trk_resThetaFitted", &resThetaFitted);
+      tree.Branch("trk_resQOverPFitted", &resQOverPFitted);
+      tree.Branch("trk_momOverlapFitted", &momOverlapFitted);
+
+      tree.Branch("trk_pullPhi", &pullPhi);
+      tree.Branch("trk_pullTheta", &pullTheta);
+      tree.Branch("trk_pullQOverP", &pullQOverP);
+
+      tree.Branch("trk_pullPhiFitted", &pullPhiFitted);
+      tree.Branch("trk_pullThetaFitted", &pullThetaFitted);
+      tree.Branch("trk_pullQOverPFitted", &pullQOverPFitted);
+    }
+  }
+};
+
 RootVertexNTupleWriter::RootVertexNTupleWriter(
     const RootVertexNTupleWriter::Config& config, Acts::Logging::Level level)
     : WriterT(config.inputVertices, "RootVertexNTupleWriter", level),
       m_cfg(config) {
-  if (m_cfg.filePath.empty()) {
-    throw std::invalid_argument("Missing output filename");
-  }
-  if (m_cfg.treeName.empty()) {
-    throw std::invalid_argument("Missing tree name");
-  }
   if (m_cfg.inputTruthVertices.empty()) {
     throw std::invalid_argument("Collection with truth vertices missing");
   }
@@ -102,131 +353,21 @@ RootVertexNTupleWriter::RootVertexNTupleWriter(
     throw std::invalid_argument("Missing input track particles matching");
   }
 
-  // Setup ROOT I/O
-  m_outputFile = TFile::Open(m_cfg.filePath.c_str(), m_cfg.fileMode.c_str());
-  if (m_outputFile == nullptr) {
-    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
-  }
-  m_outputFile->cd();
-  m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
-  if (m_outputTree == nullptr) {
-    throw std::bad_alloc();
-  }
-
-  m_outputTree->Branch("event_nr", &m_eventNr);
-
-  m_outputTree->Branch("nRecoVtx", &m_nRecoVtx);
-  m_outputTree->Branch("nTrueVtx", &m_nTrueVtx);
-  m_outputTree->Branch("nCleanVtx", &m_nCleanVtx);
-  m_outputTree->Branch("nMergedVtx", &m_nMergedVtx);
-  m_outputTree->Branch("nSplitVtx", &m_nSplitVtx);
-  m_outputTree->Branch("nVtxDetectorAcceptance", &m_nVtxDetAcceptance);
-  m_outputTree->Branch("nVtxReconstructable", &m_nVtxReconstructable);
-
-  m_outputTree->Branch("nTracksRecoVtx", &m_nTracksOnRecoVertex);
-
-  m_outputTree->Branch("recoVertexTrackWeights", &m_recoVertexTrackWeights);
-
-  m_outputTree->Branch("sumPt2", &m_sumPt2);
-
-  m_outputTree->Branch("recoX", &m_recoX);
-  m_outputTree->Branch("recoY", &m_recoY);
-  m_outputTree->Branch("recoZ", &m_recoZ);
-  m_outputTree->Branch("recoT", &m_recoT);
-
-  m_outputTree->Branch("covXX", &m_covXX);
-  m_outputTree->Branch("covYY", &m_covYY);
-  m_outputTree->Branch("covZZ", &m_covZZ);
-  m_outputTree->Branch("covTT", &m_covTT);
-  m_outputTree->Branch("covXY", &m_covXY);
-  m_outputTree->Branch("covXZ", &m_covXZ);
-  m_outputTree->Branch("covXT", &m_covXT);
-  m_outputTree->Branch("covYZ", &m_covYZ);
-  m_outputTree->Branch("covYT", &m_covYT);
-  m_outputTree->Branch("covZT", &m_covZT);
-
-  m_outputTree->Branch("seedX", &m_seedX);
-  m_outputTree->Branch("seedY", &m_seedY);
-  m_outputTree->Branch("seedZ", &m_seedZ);
-  m_outputTree->Branch("seedT", &m_seedT);
-
-  m_outputTree->Branch("vertex_primary", &m_vertexPrimary);
-  m_outputTree->Branch("vertex_secondary", &m_vertexSecondary);
-
-  m_outputTree->Branch("nTracksTruthVtx", &m_nTracksOnTruthVertex);
-
-  m_outputTree->Branch("truthPrimaryVertexDensity",
-                       &m_truthPrimaryVertexDensity);
-
-  m_outputTree->Branch("truthVertexTrackWeights", &m_truthVertexTrackWeights);
-  m_outputTree->Branch("truthVertexMatchRatio", &m_truthVertexMatchRatio);
-  m_outputTree->Branch("recoVertexContamination", &m_recoVertexContamination);
-
-  m_outputTree->Branch("recoVertexClassification", &m_recoVertexClassification);
-
-  m_outputTree->Branch("truthX", &m_truthX);
-  m_outputTree->Branch("truthY", &m_truthY);
-  m_outputTree->Branch("truthZ", &m_truthZ);
-  m_outputTree->Branch("truthT", &m_truthT);
-
-  m_outputTree->Branch("resX", &m_resX);
-  m_outputTree->Branch("resY", &m_resY);
-  m_outputTree->Branch("resZ", &m_resZ);
-  m_outputTree->Branch("resT", &m_resT);
-
-  m_outputTree->Branch("resSeedZ", &m_resSeedZ);
-  m_outputTree->Branch("resSeedT", &m_resSeedT);
-
-  m_outputTree->Branch("pullX", &m_pullX);
-  m_outputTree->Branch("pullY", &m_pullY);
-  m_outputTree->Branch("pullZ", &m_pullZ);
-  m_outputTree->Branch("pullT", &m_pullT);
-
-  if (m_cfg.writeTrackInfo) {
-    m_outputTree->Branch("trk_weight", &m_trkWeight);
-
-    m_outputTree->Branch("trk_recoPhi", &m_recoPhi);
-    m_outputTree->Branch("trk_recoTheta", &m_recoTheta);
-    m_outputTree->Branch("trk_recoQOverP", &m_recoQOverP);
-
-    m_outputTree->Branch("trk_recoPhiFitted", &m_recoPhiFitted);
-    m_outputTree->Branch("trk_recoThetaFitted", &m_recoThetaFitted);
-    m_outputTree->Branch("trk_recoQOverPFitted", &m_recoQOverPFitted);
-
-    m_outputTree->Branch("trk_truthPhi", &m_truthPhi);
-    m_outputTree->Branch("trk_truthTheta", &m_truthTheta);
-    m_outputTree->Branch("trk_truthQOverP", &m_truthQOverP);
-
-    m_outputTree->Branch("trk_resPhi", &m_resPhi);
-    m_outputTree->Branch("trk_resTheta", &m_resTheta);
-    m_outputTree->Branch("trk_resQOverP", &m_resQOverP);
-    m_outputTree->Branch("trk_momOverlap", &m_momOverlap);
-
-    m_outputTree->Branch("trk_resPhiFitted", &m_resPhiFitted);
-    m_outputTree->Branch("trk_resThetaFitted", &m_resThetaFitted);
-    m_outputTree->Branch("trk_resQOverPFitted", &m_resQOverPFitted);
-    m_outputTree->Branch("trk_momOverlapFitted", &m_momOverlapFitted);
-
-    m_outputTree->Branch("trk_pullPhi", &m_pullPhi);
-    m_outputTree->Branch("trk_pullTheta", &m_pullTheta);
-    m_outputTree->Branch("trk_pullQOverP", &m_pullQOverP);
-
-    m_outputTree->Branch("trk_pullPhiFitted", &m_pullPhiFitted);
-    m_outputTree->Branch("trk_pullThetaFitted", &m_pullThetaFitted);
-    m_outputTree->Branch("trk_pullQOverPFitted", &m_pullQOverPFitted);
-  }
+  RootTreeOutputConfig outputCfg;
+  outputCfg.filePath = m_cfg.filePath;
+  outputCfg.fileMode = m_cfg.fileMode;
+  outputCfg.treeName = m_cfg.treeName;
+  outputCfg.mode = m_cfg.outputMode;
+  m_output = std::make_unique<RootTreeOutput<Columns>>(
+      outputCfg, [this](TTree& tree, Columns& columns) {
+        columns.branch(tree, m_cfg);
+      });
 }
 
-RootVertexNTupleWriter::~RootVertexNTupleWriter() {
-  if (m_outputFile != nullptr) {
-    m_outputFile->Close();
-  }
-}
+RootVertexNTupleWriter::~RootVertexNTupleWriter() = default;
 
 ProcessCode RootVertexNTupleWriter::finalize() {
-  m_outputFile->cd();
-  m_outputTree->Write();
-  m_outputFile->Close();
+  m_output->close();
 
   return ProcessCode::SUCCESS;
 }
@@ -289,37 +430,38 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
     recoParticles = particles;
   }
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
+  // The event is written as a single row
+  std::vector<Columns> rows(1);
+  Columns& row = rows.front();
 
-  m_nRecoVtx = vertices.size();
-  m_nCleanVtx = 0;
-  m_nMergedVtx = 0;
-  m_nSplitVtx = 0;
+  row.nRecoVtx = vertices.size();
+  row.nCleanVtx = 0;
+  row.nMergedVtx = 0;
+  row.nSplitVtx = 0;
 
-  ACTS_DEBUG("Number of reco vertices in event: " << m_nRecoVtx);
+  ACTS_DEBUG("Number of reco vertices in event: " << row.nRecoVtx);
 
   // Get number of generated true primary vertices
-  m_nTrueVtx = getNumberOfTruePriVertices(particles);
+  row.nTrueVtx = getNumberOfTruePriVertices(particles);
   // Get number of detector-accepted true primary vertices
-  m_nVtxDetAcceptance = getNumberOfTruePriVertices(selectedParticles);
+  row.nVtxDetAcceptance = getNumberOfTruePriVertices(selectedParticles);
 
   ACTS_DEBUG("Number of truth particles in event : " << particles.size());
-  ACTS_DEBUG("Number of truth primary vertices : " << m_nTrueVtx);
+  ACTS_DEBUG("Number of truth primary vertices : " << row.nTrueVtx);
   ACTS_DEBUG("Number of detector-accepted truth primary vertices : "
-             << m_nVtxDetAcceptance);
+             << row.nVtxDetAcceptance);
 
   // Get the event number
-  m_eventNr = ctx.eventNumber;
+  row.eventNr = ctx.eventNumber;
 
   // Get number of track-associated true primary vertices
-  m_nVtxReconstructable = getNumberOfReconstructableVertices(recoParticles);
+  row.nVtxReconstructable = getNumberOfReconstructableVertices(recoParticles);
 
   ACTS_DEBUG("Number of reconstructed tracks : " << tracks.size());
   ACTS_DEBUG("Number of reco track-associated truth particles in event : "
              << recoParticles.size());
   ACTS_DEBUG("Maximum number of reconstructible primary vertices : "
-             << m_nVtxReconstructable);
+             << row.nVtxReconstructable);
 
   // Loop over reconstructed vertices and see if they can be matched to a true
   // vertex.
@@ -331,10 +473,10 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
 
     const auto& toTruthMatching = recoToTruthMatching[vtxIndex];
 
-    m_recoX.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eX]);
-    m_recoY.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eY]);
-    m_recoZ.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eZ]);
-    m_recoT.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eTime]);
+    row.recoX.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eX]);
+    row.recoY.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eY]);
+    row.recoZ.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eZ]);
+    row.recoT.push_back(vtx.fullPosition()[Acts::CoordinateIndices::eTime]);
 
     double varX = vtx.fullCovariance()(Acts::CoordinateIndices::eX,
                                        Acts::CoordinateIndices::eX);
@@ -345,25 +487,25 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
     double varTime = vtx.fullCovariance()(Acts::CoordinateIndices::eTime,
                                           Acts::CoordinateIndices::eTime);
 
-    m_covXX.push_back(varX);
-    m_covYY.push_back(varY);
-    m_covZZ.push_back(varZ);
-    m_covTT.push_back(varTime);
-    m_covXY.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
+    row.covXX.push_back(varX);
+    row.covYY.push_back(varY);
+    row.covZZ.push_back(varZ);
+    row.covTT.push_back(varTime);
+    row.covXY.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
                                            Acts::CoordinateIndices::eY));
-    m_covXZ.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
+    row.covXZ.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
                                            Acts::CoordinateIndices::eZ));
-    m_covXT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
+    row.covXT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eX,
                                            Acts::CoordinateIndices::eTime));
-    m_covYZ.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eY,
+    row.covYZ.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eY,
                                            Acts::CoordinateIndices::eZ));
-    m_covYT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eY,
+    row.covYT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eY,
                                            Acts::CoordinateIndices::eTime));
-    m_covZT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eZ,
+    row.covZT.push_back(vtx.fullCovariance()(Acts::CoordinateIndices::eZ,
                                            Acts::CoordinateIndices::eTime));
 
     double sumPt2 = calcSumPt2(vtx, m_cfg.minTrkWeight);
-    m_sumPt2.push_back(sumPt2);
+    row.sumPt2.push_back(sumPt2);
 
     double recoVertexTrackWeights = 0;
     for (const Acts::TrackAtVertex& trk : tracksAtVtx) {
@@ -372,13 +514,13 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
       }
       recoVertexTrackWeights += trk.trackWeight;
     }
-    m_recoVertexTrackWeights.push_back(recoVertexTrackWeights);
+    row.recoVertexTrackWeights.push_back(recoVertexTrackWeights);
 
     unsigned int nTracksOnRecoVertex = std::count_if(
         tracksAtVtx.begin(), tracksAtVtx.end(), [this](const auto& trkAtVtx) {
           return trkAtVtx.trackWeight > m_cfg.minTrkWeight;
         });
-    m_nTracksOnRecoVertex.push_back(nTracksOnRecoVertex);
+    row.nTracksOnRecoVertex.push_back(nTracksOnRecoVertex);
 
     // Saving truth information for the reconstructed vertex
     bool truthInfoWritten = false;
@@ -392,8 +534,8 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
       }
       const SimVertex& truthVertex = *iTruthVertex;
 
-      m_vertexPrimary.push_back(truthVertex.vertexId().vertexPrimary());
-      m_vertexSecondary.push_back(truthVertex.vertexId().vertexSecondary());
+      row.vertexPrimary.push_back(truthVertex.vertexId().vertexPrimary());
+      row.vertexSecondary.push_back(truthVertex.vertexId().vertexSecondary());
 
       // Count number of reconstructible tracks on truth vertex
       int nTracksOnTruthVertex = 0;
@@ -403,178 +545,105 @@ ProcessCode RootVertexNTupleWriter::writeT(const AlgorithmContext& ctx,
           ++nTracksOnTruthVertex;
         }
       }
-      m_nTracksOnTruthVertex.push_back(nTracksOnTruthVertex);
+      row.nTracksOnTruthVertex.push_back(nTracksOnTruthVertex);
 
       double truthPrimaryVertexDensity = calculateTruthPrimaryVertexDensity(
           truthVertices, vtx, m_cfg.vertexDensityWindow);
-      m_truthPrimaryVertexDensity.push_back(truthPrimaryVertexDensity);
+      row.truthPrimaryVertexDensity.push_back(truthPrimaryVertexDensity);
 
       double truthVertexTrackWeights =
           toTruthMatching.truthMajorityTrackWeights;
-      m_truthVertexTrackWeights.push_back(truthVertexTrackWeights);
+      row.truthVertexTrackWeights.push_back(truthVertexTrackWeights);
 
       double truthVertexMatchRatio = toTruthMatching.matchFraction;
-      m_truthVertexMatchRatio.push_back(truthVertexMatchRatio);
+      row.truthVertexMatchRatio.push_back(truthVertexMatchRatio);
 
       double recoVertexContamination = 1 - truthVertexMatchRatio;
-      m_recoVertexContamination.push_back(recoVertexContamination);
+      row.recoVertexContamination.push_back(recoVertexContamination);
 
       RecoVertexClassification recoVertexClassification =
           toTruthMatching.classification;
-      m_recoVertexClassification.push_back(
+      row.recoVertexClassification.push_back(
           static_cast<int>(recoVertexClassification));
 
       if (recoVertexClassification == RecoVertexClassification::Clean) {
-        ++m_nCleanVtx;
+        ++row.nCleanVtx;
       } else if (recoVertexClassification == RecoVertexClassification::Merged) {
-        ++m_nMergedVtx;
+        ++row.nMergedVtx;
       } else if (recoVertexClassification == RecoVertexClassification::Split) {
-        ++m_nSplitVtx;
+        ++row.nSplitVtx;
       }
 
       const Acts::Vector4& truePos = truthVertex.position4;
       truthPos = truePos;
-      m_truthX.push_back(truePos[Acts::CoordinateIndices::eX]);
-      m_truthY.push_back(truePos[Acts::CoordinateIndices::eY]);
-      m_truthZ.push_back(truePos[Acts::CoordinateIndices::eZ]);
-      m_truthT.push_back(truePos[Acts::CoordinateIndices::eTime]);
+      row.truthX.push_back(truePos[Acts::CoordinateIndices::eX]);
+      row.truthY.push_back(truePos[Acts::CoordinateIndices::eY]);
+      row.truthZ.push_back(truePos[Acts::CoordinateIndices::eZ]);
+      row.truthT.push_back(truePos[Acts::CoordinateIndices::eTime]);
 
       const Acts::Vector4 diffPos = vtx.fullPosition() - truePos;
-      m_resX.push_back(diffPos[Acts::CoordinateIndices::eX]);
-      m_resY.push_back(diffPos[Acts::CoordinateIndices::eY]);
-      m_resZ.push_back(diffPos[Acts::CoordinateIndices::eZ]);
-      m_resT.push_back(diffPos[Acts::CoordinateIndices::eTime]);
+      row.resX.push_back(diffPos[Acts::CoordinateIndices::eX]);
+      row.resY.push_back(diffPos[Acts::CoordinateIndices::eY]);
+      row.resZ.push_back(diffPos[Acts::CoordinateIndices::eZ]);
+      row.resT.push_back(diffPos[Acts::CoordinateIndices::eTime]);
 
-      m_pullX.push_back(pull(diffPos[Acts::CoordinateIndices::eX], varX, "X",
+      row.pullX.push_back(pull(diffPos[Acts::CoordinateIndices::eX], varX, "X",
                              true, logger()));
-      m_pullY.push_back(pull(diffPos[Acts::CoordinateIndices::eY], varY, "Y",
+      row.pullY.push_back(pull(diffPos[Acts::CoordinateIndices::eY], varY, "Y",
                              true, logger()));
-      m_pullZ.push_back(pull(diffPos[Acts::CoordinateIndices::eZ], varZ, "Z",
+      row.pullZ.push_back(pull(diffPos[Acts::CoordinateIndices::eZ], varZ, "Z",
                              true, logger()));
-      m_pullT.push_back(pull(diffPos[Acts::CoordinateIndices::eTime], varTime,
+      row.pullT.push_back(pull(diffPos[Acts::CoordinateIndices::eTime], varTime,
                              "T", true, logger()));
 
       truthInfoWritten = true;
     }
     if (!truthInfoWritten) {
-      m_vertexPrimary.push_back(-1);
-      m_vertexSecondary.push_back(-1);
+      row.vertexPrimary.push_back(-1);
+      row.vertexSecondary.push_back(-1);
 
-      m_nTracksOnTruthVertex.push_back(-1);
+      row.nTracksOnTruthVertex.push_back(-1);
 
-      m_truthPrimaryVertexDensity.push_back(nan);
+      row.truthPrimaryVertexDensity.push_back(nan);
 
-      m_truthVertexTrackWeights.push_back(nan);
-      m_truthVertexMatchRatio.push_back(nan);
-      m_recoVertexContamination.push_back(nan);
+      row.truthVertexTrackWeights.push_back(nan);
+      row.truthVertexMatchRatio.push_back(nan);
+      row.recoVertexContamination.push_back(nan);
 
-      m_recoVertexClassification.push_back(
+      row.recoVertexClassification.push_back(
           static_cast<int>(RecoVertexClassification::Unknown));
 
-      m_truthX.push_back(nan);
-      m_truthY.push_back(nan);
-      m_truthZ.push_back(nan);
-      m_truthT.push_back(nan);
+      row.truthX.push_back(nan);
+      row.truthY.push_back(nan);
+      row.truthZ.push_back(nan);
+      row.truthT.push_back(nan);
 
-      m_resX.push_back(nan);
-      m_resY.push_back(nan);
-      m_resZ.push_back(nan);
-      m_resT.push_back(nan);
+      row.resX.push_back(nan);
+      row.resY.push_back(nan);
+      row.resZ.push_back(nan);
+      row.resT.push_back(nan);
 
-      m_pullX.push_back(nan);
-      m_pullY.push_back(nan);
-      m_pullZ.push_back(nan);
-      m_pullT.push_back(nan);
+      row.pullX.push_back(nan);
+      row.pullY.push_back(nan);
+      row.pullZ.push_back(nan);
+      row.pullT.push_back(nan);
     }
 
     if (m_cfg.writeTrackInfo) {
-      writeTrackInfo(ctx, particles, tracks, trackParticleMatching, truthPos,
-                     tracksAtVtx);
+      writeTrackInfo(row, ctx, particles, tracks, trackParticleMatching,
+                     truthPos, tracksAtVtx);
     }
   }
 
-  // fill the variables
-  m_outputTree->Fill();
-
-  m_nTracksOnRecoVertex.clear();
-  m_recoVertexTrackWeights.clear();
-  m_recoX.clear();
-  m_recoY.clear();
-  m_recoZ.clear();
-  m_recoT.clear();
-  m_covXX.clear();
-  m_covYY.clear();
-  m_covZZ.clear();
-  m_covTT.clear();
-  m_covXY.clear();
-  m_covXZ.clear();
-  m_covXT.clear();
-  m_covYZ.clear();
-  m_covYT.clear();
-  m_covZT.clear();
-  m_seedX.clear();
-  m_seedY.clear();
-  m_seedZ.clear();
-  m_seedT.clear();
-  m_vertexPrimary.clear();
-  m_vertexSecondary.clear();
-  m_nTracksOnTruthVertex.clear();
-  m_truthPrimaryVertexDensity.clear();
-  m_truthVertexTrackWeights.clear();
-  m_truthVertexMatchRatio.clear();
-  m_recoVertexContamination.clear();
-  m_recoVertexClassification.clear();
-  m_truthX.clear();
-  m_truthY.clear();
-  m_truthZ.clear();
-  m_truthT.clear();
-  m_resX.clear();
-  m_resY.clear();
-  m_resZ.clear();
-  m_resT.clear();
-  m_resSeedZ.clear();
-  m_resSeedT.clear();
-  m_pullX.clear();
-  m_pullY.clear();
-  m_pullZ.clear();
-  m_pullT.clear();
-  m_sumPt2.clear();
-  m_trkWeight.clear();
-  m_recoPhi.clear();
-  m_recoTheta.clear();
-  m_recoQOverP.clear();
-  m_recoPhiFitted.clear();
-  m_recoThetaFitted.clear();
-  m_recoQOverPFitted.clear();
-  m_trkParticleIdVertexPrimary.clear();
-  m_trkParticleIdVertexSecondary.clear();
-  m_trkParticleIdParticle.clear();
-  m_trkParticleIdGeneration.clear();
-  m_trkParticleIdSubParticle.clear();
-  m_truthPhi.clear();
-  m_truthTheta.clear();
-  m_truthQOverP.clear();
-  m_resPhi.clear();
-  m_resTheta.clear();
-  m_resQOverP.clear();
-  m_momOverlap.clear();
-  m_resPhiFitted.clear();
-  m_resThetaFitted.clear();
-  m_resQOverPFitted.clear();
-  m_momOverlapFitted.clear();
-  m_pullPhi.clear();
-  m_pullTheta.clear();
-  m_pullQOverP.clear();
-  m_pullPhiFitted.clear();
-  m_pullThetaFitted.clear();
-  m_pullQOverPFitted.clear();
+  // Only handing the row over to the output is serialised
+  m_output->fill(std::move(rows));
 
   return ProcessCode::SUCCESS;
 }
 
 void RootVertexNTupleWriter::writeTrackInfo(
-    const AlgorithmContext& ctx, const SimParticleContainer& particles,
-    const ConstTrackContainer& tracks,
+    Columns& row, const AlgorithmContext& ctx,
+    const SimParticleContainer& particles, const ConstTrackContainer& tracks,
     const TrackParticleMatching& trackParticleMatching,
     const std::optional<Acts::Vector4>& truthPos,
     const std::vector<Acts::TrackAtVertex>& tracksAtVtx) {
@@ -591,47 +660,48 @@ void RootVertexNTupleWriter::writeTrackInfo(
 
   // Get references to inner vectors where all track variables corresponding
   // to the current vertex will be saved
-  auto& innerTrkWeight = m_trkWeight.emplace_back();
+  auto& innerTrkWeight = row.trkWeight.emplace_back();
 
-  auto& innerRecoPhi = m_recoPhi.emplace_back();
-  auto& innerRecoTheta = m_recoTheta.emplace_back();
-  auto& innerRecoQOverP = m_recoQOverP.emplace_back();
+  auto& innerRecoPhi = row.recoPhi.emplace_back();
+  auto& innerRecoTheta = row.recoTheta.emplace_back();
+  auto& innerRecoQOverP = row.recoQOverP.emplace_back();
 
-  auto& innerRecoPhiFitted = m_recoPhiFitted.emplace_back();
-  auto& innerRecoThetaFitted = m_recoThetaFitted.emplace_back();
-  auto& innerRecoQOverPFitted = m_recoQOverPFitted.emplace_back();
+  auto& innerRecoPhiFitted = row.recoPhiFitted.emplace_back();
+  auto& innerRecoThetaFitted = row.recoThetaFitted.emplace_back();
+  auto& innerRecoQOverPFitted = row.recoQOverPFitted.emplace_back();
 
   auto& innerTrkParticleIdVertexPrimary =
-      m_trkParticleIdVertexPrimary.emplace_back();
+      row.trkParticleIdVertexPrimary.emplace_back();
   auto& innerTrkParticleIdVertexSecondary =
-      m_trkParticleIdVertexSecondary.emplace_back();
-  auto& innerTrkParticleIdParticle = m_trkParticleIdParticle.emplace_back();
-  auto& innerTrkParticleIdGeneration = m_trkParticleIdGeneration.emplace_back();
+      row.trkParticleIdVertexSecondary.emplace_back();
+  auto& innerTrkParticleIdParticle = row.trkParticleIdParticle.emplace_back();
+  auto& innerTrkParticleIdGeneration =
+      row.trkParticleIdGeneration.emplace_back();
   auto& innerTrkParticleIdSubParticle =
-      m_trkParticleIdSubParticle.emplace_back();
+      row.trkParticleIdSubParticle.emplace_back();
 
-  auto& innerTruthPhi = m_truthPhi.emplace_back();
-  auto& innerTruthTheta = m_truthTheta.emplace_back();
-  auto& innerTruthQOverP = m_truthQOverP.emplace_back();
+  auto& innerTruthPhi = row.truthPhi.emplace_back();
+  auto& innerTruthTheta = row.truthTheta.emplace_back();
+  auto& innerTruthQOverP = row.truthQOverP.emplace_back();
 
-  auto& innerResPhi = m_resPhi.emplace_back();
-  auto& innerResTheta = m_resTheta.emplace_back();
-  auto& innerResQOverP = m_resQOverP.emplace_back();
+  auto& innerResPhi = row.resPhi.emplace_back();
+  auto& innerResTheta = row.resTheta.emplace_back();
+  auto& innerResQOverP = row.resQOverP.emplace_back();
 
-  auto& innerResPhiFitted = m_resPhiFitted.emplace_back();
-  auto& innerResThetaFitted = m_resThetaFitted.emplace_back();
-  auto& innerResQOverPFitted = m_resQOverPFitted.emplace_back();
+  auto& innerResPhiFitted = row.resPhiFitted.emplace_back();
+  auto& innerResThetaFitted = row.resThetaFitted.emplace_back();
+  auto& innerResQOverPFitted = row.resQOverPFitted.emplace_back();
 
-  auto& innerMomOverlap = m_momOverlap.emplace_back();
-  auto& innerMomOverlapFitted = m_momOverlapFitted.emplace_back();
+  auto& innerMomOverlap = row.momOverlap.emplace_back();
+  auto& innerMomOverlapFitted = row.momOverlapFitted.emplace_back();
 
-  auto& innerPullPhi = m_pullPhi.emplace_back();
-  auto& innerPullTheta = m_pullTheta.emplace_back();
-  auto& innerPullQOverP = m_pullQOverP.emplace_back();
+  auto& innerPullPhi = row.pullPhi.emplace_back();
+  auto& innerPullTheta = row.pullTheta.emplace_back();
+  auto& innerPullQOverP = row.pullQOverP.emplace_back();
 
-  auto& innerPullPhiFitted = m_pullPhiFitted.emplace_back();
-  auto& innerPullThetaFitted = m_pullThetaFitted.emplace_back();
-  auto& innerPullQOverPFitted = m_pullQOverPFitted.emplace_back();
+  auto& innerPullPhiFitted = row.pullPhiFitted.emplace_back();
+  auto& innerPullThetaFitted = row.pullThetaFitted.emplace_back();
+  auto& innerPullQOverPFitted = row.pullQOverPFitted.emplace_back();
 
   // Perigee at the true vertex position
   std::shared_ptr<Acts::PerigeeSurface> perigeeSurface;
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025 ACTS-Project
+# This file is part of ACTS.
+# See LICENSE for details.
+
+"""
+Measure how the ROOT tree writers scale with the number of event threads for
+the different output modes.
+
+The truth tracking chain on the generic detector provides the hits, tracks and
+vertices, which are written by the sim hit, track states, track summary and
+vertex writers. For every combination of output mode and number of threads,
+the throughput in events/s and the summed time spent in the writers are
+reported. The writer time includes the time the event threads wait for the
+output, which is where the locked mode stops scaling.
+"""
+
+import argparse
+import csv
+import time
+from pathlib import Path
+
+import acts
+import acts.examples
+from acts.examples.root import (
+    RootOutputMode,
+    RootSimHitWriter,
+    RootTrackStatesWriter,
+    RootTrackSummaryWriter,
+    RootVertexNTupleWriter,
+)
+
+u = acts.UnitConstants
+
+srcdir = Path(__file__).resolve().parent.parent.parent.parent
+
+modes = {
+    "Locked": RootOutputMode.Locked,
+    "Async": RootOutputMode.Async,
+    "FilePerThread": RootOutputMode.FilePerThread,
+}
+
+
+def addChain(s, trackingGeometry, field, numParticles):
+    from acts.examples.simulation import (
+        addParticleGun,
+        ParticleConfig,
+        EtaConfig,
+        PhiConfig,
+        MomentumConfig,
+        addFatras,
+        addDigitization,
+        ParticleSelectorConfig,
+        addDigiParticleSelection,
+    )
+    from acts.examples.reconstruction import (
+        addSeeding,
+        SeedingAlgorithm,
+        addKalmanTracks,
+        addVertexFitting,
+        VertexFinder,
+    )
+
+    rnd = acts.examples.RandomNumbers(seed=42)
+
+    addParticleGun(
+        s,
+        ParticleConfig(
+            num=numParticles, pdg=acts.PdgParticle.eMuon, randomizeCharge=True
+        ),
+        EtaConfig(-3.0, 3.0, uniform=True),
+        MomentumConfig(1.0 * u.GeV, 100.0 * u.GeV, transverse=True),
+        PhiConfig(0.0, 360.0 * u.degree),
+        multiplicity=1,
+        rnd=rnd,
+    )
+    addFatras(s, trackingGeometry, field, rnd=rnd)
+    addDigitization(
+        s,
+        trackingGeometry,
+        field,
+        digiConfigFile=srcdir
+        / "Examples/Configs/generic-digi-smearing-config.json",
+        rnd=rnd,
+    )
+    addDigiParticleSelection(
+        s,
+        ParticleSelectorConfig(
+            pt=(0.9 * u.GeV, None),
+            measurements=(7, None),
+            removeNeutral=True,
+            removeSecondaries=True,
+        ),
+    )
+    addSeeding(
+        s,
+        trackingGeometry,
+        field,
+        rnd=rnd,
+        inputParticles="particles_generated",
+        seedingAlgorithm=SeedingAlgorithm.TruthSmeared,
+        particleHypothesis=acts.ParticleHypothesis.muon,
+    )
+    addKalmanTracks(s, trackingGeometry, field)
+    addVertexFitting(s, field, vertexFinder=VertexFinder.Iterative)
+
+
+def addWriters(s, outputDir, mode, field):
+    s.addWriter(
+        RootSimHitWriter(
+            level=acts.logging.WARNING,
+            inputSimHits="simhits",
+            filePath=str(outputDir / "hits.root"),
+            outputMode=mode,
+        )
+    )
+    s.addWriter(
+        RootTrackStatesWriter(
+            level=acts.logging.WARNING,
+            inputTracks="tracks",
+            inputParticles="particles_selected",
+            inputTrackParticleMatching="track_particle_matching",
+            inputSimHits="simhits",
+            inputMeasurementSimHitsMap="measurement_simhits_map",
+            filePath=str(outputDir / "trackstates.root"),
+            outputMode=mode,
+        )
+    )
+    s.addWriter(
+        RootTrackSummaryWriter(
+            level=acts.logging.WARNING,
+            inputTracks="tracks",
+            inputParticles="particles_selected",
+            inputTrackParticleMatching="track_particle_matching",
+            filePath=str(outputDir / "tracksummary.root"),
+            writeCovMat=True,
+            outputMode=mode,
+        )
+    )
+    s.addWriter(
+        RootVertexNTupleWriter(
+            level=acts.logging.WARNING,
+            inputVertices="vertices",
+            inputTracks="tracks",
+            inputTruthVertices="vertices_truth",
+            inputParticles="particles",
+            inputSelectedParticles="particles_selected",
+            inputTrackParticleMatching="track_particle_matching",
+            inputVertexTruthMatching="vertex_truth_matching",
+            bField=field,
+            filePath=str(outputDir / "vertices.root"),
+            writeTrackInfo=True,
+            outputMode=mode,
+        )
+    )
+
+
+def run(args, trackingGeometry, field, modeName, numThreads):
+    outputDir = args.output / f"{modeName}_{numThreads}"
+    outputDir.mkdir(parents=True, exist_ok=True)
+
+    s = acts.examples.Sequencer(
+        events=args.events,
+        numThreads=numThreads,
+        outputDir=str(outputDir),
+        logLevel=acts.logging.WARNING,
+    )
+    addChain(s, trackingGeometry, field, args.particles)
+    addWriters(s, outputDir, modes[modeName], field)
+
+    start = time.perf_counter()
+    s.run()
+    wall = time.perf_counter() - start
+
+    writerTime = 0.0
+    with open(outputDir / "timing.csv") as f:
+        for row in csv.DictReader(f):
+            if row["identifier"].startswith("Writer:Root"):
+                writerTime += float(row["time_total_s"])
+
+    return args.events / wall, writerTime / args.events
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__)
+    p.add_argument("--events", type=int, default=1000)
+    p.add_argument(
+        "--particles", type=int, default=50, help="Particles per event"
+    )
+    p.add_argument("--threads", type=int, nargs="+", default=[1, 16, 64])
+    p.add_argument(
+        "--modes", nargs="+", choices=list(modes), default=list(modes)
+    )
+    p.add_argument(
+        "--output", type=Path, default=Path.cwd() / "root_writer_scaling"
+    )
+    p.add_argument("--csv", type=Path, default=Path("root_writer_scaling.csv"))
+    args = p.parse_args()
+
+    detector = acts.examples.GenericDetector()
+    trackingGeometry = detector.trackingGeometry()
+    field = acts.ConstantBField(acts.Vector3(0, 0, 2 * u.T))
+
+    results = []
+    for modeName in args.modes:
+        for numThreads in args.threads:
+            throughput, writerTime = run(
+                args, trackingGeometry, field, modeName, numThreads
+            )
+            results.append((modeName, numThreads, throughput, writerTime))
+
+    baseline = {
+        numThreads: throughput
+        for modeName, numThreads, throughput, _ in results
+        if modeName == "Locked"
+    }
+
+    print(
+        f"{'mode':>14} {'threads':>8} {'events/s':>10} "
+        f"{'writer ms/event':>16} {'vs Locked':>10}"
+    )
+    for modeName, numThreads, throughput, writerTime in results:
+        speedup = (
+            f"{throughput / baseline[numThreads]:.2f}x"
+            if numThreads in baseline
+            else "-"
+        )
+        print(
+            f"{modeName:>14} {numThreads:>8} {throughput:>10.1f} "
+            f"{writerTime * 1e3:>16.3f} {speedup:>10}"
+        )
+
+    with open(args.csv, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(
+            ["mode", "threads", "events_per_s", "writer_s_per_event"]
+        )
+        writer.writerows(results)
+
+
+if "__main__" == __name__:
+    main()
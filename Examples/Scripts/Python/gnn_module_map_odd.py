@@ -30,7 +30,9 @@ from acts.examples.simulation import (
 )
 from acts.examples.reconstruction import addGnn, addSpacePointsMaking
 from acts.gnn import (
+    ModuleMapCpu,
     ModuleMapCuda,
+    CpuTrackBuilding,
     CudaTrackBuilding,
     Device,
 )
@@ -48,6 +50,8 @@ def runGnnModuleMap(
     outputDir,
     events=100,
     s=None,
+    hardware="gpu",
+    numThreads=1,
 ):
     """
     Run GNN tracking with module maps on ODD.
@@ -61,19 +65,24 @@ def runGnnModuleMap(
         geometrySelection: Geometry selection JSON file path
         digiConfigFile: Digitization config file path
         moduleMapPath: Path prefix for module map files
-                      (will load .doublets.root and .triplets.root)
+                      (will load .doublets.root and .triplets.root on the
+                      GPU, .doublets.csv and .triplets.csv on the CPU)
         gnnModel: Path to trained model (.pt, .onnx, or .engine)
         outputDir: Output directory for performance files
         events: Number of events to process
         s: Optional sequencer (creates new one if None)
+        hardware: Run graph construction and track building on the "gpu" or
+                  on the "cpu"
+        numThreads: Number of threads of the CPU graph construction and track
+                    building
     """
+    assert hardware in ("cpu", "gpu"), f"Unsupported hardware: {hardware}"
+
     # Validate inputs
-    assert Path(
-        moduleMapPath + ".doublets.root"
-    ).exists(), f"Module map not found: {moduleMapPath}.doublets.root"
-    assert Path(
-        moduleMapPath + ".triplets.root"
-    ).exists(), f"Module map not found: {moduleMapPath}.triplets.root"
+    moduleMapExt = ".csv" if hardware == "cpu" else ".root"
+    for kind in ("doublets", "triplets"):
+        moduleMapFile = f"{moduleMapPath}.{kind}{moduleMapExt}"
+        assert Path(moduleMapFile).exists(), f"Module map not found: {moduleMapFile}"
     assert Path(gnnModel).exists(), f"Model file not found: {gnnModel}"
 
     s = s or Sequencer(events=events, numThreads=1)
@@ -143,11 +152,16 @@ def runGnnModuleMap(
         "phiScale": 3.141592654,
         "zScale": 1000.0,
         "etaScale": 1.0,
-        "gpuDevice": 0,
-        "gpuBlocks": 512,
-        "moreParallel": True,
     }
-    graphConstructor = ModuleMapCuda(**moduleMapConfig)
+    if hardware == "cpu":
+        graphConstructor = ModuleMapCpu(**moduleMapConfig, numThreads=numThreads)
+    else:
+        graphConstructor = ModuleMapCuda(
+            **moduleMapConfig,
+            gpuDevice=0,
+            gpuBlocks=512,
+            moreParallel=True,
+        )
 
     gnnModel = Path(gnnModel)
     edgeClassifierConfig = {
@@ -156,15 +170,17 @@ def runGnnModuleMap(
         "cut": 0.5,
     }
 
+    device = Device.Cpu() if hardware == "cpu" else Device.Cuda()
     if gnnModel.suffix == ".pt":
         edgeClassifierConfig["useEdgeFeatures"] = True
         from acts.gnn import TorchEdgeClassifier
 
+        edgeClassifierConfig["device"] = device
         edgeClassifiers = [TorchEdgeClassifier(**edgeClassifierConfig)]
     elif gnnModel.suffix == ".onnx":
         from acts.gnn import OnnxEdgeClassifier
 
-        edgeClassifierConfig["device"] = Device.Cuda()
+        edgeClassifierConfig["device"] = device
         edgeClassifiers = [OnnxEdgeClassifier(**edgeClassifierConfig)]
     elif gnnModel.suffix == ".engine":
         from acts.gnn import TensorRTEdgeClassifier
@@ -175,10 +191,14 @@ def runGnnModuleMap(
 
     trackBuilderConfig = {
         "level": acts.logging.INFO,
-        "useOneBlockImplementation": False,
         "doJunctionRemoval": True,
     }
-    trackBuilder = CudaTrackBuilding(**trackBuilderConfig)
+    if hardware == "cpu":
+        trackBuilder = CpuTrackBuilding(**trackBuilderConfig, numThreads=numThreads)
+    else:
+        trackBuilder = CudaTrackBuilding(
+            **trackBuilderConfig, useOneBlockImplementation=False
+        )
 
     e = NodeFeature
     nodeFeatures = [
@@ -16,7 +16,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
+#include <system_error>
+#include <vector>
 
 namespace ActsFatras {
 
@@ -112,75 +115,196 @@ struct MultiParticleSimulation {
     std::vector<FailedParticle> failedParticles;
 
     for (const Particle &inputParticle : inputParticles) {
-      // only consider simulatable particles
-      if (!selectParticle(inputParticle)) {
-        continue;
-      }
-      // required to allow correct particle id numbering for secondaries later
-      if ((inputParticle.particleId().generation() != 0u) ||
-          (inputParticle.particleId().subParticle() != 0u)) {
-        return detail::SimulationError::InvalidInputParticleId;
+      auto result = simulateParticle(geoCtx, magCtx, generator, inputParticle,
+                                     simulatedParticlesInitial,
+                                     simulatedParticlesFinal, hits,
+                                     failedParticles);
+      if (!result.ok()) {
+        return result.error();
       }
+    }
 
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. To avoid issues, access must always
-      //         occur via indices.
-      std::size_t iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      while (iinitial < simulatedParticlesInitial.size()) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
+    assert(
+        (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
+        "Inconsistent final sizes of the simulated particle containers");
 
-        // only simulatable particles are pushed to the container and here we
-        // only need to switch between charged/neutral.
-        auto result = Acts::Result<SingleParticleSimulationResult>::success({});
-        if (initialParticle.charge() != 0.) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
+    // the overall function call succeeded, i.e. no fatal errors occurred.
+    // yet, there might have been some particle for which the propagation
+    // failed. thus, the successful result contains a list of failed particles.
+    // sounds a bit weird, but that is the way it is.
+    return failedParticles;
+  }
 
-        if (!result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
+  /// Simulate multiple particles with independent random streams.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param makeGenerator creates the random number generator for an input
+  ///        particle, e.g. seeded from its particle id
+  /// @param inputParticles contains all particles that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param forEach runs a callable for all indices in `[0, n)` as
+  ///        `forEach(n, callable)`, possibly concurrently
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  /// @retval Acts::Result::Success with all particles that failed to simulate
+  ///
+  /// Each input particle is simulated together with all its secondaries using
+  /// its own generator and output containers, which makes the input particles
+  /// independent of each other. The outputs are appended in the order of the
+  /// input particles once all of them are simulated. The result is thus the
+  /// same for any execution order of `forEach` and equal to calling
+  /// `simulateParticle` for each input particle with its own generator.
+  ///
+  /// @tparam generator_factory_t is a callable `(const Particle &)` returning
+  ///         a random number generator
+  /// @tparam input_particles_t is a RandomAccessContainer for particles
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  /// @tparam for_each_t is a callable `(std::size_t, callable)`
+  template <typename generator_factory_t, typename input_particles_t,
+            typename output_particles_t, typename hits_t, typename for_each_t>
+  Acts::Result<std::vector<FailedParticle>> simulateIndependently(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx,
+      const generator_factory_t &makeGenerator,
+      const input_particles_t &inputParticles,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      for_each_t &&forEach) const {
+    assert(
+        (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
+        "Inconsistent initial sizes of the simulated particle containers");
 
-        assert(result->particle.particleId() == initialParticle.particleId() &&
-               "Particle id must not change during simulation");
+    struct Output {
+      output_particles_t particlesInitial;
+      output_particles_t particlesFinal;
+      hits_t hits;
+      std::vector<FailedParticle> failedParticles;
+      std::error_code error;
+    };
+    std::vector<Output> outputs(inputParticles.size());
 
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    forEach(inputParticles.size(), [&](std::size_t i) {
+      const Particle &inputParticle = inputParticles[i];
+      Output &output = outputs[i];
+      auto generator = makeGenerator(inputParticle);
+      auto result = simulateParticle(
+          geoCtx, magCtx, generator, inputParticle, output.particlesInitial,
+          output.particlesFinal, output.hits, output.failedParticles);
+      if (!result.ok()) {
+        output.error = result.error();
+      }
+    });
 
-        ++iinitial;
+    std::vector<FailedParticle> failedParticles;
+    for (Output &output : outputs) {
+      if (output.error) {
+        return output.error;
       }
+      std::ranges::move(output.particlesInitial,
+                        std::back_inserter(simulatedParticlesInitial));
+      std::ranges::move(output.particlesFinal,
+                        std::back_inserter(simulatedParticlesFinal));
+      std::ranges::move(output.hits, std::back_inserter(hits));
+      std::ranges::move(output.failedParticles,
+                        std::back_inserter(failedParticles));
     }
 
     assert(
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) &&
         "Inconsistent final sizes of the simulated particle containers");
 
-    // the overall function call succeeded, i.e. no fatal errors occurred.
-    // yet, there might have been some particle for which the propagation
-    // failed. thus, the successful result contains a list of failed particles.
-    // sounds a bit weird, but that is the way it is.
     return failedParticles;
   }
 
+  /// Simulate a single input particle and its generated secondaries.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param inputParticle is the particle that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param failedParticles contains the particles that failed to simulate
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  ///
+  /// The outputs are appended to the given containers. Nothing is done if the
+  /// particle does not pass the selection. See `simulate` for details.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_t, typename output_particles_t, typename hits_t>
+  Acts::Result<void> simulateParticle(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &inputParticle,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::vector<FailedParticle> &failedParticles) const {
+    // only consider simulatable particles
+    if (!selectParticle(inputParticle)) {
+      return Acts::Result<void>::success();
+    }
+    // required to allow correct particle id numbering for secondaries later
+    if ((inputParticle.particleId().generation() != 0u) ||
+        (inputParticle.particleId().subParticle() != 0u)) {
+      return detail::SimulationError::InvalidInputParticleId;
+    }
+
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are added to and failed
+    //         particles might be removed. To avoid issues, access must always
+    //         occur via indices.
+    std::size_t iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    while (iinitial < simulatedParticlesInitial.size()) {
+      const auto &initialParticle = simulatedParticlesInitial[iinitial];
+
+      // only simulatable particles are pushed to the container and here we
+      // only need to switch between charged/neutral.
+      auto result = Acts::Result<SingleParticleSimulationResult>::success({});
+      if (initialParticle.charge() != 0.) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
+      }
+
+      if (!result.ok()) {
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        // remove particle from output container since it was not simulated.
+        simulatedParticlesInitial.erase(
+            std::next(simulatedParticlesInitial.begin(), iinitial));
+        continue;
+      }
+
+      assert(result->particle.particleId() == initialParticle.particleId() &&
+             "Particle id must not change during simulation");
+
+      copyOutputs(result.value(), simulatedParticlesInitial,
+                  simulatedParticlesFinal, hits);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+
+      ++iinitial;
+    }
+
+    return Acts::Result<void>::success();
+  }
+
  private:
   /// Select if the particle should be simulated at all.
   bool selectParticle(const Particle &particle) const {
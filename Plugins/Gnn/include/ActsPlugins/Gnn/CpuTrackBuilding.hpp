@@ -0,0 +1,66 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsPlugins/Gnn/Stages.hpp"
+
+#include <memory>
+
+namespace ActsPlugins {
+/// @addtogroup gnn_plugin
+/// @{
+
+/// Multi-threaded track building on the CPU
+///
+/// Finds the connected components of the graph with a lock-free parallel
+/// union-find directly on the edge index tensor, without building an
+/// intermediate graph structure. Like @ref CudaTrackBuilding, candidates
+/// with less than @c Config::minCandidateSize nodes are dropped. With
+/// @c minCandidateSize set to 0 the track candidates are the same as those of
+/// @ref BoostTrackBuilding, ordered by their first node.
+class CpuTrackBuilding final : public TrackBuildingBase {
+ public:
+  /// Configuration for CPU track building
+  struct Config {
+    /// Do junction removal: if a node has more than one incoming or outgoing
+    /// edge, only the edge with the largest score is kept
+    bool doJunctionRemoval = false;
+    /// Minimum candidate size, smaller candidates are dropped
+    std::size_t minCandidateSize = 3;
+    /// Number of threads
+    std::size_t numThreads = 1;
+    /// Optional executor for the parallel loops, e.g. an existing TBB task
+    /// arena, used instead of threads started for every event
+    Acts::ParallelExecutor executor;
+  };
+
+  /// Constructor
+  /// @param cfg Configuration object
+  /// @param logger Logger instance
+  CpuTrackBuilding(const Config &cfg,
+                   std::unique_ptr<const Acts::Logger> logger)
+      : m_cfg(cfg), m_logger(std::move(logger)) {}
+
+  std::vector<std::vector<int>> operator()(
+      PipelineTensors tensors, std::vector<int> &spacePointIDs,
+      const ExecutionContext &execContext = {}) override;
+  /// Get configuration
+  /// @return Configuration object
+  const Config &config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+  const auto &logger() const { return *m_logger; }
+};
+
+/// @}
+}  // namespace ActsPlugins
@@ -0,0 +1,193 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsPlugins/Gnn/Stages.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ActsPlugins {
+
+/// @addtogroup gnn_plugin
+/// @{
+
+/// Multi-threaded CPU module map for graph construction
+///
+/// Builds the same kind of graph as @ref ModuleMapCuda on the CPU: the hit
+/// pairs of all module doublets of the module map that pass the doublet cuts
+/// are edge candidates, and only the candidates that are part of at least one
+/// hit triplet passing the triplet cuts become edges of the graph. The
+/// doublets and the triplets are processed in parallel.
+///
+/// The node features are expected to contain r, phi, z and eta in the first
+/// four columns. The selection variables of a hit pair (1, 2) are
+/// - z0 = z1 - r1 * (z2 - z1) / (r2 - r1)
+/// - dphi = phi2 - phi1, wrapped to [-pi, pi)
+/// - phiSlope = dphi / (r2 - r1)
+/// - deta = eta2 - eta1
+/// and those of a hit triplet (1, 2, 3) the differences of the slopes of the
+/// two pairs in the transverse plane (dy/dx) and in the r-z plane (dz/dr).
+///
+/// The module map is either passed in memory or read from two CSV files,
+/// `<prefix>.doublets.csv` and `<prefix>.triplets.csv`, see
+/// @ref readModuleMap for the columns.
+class ModuleMapCpu final : public GraphConstructionBase {
+ public:
+  /// Selection windows of the hit pairs of a module doublet
+  struct DoubletCuts {
+    /// Minimum longitudinal impact parameter
+    float z0Min = 0.f;
+    /// Maximum longitudinal impact parameter
+    float z0Max = 0.f;
+    /// Minimum azimuthal angle difference
+    float dphiMin = 0.f;
+    /// Maximum azimuthal angle difference
+    float dphiMax = 0.f;
+    /// Minimum ratio of azimuthal angle and radius difference
+    float phiSlopeMin = 0.f;
+    /// Maximum ratio of azimuthal angle and radius difference
+    float phiSlopeMax = 0.f;
+    /// Minimum pseudorapidity difference
+    float detaMin = 0.f;
+    /// Maximum pseudorapidity difference
+    float detaMax = 0.f;
+  };
+
+  /// A connection of two modules
+  struct Doublet {
+    /// Module id of the first (inner) module
+    std::uint64_t module1 = 0;
+    /// Module id of the second (outer) module
+    std::uint64_t module2 = 0;
+    /// Selection windows of the hit pairs
+    DoubletCuts cuts;
+  };
+
+  /// A connection of three modules
+  ///
+  /// Both module pairs must also be doublets of the module map.
+  struct Triplet {
+    /// Module id of the first (inner) module
+    std::uint64_t module1 = 0;
+    /// Module id of the second (middle) module
+    std::uint64_t module2 = 0;
+    /// Module id of the third (outer) module
+    std::uint64_t module3 = 0;
+    /// Selection windows of the inner hit pair
+    DoubletCuts cuts12;
+    /// Selection windows of the outer hit pair
+    DoubletCuts cuts23;
+    /// Minimum difference of the transverse slopes of the hit pairs
+    float diffDydxMin = 0.f;
+    /// Maximum difference of the transverse slopes of the hit pairs
+    float diffDydxMax = 0.f;
+    /// Minimum difference of the longitudinal slopes of the hit pairs
+    float diffDzdrMin = 0.f;
+    /// Maximum difference of the longitudinal slopes of the hit pairs
+    float diffDzdrMax = 0.f;
+  };
+
+  /// The module doublets and triplets with their selection windows
+  struct ModuleMap {
+    /// The module doublets
+    std::vector<Doublet> doublets;
+    /// The module triplets
+    std::vector<Triplet> triplets;
+  };
+
+  /// Configuration for ModuleMapCpu
+  struct Config {
+    /// The module map
+    std::shared_ptr<const ModuleMap> moduleMap;
+    /// Path prefix of the module map CSV files, only used if no module map
+    /// is given
+    std::string moduleMapPath;
+    /// Radial coordinate scaling factor
+    float rScale = 1.0;
+    /// Azimuthal coordinate scaling factor
+    float phiScale = 1.0;
+    /// Z-coordinate scaling factor
+    float zScale = 1.0;
+    /// Pseudorapidity scaling factor
+    float etaScale = 1.0;
+
+    /// Number of threads used for the doublet and triplet selection
+    std::size_t numThreads = 1;
+    /// Optional executor for the parallel loops, e.g. an existing TBB task
+    /// arena, used instead of threads started for every event
+    Acts::ParallelExecutor executor;
+
+    /// Small numerical constant for stability
+    float epsilon = 1e-8f;
+  };
+
+  /// Read a module map from CSV files
+  ///
+  /// The doublet file `<prefix>.doublets.csv` has the columns
+  /// `module1,module2,z0_min,z0_max,dphi_min,dphi_max,phi_slope_min,`
+  /// `phi_slope_max,deta_min,deta_max`. The triplet file
+  /// `<prefix>.triplets.csv` has the columns `module1,module2,module3`,
+  /// followed by the doublet cut columns of the inner pair with the suffix
+  /// `_12`, those of the outer pair with the suffix `_23`, and
+  /// `diff_dydx_min,diff_dydx_max,diff_dzdr_min,diff_dzdr_max`.
+  ///
+  /// @param prefix Path prefix of the two files
+  /// @return The module map
+  static std::shared_ptr<const ModuleMap> readModuleMap(
+      const std::string &prefix);
+
+  /// Write a module map to CSV files in the format of @ref readModuleMap
+  ///
+  /// @param moduleMap The module map
+  /// @param prefix Path prefix of the two files
+  static void writeModuleMap(const ModuleMap &moduleMap,
+                             const std::string &prefix);
+
+  /// Constructor
+  /// @param cfg Configuration parameters
+  /// @param logger Logger instance
+  ModuleMapCpu(const Config &cfg, std::unique_ptr<const Acts::Logger> logger);
+
+  /// Access configuration
+  /// @return Configuration reference
+  const auto &config() const { return m_cfg; }
+
+  PipelineTensors operator()(std::vector<float> &inputValues,
+                             std::size_t numNodes,
+                             const std::vector<std::uint64_t> &moduleIds,
+                             const ExecutionContext &execContext = {}) override;
+
+ private:
+  /// Index based copy of the module map
+  struct FlatModuleMap {
+    std::unordered_map<std::uint64_t, int> moduleIndices;
+    std::vector<int> doubletModule1;
+    std::vector<int> doubletModule2;
+    std::vector<DoubletCuts> doubletCuts;
+    std::vector<int> tripletDoublet12;
+    std::vector<int> tripletDoublet23;
+    std::vector<const Triplet *> tripletCuts;
+  };
+
+  FlatModuleMap m_flatMap;
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const auto &logger() const { return *m_logger; }
+};
+
+/// @}
+}  // namespace ActsPlugins
@@ -35,6 +35,8 @@ class OnnxEdgeClassifier final : public EdgeClassificationBase {
     float cut = 0.5;
     /// Device to allocate the model on
     Device device = Device::Cuda();
+    /// Number of threads used by the ONNX runtime within an inference call
+    std::size_t numThreads = 1;
   };
 
   /// Constructor
@@ -56,7 +58,7 @@ class OnnxEdgeClassifier final : public EdgeClassificationBase {
   const auto &logger() const { return *m_logger; }
 
   Config m_cfg;
-  std::unique_ptr<Ort::Env> m_env;
+  std::shared_ptr<Ort::Env> m_env;
   std::unique_ptr<Ort::Session> m_model;
 
   std::vector<std::string> m_inputNames;
@@ -0,0 +1,215 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Gnn/CpuTrackBuilding.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+/// Find the root of a node in a union-find forest that is modified
+/// concurrently, halving the path on the way
+int findRoot(std::vector<int>& parents, int node) {
+  while (true) {
+    int parent = std::atomic_ref<int>(parents[node]).load();
+    if (parent == node) {
+      return node;
+    }
+    const int grandParent = std::atomic_ref<int>(parents[parent]).load();
+    if (grandParent != parent) {
+      // May fail if another thread changed the parent, which is fine
+      std::atomic_ref<int>(parents[node]).compare_exchange_weak(parent,
+                                                                grandParent);
+    }
+    node = grandParent;
+  }
+}
+
+/// Merge the trees of two nodes. The root with the larger index is always
+/// attached to the one with the smaller index, so that no cycles can appear
+/// and the root of a tree is its smallest node.
+void unite(std::vector<int>& parents, int a, int b) {
+  while (true) {
+    a = findRoot(parents, a);
+    b = findRoot(parents, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      std::swap(a, b);
+    }
+    int expected = a;
+    if (std::atomic_ref<int>(parents[a]).compare_exchange_strong(expected, b)) {
+      return;
+    }
+  }
+}
+
+/// Ordering key of an edge for the junction removal: the larger score wins,
+/// and for equal scores the smaller edge index. The scores are expected to be
+/// non-negative, so that their bit patterns are ordered like the values.
+std::uint64_t junctionKey(float score, std::size_t edge) {
+  return (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(score))
+          << 32) |
+         (0xffffffffu - static_cast<std::uint32_t>(edge));
+}
+
+void atomicMax(std::uint64_t& target, std::uint64_t value) {
+  std::atomic_ref<std::uint64_t> ref(target);
+  std::uint64_t current = ref.load(std::memory_order_relaxed);
+  while (current < value && !ref.compare_exchange_weak(
+                                 current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+namespace ActsPlugins {
+
+std::vector<std::vector<int>> CpuTrackBuilding::operator()(
+    PipelineTensors tensors, std::vector<int>& spacePointIds,
+    const ExecutionContext& execContext) {
+  ACTS_DEBUG("Start CPU track building");
+
+  using RTI = const Tensor<std::int64_t>&;
+  const auto& edgeTensor = tensors.edgeIndex.device().isCpu()
+                               ? static_cast<RTI>(tensors.edgeIndex)
+                               : static_cast<RTI>(tensors.edgeIndex.clone(
+                                     {Device::Cpu(), execContext.stream}));
+
+  assert(edgeTensor.shape().at(0) == 2);
+
+  const auto numSpacePoints = spacePointIds.size();
+  const auto numEdges = edgeTensor.shape().at(1);
+  const std::size_t numThreads = m_cfg.numThreads;
+
+  if (numEdges == 0) {
+    ACTS_WARNING("No edges remained after edge classification");
+    return {};
+  }
+
+  const std::int64_t* srcNodes = edgeTensor.data();
+  const std::int64_t* tgtNodes = edgeTensor.data() + numEdges;
+
+  auto ms = [](auto t0, auto t1) {
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+  };
+
+  // Junction removal only marks the edges to keep, the edge tensor itself is
+  // not modified
+  std::vector<std::uint8_t> keepEdge;
+  if (m_cfg.doJunctionRemoval) {
+    assert(tensors.edgeScores.has_value());
+    using RTF = const Tensor<float>&;
+    const auto& scoreTensor = tensors.edgeScores->device().isCpu()
+                                  ? static_cast<RTF>(*tensors.edgeScores)
+                                  : static_cast<RTF>(tensors.edgeScores->clone(
+                                        {Device::Cpu(), execContext.stream}));
+    assert(scoreTensor.shape().at(0) == numEdges);
+    const float* scores = scoreTensor.data();
+
+    ACTS_DEBUG("Do junction removal...");
+    auto t0 = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::uint64_t> bestInEdge(numSpacePoints, 0);
+    std::vector<std::uint64_t> bestOutEdge(numSpacePoints, 0);
+    Acts::parallelForChunks(
+        numEdges, 4096, numThreads,
+        [&](std::size_t begin, std::size_t end) {
+          for (std::size_t i = begin; i < end; ++i) {
+            const std::uint64_t key = junctionKey(scores[i], i);
+            atomicMax(bestOutEdge[srcNodes[i]], key);
+            atomicMax(bestInEdge[tgtNodes[i]], key);
+          }
+        },
+        m_cfg.executor);
+
+    keepEdge.resize(numEdges);
+    Acts::parallelForChunks(
+        numEdges, 4096, numThreads,
+        [&](std::size_t begin, std::size_t end) {
+          for (std::size_t i = begin; i < end; ++i) {
+            const std::uint64_t key = junctionKey(scores[i], i);
+            keepEdge[i] = bestOutEdge[srcNodes[i]] == key &&
+                          bestInEdge[tgtNodes[i]] == key;
+          }
+        },
+        m_cfg.executor);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    ACTS_DEBUG("Removed " << std::ranges::count(keepEdge, 0)
+                          << " edges in junction removal");
+    ACTS_DEBUG("Junction removal took " << ms(t0, t1) << " ms");
+  }
+
+  auto t0 = std::chrono::high_resolution_clock::now();
+
+  std::vector<int> parents(numSpacePoints);
+  std::iota(parents.begin(), parents.end(), 0);
+  Acts::parallelForChunks(
+      numEdges, 4096, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          if (!keepEdge.empty() && keepEdge[i] == 0) {
+            continue;
+          }
+          assert(srcNodes[i] >= 0 && srcNodes[i] < std::ssize(parents));
+          assert(tgtNodes[i] >= 0 && tgtNodes[i] < std::ssize(parents));
+          unite(parents, static_cast<int>(srcNodes[i]),
+                static_cast<int>(tgtNodes[i]));
+        }
+      },
+      m_cfg.executor);
+
+  // After all unions the roots do not change anymore, so the trees can be
+  // flattened in parallel
+  Acts::parallelForChunks(
+      numSpacePoints, 4096, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          const int root = findRoot(parents, static_cast<int>(i));
+          std::atomic_ref<int>(parents[i]).store(root);
+        }
+      },
+      m_cfg.executor);
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+  ACTS_DEBUG("Connected components took " << ms(t0, t1) << " ms");
+
+  // Number the components by their smallest node, which is the root
+  std::vector<int> labels(numSpacePoints);
+  std::size_t numberLabels = 0;
+  for (std::size_t i = 0; i < numSpacePoints; ++i) {
+    labels[i] = static_cast<std::size_t>(parents[i]) == i
+                    ? static_cast<int>(numberLabels++)
+                    : labels[parents[i]];
+  }
+  ACTS_VERBOSE("Found " << numberLabels << " track candidates");
+
+  std::vector<std::vector<int>> trackCandidates(numberLabels);
+  for (std::size_t i = 0; i < numSpacePoints; ++i) {
+    trackCandidates[labels[i]].push_back(spacePointIds[i]);
+  }
+
+  std::erase_if(trackCandidates, [&](const std::vector<int>& candidate) {
+    return candidate.size() < m_cfg.minCandidateSize;
+  });
+
+  return trackCandidates;
+}
+
+}  // namespace ActsPlugins
@@ -0,0 +1,615 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace Acts;
+
+namespace {
+
+constexpr float g_pi = std::numbers::pi_v<float>;
+
+float resetAngle(float angle) {
+  if (angle > g_pi) {
+    return angle - 2.f * g_pi;
+  }
+  if (angle < -g_pi) {
+    return angle + 2.f * g_pi;
+  }
+  return angle;
+}
+
+float safeDivide(float num, float den, float epsilon) {
+  return den == 0.f ? num / epsilon : num / den;
+}
+
+/// Hit coordinates after the feature scaling, one array per coordinate
+struct HitCoordinates {
+  std::vector<float> r, phi, z, eta, x, y;
+
+  explicit HitCoordinates(std::size_t nHits)
+      : r(nHits), phi(nHits), z(nHits), eta(nHits), x(nHits), y(nHits) {}
+};
+
+/// Selection variables of a hit pair
+struct HitPairVariables {
+  float z0 = 0.f;
+  float dphi = 0.f;
+  float phiSlope = 0.f;
+  float deta = 0.f;
+};
+
+HitPairVariables hitPairVariables(const HitCoordinates &hits, int i, int j,
+                                  float epsilon) {
+  const float dr = hits.r[j] - hits.r[i];
+  const float dz = hits.z[j] - hits.z[i];
+
+  HitPairVariables vars;
+  vars.z0 = hits.z[i] - hits.r[i] * safeDivide(dz, dr, epsilon);
+  vars.dphi = resetAngle(hits.phi[j] - hits.phi[i]);
+  vars.phiSlope = safeDivide(vars.dphi, dr, epsilon);
+  vars.deta = hits.eta[j] - hits.eta[i];
+  return vars;
+}
+
+bool passesCuts(const ActsPlugins::ModuleMapCpu::DoubletCuts &cuts,
+                const HitPairVariables &vars) {
+  return vars.z0 >= cuts.z0Min && vars.z0 <= cuts.z0Max &&
+         vars.dphi >= cuts.dphiMin && vars.dphi <= cuts.dphiMax &&
+         vars.phiSlope >= cuts.phiSlopeMin &&
+         vars.phiSlope <= cuts.phiSlopeMax && vars.deta >= cuts.detaMin &&
+         vars.deta <= cuts.detaMax;
+}
+
+/// Same edge features as the CUDA module map, computed from the unscaled
+/// node features
+void makeEdgeFeatures(const float *srcFeatures, const float *tgtFeatures,
+                      float *edgeFeatures) {
+  enum NodeFeatures { r = 0, phi, z, eta };
+
+  const float dr = tgtFeatures[r] - srcFeatures[r];
+  const float dphi =
+      resetAngle(g_pi * (tgtFeatures[phi] - srcFeatures[phi])) / g_pi;
+  const float dz = tgtFeatures[z] - srcFeatures[z];
+  const float deta = tgtFeatures[eta] - srcFeatures[eta];
+  float phislope = 0.f;
+  float rphislope = 0.f;
+
+  if (dr != 0.f) {
+    phislope = std::clamp(dphi / dr, -100.f, 100.f);
+    const float avgR = 0.5f * (tgtFeatures[r] + srcFeatures[r]);
+    rphislope = avgR * phislope;
+  }
+
+  edgeFeatures[0] = dr;
+  edgeFeatures[1] = dphi;
+  edgeFeatures[2] = dz;
+  edgeFeatures[3] = deta;
+  edgeFeatures[4] = phislope;
+  edgeFeatures[5] = rphislope;
+}
+
+using Cuts = ActsPlugins::ModuleMapCpu::DoubletCuts;
+
+constexpr std::array<const char *, 8> g_cutColumns = {
+    "z0_min",        "z0_max",        "dphi_min", "dphi_max",
+    "phi_slope_min", "phi_slope_max", "deta_min", "deta_max"};
+
+constexpr std::array<float Cuts::*, 8> g_cutMembers = {
+    &Cuts::z0Min,       &Cuts::z0Max,       &Cuts::dphiMin, &Cuts::dphiMax,
+    &Cuts::phiSlopeMin, &Cuts::phiSlopeMax, &Cuts::detaMin, &Cuts::detaMax};
+
+std::string doubletHeader() {
+  std::string header = "module1,module2";
+  for (const char *column : g_cutColumns) {
+    header += std::string(",") + column;
+  }
+  return header;
+}
+
+std::string tripletHeader() {
+  std::string header = "module1,module2,module3";
+  for (const char *suffix : {"_12", "_23"}) {
+    for (const char *column : g_cutColumns) {
+      header += std::string(",") + column + suffix;
+    }
+  }
+  header += ",diff_dydx_min,diff_dydx_max,diff_dzdr_min,diff_dzdr_max";
+  return header;
+}
+
+/// Reads the rows of a module map CSV file with a fixed header
+class CsvRowReader {
+ public:
+  CsvRowReader(const std::string &path, const std::string &header)
+      : m_path(path), m_file(path) {
+    if (!m_file) {
+      throw std::runtime_error("Cannot open module map file " + m_path);
+    }
+    std::string line;
+    if (!std::getline(m_file, line) || line != header) {
+      throw std::runtime_error("Unexpected header in module map file " +
+                               m_path + ", expected '" + header + "'");
+    }
+  }
+
+  /// Read the next row, returns false at the end of the file
+  bool next() {
+    std::string line;
+    do {
+      if (!std::getline(m_file, line)) {
+        return false;
+      }
+      ++m_lineNumber;
+    } while (line.empty());
+    m_row.clear();
+    m_row.str(line);
+    return true;
+  }
+
+  std::uint64_t readModule() {
+    std::uint64_t value = 0;
+    readField(value);
+    return value;
+  }
+
+  float readFloat() {
+    float value = 0.f;
+    readField(value);
+    return value;
+  }
+
+  void readCuts(Cuts &cuts) {
+    for (float Cuts::*member : g_cutMembers) {
+      cuts.*member = readFloat();
+    }
+  }
+
+ private:
+  template <typename T>
+  void readField(T &value) {
+    std::string field;
+    if (!std::getline(m_row, field, ',') ||
+        !(std::istringstream(field) >> value)) {
+      throw std::runtime_error("Invalid field in module map file " + m_path +
+                               " line " + std::to_string(m_lineNumber + 1));
+    }
+  }
+
+  std::string m_path;
+  std::ifstream m_file;
+  std::istringstream m_row;
+  std::size_t m_lineNumber = 0;
+};
+
+std::ofstream openForWriting(const std::string &path,
+                             const std::string &header) {
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot open module map file " + path);
+  }
+  file << std::setprecision(std::numeric_limits<float>::max_digits10);
+  file << header << '\n';
+  return file;
+}
+
+void writeCuts(std::ostream &os, const Cuts &cuts) {
+  for (float Cuts::*member : g_cutMembers) {
+    os << ',' << cuts.*member;
+  }
+}
+
+}  // namespace
+
+namespace ActsPlugins {
+
+std::shared_ptr<const ModuleMapCpu::ModuleMap> ModuleMapCpu::readModuleMap(
+    const std::string &prefix) {
+  auto moduleMap = std::make_shared<ModuleMap>();
+
+  CsvRowReader doublets(prefix + ".doublets.csv", doubletHeader());
+  while (doublets.next()) {
+    Doublet &doublet = moduleMap->doublets.emplace_back();
+    doublet.module1 = doublets.readModule();
+    doublet.module2 = doublets.readModule();
+    doublets.readCuts(doublet.cuts);
+  }
+
+  CsvRowReader triplets(prefix + ".triplets.csv", tripletHeader());
+  while (triplets.next()) {
+    Triplet &triplet = moduleMap->triplets.emplace_back();
+    triplet.module1 = triplets.readModule();
+    triplet.module2 = triplets.readModule();
+    triplet.module3 = triplets.readModule();
+    triplets.readCuts(triplet.cuts12);
+    triplets.readCuts(triplet.cuts23);
+    triplet.diffDydxMin = triplets.readFloat();
+    triplet.diffDydxMax = triplets.readFloat();
+    triplet.diffDzdrMin = triplets.readFloat();
+    triplet.diffDzdrMax = triplets.readFloat();
+  }
+
+  return moduleMap;
+}
+
+void ModuleMapCpu::writeModuleMap(const ModuleMap &moduleMap,
+                                  const std::string &prefix) {
+  std::ofstream doublets =
+      openForWriting(prefix + ".doublets.csv", doubletHeader());
+  for (const Doublet &doublet : moduleMap.doublets) {
+    doublets << doublet.module1 << ',' << doublet.module2;
+    writeCuts(doublets, doublet.cuts);
+    doublets << '\n';
+  }
+
+  std::ofstream triplets =
+      openForWriting(prefix + ".triplets.csv", tripletHeader());
+  for (const Triplet &triplet : moduleMap.triplets) {
+    triplets << triplet.module1 << ',' << triplet.module2 << ','
+             << triplet.module3;
+    writeCuts(triplets, triplet.cuts12);
+    writeCuts(triplets, triplet.cuts23);
+    triplets << ',' << triplet.diffDydxMin << ',' << triplet.diffDydxMax << ','
+             << triplet.diffDzdrMin << ',' << triplet.diffDzdrMax << '\n';
+  }
+}
+
+ModuleMapCpu::ModuleMapCpu(const Config &cfg,
+                           std::unique_ptr<const Logger> logger_)
+    : m_cfg(cfg), m_logger(std::move(logger_)) {
+  if (m_cfg.moduleMap == nullptr && !m_cfg.moduleMapPath.empty()) {
+    ACTS_INFO("Read module map from " << m_cfg.moduleMapPath);
+    m_cfg.moduleMap = readModuleMap(m_cfg.moduleMapPath);
+  }
+  if (m_cfg.moduleMap == nullptr) {
+    throw std::invalid_argument("Missing module map");
+  }
+
+  auto moduleIndex = [&](std::uint64_t moduleId) {
+    auto [it, inserted] = m_flatMap.moduleIndices.try_emplace(
+        moduleId, static_cast<int>(m_flatMap.moduleIndices.size()));
+    return it->second;
+  };
+
+  auto doubletKey = [](int module1, int module2) {
+    return (static_cast<std::uint64_t>(module1) << 32) |
+           static_cast<std::uint32_t>(module2);
+  };
+
+  std::unordered_map<std::uint64_t, int> doubletIndices;
+  for (const Doublet &doublet : m_cfg.moduleMap->doublets) {
+    const int module1 = moduleIndex(doublet.module1);
+    const int module2 = moduleIndex(doublet.module2);
+    auto [it, inserted] = doubletIndices.try_emplace(
+        doubletKey(module1, module2),
+        static_cast<int>(m_flatMap.doubletModule1.size()));
+    if (!inserted) {
+      throw std::invalid_argument("Duplicate doublet in module map");
+    }
+    m_flatMap.doubletModule1.push_back(module1);
+    m_flatMap.doubletModule2.push_back(module2);
+    m_flatMap.doubletCuts.push_back(doublet.cuts);
+  }
+
+  auto findDoublet = [&](std::uint64_t moduleId1, std::uint64_t moduleId2) {
+    auto it1 = m_flatMap.moduleIndices.find(moduleId1);
+    auto it2 = m_flatMap.moduleIndices.find(moduleId2);
+    if (it1 != m_flatMap.moduleIndices.end() &&
+        it2 != m_flatMap.moduleIndices.end()) {
+      auto it = doubletIndices.find(doubletKey(it1->second, it2->second));
+      if (it != doubletIndices.end()) {
+        return it->second;
+      }
+    }
+    throw std::invalid_argument("Module map triplet without doublet");
+  };
+
+  for (const Triplet &triplet : m_cfg.moduleMap->triplets) {
+    m_flatMap.tripletDoublet12.push_back(
+        findDoublet(triplet.module1, triplet.module2));
+    m_flatMap.tripletDoublet23.push_back(
+        findDoublet(triplet.module2, triplet.module3));
+    m_flatMap.tripletCuts.push_back(&triplet);
+  }
+
+  ACTS_DEBUG("# of modules = " << m_flatMap.moduleIndices.size());
+  ACTS_DEBUG("# of doublets = " << m_flatMap.doubletModule1.size());
+  ACTS_DEBUG("# of triplets = " << m_flatMap.tripletDoublet12.size());
+}
+
+PipelineTensors ModuleMapCpu::operator()(
+    std::vector<float> &inputValues, std::size_t /*numNodes*/,
+    const std::vector<std::uint64_t> &moduleIds,
+    const ExecutionContext &execContext) {
+  auto t0 = std::chrono::high_resolution_clock::now();
+
+  if (moduleIds.empty()) {
+    throw NoEdgesError{};
+  }
+
+  const auto nHits = moduleIds.size();
+  assert(inputValues.size() % moduleIds.size() == 0);
+  const auto nFeatures = inputValues.size() / moduleIds.size();
+  if (nFeatures < 4) {
+    throw std::invalid_argument(
+        "ModuleMapCpu needs at least r, phi, z and eta as node features");
+  }
+  const float epsilon = m_cfg.epsilon;
+  const std::size_t numThreads = m_cfg.numThreads;
+
+  /////////////////////////
+  // Prepare input data
+  ////////////////////////
+
+  HitCoordinates hits(nHits);
+  std::vector<int> hitModules(nHits);
+  Acts::parallelForChunks(
+      nHits, 4096, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          const float *features = inputValues.data() + i * nFeatures;
+          hits.r[i] = m_cfg.rScale * features[0];
+          hits.phi[i] = m_cfg.phiScale * features[1];
+          hits.z[i] = m_cfg.zScale * features[2];
+          hits.eta[i] = m_cfg.etaScale * features[3];
+          hits.x[i] = hits.r[i] * std::cos(hits.phi[i]);
+          hits.y[i] = hits.r[i] * std::sin(hits.phi[i]);
+
+          auto it = m_flatMap.moduleIndices.find(moduleIds[i]);
+          hitModules[i] =
+              it != m_flatMap.moduleIndices.end() ? it->second : -1;
+        }
+      },
+      m_cfg.executor);
+
+  // Group the hits by module, keeping the hit order within a module. Hits on
+  // modules that are not in the module map cannot have edges.
+  const std::size_t nModules = m_flatMap.moduleIndices.size();
+  std::vector<int> moduleOffsets(nModules + 1, 0);
+  for (int module : hitModules) {
+    if (module >= 0) {
+      ++moduleOffsets[module + 1];
+    }
+  }
+  std::partial_sum(moduleOffsets.begin(), moduleOffsets.end(),
+                   moduleOffsets.begin());
+  std::vector<int> moduleHits(moduleOffsets.back());
+  {
+    std::vector<int> fill(moduleOffsets.begin(), moduleOffsets.end() - 1);
+    for (std::size_t i = 0; i < nHits; ++i) {
+      if (hitModules[i] >= 0) {
+        moduleHits[fill[hitModules[i]]++] = static_cast<int>(i);
+      }
+    }
+  }
+  ACTS_VERBOSE("Hits on module map modules: " << moduleHits.size());
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+
+  ///////////////////////////////////
+  // Doublet selection
+  ////////////////////////////////////
+
+  // Calls func(hit1, hit2, variables) for all hit pairs of a doublet that pass
+  // the doublet cuts, ordered by the first hit
+  auto forEachDoubletEdge = [&](std::size_t doublet, auto &&func) {
+    const int module1 = m_flatMap.doubletModule1[doublet];
+    const int module2 = m_flatMap.doubletModule2[doublet];
+    const DoubletCuts &cuts = m_flatMap.doubletCuts[doublet];
+    for (int k = moduleOffsets[module1]; k < moduleOffsets[module1 + 1]; ++k) {
+      const int hit1 = moduleHits[k];
+      for (int l = moduleOffsets[module2]; l < moduleOffsets[module2 + 1];
+           ++l) {
+        const int hit2 = moduleHits[l];
+        const HitPairVariables vars =
+            hitPairVariables(hits, hit1, hit2, epsilon);
+        if (passesCuts(cuts, vars)) {
+          func(hit1, hit2, vars);
+        }
+      }
+    }
+  };
+
+  // As in the CUDA implementation, the edges are counted first so that each
+  // doublet can write its edges to its own part of the edge arrays
+  const std::size_t nDoublets = m_flatMap.doubletModule1.size();
+  std::vector<std::size_t> doubletOffsets(nDoublets + 1, 0);
+  Acts::parallelForChunks(
+      nDoublets, 64, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t d = begin; d < end; ++d) {
+          std::size_t nEdges = 0;
+          forEachDoubletEdge(d, [&](int, int, const HitPairVariables &) {
+            ++nEdges;
+          });
+          doubletOffsets[d + 1] = nEdges;
+        }
+      },
+      m_cfg.executor);
+  std::partial_sum(doubletOffsets.begin(), doubletOffsets.end(),
+                   doubletOffsets.begin());
+
+  const std::size_t nDoubletEdges = doubletOffsets.back();
+  ACTS_DEBUG("nb_doublet_edges: " << nDoubletEdges);
+  if (nDoubletEdges == 0) {
+    throw NoEdgesError{};
+  }
+
+  std::vector<int> srcHits(nDoubletEdges);
+  std::vector<int> tgtHits(nDoubletEdges);
+  std::vector<HitPairVariables> edgeVars(nDoubletEdges);
+  Acts::parallelForChunks(
+      nDoublets, 64, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t d = begin; d < end; ++d) {
+          std::size_t iEdge = doubletOffsets[d];
+          forEachDoubletEdge(
+              d, [&](int hit1, int hit2, const HitPairVariables &vars) {
+                srcHits[iEdge] = hit1;
+                tgtHits[iEdge] = hit2;
+                edgeVars[iEdge] = vars;
+                ++iEdge;
+              });
+        }
+      },
+      m_cfg.executor);
+
+  ///////////////////////////////////
+  // Triplet selection
+  ////////////////////////////////////
+
+  // Several triplets can select the same edge, but they only ever set the
+  // flag to true
+  std::vector<std::uint8_t> edgeSelected(nDoubletEdges, 0);
+  auto selectEdge = [&](std::size_t iEdge) {
+    std::atomic_ref<std::uint8_t>(edgeSelected[iEdge])
+        .store(1, std::memory_order_relaxed);
+  };
+
+  const std::size_t nTriplets = m_flatMap.tripletDoublet12.size();
+  Acts::parallelForChunks(
+      nTriplets, 16, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+          const Triplet &triplet = *m_flatMap.tripletCuts[t];
+          const int doublet12 = m_flatMap.tripletDoublet12[t];
+          const int doublet23 = m_flatMap.tripletDoublet23[t];
+
+          // The edges of a doublet are sorted by their first hit
+          const auto src23Begin = srcHits.begin() + doubletOffsets[doublet23];
+          const auto src23End = srcHits.begin() + doubletOffsets[doublet23 + 1];
+          if (src23Begin == src23End) {
+            continue;
+          }
+
+          for (std::size_t p = doubletOffsets[doublet12];
+               p < doubletOffsets[doublet12 + 1]; ++p) {
+            if (!passesCuts(triplet.cuts12, edgeVars[p])) {
+              continue;
+            }
+            const int hit1 = srcHits[p];
+            const int hit2 = tgtHits[p];
+            const float dydx12 = safeDivide(hits.y[hit2] - hits.y[hit1],
+                                            hits.x[hit2] - hits.x[hit1],
+                                            epsilon);
+            const float dzdr12 = safeDivide(hits.z[hit2] - hits.z[hit1],
+                                            hits.r[hit2] - hits.r[hit1],
+                                            epsilon);
+
+            bool selected = false;
+            const auto [lower, upper] =
+                std::equal_range(src23Begin, src23End, hit2);
+            for (auto it = lower; it != upper; ++it) {
+              const auto l = static_cast<std::size_t>(it - srcHits.begin());
+              if (!passesCuts(triplet.cuts23, edgeVars[l])) {
+                continue;
+              }
+              const int hit3 = tgtHits[l];
+              const float diffDydx =
+                  dydx12 - safeDivide(hits.y[hit3] - hits.y[hit2],
+                                      hits.x[hit3] - hits.x[hit2], epsilon);
+              if (diffDydx < triplet.diffDydxMin ||
+                  diffDydx > triplet.diffDydxMax) {
+                continue;
+              }
+              const float diffDzdr =
+                  dzdr12 - safeDivide(hits.z[hit3] - hits.z[hit2],
+                                      hits.r[hit3] - hits.r[hit2], epsilon);
+              if (diffDzdr < triplet.diffDzdrMin ||
+                  diffDzdr > triplet.diffDzdrMax) {
+                continue;
+              }
+              selectEdge(l);
+              selected = true;
+            }
+            if (selected) {
+              selectEdge(p);
+            }
+          }
+        }
+      },
+      m_cfg.executor);
+
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  //----------------
+  // edges reduction
+  //----------------
+
+  std::vector<std::size_t> graphEdges;
+  for (std::size_t i = 0; i < nDoubletEdges; ++i) {
+    if (edgeSelected[i] != 0) {
+      graphEdges.push_back(i);
+    }
+  }
+  const std::size_t nGraphEdges = graphEdges.size();
+  ACTS_DEBUG("nb_graph_edges: " << nGraphEdges);
+  if (nGraphEdges == 0) {
+    throw NoEdgesError{};
+  }
+
+  const ExecutionContext cpuContext{Device::Cpu(), {}};
+
+  auto nodeFeatures = Tensor<float>::Create({nHits, nFeatures}, cpuContext);
+  std::copy(inputValues.begin(), inputValues.end(), nodeFeatures.data());
+
+  auto edgeIndex = Tensor<std::int64_t>::Create({2, nGraphEdges}, cpuContext);
+  auto edgeFeatures = Tensor<float>::Create({nGraphEdges, 6}, cpuContext);
+  Acts::parallelForChunks(
+      nGraphEdges, 4096, numThreads,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          const int src = srcHits[graphEdges[i]];
+          const int tgt = tgtHits[graphEdges[i]];
+          edgeIndex.data()[i] = src;
+          edgeIndex.data()[nGraphEdges + i] = tgt;
+          makeEdgeFeatures(inputValues.data() + src * nFeatures,
+                           inputValues.data() + tgt * nFeatures,
+                           edgeFeatures.data() + i * 6);
+        }
+      },
+      m_cfg.executor);
+
+  auto t3 = std::chrono::high_resolution_clock::now();
+
+  auto ms = [](auto a, auto b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+  };
+  ACTS_DEBUG("Preparation: " << ms(t0, t1));
+  ACTS_DEBUG("Inference: " << ms(t1, t2));
+  ACTS_DEBUG("Postprocessing: " << ms(t2, t3));
+
+  if (!execContext.device.isCpu()) {
+    return {nodeFeatures.clone(execContext),
+            edgeIndex.clone(execContext),
+            edgeFeatures.clone(execContext),
+            {}};
+  }
+
+  return {std::move(nodeFeatures),
+          std::move(edgeIndex),
+          std::move(edgeFeatures),
+          {}};
+}
+
+}  // namespace ActsPlugins
@@ -8,6 +8,8 @@
 
 #include "ActsPlugins/Gnn/OnnxEdgeClassifier.hpp"
 
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+
 #include <boost/container/static_vector.hpp>
 #include <onnxruntime_cxx_api.h>
 
@@ -68,10 +70,13 @@ OnnxEdgeClassifier::OnnxEdgeClassifier(const Config &cfg,
       throw std::runtime_error("Invalid log level");
   }
 
-  m_env = std::make_unique<Ort::Env>(onnxLevel, "Gnn - edge classifier");
+  // There can only be one environment per process, so the verbosity is set
+  // for the session
+  m_env = OnnxInferenceService::environment();
 
   Ort::SessionOptions sessionOptions;
-  sessionOptions.SetIntraOpNumThreads(1);
+  sessionOptions.SetLogSeverityLevel(static_cast<int>(onnxLevel));
+  sessionOptions.SetIntraOpNumThreads(static_cast<int>(m_cfg.numThreads));
   sessionOptions.SetGraphOptimizationLevel(
       GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
   sessionOptions.SetExecutionMode(ORT_SEQUENTIAL);
@@ -0,0 +1,148 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsPlugins/Json/TrackingGeometryJsonConverter.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Acts {
+
+class TrackingGeometry;
+
+/// @addtogroup json_plugin
+/// @{
+
+/// @brief Compact binary snapshots of fully built tracking geometries
+///
+/// A snapshot holds the output of the @ref TrackingGeometryJsonConverter,
+/// i.e. volumes, portals, surfaces, navigation policies as well as surface
+/// and volume material, in the binary CBOR encoding. The payload is preceded
+/// by a small header with a format version and a hash of the sources the
+/// geometry was built from, e.g. the geometry module library and its
+/// configuration files. Loading a snapshot skips the geometry construction
+/// and the material decoration, which makes it suitable as a cache for many
+/// short jobs which build the same geometry.
+///
+/// @note The transforms are stored as evaluated in the geometry context used
+///       for writing, and the surfaces of a loaded snapshot are not attached
+///       to detector elements.
+namespace TrackingGeometrySnapshot {
+
+/// @brief Compute the hash identifying the sources of a geometry
+///
+/// @param sources files the geometry is built from
+///
+/// @return hash of the file contents
+std::uint64_t sourceHash(const std::vector<std::filesystem::path>& sources);
+
+/// @brief Read the source hash stored in a snapshot
+///
+/// @param path snapshot file
+///
+/// @return the source hash, or nothing if the file does not exist or is not
+///         a snapshot of the supported format version
+std::optional<std::uint64_t> readSourceHash(const std::filesystem::path& path);
+
+/// @brief Write a tracking geometry snapshot
+///
+/// @param path output file
+/// @param gctx geometry context to evaluate the transforms in
+/// @param geometry tracking geometry to store
+/// @param sourceHash hash of the geometry sources, see @ref sourceHash
+/// @param converter converter used to encode the geometry
+void write(const std::filesystem::path& path, const GeometryContext& gctx,
+           const TrackingGeometry& geometry, std::uint64_t sourceHash,
+           const TrackingGeometryJsonConverter& converter =
+               TrackingGeometryJsonConverter{});
+
+/// @brief Read a tracking geometry snapshot
+///
+/// Throws if the file is not a valid snapshot or if it was written for
+/// different geometry sources.
+///
+/// @param path input file
+/// @param gctx geometry context
+/// @param expectedSourceHash hash of the geometry sources, see @ref sourceHash
+/// @param converter converter used to decode the geometry
+///
+/// @return the stored tracking geometry
+std::shared_ptr<TrackingGeometry> read(
+    const std::filesystem::path& path, const GeometryContext& gctx,
+    std::uint64_t expectedSourceHash,
+    const TrackingGeometryJsonConverter& converter =
+        TrackingGeometryJsonConverter{});
+
+/// @brief Build a tracking geometry with a snapshot as fast path
+///
+/// If the snapshot exists and matches the hash of the sources, the geometry
+/// is read from it. Otherwise it is built with @p build and the snapshot is
+/// (re)written, so that subsequent jobs can use it. Failures to read or write
+/// the snapshot are reported but do not prevent the geometry from being
+/// built.
+///
+/// This works with any geometry loader, e.g. for a DD4hep geometry module
+/// @code
+/// auto geometry = TrackingGeometrySnapshot::load(
+///     snapshotPath, {modulePath, compactFile},
+///     [&]() {
+///       auto detector = dd4hep::Detector::make_unique("detector");
+///       detector->fromCompact(compactFile.string());
+///       return loadDD4hepGeometryModule(modulePath, *detector, logger);
+///     },
+///     gctx, logger);
+/// @endcode
+/// where the DD4hep detector is only constructed if there is no valid
+/// snapshot.
+///
+/// @param snapshotPath path to the snapshot file
+/// @param sources all files the geometry is built from, e.g. the module
+///        library and the configuration, XML or GDML files it reads
+/// @param build callable building the geometry if there is no valid snapshot
+/// @param gctx geometry context
+/// @param logger logger instance
+///
+/// @return the tracking geometry
+std::shared_ptr<TrackingGeometry> load(
+    const std::filesystem::path& snapshotPath,
+    const std::vector<std::filesystem::path>& sources,
+    const std::function<std::shared_ptr<TrackingGeometry>()>& build,
+    const GeometryContext& gctx, const Logger& logger = getDummyLogger());
+
+/// @brief Load a geometry module with a snapshot as fast path
+///
+/// Uses @ref load with @ref Acts::loadGeometryModule to build the geometry.
+/// The snapshot is validated against the module library and the
+/// @p extraSources.
+///
+/// @param modulePath path to the geometry module shared library
+/// @param snapshotPath path to the snapshot file
+/// @param gctx geometry context
+/// @param extraSources further files the module reads to build the geometry
+/// @param logger logger instance
+///
+/// @return the tracking geometry
+std::shared_ptr<TrackingGeometry> loadGeometryModule(
+    const std::filesystem::path& modulePath,
+    const std::filesystem::path& snapshotPath, const GeometryContext& gctx,
+    const std::vector<std::filesystem::path>& extraSources = {},
+    const Logger& logger = getDummyLogger());
+
+}  // namespace TrackingGeometrySnapshot
+
+/// @}
+
+}  // namespace Acts
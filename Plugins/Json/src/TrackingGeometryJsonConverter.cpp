@@ -24,6 +24,7 @@
 #include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
 #include "Acts/Geometry/TrivialPortalLink.hpp"
 #include "Acts/Geometry/VolumeBounds.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
 #include "Acts/Navigation/INavigationPolicy.hpp"
 #include "Acts/Navigation/MultiNavigationPolicy.hpp"
 #include "Acts/Navigation/SurfaceArrayNavigationPolicy.hpp"
@@ -37,6 +38,7 @@
 #include "ActsPlugins/Json/AlgebraJsonConverter.hpp"
 #include "ActsPlugins/Json/GeometryIdentifierJsonConverter.hpp"
 #include "ActsPlugins/Json/GridJsonConverter.hpp"
+#include "ActsPlugins/Json/MaterialJsonConverter.hpp"
 #include "ActsPlugins/Json/SurfaceJsonConverter.hpp"
 #include "ActsPlugins/Json/UtilitiesJsonConverter.hpp"
 
@@ -161,6 +163,7 @@ constexpr const char* kAlongNormalKey = "along_normal";
 constexpr const char* kOppositeNormalKey = "opposite_normal";
 
 constexpr const char* kNavigationPolicyKey = "navigation_policy";
+constexpr const char* kMaterialKey = "material";
 
 constexpr const char* kKindKey = "kind";
 constexpr const char* kValuesKey = "values";
@@ -569,6 +572,7 @@ struct VolumeRecord {
   std::vector<std::size_t> portalIds;
   std::vector<std::size_t> surfaceIds;
   nlohmann::json navigationPolicy;
+  nlohmann::json material;
 };
 
 // -------------------------------------------------------------------
@@ -879,6 +883,18 @@ nlohmann::json Acts::TrackingGeometryJsonConverter::trackingVolumeToJson(
       jVolume[kSurfaceIdKey].push_back(surfaceIds.at(surface));
     }
 
+    if (const IVolumeMaterial* material = volume->volumeMaterial();
+        material != nullptr) {
+      nlohmann::json jMaterial(material);
+      // The material converter leaves the key out for types it does not
+      // support, which would be read back as proto material
+      if (!jMaterial.contains(kMaterialKey)) {
+        throw std::invalid_argument("Unsupported volume material type in " +
+                                    volume->volumeName());
+      }
+      jVolume[kMaterialKey] = std::move(jMaterial[kMaterialKey]);
+    }
+
     encoded[kVolumesKey].push_back(std::move(jVolume));
   }
 
@@ -937,6 +953,9 @@ Acts::TrackingGeometryJsonConverter::trackingVolumeFromJson(
     record.surfaceIds =
         jVolume.value(kSurfaceIdKey, std::vector<std::size_t>{});
     record.navigationPolicy = jVolume.at(kNavigationPolicyKey);
+    if (jVolume.contains(kMaterialKey)) {
+      record.material[kMaterialKey] = jVolume.at(kMaterialKey);
+    }
 
     if (!jVolume["geometry_id"].is_null()) {
       GeometryIdentifier geoID =
@@ -1071,6 +1090,13 @@ Acts::TrackingGeometryJsonConverter::trackingVolumeFromJson(
 
     volume->setNavigationPolicy(navigationPolicyFromJson(
         gctx, record.navigationPolicy, *volume, *logger));
+
+    if (!record.material.is_null()) {
+      const IVolumeMaterial* material = nullptr;
+      from_json(record.material, material);
+      volume->assignVolumeMaterial(
+          std::shared_ptr<const IVolumeMaterial>(material));
+    }
   }
 
   auto root = std::move(volumeStorage.at(rootVolumeId));
@@ -0,0 +1,218 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Json/TrackingGeometrySnapshot.hpp"
+
+#include "Acts/Geometry/GeometryModuleLoader.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+// File layout:
+// - 8 byte magic
+// - 4 byte format version
+// - 8 byte source hash
+// - 8 byte payload size
+// - CBOR encoded geometry payload
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                        'G', 'E', 'O', 'S'};
+constexpr std::uint32_t kFormatVersion = 1;
+
+struct Header {
+  std::uint32_t version = 0;
+  std::uint64_t sourceHash = 0;
+  std::uint64_t payloadSize = 0;
+};
+
+template <typename value_t>
+void writeValue(std::ostream& out, const value_t& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value_t));
+}
+
+template <typename value_t>
+bool readValue(std::istream& in, value_t& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(value_t));
+  return in.good();
+}
+
+std::optional<Header> readHeader(std::istream& in) {
+  std::array<char, kMagic.size()> magic{};
+  in.read(magic.data(), magic.size());
+  if (!in.good() || magic != kMagic) {
+    return std::nullopt;
+  }
+  Header header;
+  if (!readValue(in, header.version) || header.version != kFormatVersion ||
+      !readValue(in, header.sourceHash) ||
+      !readValue(in, header.payloadSize)) {
+    return std::nullopt;
+  }
+  return header;
+}
+
+// Incremental FNV-1a 64bit hash
+void hashBytes(std::uint64_t& hash, const char* data, std::size_t size) {
+  constexpr std::uint64_t fnvPrime = 0x100000001b3ULL;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i]));
+    hash *= fnvPrime;
+  }
+}
+
+}  // namespace
+
+namespace Acts::TrackingGeometrySnapshot {
+
+std::uint64_t sourceHash(const std::vector<std::filesystem::path>& sources) {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  std::vector<char> buffer(1 << 16);
+  for (const auto& source : sources) {
+    std::ifstream in(source, std::ios::binary);
+    if (!in.good()) {
+      throw std::runtime_error(
+          std::format("Cannot read geometry source '{}'", source.string()));
+    }
+    while (in.good()) {
+      in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      hashBytes(hash, buffer.data(), static_cast<std::size_t>(in.gcount()));
+    }
+  }
+  return hash;
+}
+
+std::optional<std::uint64_t> readSourceHash(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.good()) {
+    return std::nullopt;
+  }
+  auto header = readHeader(in);
+  if (!header.has_value()) {
+    return std::nullopt;
+  }
+  return header->sourceHash;
+}
+
+void write(const std::filesystem::path& path, const GeometryContext& gctx,
+           const TrackingGeometry& geometry, std::uint64_t sourceHash,
+           const TrackingGeometryJsonConverter& converter) {
+  const std::vector<std::uint8_t> payload =
+      nlohmann::json::to_cbor(converter.toJson(gctx, geometry));
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out.good()) {
+    throw std::runtime_error(std::format(
+        "Cannot open geometry snapshot '{}' for writing", path.string()));
+  }
+  out.write(kMagic.data(), kMagic.size());
+  writeValue(out, kFormatVersion);
+  writeValue(out, sourceHash);
+  writeValue(out, static_cast<std::uint64_t>(payload.size()));
+  out.write(reinterpret_cast<const char*>(payload.data()),
+            static_cast<std::streamsize>(payload.size()));
+  if (!out.good()) {
+    throw std::runtime_error(
+        std::format("Failed to write geometry snapshot '{}'", path.string()));
+  }
+}
+
+std::shared_ptr<TrackingGeometry> read(
+    const std::filesystem::path& path, const GeometryContext& gctx,
+    std::uint64_t expectedSourceHash,
+    const TrackingGeometryJsonConverter& converter) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.good()) {
+    throw std::runtime_error(
+        std::format("Cannot open geometry snapshot '{}'", path.string()));
+  }
+  auto header = readHeader(in);
+  if (!header.has_value()) {
+    throw std::runtime_error(std::format(
+        "'{}' is not a geometry snapshot of format version {}", path.string(),
+        kFormatVersion));
+  }
+  if (header->sourceHash != expectedSourceHash) {
+    throw std::runtime_error(std::format(
+        "Geometry snapshot '{}' was written for different geometry sources",
+        path.string()));
+  }
+
+  std::vector<std::uint8_t> payload(header->payloadSize);
+  in.read(reinterpret_cast<char*>(payload.data()),
+          static_cast<std::streamsize>(payload.size()));
+  if (static_cast<std::uint64_t>(in.gcount()) != header->payloadSize) {
+    throw std::runtime_error(
+        std::format("Geometry snapshot '{}' is truncated", path.string()));
+  }
+
+  return converter.fromJson(gctx, nlohmann::json::from_cbor(payload));
+}
+
+std::shared_ptr<TrackingGeometry> load(
+    const std::filesystem::path& snapshotPath,
+    const std::vector<std::filesystem::path>& sources,
+    const std::function<std::shared_ptr<TrackingGeometry>()>& build,
+    const GeometryContext& gctx, const Logger& logger) {
+  const std::uint64_t hash = sourceHash(sources);
+
+  if (readSourceHash(snapshotPath) == hash) {
+    try {
+      auto geometry = read(snapshotPath, gctx, hash);
+      ACTS_INFO("Loaded tracking geometry from snapshot "
+                << snapshotPath.string());
+      return geometry;
+    } catch (const std::exception& e) {
+      ACTS_WARNING("Failed to read geometry snapshot "
+                   << snapshotPath.string() << ": " << e.what());
+    }
+  } else {
+    ACTS_INFO("No valid geometry snapshot " << snapshotPath.string());
+  }
+
+  auto geometry = build();
+
+  // Write to a unique temporary file first and move it into place, so that
+  // concurrent jobs never see a partially written snapshot
+  std::filesystem::path tmpPath = snapshotPath;
+  tmpPath += std::format(".{:x}.tmp", std::random_device{}());
+  try {
+    write(tmpPath, gctx, *geometry, hash);
+    std::filesystem::rename(tmpPath, snapshotPath);
+    ACTS_INFO("Wrote geometry snapshot " << snapshotPath.string());
+  } catch (const std::exception& e) {
+    ACTS_WARNING("Failed to write geometry snapshot "
+                 << snapshotPath.string() << ": " << e.what());
+    std::error_code ec;
+    std::filesystem::remove(tmpPath, ec);
+  }
+
+  return geometry;
+}
+
+std::shared_ptr<TrackingGeometry> loadGeometryModule(
+    const std::filesystem::path& modulePath,
+    const std::filesystem::path& snapshotPath, const GeometryContext& gctx,
+    const std::vector<std::filesystem::path>& extraSources,
+    const Logger& logger) {
+  std::vector<std::filesystem::path> sources = {modulePath};
+  sources.insert(sources.end(), extraSources.begin(), extraSources.end());
+
+  return load(
+      snapshotPath, sources,
+      [&]() { return Acts::loadGeometryModule(modulePath, logger); }, gctx,
+      logger);
+}
+
+}  // namespace Acts::TrackingGeometrySnapshot
@@ -14,9 +14,11 @@
 #include "Acts/EventData/TrackProxyConcept.hpp"
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -31,10 +33,23 @@ class AmbiguityTrackClassifier {
  public:
   /// Construct the ambiguity scoring algorithm.
   ///
+  /// The model runs in its own session, which can be called concurrently.
+  ///
   /// @param modelPath path to the model file
   explicit AmbiguityTrackClassifier(const char* modelPath)
-      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {}
+      : m_env(OnnxInferenceService::environment()),
+        m_runtime(std::make_unique<OnnxRuntimeBase>(*m_env, modelPath)) {}
+
+  /// Construct the scoring algorithm with a given inference service.
+  ///
+  /// The inference requests of concurrent callers are combined into batches
+  /// by the service.
+  ///
+  /// @param modelPath path to the model file
+  /// @param service the inference service running the model
+  AmbiguityTrackClassifier(const char* modelPath,
+                           const std::shared_ptr<OnnxInferenceService>& service)
+      : m_model(service->loadModel(modelPath)) {}
 
   /// Compute a score for each track to be used in the track selection
   ///
@@ -74,7 +89,8 @@ class AmbiguityTrackClassifier {
     }
     // Use the network to compute a score for all the tracks.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_model != nullptr ? m_model->infer(networkInput)
+                           : m_runtime->runONNXInference(networkInput);
     return outputTensor;
   }
 
@@ -106,10 +122,13 @@ class AmbiguityTrackClassifier {
   }
 
  private:
-  // ONNX environment
-  Ort::Env m_env;
-  // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  // ONNX environment, shared with all other ONNX runtime users
+  std::shared_ptr<Ort::Env> m_env;
+  // ONNX model for the duplicate neural network, if it has its own session
+  std::unique_ptr<OnnxRuntimeBase> m_runtime;
+  // ONNX model for the duplicate neural network, if it is run by an inference
+  // service
+  std::shared_ptr<OnnxInferenceService::Model> m_model;
 };
 
 /// @}
@@ -0,0 +1,169 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <onnxruntime_cxx_api.h>
+
+namespace ActsPlugins {
+/// @addtogroup onnx_plugin
+/// @{
+
+/// Shared ONNX runtime environment and batched inference for classifiers
+///
+/// All models loaded through the service share one ONNX runtime environment
+/// with a single global thread pool, instead of one environment and one
+/// thread pool per algorithm. The pool threads do not spin when idle, so that
+/// they do not compete with the event-level worker threads for the cores.
+///
+/// The ONNX runtime only supports one environment per process, every further
+/// environment silently refers to the first one. All ONNX runtime users should
+/// therefore create their sessions in @ref environment. If the environment has
+/// no global thread pool of the configured size, e.g. because it was created
+/// elsewhere or by a service with a different number of threads, the sessions
+/// of the service fall back to their own non-spinning thread pools.
+///
+/// Inference requests of concurrent callers for the same model are combined
+/// into larger batches: while a batch is running, new requests are queued and
+/// the next free caller runs all queued requests at once. The input and
+/// output buffers of the batches are allocated once per model and reused.
+///
+/// Using the service is opt-in, the classifiers only run their models through
+/// it if they are given a service. The defaults run one batch at a time with
+/// a single thread, the configuration should be sized to the hardware.
+class OnnxInferenceService {
+ public:
+  /// Configuration of the inference service
+  struct Config {
+    /// Number of threads of the ONNX runtime thread pool shared by all models
+    std::size_t numThreads = 1;
+    /// Maximum number of rows combined into one batch. Larger requests are
+    /// run on their own.
+    std::size_t maxBatchSize = 16384;
+    /// Maximum number of batches of the same model running concurrently
+    std::size_t maxConcurrentBatches = 1;
+    /// Maximum time a batch waits for more requests before it is run, if it
+    /// is not full yet
+    std::chrono::microseconds maxLatency{0};
+  };
+
+  class Model;
+
+  /// Construct the inference service
+  ///
+  /// @param cfg the configuration
+  explicit OnnxInferenceService(const Config& cfg);
+
+  /// Process-wide ONNX runtime environment
+  ///
+  /// Created on first use with a global non-spinning thread pool, and shared
+  /// by all services and all other ONNX runtime users.
+  /// @return the shared environment
+  static std::shared_ptr<Ort::Env> environment();
+
+  /// Load a model, or return the already loaded model with the same path
+  ///
+  /// @param modelPath the path to the ML model in *.onnx format
+  /// @return the model handle
+  std::shared_ptr<Model> loadModel(const std::string& modelPath);
+
+  /// Const access to the config
+  /// @return the configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  // Shared with the models, which need the environment to outlive them
+  std::shared_ptr<Ort::Env> m_env;
+
+  std::mutex m_modelsMutex;
+  // Whether the sessions use the global thread pool of the environment
+  bool m_globalThreads = false;
+  std::unordered_map<std::string, std::weak_ptr<Model>> m_models;
+};
+
+/// A model loaded through the @ref OnnxInferenceService
+class OnnxInferenceService::Model {
+ public:
+  /// Function running the network on a contiguous batch of rows
+  using RunFunction =
+      std::function<void(const float* input, float* output, std::size_t rows)>;
+
+  /// Construct the model, use @ref OnnxInferenceService::loadModel instead
+  ///
+  /// @param inputSize the number of input features per row
+  /// @param outputSize the number of output values per row
+  /// @param run the function running the network on a batch
+  /// @param cfg the service configuration
+  Model(std::size_t inputSize, std::size_t outputSize, RunFunction run,
+        const Config& cfg);
+
+  /// Run the inference for a batch of input
+  ///
+  /// The rows may be combined with those of concurrent calls and the call
+  /// blocks until the batch containing them has been run.
+  ///
+  /// @param input The input feature values, one row per entry
+  ///
+  /// @return The output values, one vector per row
+  std::vector<std::vector<float>> infer(const NetworkBatchInput& input);
+
+  /// @brief The number of input features per row
+  /// @return The input size
+  std::size_t inputSize() const { return m_inputSize; }
+
+  /// @brief The number of output values per row
+  /// @return The output size
+  std::size_t outputSize() const { return m_outputSize; }
+
+ private:
+  struct Request {
+    const NetworkBatchInput* input = nullptr;
+    std::vector<std::vector<float>>* output = nullptr;
+    bool done = false;
+    std::exception_ptr error;
+  };
+
+  struct Buffers {
+    std::vector<float> input;
+    std::vector<float> output;
+  };
+
+  /// Run the given requests as one batch
+  void runBatch(const std::vector<Request*>& requests, Buffers& buffers) const;
+
+  Config m_cfg;
+  std::size_t m_inputSize = 0;
+  std::size_t m_outputSize = 0;
+  RunFunction m_run;
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<Request*> m_pending;
+  std::size_t m_pendingRows = 0;
+  std::size_t m_runningBatches = 0;
+  // Buffers which are not used by a running batch
+  std::vector<std::unique_ptr<Buffers>> m_freeBuffers;
+};
+
+/// @}
+}  // namespace ActsPlugins
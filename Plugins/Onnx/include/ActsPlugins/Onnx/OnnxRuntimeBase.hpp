@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -34,6 +35,14 @@ class OnnxRuntimeBase {
   /// @param modelPath the path to the ML model in *.onnx format
   OnnxRuntimeBase(Ort::Env& env, const char* modelPath);
 
+  /// @brief Parametrized constructor with custom session options
+  ///
+  /// @param env the ONNX runtime environment
+  /// @param modelPath the path to the ML model in *.onnx format
+  /// @param sessionOptions the options of the ONNX runtime session
+  OnnxRuntimeBase(Ort::Env& env, const char* modelPath,
+                  const Ort::SessionOptions& sessionOptions);
+
   /// @brief Default destructor
   ~OnnxRuntimeBase() = default;
 
@@ -61,6 +70,26 @@ class OnnxRuntimeBase {
   std::vector<std::vector<std::vector<float>>> runONNXInferenceMultiOutput(
       NetworkBatchInput& inputTensorValues) const;
 
+  /// @brief Run the ONNX inference function on preallocated buffers
+  ///
+  /// The model is required to have a single input node of shape
+  /// (batch, inputSize()) and a single output node of shape
+  /// (batch, outputSize()), both stored row-major.
+  ///
+  /// @param input The input feature values of all the rows
+  /// @param output The buffer receiving the output values of all the rows
+  /// @param batchSize The number of rows
+  void runONNXInference(const float* input, float* output,
+                        std::size_t batchSize) const;
+
+  /// @brief The number of input features per row of the first input node
+  /// @return The input size
+  std::size_t inputSize() const;
+
+  /// @brief The number of output values per row of the first output node
+  /// @return The output size
+  std::size_t outputSize() const;
+
  private:
   /// ONNX runtime session / model properties
   std::unique_ptr<Ort::Session> m_session;
@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <memory>
 #include <vector>
 
 #include <onnxruntime_cxx_api.h>
@@ -23,10 +25,23 @@ class SeedClassifier {
  public:
   /// Construct the scoring algorithm.
   ///
+  /// The model runs in its own session, which can be called concurrently.
+  ///
   /// @param modelPath path to the model file
   explicit SeedClassifier(const char* modelPath)
-      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLSeedClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {};
+      : m_env(OnnxInferenceService::environment()),
+        m_runtime(std::make_unique<OnnxRuntimeBase>(*m_env, modelPath)) {}
+
+  /// Construct the scoring algorithm with a given inference service.
+  ///
+  /// The inference requests of concurrent callers are combined into batches
+  /// by the service.
+  ///
+  /// @param modelPath path to the model file
+  /// @param service the inference service running the model
+  SeedClassifier(const char* modelPath,
+                 const std::shared_ptr<OnnxInferenceService>& service)
+      : m_model(service->loadModel(modelPath)) {}
 
   /// Compute a score for each seed to be used in the seed selection
   ///
@@ -36,7 +51,8 @@ class SeedClassifier {
       NetworkBatchInput& networkInput) const {
     // Use the network to compute a score for all the Seeds.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_model != nullptr ? m_model->infer(networkInput)
+                           : m_runtime->runONNXInference(networkInput);
     return outputTensor;
   }
 
@@ -85,10 +101,13 @@ class SeedClassifier {
   }
 
  private:
-  // ONNX environment
-  Ort::Env m_env;
-  // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  // ONNX environment, shared with all other ONNX runtime users
+  std::shared_ptr<Ort::Env> m_env;
+  // ONNX model for the duplicate neural network, if it has its own session
+  std::unique_ptr<OnnxRuntimeBase> m_runtime;
+  // ONNX model for the duplicate neural network, if it is run by an inference
+  // service
+  std::shared_ptr<OnnxInferenceService::Model> m_model;
 };
 
 /// @}
@@ -0,0 +1,269 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace ActsPlugins {
+
+namespace {
+
+// The environment shared by all ONNX runtime users of the process
+struct SharedEnvironment {
+  std::mutex mutex;
+  std::weak_ptr<Ort::Env> env;
+  // Size of the global thread pool the environment was created with
+  std::size_t numThreads = 0;
+};
+
+SharedEnvironment& sharedEnvironment() {
+  static SharedEnvironment shared;
+  return shared;
+}
+
+// Return the shared environment and the size of its global thread pool,
+// creating it with the given number of threads if there is none
+std::pair<std::shared_ptr<Ort::Env>, std::size_t> acquireEnvironment(
+    std::size_t numThreads) {
+  SharedEnvironment& shared = sharedEnvironment();
+  std::lock_guard lock(shared.mutex);
+  std::shared_ptr<Ort::Env> env = shared.env.lock();
+  if (env == nullptr) {
+    // One global thread pool for all sessions, which sleeps when idle
+    Ort::ThreadingOptions threadingOptions;
+    threadingOptions.SetGlobalIntraOpNumThreads(static_cast<int>(numThreads));
+    threadingOptions.SetGlobalInterOpNumThreads(1);
+    threadingOptions.SetGlobalSpinControl(0);
+    env = std::make_shared<Ort::Env>(threadingOptions,
+                                     ORT_LOGGING_LEVEL_WARNING,
+                                     "OnnxInferenceService");
+    shared.env = env;
+    shared.numThreads = numThreads;
+  }
+  return {env, shared.numThreads};
+}
+
+Ort::SessionOptions makeSessionOptions(bool globalThreads,
+                                       std::size_t numThreads) {
+  Ort::SessionOptions sessionOptions;
+  sessionOptions.SetGraphOptimizationLevel(
+      GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  if (globalThreads) {
+    // Use the global thread pool of the environment
+    sessionOptions.DisablePerSessionThreads();
+  } else {
+    sessionOptions.SetIntraOpNumThreads(static_cast<int>(numThreads));
+    sessionOptions.SetInterOpNumThreads(1);
+    sessionOptions.AddConfigEntry("session.intra_op.allow_spinning", "0");
+  }
+  return sessionOptions;
+}
+
+// Keeps the environment alive until the session is destroyed
+struct Network {
+  Network(std::shared_ptr<Ort::Env> sharedEnv, const std::string& modelPath,
+          const Ort::SessionOptions& sessionOptions)
+      : env(std::move(sharedEnv)),
+        runtime(*env, modelPath.c_str(), sessionOptions) {}
+
+  std::shared_ptr<Ort::Env> env;
+  OnnxRuntimeBase runtime;
+};
+
+}  // namespace
+
+OnnxInferenceService::OnnxInferenceService(const Config& cfg) : m_cfg(cfg) {
+  if (m_cfg.maxBatchSize == 0 || m_cfg.maxConcurrentBatches == 0) {
+    throw std::invalid_argument(
+        "OnnxInferenceService: batch size and number of concurrent batches "
+        "need to be positive");
+  }
+  std::size_t envThreads = 0;
+  std::tie(m_env, envThreads) = acquireEnvironment(m_cfg.numThreads);
+  // Do not silently share a thread pool of a different size
+  m_globalThreads = envThreads == m_cfg.numThreads;
+}
+
+std::shared_ptr<Ort::Env> OnnxInferenceService::environment() {
+  return acquireEnvironment(Config{}.numThreads).first;
+}
+
+std::shared_ptr<OnnxInferenceService::Model> OnnxInferenceService::loadModel(
+    const std::string& modelPath) {
+  std::lock_guard lock(m_modelsMutex);
+  std::weak_ptr<Model>& cached = m_models[modelPath];
+  std::shared_ptr<Model> model = cached.lock();
+  if (model != nullptr) {
+    return model;
+  }
+
+  std::shared_ptr<Network> network;
+  if (m_globalThreads) {
+    try {
+      network = std::make_shared<Network>(
+          m_env, modelPath, makeSessionOptions(true, m_cfg.numThreads));
+    } catch (const Ort::Exception&) {
+      // The environment was created without global thread pools outside of
+      // the service, the sessions need their own threads
+      network = std::make_shared<Network>(
+          m_env, modelPath, makeSessionOptions(false, m_cfg.numThreads));
+      m_globalThreads = false;
+    }
+  } else {
+    network = std::make_shared<Network>(
+        m_env, modelPath, makeSessionOptions(false, m_cfg.numThreads));
+  }
+
+  model = std::make_shared<Model>(
+      network->runtime.inputSize(), network->runtime.outputSize(),
+      [network](const float* input, float* output, std::size_t rows) {
+        network->runtime.runONNXInference(input, output, rows);
+      },
+      m_cfg);
+  cached = model;
+  return model;
+}
+
+OnnxInferenceService::Model::Model(std::size_t inputSize,
+                                   std::size_t outputSize, RunFunction run,
+                                   const Config& cfg)
+    : m_cfg(cfg),
+      m_inputSize(inputSize),
+      m_outputSize(outputSize),
+      m_run(std::move(run)) {
+  if (m_cfg.maxBatchSize == 0 || m_cfg.maxConcurrentBatches == 0) {
+    throw std::invalid_argument(
+        "OnnxInferenceService: batch size and number of concurrent batches "
+        "need to be positive");
+  }
+  // Preallocate the buffers for full batches
+  for (std::size_t i = 0; i < m_cfg.maxConcurrentBatches; ++i) {
+    auto buffers = std::make_unique<Buffers>();
+    buffers->input.resize(m_cfg.maxBatchSize * m_inputSize);
+    buffers->output.resize(m_cfg.maxBatchSize * m_outputSize);
+    m_freeBuffers.push_back(std::move(buffers));
+  }
+}
+
+std::vector<std::vector<float>> OnnxInferenceService::Model::infer(
+    const NetworkBatchInput& input) {
+  if (static_cast<std::size_t>(input.cols()) != inputSize()) {
+    throw std::invalid_argument(
+        "OnnxInferenceService: number of input features doesn't match the "
+        "model");
+  }
+  std::vector<std::vector<float>> output;
+  if (input.rows() == 0) {
+    return output;
+  }
+
+  Request request;
+  request.input = &input;
+  request.output = &output;
+  std::unique_lock lock(m_mutex);
+  m_pending.push_back(&request);
+  m_pendingRows += input.rows();
+  // Wake up a caller waiting for its batch to fill up
+  m_condition.notify_all();
+
+  while (!request.done) {
+    if (m_runningBatches >= m_cfg.maxConcurrentBatches) {
+      m_condition.wait(lock);
+      continue;
+    }
+
+    // Run the next batch in this thread
+    ++m_runningBatches;
+    if (m_cfg.maxLatency.count() > 0) {
+      m_condition.wait_for(lock, m_cfg.maxLatency, [&] {
+        return request.done || m_pendingRows >= m_cfg.maxBatchSize;
+      });
+    }
+    std::vector<Request*> batch;
+    std::size_t batchRows = 0;
+    while (!m_pending.empty()) {
+      Request* next = m_pending.front();
+      const std::size_t nextRows = next->input->rows();
+      if (!batch.empty() && batchRows + nextRows > m_cfg.maxBatchSize) {
+        break;
+      }
+      batch.push_back(next);
+      batchRows += nextRows;
+      m_pending.pop_front();
+    }
+    m_pendingRows -= batchRows;
+    if (batch.empty()) {
+      // The request was taken by another concurrent batch
+      --m_runningBatches;
+      m_condition.wait(lock, [&] { return request.done; });
+      continue;
+    }
+    std::unique_ptr<Buffers> buffers = std::move(m_freeBuffers.back());
+    m_freeBuffers.pop_back();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      runBatch(batch, *buffers);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    m_freeBuffers.push_back(std::move(buffers));
+    --m_runningBatches;
+    for (Request* finished : batch) {
+      finished->error = error;
+      finished->done = true;
+    }
+    m_condition.notify_all();
+  }
+
+  if (request.error) {
+    std::rethrow_exception(request.error);
+  }
+  return output;
+}
+
+void OnnxInferenceService::Model::runBatch(
+    const std::vector<Request*>& requests, Buffers& buffers) const {
+  std::size_t batchRows = 0;
+  for (const Request* request : requests) {
+    batchRows += request->input->rows();
+  }
+  // Only oversized single requests need to grow the buffers
+  const std::size_t nInput = inputSize();
+  const std::size_t nOutput = outputSize();
+  if (buffers.input.size() < batchRows * nInput) {
+    buffers.input.resize(batchRows * nInput);
+    buffers.output.resize(batchRows * nOutput);
+  }
+
+  float* inputRow = buffers.input.data();
+  for (const Request* request : requests) {
+    inputRow = std::copy_n(request->input->data(), request->input->size(),
+                           inputRow);
+  }
+
+  m_run(buffers.input.data(), buffers.output.data(), batchRows);
+
+  const float* outputRow = buffers.output.data();
+  for (const Request* request : requests) {
+    request->output->reserve(request->input->rows());
+    for (Eigen::Index i = 0; i < request->input->rows(); ++i) {
+      request->output->emplace_back(outputRow, outputRow + nOutput);
+      outputRow += nOutput;
+    }
+  }
+}
+
+}  // namespace ActsPlugins
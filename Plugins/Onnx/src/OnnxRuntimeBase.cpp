@@ -8,17 +8,33 @@
 
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <stdexcept>
 
-// Parametrized constructor
-ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env,
-                                              const char* modelPath) {
+namespace {
+
+Ort::SessionOptions defaultSessionOptions() {
   // Set the ONNX runtime session options
   Ort::SessionOptions sessionOptions;
   // Set graph optimization level
   sessionOptions.SetGraphOptimizationLevel(
       GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  return sessionOptions;
+}
+
+}  // namespace
+
+// Parametrized constructor
+ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env,
+                                              const char* modelPath)
+    : OnnxRuntimeBase(env, modelPath, defaultSessionOptions()) {}
+
+// Parametrized constructor with custom session options
+ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(
+    Ort::Env& env, const char* modelPath,
+    const Ort::SessionOptions& sessionOptions) {
   // Create the Ort session
   m_session = std::make_unique<Ort::Session>(env, modelPath, sessionOptions);
   // Default allocator
@@ -147,3 +163,51 @@ ActsPlugins::OnnxRuntimeBase::runONNXInferenceMultiOutput(
   }
   return multiOutput;
 }
+
+// Inference function using ONNX runtime on preallocated buffers
+void ActsPlugins::OnnxRuntimeBase::runONNXInference(
+    const float* input, float* output, std::size_t batchSize) const {
+  if (m_inputNodeNames.size() != 1 || m_outputNodeNames.size() != 1) {
+    throw std::runtime_error(
+        "runONNXInference: buffer inference requires a model with one input "
+        "and one output node");
+  }
+  std::array<std::int64_t, 2> inputNodeDims = {
+      static_cast<std::int64_t>(batchSize),
+      static_cast<std::int64_t>(inputSize())};
+  std::array<std::int64_t, 2> outputNodeDims = {
+      static_cast<std::int64_t>(batchSize),
+      static_cast<std::int64_t>(outputSize())};
+  if ((m_inputNodeDims[0] != -1 && m_inputNodeDims[0] != inputNodeDims[0]) ||
+      (m_outputNodeDims[0][0] != -1 &&
+       m_outputNodeDims[0][0] != outputNodeDims[0])) {
+    throw std::runtime_error(
+        "runONNXInference: batch size doesn't match the input or output node "
+        "size");
+  }
+
+  // Wrap the buffers into tensors without copying, the input is only read
+  Ort::MemoryInfo memoryInfo =
+      Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  // Rank one nodes only have the batch dimension
+  Ort::Value inputTensor = Ort::Value::CreateTensor<float>(
+      memoryInfo, const_cast<float*>(input), batchSize * inputSize(),
+      inputNodeDims.data(),
+      std::min(inputNodeDims.size(), m_inputNodeDims.size()));
+  Ort::Value outputTensor = Ort::Value::CreateTensor<float>(
+      memoryInfo, output, batchSize * outputSize(), outputNodeDims.data(),
+      std::min(outputNodeDims.size(), m_outputNodeDims.front().size()));
+
+  Ort::RunOptions run_options;
+  m_session->Run(run_options, m_inputNodeNames.data(), &inputTensor, 1,
+                 m_outputNodeNames.data(), &outputTensor, 1);
+}
+
+std::size_t ActsPlugins::OnnxRuntimeBase::inputSize() const {
+  return m_inputNodeDims.size() > 1 ? m_inputNodeDims[1] : 1;
+}
+
+std::size_t ActsPlugins::OnnxRuntimeBase::outputSize() const {
+  return m_outputNodeDims.front().size() > 1 ? m_outputNodeDims.front()[1]
+                                              : 1;
+}
@@ -24,7 +24,8 @@ void addAmbiguityResolution(py::module& mex) {
   ACTS_PYTHON_DECLARE_ALGORITHM(GreedyAmbiguityResolutionAlgorithm, mex,
                                 "GreedyAmbiguityResolutionAlgorithm",
                                 inputTracks, outputTracks, maximumSharedHits,
-                                maximumIterations, nMeasurementsMin);
+                                maximumIterations, nMeasurementsMin,
+                                useSharedHitGraph);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ScoreBasedAmbiguityResolutionAlgorithm, mex,
@@ -28,7 +28,8 @@ void addExampleAlgorithms(py::module& mex) {
       outputParticles, outputSimHits, randomNumbers, trackingGeometry,
       magneticField, pMin, emScattering, emEnergyLossIonisation,
       emEnergyLossRadiation, emPhotonConversion, generateHitsOnSensitive,
-      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle);
+      generateHitsOnMaterial, generateHitsOnPassive, averageHitsPerParticle,
+      perParticleRandomStreams, numThreads);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ParticlesPrinter, mex, "ParticlesPrinter",
                                 inputParticles);
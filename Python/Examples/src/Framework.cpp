@@ -382,8 +382,10 @@ void addFramework(py::module& mex) {
   auto c = py::class_<Config>(sequencer, "Config").def(py::init<>());
 
   ACTS_PYTHON_STRUCT(c, skip, events, logLevel, numThreads, outputDir,
-                     outputTimingFile, trackFpes, fpeMasks, failOnFirstFpe,
-                     failOnUnmaskedFpe, fpeStackTraceLength);
+                     outputTimingFile, outputCriticalPathFile,
+                     intraEventParallelism, useEventArena, eventArenaSize,
+                     trackFpes, fpeMasks, failOnFirstFpe, failOnUnmaskedFpe,
+                     fpeStackTraceLength);
 
   auto fpem =
       py::class_<Sequencer::FpeMask>(sequencer, "_FpeMask")
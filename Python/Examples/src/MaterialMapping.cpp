@@ -54,7 +54,7 @@ void addMaterialMapping(py::module& mex) {
           py::arg("geoContext"));
     ACTS_PYTHON_STRUCT(c, inputMaterialTracks, mappedMaterialTracks,
                        unmappedMaterialTracks, geoContext, materialMapper,
-                       materialWriters);
+                       materialWriters, concurrentMapping);
   }
 
   {
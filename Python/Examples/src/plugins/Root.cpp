@@ -244,8 +244,14 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsRoot, root) {
                                inputSeeds, writingMode, filePath, fileMode,
                                treeName);
 
+    py::enum_<RootOutputMode>(root, "RootOutputMode")
+        .value("Locked", RootOutputMode::Locked)
+        .value("Async", RootOutputMode::Async)
+        .value("FilePerThread", RootOutputMode::FilePerThread);
+
     ACTS_PYTHON_DECLARE_WRITER(RootSimHitWriter, root, "RootSimHitWriter",
-                               inputSimHits, filePath, fileMode, treeName);
+                               inputSimHits, filePath, fileMode, treeName,
+                               outputMode);
 
     ACTS_PYTHON_DECLARE_WRITER(
         RootSpacePointWriter, root, "RootSpacePointWriter", inputSpacePoints,
@@ -254,19 +260,19 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsRoot, root) {
     ACTS_PYTHON_DECLARE_WRITER(
         RootTrackStatesWriter, root, "RootTrackStatesWriter", inputTracks,
         inputParticles, inputTrackParticleMatching, inputSimHits,
-        inputMeasurementSimHitsMap, filePath, treeName, fileMode);
+        inputMeasurementSimHitsMap, filePath, treeName, fileMode, outputMode);
 
     ACTS_PYTHON_DECLARE_WRITER(
         RootTrackSummaryWriter, root, "RootTrackSummaryWriter", inputTracks,
         inputParticles, inputTrackParticleMatching, inputJets, filePath,
         treeName, fileMode, writeCovMat, writeGsfSpecific, writeGx2fSpecific,
-        writeJets);
+        writeJets, outputMode);
 
     ACTS_PYTHON_DECLARE_WRITER(
         RootVertexNTupleWriter, root, "RootVertexNTupleWriter", inputVertices,
         inputTracks, inputTruthVertices, inputParticles, inputSelectedParticles,
         inputTrackParticleMatching, inputVertexTruthMatching, bField, filePath,
-        treeName, fileMode, writeTrackInfo);
+        treeName, fileMode, outputMode, writeTrackInfo);
 
     ACTS_PYTHON_DECLARE_WRITER(
         RootTrackFinderPerformanceWriter, root,
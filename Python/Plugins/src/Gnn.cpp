@@ -7,8 +7,10 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
+#include "ActsPlugins/Gnn/CpuTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/CudaTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/GnnPipeline.hpp"
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
 #include "ActsPlugins/Gnn/ModuleMapCuda.hpp"
 #include "ActsPlugins/Gnn/OnnxEdgeClassifier.hpp"
 #include "ActsPlugins/Gnn/TensorRTEdgeClassifier.hpp"
@@ -65,6 +67,42 @@ PYBIND11_MODULE(ActsPluginsPythonBindingsGnn, gnn) {
 
   ACTS_PYTHON_DECLARE_GNN_STAGE(BoostTrackBuilding, TrackBuildingBase, gnn);
 
+  ACTS_PYTHON_DECLARE_GNN_STAGE(CpuTrackBuilding, TrackBuildingBase, gnn,
+                                doJunctionRemoval, minCandidateSize,
+                                numThreads);
+
+  {
+    using Alg = ModuleMapCpu;
+    using Config = Alg::Config;
+
+    auto alg =
+        py::class_<Alg, GraphConstructionBase, std::shared_ptr<Alg>>(
+            gnn, "ModuleMapCpu")
+            .def(py::init([](const Config &c, Logging::Level lvl) {
+                   return std::make_shared<Alg>(
+                       c, getDefaultLogger("ModuleMapCpu", lvl));
+                 }),
+                 py::arg("config"), py::arg("level"))
+            .def_property_readonly("config", &Alg::config)
+            .def_static("readModuleMap", &Alg::readModuleMap,
+                        py::arg("prefix"))
+            .def_static("writeModuleMap", &Alg::writeModuleMap,
+                        py::arg("moduleMap"), py::arg("prefix"));
+
+    py::class_<Alg::ModuleMap, std::shared_ptr<Alg::ModuleMap>>(alg,
+                                                                 "ModuleMap")
+        .def_property_readonly(
+            "numDoublets",
+            [](const Alg::ModuleMap &m) { return m.doublets.size(); })
+        .def_property_readonly(
+            "numTriplets",
+            [](const Alg::ModuleMap &m) { return m.triplets.size(); });
+
+    auto c = py::class_<Config>(alg, "Config").def(py::init<>());
+    ACTS_PYTHON_STRUCT(c, moduleMap, moduleMapPath, rScale, phiScale, zScale,
+                       etaScale, numThreads, epsilon);
+  }
+
 #ifdef ACTS_GNN_TORCH_BACKEND
   ACTS_PYTHON_DECLARE_GNN_STAGE(TorchMetricLearning, GraphConstructionBase, gnn,
                                 modelPath, selectedFeatures, embeddingDim, rVal,
@@ -89,7 +127,7 @@ PYBIND11_MODULE(ActsPluginsPythonBindingsGnn, gnn) {
 
 #ifdef ACTS_GNN_ONNX_BACKEND
   ACTS_PYTHON_DECLARE_GNN_STAGE(OnnxEdgeClassifier, EdgeClassificationBase, gnn,
-                                modelPath, cut, device);
+                                modelPath, cut, device, numThreads);
 #endif
 
 #ifdef ACTS_GNN_WITH_MODULEMAP
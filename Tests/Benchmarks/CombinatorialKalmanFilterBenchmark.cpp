@@ -0,0 +1,233 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/TrackStateCreator.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Holders.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "ActsTests/CommonHelpers/MeasurementsCreator.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace Acts::UnitLiterals;
+using namespace ActsTests;
+
+namespace {
+
+using TestTrackContainer =
+    Acts::TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                         detail::ValueHolder>;
+using TrackStateContainerBackend =
+    TestTrackContainer::TrackStateContainerBackend;
+using SourceLinkContainer =
+    std::unordered_multimap<GeometryIdentifier, TestSourceLink>;
+
+struct SourceLinkAccessor {
+  struct Iterator {
+    using BaseIterator = SourceLinkContainer::const_iterator;
+
+    using iterator_category = BaseIterator::iterator_category;
+    using value_type = BaseIterator::value_type;
+    using difference_type = BaseIterator::difference_type;
+    using pointer = BaseIterator::pointer;
+    using reference = BaseIterator::reference;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    SourceLink operator*() const { return SourceLink{m_iterator->second}; }
+
+    BaseIterator m_iterator;
+  };
+
+  const SourceLinkContainer* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+}  // namespace
+
+namespace Acts {
+template Result<std::pair<
+    std::vector<TrackStateContainerBackend::TrackStateProxy>::iterator,
+    std::vector<TrackStateContainerBackend::TrackStateProxy>::iterator>>
+MeasurementSelector::select<TrackStateContainerBackend>(
+    std::vector<TrackStateContainerBackend::TrackStateProxy>&, bool&,
+    const Logger&) const;
+}  // namespace Acts
+
+int main(int argc, char* argv[]) {
+  std::size_t nTracks = 100;
+  std::size_t maxBranches = 3;
+  std::size_t runs = 20;
+  if (argc >= 2) {
+    nTracks = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    maxBranches = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    runs = std::stoi(argv[3]);
+  }
+
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+  MagneticFieldContext mctx;
+  CalibrationContext cctx;
+
+  // The generic barrel pixel detector from the test helpers. The full
+  // detectors used in the examples are not available to the core benchmarks.
+  CylindricalTrackingGeometry cGeometry(gctx);
+  std::shared_ptr<const TrackingGeometry> geometry = cGeometry();
+
+  Navigator::Config navCfg{geometry};
+  navCfg.resolvePassive = false;
+  navCfg.resolveMaterial = true;
+  navCfg.resolveSensitive = true;
+
+  using FieldPropagator = Propagator<EigenStepper<>, Navigator>;
+
+  auto field = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+  FieldPropagator propagator{EigenStepper<>(field), Navigator(navCfg)};
+
+  // Tracks are collimated in a narrow cone to get dense hits with many
+  // compatible measurements per surface, as in the core of a jet
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> phiDist(0., 0.05);
+  std::uniform_real_distribution<double> thetaDist(85_degree, 95_degree);
+  std::uniform_real_distribution<double> pDist(1_GeV, 10_GeV);
+
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 100_um;
+  stddev[eBoundLoc1] = 100_um;
+  stddev[eBoundTime] = 25_ns;
+  stddev[eBoundPhi] = 0.5_degree;
+  stddev[eBoundTheta] = 0.5_degree;
+  stddev[eBoundQOverP] = 1 / 10_GeV;
+  BoundMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  MeasurementResolutionMap resolutions = {
+      {GeometryIdentifier(), {MeasurementType::eLoc01, {10_um, 50_um}}}};
+
+  std::vector<BoundTrackParameters> seeds;
+  SourceLinkContainer sourceLinks;
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const double q = (i % 2 == 0) ? 1_e : -1_e;
+    auto params = BoundTrackParameters::createCurvilinear(
+        Vector4::Zero(), phiDist(rng), thetaDist(rng), q / pDist(rng), cov,
+        ParticleHypothesis::pion());
+    auto measurements = createMeasurements(propagator, gctx, mctx, params,
+                                           resolutions, rng, i);
+    for (auto& sl : measurements.sourceLinks) {
+      sourceLinks.emplace(sl.m_geometryId, std::move(sl));
+    }
+    seeds.push_back(std::move(params));
+  }
+  std::cout << "Generated " << seeds.size() << " seeds with "
+            << sourceLinks.size() << " measurements" << std::endl;
+
+  GainMatrixUpdater updater;
+  MeasurementSelector measSel{MeasurementSelector::Config{
+      {GeometryIdentifier(), {{}, {100.}, {maxBranches}}}}};
+
+  SourceLinkAccessor slAccessor{&sourceLinks};
+  using TrackStateCreatorType =
+      TrackStateCreator<SourceLinkAccessor::Iterator, TestTrackContainer>;
+  TrackStateCreatorType trackStateCreator;
+  trackStateCreator.sourceLinkAccessor
+      .template connect<&SourceLinkAccessor::range>(&slAccessor);
+  trackStateCreator.calibrator.template connect<
+      &testSourceLinkCalibrator<TrackStateContainerBackend>>();
+  trackStateCreator.measurementSelector.template connect<
+      &MeasurementSelector::select<TrackStateContainerBackend>>(&measSel);
+
+  CombinatorialKalmanFilterExtensions<TestTrackContainer> extensions;
+  extensions.updater.template connect<
+      &GainMatrixUpdater::operator()<TrackStateContainerBackend>>(&updater);
+  extensions.createTrackStates
+      .template connect<&TrackStateCreatorType::createTrackStates>(
+          &trackStateCreator);
+
+  CombinatorialKalmanFilterOptions<TestTrackContainer> options(
+      gctx, mctx, cctx, extensions, PropagatorPlainOptions(gctx, mctx));
+
+  CombinatorialKalmanFilter<FieldPropagator, TestTrackContainer> ckf(
+      std::move(propagator));
+
+  std::ofstream os{"ckf_bench.csv"};
+  os << "name,tracks,max_branches,found,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  // One iteration finds the tracks for all seeds
+  auto benchmark = [&](const std::string& name,
+                       CombinatorialKalmanFilterTraversal traversal) {
+    options.traversal = traversal;
+
+    std::size_t nFound = 0;
+    auto findTracks = [&] {
+      TestTrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+      auto results = ckf.findTracks(
+          std::span<const BoundTrackParameters>(seeds), options, tc);
+      nFound = 0;
+      for (const auto& res : results) {
+        nFound += res.ok() ? res->size() : 0;
+      }
+      return nFound;
+    };
+
+    std::cout << "Benchmarking " << name << " track finding: " << std::flush;
+    const auto result = microBenchmark(findTracks, 1, runs,
+                                       std::chrono::milliseconds(100));
+    std::cout << result << std::endl;
+    std::cout << "  found " << nFound << " tracks" << std::endl;
+
+    os << name << "," << seeds.size() << "," << maxBranches << "," << nFound
+       << "," << result.run_timings.size() << "," << result.iters_per_run
+       << "," << result.totalTime().count() << ","
+       << result.runTimeMedian().count() << ","
+       << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << std::endl;
+  };
+
+  benchmark("depth_first", CombinatorialKalmanFilterTraversal::DepthFirst);
+  benchmark("breadth_first", CombinatorialKalmanFilterTraversal::BreadthFirst);
+}
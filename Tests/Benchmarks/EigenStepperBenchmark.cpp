@@ -23,5 +23,6 @@ int main(int argc, char* argv[]) {
   auto bField = benchmark.makeField();
   Stepper stepper(std::move(bField));
   benchmark.run(stepper, "EigenStepper");
+  benchmark.runBatch(stepper, "EigenStepperBatch");
   return 0;
 }
@@ -0,0 +1,132 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+
+using namespace Acts;
+using namespace UnitLiterals;
+using namespace ActsTests;
+
+int main(int argc, char* argv[]) {
+  std::size_t batchSize = 64;
+  std::size_t iters_map = 1e3;
+  std::size_t iters_solenoid = 3;
+  std::size_t runs_solenoid = 100;
+  if (argc >= 2) {
+    batchSize = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    iters_map = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    iters_solenoid = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    runs_solenoid = std::stoi(argv[4]);
+  }
+
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  const std::size_t nCoils = 1154;
+  const double bMagCenter = 2_T;
+  const std::size_t nBinsR = 150;
+  const std::size_t nBinsZ = 200;
+
+  double rMin = -0.1;
+  double rMax = R * 2.;
+  double zMin = 2 * (-L / 2.);
+  double zMax = 2 * (L / 2.);
+
+  SolenoidBField bSolenoidField({R, L, nCoils, bMagCenter});
+  std::cout << "Building interpolated field map" << std::endl;
+  auto bFieldMap = solenoidFieldMap({rMin, rMax}, {zMin, zMax},
+                                    {nBinsR, nBinsZ}, bSolenoidField);
+  ConstantBField bConstantField(Vector3(0, 0, bMagCenter));
+  MagneticFieldContext mctx{};
+
+  // The positions are spread over the field map, similar to the components
+  // of a multi-component state that share one field lookup call.
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> zDist(1.5 * (-L / 2.), 1.5 * L / 2.);
+  std::uniform_real_distribution<double> rDist(0, R * 1.5);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  MagneticFieldProvider::VectorBatch positions(batchSize, 3);
+  for (std::size_t i = 0; i < batchSize; ++i) {
+    const double z = zDist(rng), r = rDist(rng), phi = phiDist(rng);
+    positions.row(i) << r * std::cos(phi), r * std::sin(phi), z;
+  }
+  MagneticFieldProvider::VectorBatch fields(batchSize, 3);
+
+  std::ofstream os{"bfield_batch_bench.csv"};
+
+  auto csv = [&](const std::string& name, const auto& res) {
+    os << name << "," << batchSize << "," << res.run_timings.size() << ","
+       << res.iters_per_run << "," << res.totalTime().count() << ","
+       << res.runTimeMedian().count() << ","
+       << 1.96 * res.runTimeError().count() << ","
+       << res.iterTimeAverage().count() << ","
+       << 1.96 * res.iterTimeError().count();
+
+    os << std::endl;
+  };
+
+  os << "name,batch_size,runs,iters,total_time,run_time_median,run_time_"
+        "error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  // One iteration always looks up the full batch, either with one virtual
+  // call per position or with a single batched call.
+  auto benchmark = [&](const std::string& name,
+                       const MagneticFieldProvider& field, std::size_t iters,
+                       std::size_t runs) {
+    auto cache = field.makeCache(mctx);
+
+    std::cout << "Benchmarking " << name << " lookup, one call per position: "
+              << std::flush;
+    const auto single_result = microBenchmark(
+        [&] {
+          for (Eigen::Index i = 0; i < positions.rows(); ++i) {
+            fields.row(i) =
+                field.getField(positions.row(i).transpose(), cache)
+                    ->transpose();
+          }
+          return fields(0, 2);
+        },
+        iters, runs);
+    std::cout << single_result << std::endl;
+    csv(name + "_single", single_result);
+
+    std::cout << "Benchmarking " << name << " lookup, batched: " << std::flush;
+    const auto batch_result = microBenchmark(
+        [&] {
+          field.getFields(positions, fields, cache).value();
+          return fields(0, 2);
+        },
+        iters, runs);
+    std::cout << batch_result << std::endl;
+    csv(name + "_batch", batch_result);
+  };
+
+  benchmark("constant", bConstantField, iters_map, 20000);
+  benchmark("interp", bFieldMap, iters_map, 20000);
+  // SolenoidBField lookups are slow, so use fewer iterations and runs
+  benchmark("solenoid", bSolenoidField, iters_solenoid, runs_solenoid);
+}
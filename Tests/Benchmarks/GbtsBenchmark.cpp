@@ -0,0 +1,201 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/GbtsGeometry.hpp"
+#include "Acts/Seeding2/GbtsLayerConnection.hpp"
+#include "Acts/Seeding2/GbtsRoiDescriptor.hpp"
+#include "Acts/Seeding2/GbtsTrackingFilter.hpp"
+#include "Acts/Seeding2/GraphBasedTrackSeeder.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+using namespace ActsTests;
+
+namespace {
+
+bool sameSeeds(const SeedContainer2& a, const SeedContainer2& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (SeedContainer2::Index i = 0; i < a.size(); ++i) {
+    const auto seedA = a[i];
+    const auto seedB = b[i];
+    if (!std::ranges::equal(seedA.spacePointIndices(),
+                            seedB.spacePointIndices()) ||
+        seedA.quality() != seedB.quality()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t nTracks = 2000;
+  std::size_t runs = 10;
+  std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc >= 2) {
+    nTracks = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    maxThreads = std::stoi(argv[3]);
+  }
+
+  const float bFieldInZ = 2_T;
+  const float minPt = 1_GeV;
+
+  // Pixel barrel layers, each connected to the next two layers inside. The
+  // tracking filter is tuned for closely spaced layers like these.
+  const std::vector<float> layerRadii = {33_mm,  50_mm,  88_mm,  122_mm,
+                                         160_mm, 200_mm, 250_mm, 300_mm};
+  std::vector<GbtsLayerDescription> layers;
+  std::stringstream connections;
+  connections << 2 * layerRadii.size() - 3 << " 0.2\n";
+  for (std::size_t l = 0; l < layerRadii.size(); ++l) {
+    const std::int32_t id = 80000 + 1000 * static_cast<std::int32_t>(l);
+    layers.push_back(
+        {id, GbtsLayerType::Barrel, layerRadii[l], -1000_mm, 1000_mm});
+    for (std::size_t skip = 1; skip <= std::min<std::size_t>(l, 2); ++skip) {
+      // index, stage, source, destination and a dummy 1x1 bin table
+      connections << 0 << " " << 0 << " " << id << " " << id - 1000 * skip
+                  << " 1 1 1\n0\n";
+    }
+  }
+  const GbtsLayerConnectionMap connectionMap =
+      GbtsLayerConnectionMap::fromStream(connections, false);
+  auto geometry = std::make_shared<GbtsGeometry>(layers, connectionMap);
+
+  // Space points of helices crossing the layers
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<float> ptDist(minPt, 10_GeV);
+  std::normal_distribution<float> z0Dist(0, 50_mm);
+  std::normal_distribution<float> noiseDist(0, 0.01_mm);
+
+  SpacePointContainer2 spacePoints(
+      SpacePointColumns::X | SpacePointColumns::Y | SpacePointColumns::Z |
+      SpacePointColumns::R | SpacePointColumns::Phi);
+  auto layerColumn = spacePoints.createColumn<std::uint32_t>("layerId");
+  auto clusterWidthColumn = spacePoints.createColumn<float>("clusterWidth");
+  auto localPositionColumn = spacePoints.createColumn<float>("localPositionY");
+
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = std::sinh(etaDist(rng));
+    const float z0 = z0Dist(rng);
+    const float q = (i % 2 == 0) ? 1 : -1;
+    // helix radius in mm for pt in GeV and field in T
+    const float radius = ptDist(rng) / (0.3f * bFieldInZ / 1_T) / 1_GeV * 1_m;
+    for (std::size_t l = 0; l < layerRadii.size(); ++l) {
+      const float r = layerRadii[l];
+      if (r > 2 * radius) {
+        break;
+      }
+      const float phi = phi0 + q * std::asin(r / (2 * radius));
+      const float x = r * std::cos(phi) + noiseDist(rng);
+      const float y = r * std::sin(phi) + noiseDist(rng);
+      auto sp = spacePoints.createSpacePoint();
+      sp.x() = x;
+      sp.y() = y;
+      sp.z() = z0 + r * cotTheta;
+      sp.r() = std::hypot(x, y);
+      sp.phi() = std::atan2(y, x);
+      sp.extra(layerColumn) = l;
+      sp.extra(clusterWidthColumn) = 0;
+      sp.extra(localPositionColumn) = 0;
+    }
+  }
+
+  const GbtsRoiDescriptor roi(0, -4.5, 4.5, 0, -std::numbers::pi,
+                              std::numbers::pi, 0, -150., 150.);
+  const GraphBasedTrackSeeder::Options options(bFieldInZ);
+  const GbtsTrackingFilter filter({}, geometry);
+
+  auto makeSeeder = [&](std::size_t nThreads) {
+    GraphBasedTrackSeeder::Config config;
+    config.minPt = minPt;
+    config.numThreads = nThreads;
+    return GraphBasedTrackSeeder(
+        GraphBasedTrackSeeder::DerivedConfig(config), geometry,
+        getDefaultLogger("Gbts", Logging::ERROR));
+  };
+
+  std::cout << "Seeding " << spacePoints.size() << " space points in "
+            << geometry->binGroups().size() << " bin groups and "
+            << geometry->binGroupStages().size() - 1 << " stages"
+            << std::endl;
+
+  std::ofstream os{"gbts_bench.csv"};
+  os << "threads,space_points,seeds,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error,speedup"
+     << std::endl;
+
+  SeedContainer2 serialSeeds;
+  makeSeeder(1).createSeeds(spacePoints, roi, layerRadii.size(), filter,
+                            options, serialSeeds);
+
+  double serialTime = 0;
+  for (std::size_t nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+    const GraphBasedTrackSeeder seeder = makeSeeder(nThreads);
+    SeedContainer2 seeds;
+    seeder.createSeeds(spacePoints, roi, layerRadii.size(), filter, options,
+                       seeds);
+    if (!sameSeeds(seeds, serialSeeds)) {
+      std::cerr << "Seeds with " << nThreads
+                << " threads differ from the serial seeds" << std::endl;
+      return 1;
+    }
+
+    std::cout << "Benchmarking GBTS with " << nThreads
+              << " threads: " << std::flush;
+    const auto result = microBenchmark(
+        [&] {
+          seeds.clear();
+          seeder.createSeeds(spacePoints, roi, layerRadii.size(), filter,
+                             options, seeds);
+        },
+        1, runs, std::chrono::milliseconds(100));
+
+    const double runTime = result.runTimeMedian().count();
+    if (serialTime == 0) {
+      serialTime = runTime;
+    }
+    std::cout << result << std::endl;
+    std::cout << "  speedup " << serialTime / runTime << std::endl;
+    os << nThreads << "," << spacePoints.size() << "," << serialSeeds.size()
+       << "," << result.run_timings.size() << "," << result.iters_per_run
+       << "," << result.totalTime().count() << "," << runTime << ","
+       << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << ","
+       << serialTime / runTime << std::endl;
+  }
+}
@@ -0,0 +1,371 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
+#include "ActsPlugins/Gnn/CpuTrackBuilding.hpp"
+#include "ActsPlugins/Gnn/GnnPipeline.hpp"
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
+#ifdef ACTS_GNN_ONNX_BACKEND
+#include "ActsPlugins/Gnn/OnnxEdgeClassifier.hpp"
+#endif
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsPlugins;
+using namespace ActsTests;
+
+namespace {
+
+constexpr float g_pi = std::numbers::pi_v<float>;
+
+// Toy barrel detector with cylindrical layers, segmented in phi and z
+constexpr std::size_t nLayers = 10;
+constexpr float layerSpacing = 30.f;
+constexpr float halfLength = 1000.f;
+constexpr std::size_t nZModules = 10;
+
+// Scaling of the node features as in the usual GNN pipelines
+constexpr float rScale = 1000.f;
+constexpr float phiScale = g_pi;
+constexpr float zScale = 1000.f;
+
+struct Hit {
+  float r = 0.f;
+  float phi = 0.f;
+  float z = 0.f;
+  float eta = 0.f;
+  std::uint64_t module = 0;
+};
+
+struct Event {
+  std::vector<float> features;
+  std::vector<std::uint64_t> moduleIds;
+  std::vector<int> spacePointIds;
+};
+
+float resetAngle(float angle) {
+  if (angle > g_pi) {
+    return angle - 2.f * g_pi;
+  }
+  if (angle < -g_pi) {
+    return angle + 2.f * g_pi;
+  }
+  return angle;
+}
+
+/// The hits of a helix-like particle from the beam line, one per layer
+std::vector<Hit> simulateParticle(std::mt19937& rng) {
+  std::uniform_real_distribution<float> phiDist(-g_pi, g_pi);
+  std::uniform_real_distribution<float> etaDist(-1.5f, 1.5f);
+  std::uniform_real_distribution<float> curvatureDist(-1e-3f, 1e-3f);
+  std::normal_distribution<float> z0Dist(0.f, 30.f);
+
+  const float phi0 = phiDist(rng);
+  const float cotTheta = std::sinh(etaDist(rng));
+  const float curvature = curvatureDist(rng);
+  const float z0 = z0Dist(rng);
+
+  std::vector<Hit> hits;
+  for (std::size_t layer = 0; layer < nLayers; ++layer) {
+    Hit hit;
+    hit.r = layerSpacing * (layer + 1);
+    hit.phi = resetAngle(phi0 + curvature * hit.r);
+    hit.z = z0 + cotTheta * hit.r;
+    if (std::abs(hit.z) >= halfLength) {
+      break;
+    }
+    hit.eta = std::asinh(hit.z / hit.r);
+
+    const std::size_t nPhiModules = 8 * (layer + 2);
+    const auto phiBin = static_cast<std::size_t>(
+        (hit.phi + g_pi) / (2.f * g_pi) * nPhiModules);
+    const auto zBin = static_cast<std::size_t>(
+        (hit.z + halfLength) / (2.f * halfLength) * nZModules);
+    hit.module = (static_cast<std::uint64_t>(layer) << 32) |
+                 (std::min(phiBin, nPhiModules - 1) << 16) | zBin;
+    hits.push_back(hit);
+  }
+  return hits;
+}
+
+/// Same selection variables as used by the ModuleMapCpu
+std::array<float, 4> doubletVariables(const Hit& a, const Hit& b) {
+  const float dr = b.r - a.r;
+  const float dphi = resetAngle(b.phi - a.phi);
+  return {a.z - a.r * (b.z - a.z) / dr, dphi, dphi / dr, b.eta - a.eta};
+}
+
+std::array<float, 2> tripletVariables(const Hit& a, const Hit& b,
+                                      const Hit& c) {
+  auto dydx = [](const Hit& h1, const Hit& h2) {
+    return (h2.r * std::sin(h2.phi) - h1.r * std::sin(h1.phi)) /
+           (h2.r * std::cos(h2.phi) - h1.r * std::cos(h1.phi));
+  };
+  auto dzdr = [](const Hit& h1, const Hit& h2) {
+    return (h2.z - h1.z) / (h2.r - h1.r);
+  };
+  return {dydx(a, b) - dydx(b, c), dzdr(a, b) - dzdr(b, c)};
+}
+
+void extendCuts(ModuleMapCpu::DoubletCuts& cuts,
+                const std::array<float, 4>& vars, bool first) {
+  auto extend = [&](float& min, float& max, float value) {
+    min = first ? value : std::min(min, value);
+    max = first ? value : std::max(max, value);
+  };
+  extend(cuts.z0Min, cuts.z0Max, vars[0]);
+  extend(cuts.dphiMin, cuts.dphiMax, vars[1]);
+  extend(cuts.phiSlopeMin, cuts.phiSlopeMax, vars[2]);
+  extend(cuts.detaMin, cuts.detaMax, vars[3]);
+}
+
+/// Build the module map from the truth hits of simulated particles, like the
+/// module maps of the real detectors are built
+std::shared_ptr<const ModuleMapCpu::ModuleMap> trainModuleMap(
+    std::size_t nParticles, std::mt19937& rng) {
+  using DoubletKey = std::pair<std::uint64_t, std::uint64_t>;
+  using TripletKey = std::tuple<std::uint64_t, std::uint64_t, std::uint64_t>;
+  std::map<DoubletKey, ModuleMapCpu::Doublet> doublets;
+  std::map<TripletKey, ModuleMapCpu::Triplet> triplets;
+
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    const std::vector<Hit> hits = simulateParticle(rng);
+    for (std::size_t j = 0; j + 1 < hits.size(); ++j) {
+      const Hit& a = hits[j];
+      const Hit& b = hits[j + 1];
+      auto [it, inserted] = doublets.try_emplace({a.module, b.module});
+      it->second.module1 = a.module;
+      it->second.module2 = b.module;
+      extendCuts(it->second.cuts, doubletVariables(a, b), inserted);
+
+      if (j + 2 >= hits.size()) {
+        continue;
+      }
+      const Hit& c = hits[j + 2];
+      auto [tit, tinserted] =
+          triplets.try_emplace({a.module, b.module, c.module});
+      ModuleMapCpu::Triplet& triplet = tit->second;
+      triplet.module1 = a.module;
+      triplet.module2 = b.module;
+      triplet.module3 = c.module;
+      extendCuts(triplet.cuts12, doubletVariables(a, b), tinserted);
+      extendCuts(triplet.cuts23, doubletVariables(b, c), tinserted);
+      const auto [diffDydx, diffDzdr] = tripletVariables(a, b, c);
+      triplet.diffDydxMin =
+          tinserted ? diffDydx : std::min(triplet.diffDydxMin, diffDydx);
+      triplet.diffDydxMax =
+          tinserted ? diffDydx : std::max(triplet.diffDydxMax, diffDydx);
+      triplet.diffDzdrMin =
+          tinserted ? diffDzdr : std::min(triplet.diffDzdrMin, diffDzdr);
+      triplet.diffDzdrMax =
+          tinserted ? diffDzdr : std::max(triplet.diffDzdrMax, diffDzdr);
+    }
+  }
+
+  // Widen the windows a bit, to account for the limited training statistics
+  // and the rounding of the scaled node features
+  auto widen = [](float& min, float& max) {
+    const float margin = 0.05f * (max - min) + 1e-4f;
+    min -= margin;
+    max += margin;
+  };
+  auto widenCuts = [&](ModuleMapCpu::DoubletCuts& cuts) {
+    widen(cuts.z0Min, cuts.z0Max);
+    widen(cuts.dphiMin, cuts.dphiMax);
+    widen(cuts.phiSlopeMin, cuts.phiSlopeMax);
+    widen(cuts.detaMin, cuts.detaMax);
+  };
+
+  auto moduleMap = std::make_shared<ModuleMapCpu::ModuleMap>();
+  for (auto& [key, doublet] : doublets) {
+    widenCuts(doublet.cuts);
+    moduleMap->doublets.push_back(doublet);
+  }
+  for (auto& [key, triplet] : triplets) {
+    widenCuts(triplet.cuts12);
+    widenCuts(triplet.cuts23);
+    widen(triplet.diffDydxMin, triplet.diffDydxMax);
+    widen(triplet.diffDzdrMin, triplet.diffDzdrMax);
+    moduleMap->triplets.push_back(triplet);
+  }
+  return moduleMap;
+}
+
+Event simulateEvent(std::size_t nParticles, std::mt19937& rng) {
+  Event event;
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    for (const Hit& hit : simulateParticle(rng)) {
+      event.features.insert(event.features.end(),
+                            {hit.r / rScale, hit.phi / phiScale,
+                             hit.z / zScale, hit.eta});
+      event.moduleIds.push_back(hit.module);
+      event.spacePointIds.push_back(
+          static_cast<int>(event.spacePointIds.size()));
+    }
+  }
+  return event;
+}
+
+/// Stand-in for a trained edge classifier, if no ONNX model is given. Scores
+/// the edges by their azimuthal slope, which is small for the edges of the
+/// simulated particles.
+class ToyEdgeClassifier final : public EdgeClassificationBase {
+ public:
+  PipelineTensors operator()(PipelineTensors tensors,
+                             const ExecutionContext& execContext) override {
+    const std::size_t nEdges = tensors.edgeIndex.shape()[1];
+    auto scores = Tensor<float>::Create({nEdges, 1}, execContext);
+    const float* edgeFeatures = tensors.edgeFeatures->data();
+    for (std::size_t i = 0; i < nEdges; ++i) {
+      scores.data()[i] = 3.f - 10.f * std::abs(edgeFeatures[6 * i + 4]);
+    }
+
+    sigmoid(scores);
+    auto mask = scoreMask(scores, 0.5f);
+    auto newScores = selectRows(scores, mask, execContext);
+    auto newEdgeIndex = selectCols(tensors.edgeIndex, mask, execContext);
+    auto newEdgeFeatures =
+        selectRows(*tensors.edgeFeatures, mask, execContext);
+    if (newEdgeIndex.shape()[1] == 0) {
+      throw NoEdgesError{};
+    }
+    return {std::move(tensors.nodeFeatures), std::move(newEdgeIndex),
+            std::move(newEdgeFeatures), std::move(newScores)};
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 20;
+  std::size_t nParticles = 2000;
+  std::size_t maxThreads = 8;
+  std::string modelPath;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nParticles = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    maxThreads = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    modelPath = argv[4];
+  }
+
+  std::mt19937 rng(42);
+  const auto moduleMap = trainModuleMap(200000, rng);
+  std::cout << "Module map with " << moduleMap->doublets.size()
+            << " doublets and " << moduleMap->triplets.size() << " triplets"
+            << std::endl;
+
+  std::vector<Event> events;
+  for (std::size_t i = 0; i < 5; ++i) {
+    events.push_back(simulateEvent(nParticles, rng));
+  }
+
+  std::ofstream os{"gnn_cpu_pipeline_bench.csv"};
+  os << "name,threads,particles,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  auto makeEdgeClassifier =
+      [&](std::size_t numThreads) -> std::shared_ptr<EdgeClassificationBase> {
+    if (modelPath.empty()) {
+      return std::make_shared<ToyEdgeClassifier>();
+    }
+#ifdef ACTS_GNN_ONNX_BACKEND
+    OnnxEdgeClassifier::Config cfg;
+    cfg.modelPath = modelPath;
+    cfg.device = Device::Cpu();
+    cfg.numThreads = numThreads;
+    return std::make_shared<OnnxEdgeClassifier>(
+        cfg, getDefaultLogger("OnnxEdgeClassifier", Logging::WARNING));
+#else
+    static_cast<void>(numThreads);
+    throw std::invalid_argument("The GNN plugin is built without ONNX");
+#endif
+  };
+
+  auto bench = [&](const std::string& name, std::size_t numThreads,
+                   std::shared_ptr<TrackBuildingBase> trackBuilder) {
+    ModuleMapCpu::Config graphCfg;
+    graphCfg.moduleMap = moduleMap;
+    graphCfg.rScale = rScale;
+    graphCfg.phiScale = phiScale;
+    graphCfg.zScale = zScale;
+    graphCfg.numThreads = numThreads;
+
+    GnnPipeline pipeline(
+        std::make_shared<ModuleMapCpu>(
+            graphCfg, getDefaultLogger("ModuleMapCpu", Logging::WARNING)),
+        {makeEdgeClassifier(numThreads)}, std::move(trackBuilder),
+        getDefaultLogger("GnnPipeline", Logging::WARNING));
+
+    GnnTiming timing;
+    std::size_t nCandidates = 0;
+    for (const Event& event : events) {
+      Event copy = event;
+      nCandidates += pipeline
+                         .run(copy.features, copy.moduleIds,
+                              copy.spacePointIds, Device::Cpu(), {}, &timing)
+                         .size();
+    }
+
+    std::cout << name << " with " << numThreads << " threads: " << std::flush;
+    const auto result = microBenchmark(
+        [&](const Event& event) {
+          Event copy = event;
+          return pipeline.run(copy.features, copy.moduleIds,
+                              copy.spacePointIds, Device::Cpu());
+        },
+        events, runs);
+    std::cout << result << std::endl;
+    std::cout << "  last event: graph building "
+              << timing.graphBuildingTime.count() << " ms, edge classifier "
+              << timing.classifierTimes.front().count()
+              << " ms, track building " << timing.trackBuildingTime.count()
+              << " ms, " << nCandidates << " candidates in " << events.size()
+              << " events" << std::endl;
+    os << name << "," << numThreads << "," << nParticles << ","
+       << result.run_timings.size() << "," << result.iters_per_run << ","
+       << result.totalTime().count() << "," << result.runTimeMedian().count()
+       << "," << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << std::endl;
+  };
+
+  bench("boost", 1,
+        std::make_shared<BoostTrackBuilding>(
+            BoostTrackBuilding::Config{},
+            getDefaultLogger("BoostTrackBuilding", Logging::WARNING)));
+
+  for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+    CpuTrackBuilding::Config cfg;
+    cfg.numThreads = numThreads;
+    bench("cpu", numThreads,
+          std::make_shared<CpuTrackBuilding>(
+              cfg, getDefaultLogger("CpuTrackBuilding", Logging::WARNING)));
+  }
+}
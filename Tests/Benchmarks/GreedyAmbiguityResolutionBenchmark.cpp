@@ -0,0 +1,163 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsTests;
+
+using State = GreedyAmbiguityResolution::State;
+
+namespace {
+
+/// Creates the resolver state of an event with the given number of particles.
+/// Every particle leaves one good track, a number of duplicates which differ
+/// in a few measurements, and there are fake tracks made of random
+/// measurements.
+State makeEvent(std::size_t nParticles, double duplicatesPerParticle,
+                double fakesPerParticle, std::mt19937& rng) {
+  const std::size_t nLayers = 10;
+  const std::size_t nMeasurements = nParticles * nLayers;
+
+  std::uniform_int_distribution<std::size_t> measDist(0, nMeasurements - 1);
+  std::uniform_int_distribution<std::size_t> layerDist(0, nLayers - 1);
+  std::poisson_distribution<std::size_t> duplicateDist(duplicatesPerParticle);
+  std::uniform_int_distribution<std::size_t> nSwapDist(1, 3);
+  std::gamma_distribution<float> chi2Dist(2., 1.);
+
+  std::vector<std::vector<std::size_t>> measurements;
+  for (std::size_t iParticle = 0; iParticle < nParticles; ++iParticle) {
+    std::vector<std::size_t> truth(nLayers);
+    for (std::size_t iLayer = 0; iLayer < nLayers; ++iLayer) {
+      truth[iLayer] = iParticle * nLayers + iLayer;
+    }
+    measurements.push_back(truth);
+
+    for (std::size_t i = duplicateDist(rng); i > 0; --i) {
+      auto duplicate = truth;
+      for (std::size_t j = nSwapDist(rng); j > 0; --j) {
+        duplicate[layerDist(rng)] = measDist(rng);
+      }
+      measurements.push_back(std::move(duplicate));
+    }
+  }
+  const auto nFakes = static_cast<std::size_t>(fakesPerParticle * nParticles);
+  for (std::size_t i = 0; i < nFakes; ++i) {
+    std::vector<std::size_t> fake(nLayers);
+    std::ranges::generate(fake, [&]() { return measDist(rng); });
+    measurements.push_back(std::move(fake));
+  }
+  std::ranges::shuffle(measurements, rng);
+
+  State state;
+  for (auto& trackMeasurements : measurements) {
+    // a track uses every measurement at most once
+    std::ranges::sort(trackMeasurements);
+    auto duplicates = std::ranges::unique(trackMeasurements);
+    trackMeasurements.erase(duplicates.begin(), duplicates.end());
+
+    state.trackTips.push_back(static_cast<int>(state.numberOfTracks));
+    state.trackChi2.push_back(chi2Dist(rng));
+    state.selectedTracks.insert(state.numberOfTracks);
+    for (auto iMeasurement : trackMeasurements) {
+      state.tracksPerMeasurement[iMeasurement].insert(state.numberOfTracks);
+    }
+    state.measurementsPerTrack.push_back(std::move(trackMeasurements));
+    ++state.numberOfTracks;
+  }
+  state.sharedMeasurementsPerTrack.assign(state.numberOfTracks, 0);
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
+        ++state.sharedMeasurementsPerTrack[iTrack];
+      }
+    }
+  }
+  return state;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 5;
+  double duplicatesPerParticle = 3.;
+  double fakesPerParticle = 1.;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    duplicatesPerParticle = std::stod(argv[2]);
+  }
+  if (argc >= 4) {
+    fakesPerParticle = std::stod(argv[3]);
+  }
+
+  std::ofstream os{"greedy_ambiguity_resolution_bench.csv"};
+  os << "name,particles,tracks,selected,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  std::mt19937 rng(42);
+
+  // Roughly 1k, 4k and 10k particles correspond to pileup 50, 200 and 500
+  for (std::size_t nParticles : {1000u, 4000u, 10000u}) {
+    const State event =
+        makeEvent(nParticles, duplicatesPerParticle, fakesPerParticle, rng);
+
+    std::vector<std::size_t> referenceTracks;
+    for (bool useSharedHitGraph : {false, true}) {
+      GreedyAmbiguityResolution::Config cfg;
+      cfg.maximumIterations = std::numeric_limits<std::uint32_t>::max();
+      cfg.useSharedHitGraph = useSharedHitGraph;
+      GreedyAmbiguityResolution resolver(cfg);
+
+      const std::string name = useSharedHitGraph ? "graph" : "scan";
+
+      // The state copy is part of every iteration for both variants
+      State state;
+      auto resolve = [&]() {
+        state = event;
+        resolver.resolve(state);
+        return state.selectedTracks.size();
+      };
+
+      std::cout << "Resolving " << event.numberOfTracks << " tracks with "
+                << name << ": " << std::flush;
+      const auto result =
+          microBenchmark(resolve, 1, runs, std::chrono::milliseconds(100));
+      std::cout << result << std::endl;
+
+      std::vector<std::size_t> selectedTracks(state.selectedTracks.begin(),
+                                              state.selectedTracks.end());
+      if (!useSharedHitGraph) {
+        referenceTracks = selectedTracks;
+      } else if (selectedTracks != referenceTracks) {
+        std::cerr << "Selected tracks differ between the resolvers"
+                  << std::endl;
+        return 1;
+      }
+
+      os << name << "," << nParticles << "," << event.numberOfTracks << ","
+         << selectedTracks.size() << "," << result.run_timings.size() << ","
+         << result.iters_per_run << "," << result.totalTime().count() << ","
+         << result.runTimeMedian().count() << ","
+         << 1.96 * result.runTimeError().count() << ","
+         << result.iterTimeAverage().count() << ","
+         << 1.96 * result.iterTimeError().count() << std::endl;
+    }
+  }
+}
@@ -0,0 +1,172 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Material/InterpolatedMaterialMap.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace UnitLiterals;
+using namespace ActsTests;
+
+namespace {
+
+using EAxis = Axis<AxisType::Equidistant>;
+using FieldGrid = Grid<Vector3, EAxis, EAxis, EAxis>;
+using MaterialGrid = Grid<Material::ParametersVector, EAxis, EAxis, EAxis>;
+using Point = std::array<double, 3>;
+
+/// Interpolates through the generic neighborhood of the grid, as the grid
+/// did before the corner bins were computed from the strides
+template <typename grid_t>
+typename grid_t::value_type interpolateNeighborhood(const grid_t& grid,
+                                                    const Point& point) {
+  constexpr std::size_t nCorners = 1 << grid_t::DIM;
+  std::array<typename grid_t::value_type, nCorners> neighbors{};
+  const auto localBins = grid.localBinsFromPosition(point);
+  std::size_t i = 0;
+  for (std::size_t bin : grid.closestPointsIndices(point)) {
+    neighbors.at(i++) = grid.at(bin);
+  }
+  return interpolate(point, grid.lowerLeftBinEdge(localBins),
+                     grid.upperRightBinEdge(localBins), neighbors);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t nPoints = 4096;
+  std::size_t iters = 100;
+  std::size_t runs = 50;
+  if (argc >= 2) {
+    nPoints = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    iters = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    runs = std::stoi(argv[3]);
+  }
+
+  // An ATLAS-like solenoid, once as a 3D cartesian grid inside of the coil
+  // and once as the usual r-z field map
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  SolenoidBField solenoid({R, L, 1154, 2_T});
+
+  std::cout << "Building grids" << std::endl;
+  FieldGrid fieldGrid(Type<Vector3>, EAxis(-1_m, 1_m, 60),
+                      EAxis(-1_m, 1_m, 60), EAxis(-L / 2., L / 2., 120));
+  for (std::size_t bin = 0; bin < fieldGrid.size(); ++bin) {
+    const auto llEdge =
+        fieldGrid.lowerLeftBinEdge(fieldGrid.localBinsFromGlobalBin(bin));
+    fieldGrid.at(bin) =
+        solenoid.getField(Vector3(llEdge[0], llEdge[1], llEdge[2]));
+  }
+  auto rzFieldMap = solenoidFieldMap({0., R}, {-L / 2., L / 2.}, {150, 200},
+                                     solenoid);
+
+  // Material classification values which vary smoothly in all directions
+  MaterialGrid materialGrid(Type<Material::ParametersVector>,
+                            EAxis(-1_m, 1_m, 50), EAxis(-1_m, 1_m, 50),
+                            EAxis(-3_m, 3_m, 100));
+  for (std::size_t bin = 0; bin < materialGrid.size(); ++bin) {
+    const auto llEdge =
+        materialGrid.lowerLeftBinEdge(materialGrid.localBinsFromGlobalBin(bin));
+    const double rho = 1. + std::hypot(llEdge[0], llEdge[1]) / 1_m;
+    materialGrid.at(bin) << 95.7 * rho, 465.2 * rho, 28.0855, 14., 2.329 / rho;
+  }
+  MaterialMapLookup<MaterialGrid> materialLookup(
+      [](const Vector3& pos) { return pos; }, materialGrid);
+  InterpolatedMaterialMap materialMap(std::move(materialLookup));
+
+  // Positions inside all grids
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> xyDist(-0.6_m, 0.6_m);
+  std::uniform_real_distribution<double> zDist(-2.5_m, 2.5_m);
+  std::vector<Point> points(nPoints);
+  for (Point& p : points) {
+    p = {xyDist(rng), xyDist(rng), zDist(rng)};
+  }
+
+  std::ofstream os{"grid_bench.csv"};
+  os << "name,points,runs,iters,total_time,run_time_median,run_time_error,"
+        "iter_time_average,iter_time_error"
+     << std::endl;
+
+  // One iteration always looks up all of the points
+  auto bench = [&](const std::string& name, auto&& lookup) {
+    std::cout << "Benchmarking " << name << ": " << std::flush;
+    const auto result = microBenchmark(
+        [&] {
+          double sum = 0.;
+          for (const Point& p : points) {
+            sum += lookup(p);
+          }
+          return sum;
+        },
+        iters, runs);
+    std::cout << result << std::endl;
+    os << name << "," << nPoints << "," << result.run_timings.size() << ","
+       << result.iters_per_run << "," << result.totalTime().count() << ","
+       << result.runTimeMedian().count() << ","
+       << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << std::endl;
+  };
+
+  bench("field_grid_neighborhood", [&](const Point& p) {
+    return interpolateNeighborhood(fieldGrid, p).z();
+  });
+  bench("field_grid_direct",
+        [&](const Point& p) { return fieldGrid.interpolate(p).z(); });
+  bench("field_map_rz", [&](const Point& p) {
+    return rzFieldMap.getFieldUnchecked(Vector3(p[0], p[1], p[2])).z();
+  });
+
+  bench("material_grid_neighborhood", [&](const Point& p) {
+    return interpolateNeighborhood(materialGrid, p)[0];
+  });
+  bench("material_grid_direct",
+        [&](const Point& p) { return materialGrid.interpolate(p)[0]; });
+  bench("material_map_binned", [&](const Point& p) {
+    return materialMap.material(Vector3(p[0], p[1], p[2])).X0();
+  });
+  bench("material_map_interpolated", [&](const Point& p) {
+    return materialMap.getMaterial(Vector3(p[0], p[1], p[2])).X0();
+  });
+
+  // Both interpolations have to agree
+  for (const Point& p : points) {
+    if (!fieldGrid.interpolate(p).isApprox(
+            interpolateNeighborhood(fieldGrid, p)) ||
+        !materialGrid.interpolate(p).isApprox(
+            interpolateNeighborhood(materialGrid, p))) {
+      std::cerr << "Interpolation differs from the neighborhood interpolation"
+                << std::endl;
+      return 1;
+    }
+  }
+}
@@ -0,0 +1,174 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/TrackFitting/GlobalChiSquareFitter.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace ActsTests;
+
+namespace {
+
+/// Input of one toy track, crossing a layer with a 2D measurement and
+/// material for each transport
+struct ToyTrack {
+  std::vector<BoundMatrix> transports;
+  std::vector<BoundVector> predicted;
+  std::vector<Vector2> measurements;
+  std::vector<Vector2> scatteringBVectors;
+};
+
+ToyTrack makeToyTrack(std::size_t nLayers, std::mt19937& rng) {
+  std::normal_distribution<double> gauss(0., 1.);
+
+  ToyTrack track;
+  for (std::size_t iLayer = 0; iLayer < nLayers; ++iLayer) {
+    // Straight line between the layers with a small bending in phi
+    BoundMatrix transport = BoundMatrix::Identity();
+    transport(eBoundLoc0, eBoundPhi) = 30.;
+    transport(eBoundLoc1, eBoundTheta) = 30.;
+    transport(eBoundLoc0, eBoundQOverP) = 0.15;
+    transport(eBoundPhi, eBoundQOverP) = 1e-2;
+    track.transports.push_back(transport);
+
+    BoundVector predicted = BoundVector::Zero();
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      predicted[i] = gauss(rng);
+    }
+    track.predicted.push_back(predicted);
+    track.measurements.emplace_back(predicted[eBoundLoc0] + 0.1 * gauss(rng),
+                                    predicted[eBoundLoc1] + 0.2 * gauss(rng));
+    track.scatteringBVectors.emplace_back(1e-2 * gauss(rng),
+                                          1e-2 * gauss(rng));
+  }
+  return track;
+}
+
+/// Fill the system as the fitter does and solve it once
+Eigen::VectorXd fitToyTrack(const ToyTrack& track, Gx2fSolver solver,
+                            const Logger& logger) {
+  const std::size_t nLayers = track.transports.size();
+  Gx2fSystem extendedSystem{eBoundSize + 2 * (nLayers - 1), solver};
+  const bool structured = solver == Gx2fSolver::eStructured;
+
+  Matrix<2, eBoundSize> projector = Matrix<2, eBoundSize>::Zero();
+  projector(0, eBoundLoc0) = 1.;
+  projector(1, eBoundLoc1) = 1.;
+  const SquareMatrix<2> covariance = Vector2(1e-2, 4e-2).asDiagonal();
+
+  std::vector<BoundMatrix> jacobianFromStart = {BoundMatrix::Identity()};
+  for (std::size_t iLayer = 0; iLayer < nLayers; ++iLayer) {
+    if (structured) {
+      jacobianFromStart.back() =
+          track.transports[iLayer] * jacobianFromStart.back();
+    } else {
+      for (auto& jac : jacobianFromStart) {
+        jac = track.transports[iLayer] * jac;
+      }
+    }
+
+    addMeasurementToGx2fSumsBackend(
+        extendedSystem, jacobianFromStart, covariance, track.predicted[iLayer],
+        track.measurements[iLayer], projector, logger);
+
+    if (iLayer + 1 == nLayers) {
+      break;
+    }
+
+    if (structured) {
+      Gx2fSegment& segment = extendedSystem.segments().emplace_back();
+      segment.transport = jacobianFromStart.back();
+      segment.scatteringAMatrix = 1e4 * SquareMatrix<2>::Identity();
+      segment.scatteringBVector = track.scatteringBVectors[iLayer];
+    } else {
+      const std::size_t deltaPosition = eBoundSize + 2 * iLayer;
+      extendedSystem.aMatrix()(deltaPosition, deltaPosition) += 1e4;
+      extendedSystem.aMatrix()(deltaPosition + 1, deltaPosition + 1) += 1e4;
+      extendedSystem.bVector().segment<2>(deltaPosition) +=
+          track.scatteringBVectors[iLayer];
+    }
+    jacobianFromStart.emplace_back(BoundMatrix::Identity());
+  }
+
+  BoundMatrix covariancePredicted = BoundMatrix::Identity();
+  Eigen::VectorXd deltaParams = computeGx2fDeltaParams(extendedSystem);
+  updateGx2fCovarianceParams(covariancePredicted, extendedSystem);
+  deltaParams.head<eBoundSize>() += covariancePredicted.diagonal();
+  return deltaParams;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 100;
+  std::size_t nTracks = 100;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nTracks = std::stoi(argv[2]);
+  }
+
+  const auto logger = getDefaultLogger("Gx2fSolverBenchmark", Logging::INFO);
+
+  std::ofstream os{"gx2f_solver_bench.csv"};
+  os << "name,layers,tracks,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  std::mt19937 rng(42);
+
+  for (std::size_t nLayers : {5u, 10u, 20u, 40u, 80u, 160u}) {
+    std::vector<ToyTrack> tracks;
+    for (std::size_t i = 0; i < nTracks; ++i) {
+      tracks.push_back(makeToyTrack(nLayers, rng));
+    }
+
+    auto bench = [&](const std::string& name, Gx2fSolver solver) {
+      std::cout << name << " with " << nLayers << " layers: " << std::flush;
+      const auto result = microBenchmark(
+          [&](const ToyTrack& track) {
+            return fitToyTrack(track, solver, *logger);
+          },
+          tracks, runs);
+      std::cout << result << std::endl;
+      os << name << "," << nLayers << "," << nTracks << ","
+         << result.run_timings.size() << "," << result.iters_per_run << ","
+         << result.totalTime().count() << "," << result.runTimeMedian().count()
+         << "," << 1.96 * result.runTimeError().count() << ","
+         << result.iterTimeAverage().count() << ","
+         << 1.96 * result.iterTimeError().count() << std::endl;
+    };
+
+    bench("dense", Gx2fSolver::eDense);
+    bench("structured", Gx2fSolver::eStructured);
+
+    // Both solvers need to find the same solution
+    for (const ToyTrack& track : tracks) {
+      const Eigen::VectorXd dense =
+          fitToyTrack(track, Gx2fSolver::eDense, *logger);
+      const Eigen::VectorXd structured =
+          fitToyTrack(track, Gx2fSolver::eStructured, *logger);
+      if (!dense.isApprox(structured, 1e-3)) {
+        std::cerr << "Structured solution differs from dense solution"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+}
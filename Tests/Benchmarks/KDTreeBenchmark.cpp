@@ -0,0 +1,193 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/KDTree.hpp"
+#include "Acts/Utilities/RangeXD.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsTests;
+
+namespace {
+
+using Point = std::array<float, 3>;
+using Points = std::vector<std::pair<Point, std::size_t>>;
+using Range = RangeXD<3, float>;
+
+/// Creates space point like coordinates in (phi, r, z)
+Points makePoints(std::size_t nPoints, std::mt19937& rng) {
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> rDist(30.f, 1000.f);
+  std::uniform_real_distribution<float> zDist(-3000.f, 3000.f);
+
+  Points points;
+  for (std::size_t i = 0; i < nPoints; ++i) {
+    points.push_back({{phiDist(rng), rDist(rng), zDist(rng)}, i});
+  }
+  return points;
+}
+
+/// Creates query boxes of roughly the size of a seeding doublet search
+std::vector<Range> makeRanges(const Points& points, std::size_t nRanges,
+                              std::mt19937& rng) {
+  std::uniform_int_distribution<std::size_t> pointDist(0, points.size() - 1);
+
+  std::vector<Range> ranges;
+  for (std::size_t i = 0; i < nRanges; ++i) {
+    const Point& c = points[pointDist(rng)].first;
+    Range range;
+    range[0].shrink(c[0] - 0.05f, c[0] + 0.05f);
+    range[1].shrink(c[1], c[1] + 150.f);
+    range[2].shrink(c[2] - 300.f, c[2] + 300.f);
+    ranges.push_back(range);
+  }
+  return ranges;
+}
+
+template <std::size_t LeafSize>
+using Tree = KDTree<3, std::size_t, float, std::array, LeafSize>;
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 10;
+  std::size_t nRanges = 1000;
+  std::size_t k = 8;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nRanges = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    k = std::stoi(argv[3]);
+  }
+
+  std::ofstream os{"kdtree_bench.csv"};
+  os << "name,points,queries,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  std::mt19937 rng(42);
+
+  for (std::size_t nPoints : {10000u, 100000u}) {
+    const Points points = makePoints(nPoints, rng);
+    const std::vector<Range> ranges = makeRanges(points, nRanges, rng);
+
+    Tree<4> tree4{Points(points)};
+    Tree<16> tree16{Points(points)};
+    Tree<64> tree64{Points(points)};
+
+    auto bench = [&](const std::string& name, auto&& iteration) {
+      std::cout << name << " with " << nPoints << " points: " << std::flush;
+      const auto result = microBenchmark(iteration, 1, runs);
+      std::cout << result << std::endl;
+      os << name << "," << nPoints << "," << nRanges << ","
+         << result.run_timings.size() << "," << result.iters_per_run << ","
+         << result.totalTime().count() << "," << result.runTimeMedian().count()
+         << "," << 1.96 * result.runTimeError().count() << ","
+         << result.iterTimeAverage().count() << ","
+         << 1.96 * result.iterTimeError().count() << std::endl;
+    };
+
+    // Linear scan over all points as the baseline
+    bench("range_linear", [&]() {
+      std::size_t found = 0;
+      for (const Range& range : ranges) {
+        for (const auto& [c, v] : points) {
+          found += range.contains(c) ? 1 : 0;
+        }
+      }
+      return found;
+    });
+
+    bench("range_leaf4", [&]() {
+      std::vector<std::size_t> out;
+      for (const Range& range : ranges) {
+        out.clear();
+        tree4.rangeSearch(range, out);
+      }
+      return out.size();
+    });
+    bench("range_leaf16", [&]() {
+      std::vector<std::size_t> out;
+      for (const Range& range : ranges) {
+        out.clear();
+        tree16.rangeSearch(range, out);
+      }
+      return out.size();
+    });
+    bench("range_leaf64", [&]() {
+      std::vector<std::size_t> out;
+      for (const Range& range : ranges) {
+        out.clear();
+        tree64.rangeSearch(range, out);
+      }
+      return out.size();
+    });
+    bench("range_batch_leaf16", [&]() {
+      std::size_t found = 0;
+      tree16.rangeSearchMapDiscardBatch(
+          ranges, [&found](std::size_t, const Point&, std::size_t) {
+            ++found;
+          });
+      return found;
+    });
+
+    // The range centres are used as points for the neighbour search
+    bench("knn_linear", [&]() {
+      std::vector<std::pair<float, std::size_t>> distances(points.size());
+      std::size_t found = 0;
+      for (const Range& range : ranges) {
+        Point p = {range[0].min(), range[1].min(), range[2].min()};
+        for (std::size_t i = 0; i < points.size(); ++i) {
+          const Point& c = points[i].first;
+          float d = 0.f;
+          for (std::size_t j = 0; j < 3; ++j) {
+            d += (c[j] - p[j]) * (c[j] - p[j]);
+          }
+          distances[i] = {d, i};
+        }
+        std::size_t n = std::min(k, points.size());
+        std::partial_sort(distances.begin(), distances.begin() + n,
+                          distances.end());
+        found += distances[n - 1].second;
+      }
+      return found;
+    });
+    bench("knn_leaf16", [&]() {
+      std::size_t found = 0;
+      for (const Range& range : ranges) {
+        Point p = {range[0].min(), range[1].min(), range[2].min()};
+        found += tree16.knnSearch(p, k).back().second;
+      }
+      return found;
+    });
+
+    // The batched search needs to find exactly the same elements
+    std::vector<std::vector<std::size_t>> batch =
+        tree16.rangeSearchBatch(ranges);
+    for (std::size_t q = 0; q < ranges.size(); ++q) {
+      if (batch[q] != tree16.rangeSearch(ranges[q])) {
+        std::cerr << "Batched range search differs from single search"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+}
@@ -0,0 +1,115 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/AsyncPrintPolicy.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsTests;
+
+namespace {
+
+/// Logs the given number of debug messages on every thread
+void logConcurrently(const Logger& baseLogger, std::size_t nThreads,
+                     std::size_t nMessages) {
+  auto work = [&baseLogger, nMessages](std::size_t thread) {
+    ACTS_LOCAL_LOGGER(baseLogger.clone());
+    for (std::size_t im = 0; im < nMessages; ++im) {
+      ACTS_DEBUG("thread " << thread << " message " << im << " value "
+                           << 0.5 * im);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t it = 1; it < nThreads; ++it) {
+    threads.emplace_back(work, it);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 5;
+  std::size_t nMessages = 10000;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nMessages = std::stoi(argv[2]);
+  }
+
+  std::ofstream os{"logger_bench.csv"};
+  os << "name,threads,messages,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  // The default print policy only serializes the output to std::cout, which
+  // is redirected into a file for the benchmark. The progress is reported on
+  // std::cerr instead.
+  std::ofstream syncFile{"logger_bench_sync.log"};
+  std::streambuf* coutBuffer = std::cout.rdbuf(syncFile.rdbuf());
+  auto syncLogger = getDefaultLogger("SyncLogger", Logging::DEBUG);
+
+  std::ofstream blockFile{"logger_bench_block.log"};
+  Logging::AsyncLogSink::Config blockCfg;
+  blockCfg.out = &blockFile;
+  blockCfg.overflowPolicy = Logging::AsyncLogSink::OverflowPolicy::Block;
+  auto blockSink = std::make_shared<Logging::AsyncLogSink>(blockCfg);
+  auto blockLogger = getAsyncLogger("BlockLogger", Logging::DEBUG, blockSink);
+
+  std::ofstream dropFile{"logger_bench_drop.log"};
+  Logging::AsyncLogSink::Config dropCfg = blockCfg;
+  dropCfg.out = &dropFile;
+  dropCfg.overflowPolicy = Logging::AsyncLogSink::OverflowPolicy::Drop;
+  auto dropSink = std::make_shared<Logging::AsyncLogSink>(dropCfg);
+  auto dropLogger = getAsyncLogger("DropLogger", Logging::DEBUG, dropSink);
+
+  // The async variants include waiting for the sink to write everything
+  auto bench = [&](const std::string& name, const Logger& logger,
+                   Logging::AsyncLogSink* sink, std::size_t nThreads) {
+    std::cerr << "Logging " << nMessages << " messages on " << nThreads
+              << " threads, " << name << ": " << std::flush;
+    const auto result = microBenchmark(
+        [&] {
+          logConcurrently(logger, nThreads, nMessages);
+          if (sink != nullptr) {
+            sink->flush();
+          }
+        },
+        1, runs);
+    std::cerr << result << std::endl;
+    os << name << "," << nThreads << "," << nMessages << ","
+       << result.run_timings.size() << "," << result.iters_per_run << ","
+       << result.totalTime().count() << "," << result.runTimeMedian().count()
+       << "," << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << std::endl;
+  };
+
+  for (std::size_t nThreads : {1u, 2u, 4u, 8u, 16u}) {
+    bench("sync", *syncLogger, nullptr, nThreads);
+    bench("async_block", *blockLogger, blockSink.get(), nThreads);
+    bench("async_drop", *dropLogger, dropSink.get(), nThreads);
+  }
+  std::cerr << "Dropped " << dropSink->droppedMessages() << " messages"
+            << std::endl;
+
+  std::cout.rdbuf(coutBuffer);
+}
@@ -0,0 +1,269 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialAccumulator.hpp"
+#include "Acts/Material/MaterialInteraction.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+#include "ActsTests/CommonHelpers/PredefinedMaterials.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsTests;
+
+using State = ISurfaceMaterialAccumulator::State;
+
+namespace {
+
+using Track = std::vector<MaterialInteraction>;
+using Event = std::vector<Track>;
+
+const auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+
+constexpr double halfLengthZ = 500.;
+
+/// Creates barrel-like cylinders with binned proto material
+std::vector<std::shared_ptr<Surface>> makeSurfaces(std::size_t nSurfaces) {
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (std::size_t is = 0; is < nSurfaces; ++is) {
+    auto surface = Surface::makeShared<CylinderSurface>(
+        Transform3::Identity(), 30. + 20. * is, halfLengthZ);
+    surface->assignGeometryId(GeometryIdentifier().withSensitive(is + 1));
+    BinUtility binning(128, -std::numbers::pi, std::numbers::pi, closed,
+                       AxisDirection::AxisPhi);
+    binning += BinUtility(64, -halfLengthZ, halfLengthZ, open,
+                          AxisDirection::AxisZ);
+    surface->assignSurfaceMaterial(
+        std::make_shared<ProtoSurfaceMaterial>(binning));
+    surfaces.push_back(std::move(surface));
+  }
+  return surfaces;
+}
+
+/// Creates the already assigned material interactions of straight tracks
+/// from the origin, one per crossed cylinder.
+Event makeEvent(const std::vector<std::shared_ptr<Surface>>& surfaces,
+                std::size_t nTracks, std::mt19937& rng) {
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> etaDist(-1.5, 1.5);
+  std::uniform_real_distribution<float> thicknessDist(0.1, 0.5);
+  const Material silicon = makeSilicon();
+
+  Event event(nTracks);
+  for (auto& track : event) {
+    const double eta = etaDist(rng);
+    const Vector3 direction = makeDirectionFromPhiEta(phiDist(rng), eta);
+    for (const auto& surface : surfaces) {
+      const auto* cylinder = static_cast<const CylinderSurface*>(surface.get());
+      const double r = cylinder->bounds().get(CylinderBounds::eR);
+      const Vector3 position = r * std::cosh(eta) * direction;
+      if (std::abs(position.z()) > halfLengthZ) {
+        continue;
+      }
+      MaterialInteraction mi;
+      mi.surface = surface.get();
+      mi.position = position;
+      mi.intersection = position;
+      mi.direction = direction;
+      mi.pathCorrection = std::cosh(eta);
+      mi.materialSlab = MaterialSlab(silicon, thicknessDist(rng));
+      track.push_back(mi);
+    }
+  }
+  return event;
+}
+
+/// Maps all events directly into the full state
+void mapSerially(const BinnedSurfaceMaterialAccumulator& accumulator,
+                 State& state, const std::vector<Event>& events) {
+  for (const auto& event : events) {
+    for (const auto& track : event) {
+      accumulator.accumulate(state, gctx, track, {});
+    }
+  }
+}
+
+/// Maps every event into its own partial state on the given number of
+/// threads, the partial states are merged in event order
+void mapConcurrently(const BinnedSurfaceMaterialAccumulator& accumulator,
+                     State& state, const std::vector<Event>& events,
+                     std::size_t nThreads) {
+  std::atomic<std::size_t> nextEvent = 0;
+  std::map<std::size_t, std::unique_ptr<State>> pendingStates;
+  std::size_t nextMergeEvent = 0;
+  std::mutex pendingMutex;
+  std::mutex mergeMutex;
+
+  auto mergePending = [&](bool all) {
+    std::unique_lock<std::mutex> mergeLock(mergeMutex, std::defer_lock);
+    if (all) {
+      mergeLock.lock();
+    } else if (!mergeLock.try_lock()) {
+      return;
+    }
+    while (true) {
+      std::unique_ptr<State> partialState;
+      {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        auto next = pendingStates.begin();
+        if (next == pendingStates.end() ||
+            (!all && next->first != nextMergeEvent)) {
+          break;
+        }
+        nextMergeEvent = next->first + 1;
+        partialState = std::move(next->second);
+        pendingStates.erase(next);
+      }
+      accumulator.mergeState(state, *partialState);
+    }
+  };
+
+  auto work = [&]() {
+    for (std::size_t iEvent = nextEvent++; iEvent < events.size();
+         iEvent = nextEvent++) {
+      auto partialState = accumulator.createPartialState(state);
+      for (const auto& track : events[iEvent]) {
+        accumulator.accumulate(*partialState, gctx, track, {});
+      }
+      {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pendingStates.emplace(iEvent, std::move(partialState));
+      }
+      mergePending(false);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t it = 1; it < nThreads; ++it) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  mergePending(true);
+}
+
+/// Flattens the average thickness of all bins, for comparisons
+std::vector<float> summarize(const State& state) {
+  const auto& cState =
+      static_cast<const BinnedSurfaceMaterialAccumulator::State&>(state);
+  std::vector<float> thicknesses;
+  for (const auto& [geoID, accMaterial] : cState.accumulatedMaterial) {
+    for (const auto& accVec : accMaterial.accumulatedMaterial()) {
+      for (const auto& slab : accVec) {
+        thicknesses.push_back(slab.totalAverage().first.thickness());
+      }
+    }
+  }
+  return thicknesses;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t runs = 5;
+  std::size_t nEvents = 128;
+  std::size_t nTracks = 250;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nEvents = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nTracks = std::stoi(argv[3]);
+  }
+
+  const auto surfaces = makeSurfaces(10);
+  BinnedSurfaceMaterialAccumulator::Config cfg;
+  for (const auto& surface : surfaces) {
+    cfg.materialSurfaces.push_back(surface.get());
+  }
+  cfg.emptyBinCorrection = false;
+  BinnedSurfaceMaterialAccumulator accumulator(cfg);
+
+  std::mt19937 rng(42);
+  std::vector<Event> events;
+  for (std::size_t ie = 0; ie < nEvents; ++ie) {
+    events.push_back(makeEvent(surfaces, nTracks, rng));
+  }
+
+  std::ofstream os{"material_mapping_bench.csv"};
+  os << "name,threads,events,tracks,runs,iters,total_time,run_time_median,"
+        "run_time_error,iter_time_average,iter_time_error"
+     << std::endl;
+
+  auto report = [&](const std::string& name, std::size_t nThreads,
+                    const MicroBenchmarkResult& result) {
+    os << name << "," << nThreads << "," << nEvents << "," << nTracks << ","
+       << result.run_timings.size() << "," << result.iters_per_run << ","
+       << result.totalTime().count() << "," << result.runTimeMedian().count()
+       << "," << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << std::endl;
+  };
+
+  // The state creation is part of every iteration for all variants
+  std::unique_ptr<State> state;
+  {
+    auto map = [&]() {
+      state = accumulator.createState(gctx);
+      mapSerially(accumulator, *state, events);
+    };
+    std::cout << "Mapping " << nEvents << " events into the full state: "
+              << std::flush;
+    const auto result = microBenchmark(map, 1, runs);
+    std::cout << result << std::endl;
+    report("serial", 1, result);
+  }
+
+  std::vector<float> reference;
+  for (std::size_t nThreads : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+    auto map = [&]() {
+      state = accumulator.createState(gctx);
+      mapConcurrently(accumulator, *state, events, nThreads);
+    };
+    std::cout << "Mapping " << nEvents << " events into partial states with "
+              << nThreads << " threads: " << std::flush;
+    const auto result = microBenchmark(map, 1, runs);
+    std::cout << result << std::endl;
+    report("partial", nThreads, result);
+
+    // The merge order is fixed, the maps must not depend on the threads
+    auto thicknesses = summarize(*state);
+    if (reference.empty()) {
+      reference = std::move(thicknesses);
+    } else if (thicknesses != reference) {
+      std::cerr << "Material maps differ between thread counts" << std::endl;
+      return 1;
+    }
+  }
+}
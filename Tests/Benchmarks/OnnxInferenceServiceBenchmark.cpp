@@ -0,0 +1,182 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+#include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ActsPlugins;
+
+namespace {
+
+/// The input of the duplicate classifier of the ML ambiguity resolution for
+/// the track candidates of one event, see AmbiguityTrackClassifier
+NetworkBatchInput simulateEvent(std::size_t nTracks, std::mt19937& rng) {
+  std::uniform_int_distribution<int> nMeasurementsDist(7, 16);
+  std::uniform_int_distribution<int> nOutliersDist(0, 2);
+  std::uniform_int_distribution<int> nHolesDist(0, 2);
+  std::exponential_distribution<float> chi2Dist(1.f);
+  std::uniform_real_distribution<float> etaDist(-3.f, 3.f);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+
+  NetworkBatchInput input(nTracks, 8);
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const int nMeasurements = nMeasurementsDist(rng);
+    const int nOutliers = nOutliersDist(rng);
+    const int nHoles = nHolesDist(rng);
+    const int ndf = 2 * nMeasurements - 5;
+    input(i, 0) = static_cast<float>(nMeasurements + nOutliers + nHoles);
+    input(i, 1) = static_cast<float>(nMeasurements);
+    input(i, 2) = static_cast<float>(nOutliers);
+    input(i, 3) = static_cast<float>(nHoles);
+    input(i, 4) = static_cast<float>(ndf);
+    input(i, 5) = chi2Dist(rng);
+    input(i, 6) = etaDist(rng);
+    input(i, 7) = phiDist(rng);
+  }
+  return input;
+}
+
+/// Process the events in the given number of threads and return the
+/// throughput in events/s
+double eventsPerSecond(
+    const std::function<std::size_t(const NetworkBatchInput&)>& process,
+    const std::vector<NetworkBatchInput>& events, std::size_t nEvents,
+    std::size_t numThreads) {
+  std::atomic<std::size_t> nextEvent = 0;
+  std::atomic<std::size_t> nScores = 0;
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&]() {
+      for (std::size_t i = nextEvent++; i < nEvents; i = nextEvent++) {
+        nScores += process(events[i % events.size()]);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const std::chrono::duration<double> time =
+      std::chrono::steady_clock::now() - start;
+  if (nScores != nEvents * static_cast<std::size_t>(events.front().rows())) {
+    throw std::runtime_error("Unexpected number of scores");
+  }
+  return static_cast<double>(nEvents) / time.count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " <duplicateClassifier.onnx> [tracks per event] [events] "
+                 "[runs] [max threads]"
+              << std::endl;
+    return 1;
+  }
+  const std::string modelPath = argv[1];
+  std::size_t nTracks = 2000;
+  std::size_t nEvents = 500;
+  std::size_t runs = 5;
+  std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc >= 3) {
+    nTracks = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nEvents = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    runs = std::stoi(argv[4]);
+  }
+  if (argc >= 6) {
+    maxThreads = std::stoi(argv[5]);
+  }
+
+  std::mt19937 rng(42);
+  std::vector<NetworkBatchInput> events;
+  for (std::size_t i = 0; i < 20; ++i) {
+    events.push_back(simulateEvent(nTracks, rng));
+  }
+
+  std::ofstream os{"onnx_inference_service_bench.csv"};
+  os << "name,threads,tracks,events,runs,events_per_s_median,"
+        "events_per_s_min,events_per_s_max"
+     << std::endl;
+
+  auto bench = [&](const std::string& name, std::size_t numThreads,
+                   const std::function<std::size_t(const NetworkBatchInput&)>&
+                       process) {
+    std::vector<double> throughputs;
+    for (std::size_t run = 0; run < runs; ++run) {
+      throughputs.push_back(
+          eventsPerSecond(process, events, nEvents, numThreads));
+    }
+    std::ranges::sort(throughputs);
+    const double median = throughputs[throughputs.size() / 2];
+    std::cout << name << " with " << numThreads << " threads: " << median
+              << " events/s (" << throughputs.front() << " - "
+              << throughputs.back() << ")" << std::endl;
+    os << name << "," << numThreads << "," << nTracks << "," << nEvents << ","
+       << runs << "," << median << "," << throughputs.front() << ","
+       << throughputs.back() << std::endl;
+    return median;
+  };
+
+  for (std::size_t numThreads = 1; numThreads <= maxThreads;
+       numThreads *= 2) {
+    // One session with its own spinning thread pool shared by all event
+    // threads, as the classifiers do without an inference service
+    OnnxRuntimeBase runtime(*OnnxInferenceService::environment(),
+                            modelPath.c_str(), Ort::SessionOptions{});
+    const double baseline =
+        bench("runtime", numThreads, [&](const NetworkBatchInput& input) {
+          NetworkBatchInput copy = input;
+          return runtime.runONNXInference(copy).size();
+        });
+
+    // The service running the events concurrently without combining them
+    OnnxInferenceService::Config unbatchedCfg;
+    unbatchedCfg.maxConcurrentBatches = numThreads;
+    OnnxInferenceService unbatchedService(unbatchedCfg);
+    auto unbatched = unbatchedService.loadModel(modelPath);
+    const double unbatchedThroughput =
+        bench("service", numThreads, [&](const NetworkBatchInput& input) {
+          return unbatched->infer(input).size();
+        });
+
+    // The service combining the events into batches
+    OnnxInferenceService batchedService(OnnxInferenceService::Config{});
+    auto batched = batchedService.loadModel(modelPath);
+    const double batchedThroughput =
+        bench("batched", numThreads, [&](const NetworkBatchInput& input) {
+          return batched->infer(input).size();
+        });
+
+    std::cout << "  speed-up vs runtime: service "
+              << unbatchedThroughput / baseline << ", batched "
+              << batchedThroughput / baseline << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,305 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/BroadTripletSeedFilter.hpp"
+#include "Acts/Seeding2/CylindricalSpacePointGrid2.hpp"
+#include "Acts/Seeding2/DoubletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeeder.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using namespace ActsTests;
+
+namespace {
+
+struct SpacePointGroup {
+  std::vector<SpacePointContainer2::ConstRange> bottomSpRanges;
+  SpacePointContainer2::ConstRange middleSpRange;
+  std::vector<SpacePointContainer2::ConstRange> topSpRanges;
+  std::pair<float, float> radiusRangeForMiddle;
+};
+
+bool sameSeeds(const SeedContainer2& a, const SeedContainer2& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (SeedContainer2::Index i = 0; i < a.size(); ++i) {
+    const auto seedA = a[i];
+    const auto seedB = b[i];
+    if (!std::ranges::equal(seedA.spacePointIndices(),
+                            seedB.spacePointIndices()) ||
+        seedA.quality() != seedB.quality() ||
+        seedA.vertexZ() != seedB.vertexZ()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t nTracks = 2000;
+  std::size_t runs = 10;
+  std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  if (argc >= 2) {
+    nTracks = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    maxThreads = std::stoi(argv[3]);
+  }
+
+  const float bFieldInZ = 2_T;
+  const float minPt = 500_MeV;
+
+  // Space points of helices crossing a set of barrel layers
+  const std::vector<float> layerRadii = {32_mm,  72_mm,  116_mm, 172_mm,
+                                         260_mm, 360_mm, 500_mm};
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<float> ptDist(minPt, 10_GeV);
+  std::normal_distribution<float> z0Dist(0, 50_mm);
+  std::normal_distribution<float> noiseDist(0, 0.01_mm);
+
+  std::vector<std::array<float, 3>> rawSpacePoints;
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = std::sinh(etaDist(rng));
+    const float z0 = z0Dist(rng);
+    const float q = (i % 2 == 0) ? 1 : -1;
+    // helix radius in mm for pt in GeV and field in T
+    const float radius = ptDist(rng) / (0.3f * bFieldInZ / 1_T) / 1_GeV * 1_m;
+    for (float r : layerRadii) {
+      if (r > 2 * radius) {
+        break;
+      }
+      const float phi = phi0 + q * std::asin(r / (2 * radius));
+      const float z = z0 + r * cotTheta;
+      rawSpacePoints.push_back({r * std::cos(phi) + noiseDist(rng),
+                                r * std::sin(phi) + noiseDist(rng), z});
+    }
+  }
+
+  CylindricalSpacePointGrid2::Config gridConfig;
+  gridConfig.minPt = minPt;
+  gridConfig.rMax = 600_mm;
+  gridConfig.zMin = -2800_mm;
+  gridConfig.zMax = 2800_mm;
+  gridConfig.deltaRMax = 270_mm;
+  gridConfig.impactMax = 20_mm;
+  gridConfig.zBinEdges = {-2800, -2500, -1400, -925, -500, -250, 0,
+                          250,   500,   925,   1400, 2500, 2800};
+  gridConfig.bFieldInZ = bFieldInZ;
+  gridConfig.bottomBinFinder.emplace(1, 1, 0);
+  gridConfig.topBinFinder.emplace(1, 1, 0);
+  CylindricalSpacePointGrid2 grid(gridConfig);
+
+  for (std::size_t i = 0; i < rawSpacePoints.size(); ++i) {
+    const auto& [x, y, z] = rawSpacePoints[i];
+    grid.insert(i, std::atan2(y, x), z, std::hypot(x, y));
+  }
+
+  // Copy the space points in grid order, sorted by radius in each bin
+  SpacePointContainer2 spacePoints(
+      SpacePointColumns::PackedXY | SpacePointColumns::PackedZR |
+      SpacePointColumns::VarianceZ | SpacePointColumns::VarianceR);
+  std::vector<SpacePointIndexRange2> binRanges;
+  for (std::size_t i = 0; i < grid.numberOfBins(); ++i) {
+    auto& bin = grid.at(i);
+    std::ranges::sort(bin, {}, [&](SpacePointIndex2 index) {
+      return std::hypot(rawSpacePoints[index][0], rawSpacePoints[index][1]);
+    });
+    const std::uint32_t begin = spacePoints.size();
+    for (SpacePointIndex2 index : bin) {
+      const auto& [x, y, z] = rawSpacePoints[index];
+      auto sp = spacePoints.createSpacePoint();
+      sp.xy() = std::array<float, 2>{x, y};
+      sp.zr() = std::array<float, 2>{z, std::hypot(x, y)};
+      sp.varianceZ() = 0.01_mm * 0.01_mm;
+      sp.varianceR() = 0.01_mm * 0.01_mm;
+    }
+    binRanges.emplace_back(begin, spacePoints.size());
+  }
+
+  std::vector<SpacePointGroup> groups;
+  for (const auto [bottom, middle, top] : grid.binnedGroup()) {
+    const auto middleSpRange =
+        spacePoints.range(binRanges.at(middle)).asConst();
+    if (middleSpRange.empty()) {
+      continue;
+    }
+    SpacePointGroup& group =
+        groups.emplace_back(SpacePointGroup{{}, middleSpRange, {}, {}});
+    for (const auto b : bottom) {
+      group.bottomSpRanges.push_back(
+          spacePoints.range(binRanges.at(b)).asConst());
+    }
+    for (const auto t : top) {
+      group.topSpRanges.push_back(spacePoints.range(binRanges.at(t)).asConst());
+    }
+    group.radiusRangeForMiddle = {50_mm, 400_mm};
+  }
+
+  DoubletSeedFinder::Config bottomConfig;
+  bottomConfig.spacePointsSortedByRadius = true;
+  bottomConfig.candidateDirection = Direction::Backward();
+  bottomConfig.minPt = minPt;
+  auto bottomFinder = DoubletSeedFinder::create(
+      DoubletSeedFinder::DerivedConfig(bottomConfig, bFieldInZ));
+  DoubletSeedFinder::Config topConfig = bottomConfig;
+  topConfig.candidateDirection = Direction::Forward();
+  auto topFinder = DoubletSeedFinder::create(
+      DoubletSeedFinder::DerivedConfig(topConfig, bFieldInZ));
+
+  TripletSeedFinder::Config tripletConfig;
+  tripletConfig.minPt = minPt;
+  auto tripletFinder = TripletSeedFinder::create(
+      TripletSeedFinder::DerivedConfig(tripletConfig, bFieldInZ));
+
+  BroadTripletSeedFilter::Config filterConfig;
+  auto filterLogger = getDefaultLogger("Filter", Logging::INFO);
+
+  TripletSeeder seeder;
+
+  std::cout << "Seeding " << spacePoints.size() << " space points in "
+            << groups.size() << " middle groups" << std::endl;
+
+  std::ofstream os{"seeding_bench.csv"};
+  os << "name,threads,space_points,seeds,runs,iters,total_time,"
+        "run_time_median,run_time_error,iter_time_average,iter_time_error,"
+        "speedup"
+     << std::endl;
+
+  // The groups are modified by the seeder, so each run works on a copy
+  auto runSerial = [&](SeedContainer2& seeds) {
+    BroadTripletSeedFilter::State filterState;
+    BroadTripletSeedFilter::Cache filterCache;
+    BroadTripletSeedFilter filter(filterConfig, filterState, filterCache,
+                                  *filterLogger);
+    TripletSeeder::Cache cache;
+    std::vector<SpacePointGroup> runGroups = groups;
+
+    seeds.clear();
+    for (SpacePointGroup& group : runGroups) {
+      seeder.createSeedsFromGroups(
+          cache, *bottomFinder, *topFinder, *tripletFinder, filter,
+          spacePoints, group.bottomSpRanges, group.middleSpRange,
+          group.topSpRanges, group.radiusRangeForMiddle, seeds);
+    }
+  };
+
+  auto runParallel = [&](SeedContainer2& seeds, std::size_t nThreads) {
+    BroadTripletSeedFilter::State filterState;
+    BroadTripletSeedFilter::Cache filterCache;
+    BroadTripletSeedFilter filter(filterConfig, filterState, filterCache,
+                                  *filterLogger);
+    std::vector<SpacePointGroup> runGroups = groups;
+    std::vector<TripletSeeder::CandidateRecord> records(runGroups.size());
+
+    std::atomic<std::size_t> nextGroup = 0;
+    auto worker = [&]() {
+      TripletSeeder::Cache cache;
+      for (std::size_t i = nextGroup++; i < runGroups.size();
+           i = nextGroup++) {
+        SpacePointGroup& group = runGroups[i];
+        seeder.recordCandidatesFromGroups(
+            cache, *bottomFinder, *topFinder, *tripletFinder, spacePoints,
+            group.bottomSpRanges, group.middleSpRange, group.topSpRanges,
+            group.radiusRangeForMiddle, records[i]);
+      }
+    };
+    std::vector<std::thread> threads;
+    for (std::size_t t = 1; t < nThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    TripletSeeder::Cache cache;
+    seeds.clear();
+    for (const TripletSeeder::CandidateRecord& record : records) {
+      seeder.filterRecordedCandidates(cache, filter, spacePoints, record,
+                                      seeds);
+    }
+  };
+
+  SeedContainer2 serialSeeds;
+  serialSeeds.assignSpacePointContainer(spacePoints);
+  runSerial(serialSeeds);
+
+  double serialTime = 0;
+  auto report = [&](const std::string& name, std::size_t nThreads,
+                    const auto& result) {
+    const double runTime = result.runTimeMedian().count();
+    if (serialTime == 0) {
+      serialTime = runTime;
+    }
+    std::cout << result << std::endl;
+    std::cout << "  speedup " << serialTime / runTime << std::endl;
+    os << name << "," << nThreads << "," << spacePoints.size() << ","
+       << serialSeeds.size() << "," << result.run_timings.size() << ","
+       << result.iters_per_run << "," << result.totalTime().count() << ","
+       << runTime << "," << 1.96 * result.runTimeError().count() << ","
+       << result.iterTimeAverage().count() << ","
+       << 1.96 * result.iterTimeError().count() << ","
+       << serialTime / runTime << std::endl;
+  };
+
+  {
+    SeedContainer2 seeds;
+    seeds.assignSpacePointContainer(spacePoints);
+    std::cout << "Benchmarking serial seeding: " << std::flush;
+    const auto result =
+        microBenchmark([&] { runSerial(seeds); }, 1, runs,
+                       std::chrono::milliseconds(100));
+    report("serial", 1, result);
+  }
+
+  for (std::size_t nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+    SeedContainer2 seeds;
+    seeds.assignSpacePointContainer(spacePoints);
+    runParallel(seeds, nThreads);
+    if (!sameSeeds(seeds, serialSeeds)) {
+      std::cerr << "Seeds with " << nThreads
+                << " threads differ from the serial seeds" << std::endl;
+      return 1;
+    }
+
+    std::cout << "Benchmarking parallel seeding with " << nThreads
+              << " threads: " << std::flush;
+    const auto result =
+        microBenchmark([&] { runParallel(seeds, nThreads); }, 1, runs,
+                       std::chrono::milliseconds(100));
+    report("parallel", nThreads, result);
+  }
+}
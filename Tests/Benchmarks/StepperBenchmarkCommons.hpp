@@ -18,7 +18,12 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <numbers>
+#include <span>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -35,6 +40,7 @@ struct BenchmarkStepper {
   double maxPathInM{};
   unsigned int lvl{};
   bool withCov{};
+  unsigned int batchSize{};
 
   std::optional<int> parseOptions(int argc, char* argv[]) {
     try {
@@ -47,6 +53,7 @@ struct BenchmarkStepper {
         ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
         ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
         ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+        ("batch",po::value<unsigned int>(&batchSize)->default_value(16),"number of tracks propagated together by batching steppers")
         ("verbose",po::value<unsigned int>(&lvl)->default_value(Logging::INFO),"logging level");
       // clang-format on
       po::variables_map vm;
@@ -142,6 +149,96 @@ struct BenchmarkStepper {
     ACTS_INFO("average number of steps = " << 1.0 * numSteps / numIters);
     ACTS_INFO("step efficiency = " << 1.0 * numSteps / numStepTrials);
   }
+
+  /// Same as `run` but propagates the tracks in batches of `batchSize` with
+  /// `Propagator::propagateBatch`
+  template <typename Stepper>
+  void runBatch(Stepper stepper, const std::string& name) const {
+    using Propagator = Propagator<Stepper>;
+    using PropagatorOptions = typename Propagator::template Options<>;
+    using Covariance = BoundMatrix;
+
+    // Create a test context
+    GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+    MagneticFieldContext mfContext = MagneticFieldContext();
+
+    ACTS_LOCAL_LOGGER(getDefaultLogger(name, Logging::Level(lvl)));
+
+    const unsigned int nBatches = std::max(toys / std::max(batchSize, 1u), 1u);
+
+    // print information about profiling setup
+    ACTS_INFO("propagating " << nBatches << " batches of " << batchSize
+                             << " tracks with pT = " << ptInGeV << "GeV in a "
+                             << BzInT << "T B-field");
+
+    Propagator propagator(std::move(stepper));
+
+    PropagatorOptions options(tgContext, mfContext);
+    options.pathLimit = maxPathInM * UnitConstants::m;
+
+    Covariance cov;
+    // clang-format off
+    cov << 10_mm, 0, 0, 0, 0, 0,
+            0, 10_mm, 0, 0, 0, 0,
+            0, 0, 1, 0, 0, 0,
+            0, 0, 0, 1, 0, 0,
+            0, 0, 0, 0, 1_e / 10_GeV, 0,
+            0, 0, 0, 0, 0, 0;
+    // clang-format on
+
+    std::optional<Covariance> covOpt = std::nullopt;
+    if (withCov) {
+      covOpt = cov;
+    }
+
+    // spread the tracks in azimuth
+    std::vector<BoundTrackParameters> pars;
+    for (unsigned int i = 0; i < batchSize; ++i) {
+      const double phi = 2 * std::numbers::pi * i / batchSize;
+      pars.push_back(BoundTrackParameters::createCurvilinear(
+          Vector4::Zero(), Vector3(std::cos(phi), std::sin(phi), 0),
+          +1 / ptInGeV, covOpt, ParticleHypothesis::pion()));
+    }
+
+    using State = decltype(propagator.makeState(options));
+    std::vector<State> states;
+    states.reserve(batchSize);
+
+    double totalPathLength = 0;
+    std::size_t numSteps = 0;
+    std::size_t numStepTrials = 0;
+    std::size_t numTracks = 0;
+    const auto propagationBenchResult = microBenchmark(
+        [&] {
+          states.clear();
+          for (const auto& par : pars) {
+            states.push_back(propagator.makeState(options));
+            auto initRes = propagator.initialize(states.back(), par);
+            if (!initRes.ok()) {
+              ACTS_ERROR("initialization failed: " << initRes.error());
+              return;
+            }
+          }
+          auto results = propagator.propagateBatch(std::span<State>(states));
+          for (std::size_t i = 0; i < states.size(); ++i) {
+            auto r = propagator
+                         .makeResult(std::move(states[i]), results[i],
+                                     options, true)
+                         .value();
+            totalPathLength += r.pathLength;
+            numSteps += r.steps;
+            numStepTrials += r.statistics.stepping.nAttemptedSteps;
+            ++numTracks;
+          }
+        },
+        1, nBatches);
+
+    ACTS_INFO("Execution stats: " << propagationBenchResult);
+    ACTS_INFO("average path length = " << totalPathLength / numTracks / 1_mm
+                                       << "mm");
+    ACTS_INFO("average number of steps = " << 1.0 * numSteps / numTracks);
+    ACTS_INFO("step efficiency = " << 1.0 * numSteps / numStepTrials);
+  }
 };
 
 }  // namespace ActsTests
@@ -28,6 +28,8 @@
 
 #include <algorithm>
 #include <random>
+#include <thread>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::UnitLiterals;
@@ -250,3 +252,105 @@ BOOST_DATA_TEST_CASE(FatrasSimulationCase, dataset, pdg, phi, eta, p,
     BOOST_CHECK(containsParticleId(simulatedFinal, hit));
   }
 }
+
+BOOST_AUTO_TEST_CASE(FatrasSimulationIndependently) {
+  auto geoCtx = GeometryContext::dangerouslyDefaultConstruct();
+  MagneticFieldContext magCtx;
+
+  CylindricalTrackingGeometry geoBuilder(geoCtx);
+  auto trackingGeometry = geoBuilder();
+
+  Navigator navigator({trackingGeometry});
+  ChargedStepper chargedStepper(
+      std::make_shared<ConstantBField>(Vector3{0, 0, 1_T}));
+  ChargedPropagator chargedPropagator(std::move(chargedStepper), navigator);
+  NeutralPropagator neutralPropagator(NeutralStepper(), navigator);
+  FatrasSimulation simulator(
+      ChargedSimulation(std::move(chargedPropagator),
+                        getDefaultLogger("ChargedSimulation", Logging::INFO)),
+      NeutralSimulation(std::move(neutralPropagator),
+                        getDefaultLogger("NeutralSimulation", Logging::INFO)));
+
+  std::vector<ActsFatras::Particle> input;
+  for (int i = 1; i <= 16; ++i) {
+    const auto pid =
+        ActsFatras::Barcode().withVertexPrimary(42).withParticle(i);
+    input.push_back(ActsFatras::Particle(pid, PdgParticle::eElectron)
+                        .setDirection(makeDirectionFromPhiEta(0.4 * i, 0.5))
+                        .setAbsoluteMomentum(10_GeV));
+  }
+
+  // the generator only depends on the particle id
+  auto makeGenerator = [](const ActsFatras::Particle& particle) {
+    return Generator(particle.particleId().hash());
+  };
+
+  struct Output {
+    std::vector<ActsFatras::Particle> initial;
+    std::vector<ActsFatras::Particle> final;
+    std::vector<ActsFatras::Hit> hits;
+  };
+  auto simulate = [&](auto&& forEach) {
+    Output output;
+    auto result = simulator.simulateIndependently(
+        geoCtx, magCtx, makeGenerator, input, output.initial, output.final,
+        output.hits, forEach);
+    BOOST_CHECK(result.ok());
+    BOOST_CHECK(result->empty());
+    return output;
+  };
+
+  auto sequential = simulate([](std::size_t n, const auto& simulateOne) {
+    for (std::size_t i = 0; i < n; ++i) {
+      simulateOne(i);
+    }
+  });
+  auto reversed = simulate([](std::size_t n, const auto& simulateOne) {
+    for (std::size_t i = n; 0 < i; --i) {
+      simulateOne(i - 1);
+    }
+  });
+  auto threaded = simulate([](std::size_t n, const auto& simulateOne) {
+    std::vector<std::jthread> threads;
+    for (std::size_t i = 0; i < n; ++i) {
+      threads.emplace_back([&simulateOne, i]() { simulateOne(i); });
+    }
+  });
+
+  // the splitting process generates secondaries
+  BOOST_CHECK_LT(input.size(), sequential.initial.size());
+  BOOST_CHECK_EQUAL(sequential.initial.size(), sequential.final.size());
+  BOOST_CHECK_LT(0u, sequential.hits.size());
+
+  // same result as simulating each particle on its own
+  Output single;
+  std::vector<FailedParticle> failed;
+  for (const auto& particle : input) {
+    auto generator = makeGenerator(particle);
+    BOOST_CHECK(simulator
+                    .simulateParticle(geoCtx, magCtx, generator, particle,
+                                      single.initial, single.final,
+                                      single.hits, failed)
+                    .ok());
+  }
+  BOOST_CHECK(failed.empty());
+
+  for (const Output* other : {&reversed, &threaded, &single}) {
+    BOOST_REQUIRE_EQUAL(other->final.size(), sequential.final.size());
+    for (std::size_t i = 0; i < sequential.final.size(); ++i) {
+      BOOST_CHECK_EQUAL(other->initial[i].particleId(),
+                        sequential.initial[i].particleId());
+      BOOST_CHECK_EQUAL(other->final[i].particleId(),
+                        sequential.final[i].particleId());
+      BOOST_CHECK_EQUAL(other->final[i].fourPosition(),
+                        sequential.final[i].fourPosition());
+    }
+    BOOST_REQUIRE_EQUAL(other->hits.size(), sequential.hits.size());
+    for (std::size_t i = 0; i < sequential.hits.size(); ++i) {
+      BOOST_CHECK_EQUAL(other->hits[i].particleId(),
+                        sequential.hits[i].particleId());
+      BOOST_CHECK_EQUAL(other->hits[i].fourPosition(),
+                        sequential.hits[i].fourPosition());
+    }
+  }
+}
@@ -11,10 +11,13 @@
 #include "Acts/EventData/detail/TestSourceLink.hpp"
 #include "Acts/Geometry/CuboidVolumeBuilder.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
 #include "ActsAlignment/Kernel/Alignment.hpp"
 #include "ActsTests/CommonHelpers/AlignmentHelpers.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
+#include <random>
 #include <string>
 
 using namespace Acts;
@@ -137,3 +140,99 @@ BOOST_AUTO_TEST_CASE(ZeroFieldKalmanAlignment) {
 
   // BOOST_CHECK(alignRes.ok());
 }
+
+///
+/// @brief Unit test for the sparse solvers of the alignment equation
+///
+BOOST_AUTO_TEST_CASE(SparseAlignmentSolvers) {
+  // The alignment equation does not need a fitter
+  struct NoFitter {};
+  const ActsAlignment::Alignment<NoFitter> alignment(NoFitter{});
+
+  // A chain of surfaces where every toy track crosses a few neighbouring ones
+  constexpr std::size_t nSurfaces = 20;
+  constexpr std::size_t nSurfacesPerTrack = 4;
+  constexpr std::size_t nTracks = 200;
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  // The last surface is not crossed by any track
+  for (std::size_t i = 0; i < nSurfaces + 1; i++) {
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        Transform3::Identity(), std::make_shared<RectangleBounds>(1., 1.)));
+  }
+
+  std::mt19937 rng(1234);
+  std::normal_distribution<double> gauss(0., 1.);
+  std::uniform_int_distribution<std::size_t> firstSurface(
+      0, nSurfaces - nSurfacesPerTrack);
+  std::vector<ActsAlignment::detail::TrackAlignmentState> alignStates;
+  for (std::size_t iTrack = 0; iTrack < nTracks; iTrack++) {
+    ActsAlignment::detail::TrackAlignmentState alignState;
+    alignState.alignmentDof = nSurfacesPerTrack * eAlignmentSize;
+    alignState.measurementDim = 2 * alignState.alignmentDof;
+    const std::size_t first = firstSurface(rng);
+    for (std::size_t i = 0; i < nSurfacesPerTrack; i++) {
+      alignState.alignedSurfaces[surfaces.at(first + i).get()] = {first + i, i};
+    }
+    DynamicMatrix residualDerivative(alignState.measurementDim,
+                                     alignState.alignmentDof);
+    DynamicVector residual(alignState.measurementDim);
+    for (auto& value : residualDerivative.reshaped()) {
+      value = gauss(rng);
+    }
+    for (auto& value : residual) {
+      value = gauss(rng);
+    }
+    alignState.chi2 = residual.squaredNorm();
+    alignState.alignmentToChi2Derivative =
+        2 * residualDerivative.transpose() * residual;
+    alignState.alignmentToChi2SecondDerivative =
+        2 * residualDerivative.transpose() * residualDerivative;
+    alignStates.push_back(alignState);
+  }
+
+  ActsAlignment::AlignmentResult denseResult;
+  for (std::size_t i = 0; i < nSurfaces; i++) {
+    denseResult.idxedAlignSurfaces.emplace(surfaces.at(i).get(), i);
+  }
+  alignment.calculateAlignmentParameters(alignStates, denseResult);
+  BOOST_CHECK(denseResult.result.ok());
+  BOOST_CHECK_EQUAL(denseResult.numTracks, nTracks);
+  BOOST_CHECK_EQUAL(denseResult.alignmentCovarianceBlocks.size(), nSurfaces);
+
+  using ActsAlignment::AlignmentSolver;
+  for (auto solver :
+       {AlignmentSolver::SparseCholesky, AlignmentSolver::ConjugateGradient}) {
+    for (std::size_t numThreads : {1u, 3u}) {
+      ActsAlignment::AlignmentSolverOptions solverOptions;
+      solverOptions.solver = solver;
+      solverOptions.numThreads = numThreads;
+
+      ActsAlignment::AlignmentResult alignResult;
+      alignResult.idxedAlignSurfaces = denseResult.idxedAlignSurfaces;
+      alignResult.idxedAlignSurfaces.emplace(surfaces.back().get(), nSurfaces);
+      alignment.calculateAlignmentParameters(alignStates, alignResult,
+                                             solverOptions);
+      BOOST_CHECK(alignResult.result.ok());
+      BOOST_CHECK_EQUAL(alignResult.alignmentCovariance.size(), 0);
+      BOOST_REQUIRE_EQUAL(alignResult.alignmentCovarianceBlocks.size(),
+                          nSurfaces + 1);
+      CHECK_CLOSE_REL(alignResult.chi2, denseResult.chi2, 1e-12);
+      CHECK_CLOSE_REL(alignResult.deltaChi2, denseResult.deltaChi2, 1e-6);
+
+      const DynamicVector delta =
+          alignResult.deltaAlignmentParameters.head(nSurfaces *
+                                                    eAlignmentSize);
+      CHECK_CLOSE_ABS(delta, denseResult.deltaAlignmentParameters, 1e-6);
+      for (std::size_t i = 0; i < nSurfaces; i++) {
+        CHECK_CLOSE_ABS(alignResult.alignmentCovarianceBlocks.at(i),
+                        denseResult.alignmentCovarianceBlocks.at(i), 1e-6);
+      }
+      // The surface without tracks stays where it is
+      CHECK_CLOSE_ABS(
+          alignResult.deltaAlignmentParameters.tail<eAlignmentSize>(),
+          AlignmentVector::Zero(), 1e-12);
+      CHECK_CLOSE_ABS(alignResult.alignmentCovarianceBlocks.back(),
+                      AlignmentMatrix::Zero(), 1e-12);
+    }
+  }
+}
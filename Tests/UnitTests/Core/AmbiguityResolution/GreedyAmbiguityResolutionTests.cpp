@@ -0,0 +1,155 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+using State = GreedyAmbiguityResolution::State;
+
+/// Fills the state the same way as `computeInitialState` without the need
+/// for a track container.
+State makeState(const std::vector<std::vector<std::size_t>>& measurements,
+                const std::vector<float>& chi2) {
+  State state;
+  state.numberOfTracks = measurements.size();
+  state.trackChi2 = chi2;
+  state.measurementsPerTrack = measurements;
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    state.trackTips.push_back(static_cast<int>(iTrack));
+    state.selectedTracks.insert(iTrack);
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
+    }
+  }
+  state.sharedMeasurementsPerTrack.assign(state.numberOfTracks, 0);
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
+        ++state.sharedMeasurementsPerTrack[iTrack];
+      }
+    }
+  }
+  return state;
+}
+
+void checkEqualStates(const State& a, const State& b) {
+  BOOST_CHECK_EQUAL_COLLECTIONS(a.selectedTracks.begin(),
+                                a.selectedTracks.end(),
+                                b.selectedTracks.begin(),
+                                b.selectedTracks.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(a.sharedMeasurementsPerTrack.begin(),
+                                a.sharedMeasurementsPerTrack.end(),
+                                b.sharedMeasurementsPerTrack.begin(),
+                                b.sharedMeasurementsPerTrack.end());
+  BOOST_REQUIRE_EQUAL(a.tracksPerMeasurement.size(),
+                      b.tracksPerMeasurement.size());
+  for (const auto& [iMeasurement, tracks] : a.tracksPerMeasurement) {
+    const auto& other = b.tracksPerMeasurement.at(iMeasurement);
+    BOOST_CHECK_EQUAL_COLLECTIONS(tracks.begin(), tracks.end(), other.begin(),
+                                  other.end());
+  }
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(AmbiguitesResolutionSuite)
+
+BOOST_AUTO_TEST_CASE(GreedyAmbiguityResolutionSimple) {
+  // track 1 shares all its measurements, track 0 and 2 share one each
+  std::vector<std::vector<std::size_t>> measurements = {
+      {0, 1, 2, 3}, {3, 4, 5, 6}, {4, 5, 6, 7}, {8, 9, 10, 11}};
+  std::vector<float> chi2 = {1, 1, 1, 1};
+
+  for (bool useSharedHitGraph : {false, true}) {
+    GreedyAmbiguityResolution::Config cfg;
+    cfg.maximumSharedHits = 1;
+    cfg.useSharedHitGraph = useSharedHitGraph;
+    GreedyAmbiguityResolution resolver(cfg);
+
+    State state = makeState(measurements, chi2);
+    BOOST_CHECK_EQUAL(state.sharedMeasurementsPerTrack[1], 4u);
+    resolver.resolve(state);
+
+    std::vector<std::size_t> expected = {0, 2, 3};
+    BOOST_CHECK_EQUAL_COLLECTIONS(state.selectedTracks.begin(),
+                                  state.selectedTracks.end(), expected.begin(),
+                                  expected.end());
+    for (std::size_t iTrack : state.selectedTracks) {
+      BOOST_CHECK_EQUAL(state.sharedMeasurementsPerTrack[iTrack], 0u);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GreedyAmbiguityResolutionSharedHitGraph) {
+  std::mt19937 rng(1234);
+
+  for (std::size_t event = 0; event < 50; ++event) {
+    const std::size_t nTracks = 100 + 20 * event;
+    const std::size_t nMeasurements = 4 * nTracks;
+
+    std::uniform_int_distribution<std::size_t> nMeasDist(7, 12);
+    std::uniform_int_distribution<std::size_t> measDist(0, nMeasurements - 1);
+    // few distinct values to provoke ties in the track comparison
+    std::uniform_int_distribution<int> chi2Dist(1, 4);
+
+    std::vector<std::vector<std::size_t>> measurements(nTracks);
+    std::vector<float> chi2(nTracks);
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      const std::size_t nTrackMeasurements = nMeasDist(rng);
+      while (measurements[iTrack].size() < nTrackMeasurements) {
+        std::size_t iMeasurement = measDist(rng);
+        if (std::ranges::find(measurements[iTrack], iMeasurement) ==
+            measurements[iTrack].end()) {
+          measurements[iTrack].push_back(iMeasurement);
+        }
+      }
+      chi2[iTrack] = static_cast<float>(chi2Dist(rng));
+    }
+
+    for (std::uint32_t maximumSharedHits : {0u, 1u, 3u}) {
+      for (std::uint32_t maximumIterations : {10u, 10000u}) {
+        GreedyAmbiguityResolution::Config cfg;
+        cfg.maximumSharedHits = maximumSharedHits;
+        cfg.maximumIterations = maximumIterations;
+
+        State reference = makeState(measurements, chi2);
+        GreedyAmbiguityResolution(cfg).resolve(reference);
+
+        cfg.useSharedHitGraph = true;
+        State state = makeState(measurements, chi2);
+        GreedyAmbiguityResolution(cfg).resolve(state);
+
+        checkEqualStates(state, reference);
+
+        // resolving again continues from the remaining tracks
+        cfg.maximumIterations = 10000;
+        cfg.useSharedHitGraph = false;
+        GreedyAmbiguityResolution(cfg).resolve(reference);
+        cfg.useSharedHitGraph = true;
+        GreedyAmbiguityResolution(cfg).resolve(state);
+
+        checkEqualStates(state, reference);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
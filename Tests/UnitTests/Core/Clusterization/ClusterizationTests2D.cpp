@@ -116,6 +116,10 @@ void hash(Cluster2D& cl) {
   }
 }
 
+bool cellColumnComp(const Cell2D& left, const Cell2D& right) {
+  return (left.col == right.col) ? left.row < right.row : left.col < right.col;
+}
+
 bool clHashComp(const Cluster2D& left, const Cluster2D& right) {
   return left.hash < right.hash;
 }
@@ -248,6 +252,96 @@ BOOST_AUTO_TEST_CASE(Grid_2D_rand) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Grid_2D_rand_sorted_modules) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+  using Cluster = Cluster2D;
+  using ClusterC = std::vector<Cluster>;
+
+  std::size_t sizeX = 500;
+  std::size_t sizeY = 500;
+  std::size_t nModules = 20;
+  std::mt19937_64 rnd(71902647);
+
+  // Cells of all modules in one flat array, sorted column-wise per module
+  CellC cells;
+  std::vector<std::size_t> moduleOffsets = {0};
+  std::vector<ClusterC> expected;
+  for (std::size_t i = 0; i < nModules; ++i) {
+    CellC moduleCells;
+    ClusterC& cls = expected.emplace_back();
+    for (Rectangle& rect : segment(0, 0, sizeX, sizeY, rnd)) {
+      auto& [x0, y0, x1, y1] = rect;
+      Cluster cl = gencluster(x0, y0, x1, y1, rnd);
+      hash(cl);
+      moduleCells.insert(moduleCells.end(), cl.cells.begin(), cl.cells.end());
+      cls.push_back(cl);
+    }
+    std::ranges::sort(cls, clHashComp);
+
+    std::ranges::sort(moduleCells, cellColumnComp);
+    cells.insert(cells.end(), moduleCells.begin(), moduleCells.end());
+    moduleOffsets.push_back(cells.size());
+  }
+
+  Ccl::SortedClusteringData data;
+  ClusterC newCls;
+  std::vector<std::size_t> clusterOffsets;
+  Ccl::createSortedModuleClusters<CellC, ClusterC>(data, cells, moduleOffsets,
+                                                   newCls, clusterOffsets);
+  BOOST_REQUIRE_EQUAL(clusterOffsets.size(), moduleOffsets.size());
+  BOOST_CHECK_EQUAL(clusterOffsets.back(), newCls.size());
+
+  for (std::size_t i = 0; i < nModules; ++i) {
+    ClusterC moduleCls(newCls.begin() + clusterOffsets[i],
+                       newCls.begin() + clusterOffsets[i + 1]);
+
+    // Clusters are ordered by their first cell
+    for (std::size_t j = 1; j < moduleCls.size(); ++j) {
+      BOOST_CHECK(cellColumnComp(moduleCls[j - 1].cells.front(),
+                                 moduleCls[j].cells.front()));
+    }
+
+    for (Cluster& cl : moduleCls) {
+      hash(cl);
+    }
+    std::ranges::sort(moduleCls, clHashComp);
+
+    BOOST_CHECK_EQUAL(moduleCls.size(), expected[i].size());
+    for (std::size_t j = 0; j < moduleCls.size(); j++) {
+      BOOST_CHECK_EQUAL(moduleCls.at(j).hash, expected[i].at(j).hash);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Grid_2D_sorted_invalid_input) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+  using Cluster = Cluster2D;
+  using ClusterC = std::vector<Cluster>;
+
+  Ccl::SortedClusteringData data;
+  ClusterC clusters;
+
+  // cell is (row, column)
+  CellC unsorted = {Cell(10, 20), Cell(10, 19)};
+  BOOST_CHECK_THROW(
+      (Ccl::createSortedClusters<CellC, ClusterC>(data, unsorted, clusters)),
+      std::invalid_argument);
+
+  CellC duplicates = {Cell(10, 20), Cell(10, 20)};
+  BOOST_CHECK_THROW(
+      (Ccl::createSortedClusters<CellC, ClusterC>(data, duplicates, clusters)),
+      std::invalid_argument);
+
+  CellC cells = {Cell(10, 20), Cell(11, 20)};
+  std::vector<std::size_t> offsets = {0, 3};
+  std::vector<std::size_t> clusterOffsets;
+  BOOST_CHECK_THROW((Ccl::createSortedModuleClusters<CellC, ClusterC>(
+                        data, cells, offsets, clusters, clusterOffsets)),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(Grid_2D_duplicate_cells) {
   using Cell = Cell2D;
   using CellC = std::vector<Cell>;
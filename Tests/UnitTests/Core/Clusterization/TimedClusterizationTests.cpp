@@ -262,4 +262,50 @@ BOOST_AUTO_TEST_CASE(TimedGrid_2D_noTollerance) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TimedGrid_2D_withtime_sorted) {
+  // Same as TimedGrid_2D_withtime with the cells sorted column-wise
+  /*
+    X Y O X
+    O Y Y X
+    X X Z Z
+    X O O X
+  */
+  std::vector<Cell> cells;
+  cells.emplace_back(0ul, 0, 0, 0);
+  cells.emplace_back(3ul, 0, 2, 0);
+  cells.emplace_back(5ul, 0, 3, 0);
+  cells.emplace_back(7ul, 1, 0, 1);
+  cells.emplace_back(8ul, 1, 1, 1);
+  cells.emplace_back(4ul, 1, 2, 0);
+  cells.emplace_back(9ul, 2, 1, 1);
+  cells.emplace_back(10ul, 2, 2, 2);
+  cells.emplace_back(1ul, 3, 0, 0);
+  cells.emplace_back(2ul, 3, 1, 0);
+  cells.emplace_back(11ul, 3, 2, 2);
+  cells.emplace_back(6ul, 3, 3, 0);
+
+  // clusters in the order of their first cell
+  std::vector<std::vector<Identifier>> expectedResults;
+  expectedResults.push_back({0ul});
+  expectedResults.push_back({3ul, 4ul, 5ul});
+  expectedResults.push_back({7ul, 8ul, 9ul});
+  expectedResults.push_back({10ul, 11ul});
+  expectedResults.push_back({1ul, 2ul});
+  expectedResults.push_back({6ul});
+
+  Acts::Ccl::SortedClusteringData data;
+  ClusterCollection clusters;
+  Acts::Ccl::createSortedClusters<CellCollection, ClusterCollection, 2>(
+      data, cells, clusters, Acts::Ccl::TimedConnect<Cell, 2>(0.5));
+
+  BOOST_REQUIRE_EQUAL(clusters.size(), expectedResults.size());
+  for (std::size_t i(0); i < clusters.size(); ++i) {
+    std::vector<Identifier>& timedIds = clusters[i].ids;
+    std::ranges::sort(timedIds);
+    BOOST_CHECK_EQUAL_COLLECTIONS(timedIds.begin(), timedIds.end(),
+                                  expectedResults[i].begin(),
+                                  expectedResults[i].end());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,225 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/MappedTrackContainer.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/EventData/detail/TestTrackState.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "ActsTests/CommonHelpers/TemporaryDirectory.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace Acts::HashedStringLiteral;
+
+namespace {
+
+const auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+// fixed seed for reproducible tests
+std::default_random_engine rng(31415);
+
+struct SourceLinkStore {
+  std::vector<TestSourceLink> sourceLinks;
+
+  std::uint64_t encode(const SourceLink& sl) const {
+    return sl.get<TestSourceLink>().sourceId;
+  }
+
+  SourceLink decode(std::uint64_t id) const {
+    return SourceLink{sourceLinks.at(id)};
+  }
+};
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(MappedTrackContainerRoundTrip) {
+  CubicTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  std::vector<const Surface*> sensitives;
+  geometry->visitSurfaces([&](const Surface* s) { sensitives.push_back(s); },
+                          true);
+  BOOST_REQUIRE(!sensitives.empty());
+
+  SourceLinkStore store;
+  VectorTrackContainer vtc;
+  VectorMultiTrajectory mtj;
+  TrackContainer tc{vtc, mtj};
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3{1., 2., 3.});
+
+  for (std::size_t itrack = 0; itrack < 4; ++itrack) {
+    auto track = tc.makeTrack();
+    for (std::size_t i = 0; i < sensitives.size(); ++i) {
+      auto mask = TrackStatePropMask::All;
+      if (i == 0) {
+        mask &= ~TrackStatePropMask::Calibrated;
+      }
+      auto ts = track.appendTrackState(mask);
+      TestTrackState pc(rng, 1u + (i % 2));
+      pc.sourceLink.sourceId = store.sourceLinks.size();
+      store.sourceLinks.push_back(pc.sourceLink);
+      fillTrackState<VectorMultiTrajectory>(pc, mask, ts);
+      ts.setReferenceSurface(sensitives[i]->getSharedPtr());
+      ts.typeFlags().setIsMeasurement();
+      if (i == 1) {
+        ts.shareFrom(TrackStatePropMask::Predicted,
+                     TrackStatePropMask::Filtered);
+      }
+    }
+    track.setReferenceSurface(perigee);
+    track.parameters().setRandom();
+    track.covariance().setRandom();
+    track.nMeasurements() = 3 + itrack;
+    track.nHoles() = 1;
+    track.chi2() = 1.5f * itrack;
+    track.nDoF() = 7;
+    track.setParticleHypothesis(ParticleHypothesis::electron());
+  }
+
+  TemporaryDirectory tmp;
+  auto path = tmp.path() / "tracks.bin";
+
+  Delegate<std::uint64_t(const SourceLink&)> encoder;
+  encoder.connect<&SourceLinkStore::encode>(&store);
+  writeMappedTrackFile(path, gctx, vtc, mtj, encoder);
+
+  MappedTrackFile::Config cfg;
+  cfg.trackingGeometry = geometry.get();
+  cfg.sourceLinkDecoder.connect<&SourceLinkStore::decode>(&store);
+  auto file = std::make_shared<const MappedTrackFile>(path, cfg);
+  BOOST_CHECK_EQUAL(file->numTracks(), tc.size());
+  BOOST_CHECK_EQUAL(file->numTrackStates(), mtj.size());
+
+  TrackContainer mapped{std::make_shared<MappedTrackContainer>(file),
+                        std::make_shared<MappedMultiTrajectory>(file)};
+  BOOST_REQUIRE_EQUAL(mapped.size(), tc.size());
+
+  for (std::size_t itrack = 0; itrack < tc.size(); ++itrack) {
+    auto exp = tc.getTrack(itrack);
+    auto act = mapped.getTrack(itrack);
+
+    BOOST_CHECK_EQUAL(act.tipIndex(), exp.tipIndex());
+    BOOST_CHECK_EQUAL(act.stemIndex(), exp.stemIndex());
+    BOOST_CHECK_EQUAL(act.parameters(), exp.parameters());
+    BOOST_CHECK_EQUAL(act.covariance(), exp.covariance());
+    BOOST_CHECK_EQUAL(act.nMeasurements(), exp.nMeasurements());
+    BOOST_CHECK_EQUAL(act.nHoles(), exp.nHoles());
+    BOOST_CHECK_EQUAL(act.chi2(), exp.chi2());
+    BOOST_CHECK_EQUAL(act.nDoF(), exp.nDoF());
+    BOOST_CHECK_EQUAL(act.particleHypothesis(), exp.particleHypothesis());
+    BOOST_CHECK_EQUAL(act.nTrackStates(), exp.nTrackStates());
+    BOOST_REQUIRE(act.hasReferenceSurface());
+    BOOST_CHECK_EQUAL(act.referenceSurface().type(), Surface::Perigee);
+    BOOST_CHECK_EQUAL(act.referenceSurface().center(gctx), perigee->center(gctx));
+    // The shared perigee is created once on first access
+    BOOST_CHECK_EQUAL(&act.referenceSurface(),
+                      &mapped.getTrack(0).referenceSurface());
+
+    auto expStates = exp.trackStatesReversed();
+    auto actStates = act.trackStatesReversed();
+    auto expIt = expStates.begin();
+    for (auto ts : actStates) {
+      auto ets = *expIt;
+      ++expIt;
+      BOOST_CHECK_EQUAL(ts.index(), ets.index());
+      BOOST_CHECK_EQUAL(ts.previous(), ets.previous());
+      BOOST_CHECK_EQUAL(&ts.referenceSurface(), &ets.referenceSurface());
+      BOOST_CHECK_EQUAL(ts.predicted(), ets.predicted());
+      BOOST_CHECK_EQUAL(ts.predictedCovariance(), ets.predictedCovariance());
+      BOOST_CHECK_EQUAL(ts.filtered(), ets.filtered());
+      BOOST_CHECK_EQUAL(ts.smoothed(), ets.smoothed());
+      BOOST_CHECK_EQUAL(ts.smoothedCovariance(), ets.smoothedCovariance());
+      BOOST_CHECK_EQUAL(ts.jacobian(), ets.jacobian());
+      BOOST_CHECK_EQUAL(ts.chi2(), ets.chi2());
+      BOOST_CHECK_EQUAL(ts.pathLength(), ets.pathLength());
+      BOOST_CHECK_EQUAL(ts.typeFlags().isMeasurement(),
+                        ets.typeFlags().isMeasurement());
+      BOOST_CHECK_EQUAL(ts.hasCalibrated(), ets.hasCalibrated());
+      BOOST_CHECK_EQUAL(ts.hasUncalibratedSourceLink(),
+                        ets.hasUncalibratedSourceLink());
+      if (ets.hasCalibrated()) {
+        BOOST_CHECK_EQUAL(ts.calibratedSize(), ets.calibratedSize());
+        BOOST_CHECK_EQUAL(ts.effectiveCalibrated(), ets.effectiveCalibrated());
+        BOOST_CHECK_EQUAL(ts.effectiveCalibratedCovariance(),
+                          ets.effectiveCalibratedCovariance());
+        BOOST_CHECK(ts.projectorSubspaceIndices() ==
+                    ets.projectorSubspaceIndices());
+        BOOST_CHECK(ts.getUncalibratedSourceLink().get<TestSourceLink>() ==
+                    ets.getUncalibratedSourceLink().get<TestSourceLink>());
+      }
+    }
+  }
+
+  // Filtered parameters shared with the predicted ones stay shared
+  auto shared = mapped.trackStateContainer().getTrackState(1);
+  BOOST_CHECK_EQUAL((shared.component<TrackIndexType, "filtered"_hash>()),
+                    (shared.component<TrackIndexType, "predicted"_hash>()));
+
+  // Copy back into a mutable container
+  VectorTrackContainer vtc2;
+  VectorMultiTrajectory mtj2;
+  TrackContainer tc2{vtc2, mtj2};
+  for (auto track : mapped) {
+    auto copy = tc2.makeTrack();
+    copy.copyFrom(track);
+  }
+  BOOST_CHECK_EQUAL(tc2.size(), tc.size());
+  BOOST_CHECK_EQUAL(mtj2.size(), mtj.size());
+}
+
+BOOST_AUTO_TEST_CASE(MappedTrackFileInvalid) {
+  TemporaryDirectory tmp;
+
+  BOOST_CHECK_THROW(MappedTrackFile(tmp.path() / "missing.bin"),
+                    std::runtime_error);
+
+  auto path = tmp.path() / "garbage.bin";
+  {
+    std::ofstream os(path, std::ios::binary);
+    std::vector<char> garbage(1024, 'x');
+    os.write(garbage.data(), garbage.size());
+  }
+  BOOST_CHECK_THROW(MappedTrackFile{path}, std::runtime_error);
+
+  // Surfaces that are neither in the geometry nor perigees are rejected
+  VectorTrackContainer vtc;
+  VectorMultiTrajectory mtj;
+  TrackContainer tc{vtc, mtj};
+  auto track = tc.makeTrack();
+  auto ts = track.appendTrackState(TrackStatePropMask::None);
+  ts.setReferenceSurface(
+      Surface::makeShared<PlaneSurface>(Transform3::Identity()));
+  BOOST_CHECK_THROW(writeMappedTrackFile(tmp.path() / "out.bin", gctx, vtc, mtj),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -13,6 +13,9 @@
 #include "Acts/EventData/SpacePointContainer2.hpp"
 #include "Acts/EventData/Types.hpp"
 
+#include <array>
+#include <cstddef>
+#include <memory_resource>
 #include <stdexcept>
 
 #include <boost/core/no_exceptions_support.hpp>
@@ -280,6 +283,47 @@ BOOST_AUTO_TEST_CASE(CopyFrom) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  std::array<std::byte, 4096> buffer{};
+  std::pmr::monotonic_buffer_resource resource(
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  const auto inBuffer = [&](const void* ptr) {
+    const auto* bytes = static_cast<const std::byte*>(ptr);
+    return bytes >= buffer.data() && bytes < buffer.data() + buffer.size();
+  };
+
+  SpacePointContainer2 container(
+      SpacePointColumns::SourceLinks | SpacePointColumns::X, &resource);
+  BOOST_CHECK_EQUAL(container.memoryResource(), &resource);
+  auto extra = container.createColumn<int>("extra");
+  for (int i = 0; i < 10; ++i) {
+    auto sp = container.createSpacePoint();
+    sp.assignSourceLinks(std::array<SourceLink, 1>{SourceLink(i)});
+    sp.x() = static_cast<float>(i);
+    extra[sp.index()] = i;
+  }
+
+  BOOST_CHECK(inBuffer(container.xColumn().data().data()));
+  BOOST_CHECK(inBuffer(container.at(3).sourceLinks().data()));
+  BOOST_CHECK(inBuffer(container.column<int>("extra").data().data()));
+
+  // copies do not depend on the lifetime of the resource
+  SpacePointContainer2 copy = container;
+  BOOST_CHECK_NE(copy.memoryResource(), &resource);
+  BOOST_CHECK(!inBuffer(copy.xColumn().data().data()));
+  BOOST_CHECK(!inBuffer(copy.column<int>("extra").data().data()));
+  BOOST_CHECK_EQUAL(copy.at(3).x(), 3);
+  BOOST_CHECK_EQUAL(copy.at(3).sourceLinks()[0].get<int>(), 3);
+
+  // moving into a container with another resource copies the data
+  SpacePointContainer2 moved;
+  moved = std::move(container);
+  BOOST_CHECK(!inBuffer(moved.xColumn().data().data()));
+  BOOST_CHECK(!inBuffer(moved.column<int>("extra").data().data()));
+  BOOST_CHECK_EQUAL(moved.at(7).x(), 7);
+  BOOST_CHECK_EQUAL(moved.column<int>("extra")[7], 7);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
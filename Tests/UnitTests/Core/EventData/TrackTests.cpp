@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <random>
 #include <stdexcept>
@@ -556,6 +557,47 @@ BOOST_AUTO_TEST_CASE(ShallowCopy) {
   BOOST_CHECK_EQUAL(t2_ts3.index(), ts3.index());
 }
 
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  std::vector<std::byte> buffer(1 << 16);
+  std::pmr::monotonic_buffer_resource resource(
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  const auto inBuffer = [&](const void* ptr) {
+    const auto* bytes = static_cast<const std::byte*>(ptr);
+    return bytes >= buffer.data() && bytes < buffer.data() + buffer.size();
+  };
+
+  TrackContainer tc{VectorTrackContainer{&resource},
+                    VectorMultiTrajectory{&resource}};
+  auto t = tc.makeTrack();
+  t.parameters().setRandom();
+  for (std::size_t i = 0; i < 5; i++) {
+    auto ts = t.appendTrackState();
+    ts.predicted().setRandom();
+    ts.allocateCalibrated(2);
+    ts.template calibrated<2>().setRandom();
+  }
+
+  BOOST_CHECK(inBuffer(t.parameters().data()));
+  for (const auto& ts : t.trackStatesReversed()) {
+    BOOST_CHECK(inBuffer(ts.predicted().data()));
+    BOOST_CHECK(inBuffer(ts.template calibrated<2>().data()));
+  }
+
+  // copies use the default memory resource
+  TrackContainer tcCopy{VectorTrackContainer{tc.container()},
+                        VectorMultiTrajectory{tc.trackStateContainer()}};
+  auto tCopy = tcCopy.getTrack(t.index());
+  BOOST_CHECK(!inBuffer(tCopy.parameters().data()));
+  BOOST_CHECK_EQUAL(tCopy.parameters(), t.parameters());
+  BOOST_CHECK_EQUAL(tCopy.nTrackStates(), t.nTrackStates());
+  for (const auto& ts : tCopy.trackStatesReversed()) {
+    BOOST_CHECK(!inBuffer(ts.predicted().data()));
+    BOOST_CHECK(!inBuffer(ts.template calibrated<2>().data()));
+    auto original = tc.trackStateContainer().getTrackState(ts.index());
+    BOOST_CHECK_EQUAL(ts.predicted(), original.predicted());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
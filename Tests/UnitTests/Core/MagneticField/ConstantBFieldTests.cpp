@@ -121,6 +121,20 @@ BOOST_DATA_TEST_CASE(
   BOOST_CHECK_EQUAL(Btrue, BField.getField(-2 * pos, bCache).value());
 }
 
+BOOST_AUTO_TEST_CASE(ConstantBField_getFields) {
+  const Vector3 bTrue(1_T, -2_T, 0.5_T);
+  ConstantBField BField{bTrue};
+  auto bCache = BField.makeCache(mfContext);
+
+  MagneticFieldProvider::VectorBatch positions =
+      MagneticFieldProvider::VectorBatch::Random(19, 3) * 10_m;
+  MagneticFieldProvider::VectorBatch fields(19, 3);
+  BOOST_CHECK(BField.getFields(positions, fields, bCache).ok());
+  for (Eigen::Index i = 0; i < fields.rows(); ++i) {
+    BOOST_CHECK_EQUAL(Vector3(fields.row(i).transpose()), bTrue);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -162,6 +162,70 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
 
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_batch) {
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  // rotate the (r,z) field into the global frame
+  auto transformBField = [](const Vector3& field, const Vector3& pos) {
+    const double r = perp(pos);
+    if (r == 0.) {
+      return Vector3(0., 0., field.z());
+    }
+    return Vector3(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                   field.z());
+  };
+
+  Axis r(0.0, 4.0, 8u);
+  Axis z(-5, 7, 12u);
+  Grid g(Type<Vector3>, std::move(r), std::move(z));
+  using Grid_t = decltype(g);
+  for (std::size_t i = 0; i < g.size(); ++i) {
+    const auto indices = g.localBinsFromGlobalBin(i);
+    const double k = static_cast<double>(indices.at(0) * 3 + indices.at(1));
+    g.at(i) = Vector3(std::sin(k), 0., std::cos(k));
+  }
+
+  InterpolatedBFieldMap<Grid_t> b{{transformPos, transformBField, g}};
+  auto cache = b.makeCache(mfContext);
+
+  // more positions than the internal block size, with some outside the map
+  const std::size_t nPositions = 37;
+  MagneticFieldProvider::VectorBatch positions(nPositions, 3);
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    const double t = static_cast<double>(i) / nPositions;
+    positions.row(i) << 3.5 * t * std::cos(7 * t), 3.5 * t * std::sin(7 * t),
+        -6 + 12 * t;
+  }
+  positions.row(5) << 0, 0, 1.5;
+
+  MagneticFieldProvider::VectorBatch fields(nPositions, 3);
+  auto res = b.getFields(positions, fields, cache);
+  BOOST_CHECK(!res.ok());
+
+  std::size_t nInside = 0;
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    const Vector3 pos = positions.row(i).transpose();
+    BOOST_TEST_CONTEXT("position " << i) {
+      auto expected = b.getField(pos);
+      BOOST_CHECK_EQUAL(expected.ok(), b.isInside(pos));
+      if (expected.ok()) {
+        ++nInside;
+        CHECK_CLOSE_ABS(fields.row(i).transpose(), *expected, 1e-12);
+      } else {
+        CHECK_CLOSE_ABS(fields.row(i).transpose(), Vector3::Zero(), 1e-12);
+      }
+    }
+  }
+  BOOST_CHECK_GT(nInside, 16u);
+
+  // only positions inside the map
+  auto inside = positions.middleRows(10, 20);
+  MagneticFieldProvider::VectorBatch insideFields(inside.rows(), 3);
+  BOOST_CHECK(b.getFields(inside, insideFields, cache).ok());
+  CHECK_CLOSE_ABS(insideFields, fields.middleRows(10, 20), 1e-15);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
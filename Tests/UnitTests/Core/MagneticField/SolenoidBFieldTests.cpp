@@ -15,6 +15,7 @@
 #include "Acts/Utilities/Result.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
+#include <cmath>
 #include <cstddef>
 
 using namespace Acts;
@@ -109,6 +110,39 @@ BOOST_AUTO_TEST_CASE(TestSolenoidBField) {
   // outf.close();
 }
 
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldBatch) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+  auto cache = bField.makeCache(mfContext);
+
+  // include on-axis positions and more positions than the block size
+  const std::size_t nPositions = 21;
+  MagneticFieldProvider::VectorBatch positions(nPositions, 3);
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    const double t = static_cast<double>(i) / nPositions;
+    const double r = (i % 4 == 0) ? 0. : 1.5 * cfg.radius * t;
+    positions.row(i) << r * std::cos(5 * t), r * std::sin(5 * t),
+        cfg.length * (t - 0.5);
+  }
+
+  MagneticFieldProvider::VectorBatch fields(nPositions, 3);
+  BOOST_CHECK(bField.getFields(positions, fields, cache).ok());
+
+  for (std::size_t i = 0; i < nPositions; ++i) {
+    BOOST_TEST_CONTEXT("position " << i) {
+      const Vector3 expected =
+          bField.getField(Vector3(positions.row(i).transpose()));
+      CHECK_CLOSE_ABS(fields.row(i).transpose(), expected, 1e-9_T);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
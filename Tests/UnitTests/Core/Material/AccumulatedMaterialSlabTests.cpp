@@ -192,6 +192,47 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// merging separately averaged tracks is equivalent to averaging all of them
+BOOST_AUTO_TEST_CASE(MergeSeparateTracks) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab three = unit;
+  three.scaleThickness(3);
+  MaterialSlab vac = MaterialSlab::Vacuum(2 * unit.thickness());
+
+  AccumulatedMaterialSlab all;
+  for (const auto& slab : {unit, three, vac, vac}) {
+    all.accumulate(slab);
+    all.trackAverage();
+  }
+
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (const auto& slab : {unit, three}) {
+    first.accumulate(slab);
+    first.trackAverage();
+  }
+  for (const auto& slab : {vac, vac}) {
+    second.accumulate(slab);
+    second.trackAverage();
+  }
+  // merging into and from an empty store does not change the material
+  AccumulatedMaterialSlab merged;
+  merged.merge(first);
+  merged.merge(AccumulatedMaterialSlab());
+  merged.merge(second);
+
+  auto [expected, expectedCount] = all.totalAverage();
+  auto [average, trackCount] = merged.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, expectedCount);
+  CHECK_CLOSE_REL(average.thickness(), expected.thickness(), eps);
+  CHECK_CLOSE_REL(average.material().X0(), expected.material().X0(), eps);
+  CHECK_CLOSE_REL(average.material().L0(), expected.material().L0(), eps);
+  CHECK_CLOSE_REL(average.material().Ar(), expected.material().Ar(), eps);
+  CHECK_CLOSE_REL(average.material().Z(), expected.material().Z(), eps);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  expected.material().molarDensity(), eps);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -13,6 +13,7 @@
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/BinnedSurfaceMaterialAccumulator.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/Material.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Material/ProtoSurfaceMaterial.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
@@ -216,6 +217,93 @@ BOOST_AUTO_TEST_CASE(AccumulationTest) {
                     std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(PartialStateTest) {
+  auto surface =
+      Surface::makeShared<CylinderSurface>(Transform3::Identity(), 30.0, 100.0);
+  surface->assignGeometryId(GeometryIdentifier().withSensitive(1));
+
+  // Binned in phi, the tracks below hit different bins
+  BinUtility sb(4, -std::numbers::pi, std::numbers::pi, closed,
+                AxisDirection::AxisPhi);
+  surface->assignSurfaceMaterial(std::make_shared<ProtoSurfaceMaterial>(sb));
+
+  BinnedSurfaceMaterialAccumulator::Config bsmaConfig;
+  bsmaConfig.materialSurfaces = {surface.get()};
+  BinnedSurfaceMaterialAccumulator bsma(bsmaConfig);
+
+  Material mat = Material::fromMolarDensity(1., 2., 3., 4., 5.);
+  std::vector<std::vector<MaterialInteraction>> tracks;
+  for (Vector3 dir : {Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(1, 0.1, 0),
+                      Vector3(-1, 0, 0)}) {
+    dir.normalize();
+    MaterialInteraction mi;
+    mi.surface = surface.get();
+    mi.position = 30 * dir;
+    mi.intersection = 30 * dir;
+    mi.direction = dir;
+    mi.materialSlab = MaterialSlab(mat, static_cast<float>(tracks.size() + 1));
+    tracks.push_back({mi});
+  }
+
+  // Reference: all tracks directly into the full state
+  auto referenceState = bsma.createState(tContext);
+  for (const auto& track : tracks) {
+    bsma.accumulate(*referenceState, tContext, track, {});
+  }
+
+  // Two partial states, merged into the full state
+  auto state = bsma.createState(tContext);
+  auto firstState = bsma.createPartialState(*state);
+  auto secondState = bsma.createPartialState(*state);
+  bsma.accumulate(*firstState, tContext, tracks[0], {});
+  bsma.accumulate(*firstState, tContext, tracks[1], {});
+  bsma.accumulate(*secondState, tContext, tracks[2], {});
+  bsma.accumulate(*secondState, tContext, tracks[3], {});
+
+  // The full state is untouched before merging
+  auto cState =
+      static_cast<const BinnedSurfaceMaterialAccumulator::State*>(state.get());
+  const auto& accMaterial =
+      cState->accumulatedMaterial.at(surface->geometryId());
+  for (const auto& accVec : accMaterial.accumulatedMaterial()) {
+    for (const auto& slab : accVec) {
+      BOOST_CHECK_EQUAL(slab.totalAverage().second, 0u);
+    }
+  }
+
+  bsma.mergeState(*state, *firstState);
+  bsma.mergeState(*state, *secondState);
+
+  // Partial states are emptied by the merge
+  auto pState =
+      static_cast<const BinnedSurfaceMaterialAccumulator::PartialState*>(
+          firstState.get());
+  BOOST_CHECK(pState->accumulatedMaterial.empty());
+
+  auto cReference = static_cast<const BinnedSurfaceMaterialAccumulator::State*>(
+      referenceState.get());
+  const auto& refMaterial =
+      cReference->accumulatedMaterial.at(surface->geometryId());
+  for (std::size_t ib1 = 0; ib1 < refMaterial.accumulatedMaterial().size();
+       ++ib1) {
+    const auto& refVec = refMaterial.accumulatedMaterial()[ib1];
+    for (std::size_t ib0 = 0; ib0 < refVec.size(); ++ib0) {
+      auto [expected, expectedCount] = refVec[ib0].totalAverage();
+      auto [average, trackCount] =
+          accMaterial.accumulatedMaterial()[ib1][ib0].totalAverage();
+      BOOST_CHECK_EQUAL(trackCount, expectedCount);
+      BOOST_CHECK_CLOSE(average.thickness(), expected.thickness(), 1e-4);
+    }
+  }
+
+  // Partial states only merge into the state they were created from
+  auto otherState = bsma.createState(tContext);
+  BOOST_CHECK_THROW(bsma.mergeState(*otherState, *firstState),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(bsma.createPartialState(*firstState),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
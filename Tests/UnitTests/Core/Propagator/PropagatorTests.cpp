@@ -21,6 +21,7 @@
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/EigenStepperDenseExtension.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/VoidNavigator.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
@@ -30,6 +31,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
 #include <cmath>
@@ -39,8 +41,10 @@
 #include <numbers>
 #include <optional>
 #include <random>
+#include <span>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 
@@ -483,6 +487,66 @@ BOOST_AUTO_TEST_CASE(BasicPropagatorInterface) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(BatchPropagation) {
+  EigenPropagatorType::Options<> options(tgContext, mfContext);
+  options.pathLimit = 2_m;
+  options.stepping.maxStepSize = 10_cm;
+
+  const std::size_t nTracks = 12;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> thetaDist(0.5, 2.5);
+  std::uniform_real_distribution<double> pDist(0.2_GeV, 10_GeV);
+
+  Covariance cov = Covariance::Identity() * 1e-4;
+
+  std::vector<BoundTrackParameters> starts;
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    starts.push_back(BoundTrackParameters::createCurvilinear(
+        Vector4::Zero(),
+        makeDirectionFromPhiTheta(phiDist(rng), thetaDist(rng)),
+        q / pDist(rng), cov, ParticleHypothesis::pion()));
+  }
+
+  using State = decltype(epropagator.makeState(options));
+  std::vector<State> states;
+  states.reserve(nTracks);
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    states.push_back(epropagator.makeState(options));
+    BOOST_REQUIRE(epropagator.initialize(states.back(), starts[i]).ok());
+  }
+  // the last track runs out of steps
+  states.back().options.maxSteps = 3;
+
+  auto results = epropagator.propagateBatch(std::span<State>(states));
+  BOOST_REQUIRE_EQUAL(results.size(), nTracks);
+
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto state = epropagator.makeState(options);
+    BOOST_REQUIRE(epropagator.initialize(state, starts[i]).ok());
+    state.options.maxSteps = states[i].options.maxSteps;
+    auto result = epropagator.propagate(state);
+
+    BOOST_CHECK_EQUAL(results[i].ok(), result.ok());
+    if (!result.ok()) {
+      BOOST_CHECK(results[i].error() ==
+                  PropagatorError::StepCountLimitReached);
+      continue;
+    }
+
+    BOOST_CHECK_EQUAL(states[i].steps, state.steps);
+    BOOST_CHECK_EQUAL(states[i].stepping.nStepTrials,
+                      state.stepping.nStepTrials);
+    CHECK_CLOSE_ABS(states[i].pathLength, state.pathLength, 1e-12);
+    CHECK_CLOSE_ABS(states[i].stepping.pars, state.stepping.pars, 1e-12);
+    CHECK_CLOSE_ABS(states[i].stepping.jacTransport,
+                    state.stepping.jacTransport, 1e-12);
+  }
+  BOOST_CHECK(!results.back().ok());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
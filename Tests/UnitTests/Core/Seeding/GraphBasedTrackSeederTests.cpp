@@ -0,0 +1,171 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/GbtsGeometry.hpp"
+#include "Acts/Seeding2/GbtsLayerConnection.hpp"
+#include "Acts/Seeding2/GbtsRoiDescriptor.hpp"
+#include "Acts/Seeding2/GbtsTrackingFilter.hpp"
+#include "Acts/Seeding2/GraphBasedTrackSeeder.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+constexpr float bFieldInZ = 2_T;
+constexpr float minPt = 1_GeV;
+
+/// Pixel barrel layers, each connected to the next two layers inside
+const std::vector<float> layerRadii = {33_mm,  50_mm,  88_mm,  122_mm,
+                                       160_mm, 200_mm, 250_mm, 300_mm};
+
+std::shared_ptr<GbtsGeometry> makeGeometry() {
+  std::vector<GbtsLayerDescription> layers;
+  std::stringstream connections;
+  connections << 2 * layerRadii.size() - 3 << " 0.2\n";
+  for (std::size_t l = 0; l < layerRadii.size(); ++l) {
+    const std::int32_t id = 80000 + 1000 * static_cast<std::int32_t>(l);
+    layers.push_back(
+        {id, GbtsLayerType::Barrel, layerRadii[l], -1000_mm, 1000_mm});
+    for (std::size_t skip = 1; skip <= std::min<std::size_t>(l, 2); ++skip) {
+      // index, stage, source, destination and a dummy 1x1 bin table
+      connections << 0 << " " << 0 << " " << id << " " << id - 1000 * skip
+                  << " 1 1 1\n0\n";
+    }
+  }
+  const GbtsLayerConnectionMap connectionMap =
+      GbtsLayerConnectionMap::fromStream(connections, false);
+  return std::make_shared<GbtsGeometry>(layers, connectionMap);
+}
+
+/// Space points of helices crossing the layers
+SpacePointContainer2 makeSpacePoints(std::size_t nTracks) {
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<float> ptDist(minPt, 10_GeV);
+  std::normal_distribution<float> z0Dist(0, 50_mm);
+  std::normal_distribution<float> noiseDist(0, 0.01_mm);
+
+  SpacePointContainer2 spacePoints(
+      SpacePointColumns::X | SpacePointColumns::Y | SpacePointColumns::Z |
+      SpacePointColumns::R | SpacePointColumns::Phi);
+  auto layerColumn = spacePoints.createColumn<std::uint32_t>("layerId");
+  auto clusterWidthColumn = spacePoints.createColumn<float>("clusterWidth");
+  auto localPositionColumn = spacePoints.createColumn<float>("localPositionY");
+
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = std::sinh(etaDist(rng));
+    const float z0 = z0Dist(rng);
+    const float q = (i % 2 == 0) ? 1 : -1;
+    // helix radius in mm for pt in GeV and field in T
+    const float radius = ptDist(rng) / (0.3f * bFieldInZ / 1_T) / 1_GeV * 1_m;
+    for (std::size_t l = 0; l < layerRadii.size(); ++l) {
+      const float r = layerRadii[l];
+      if (r > 2 * radius) {
+        break;
+      }
+      const float phi = phi0 + q * std::asin(r / (2 * radius));
+      const float x = r * std::cos(phi) + noiseDist(rng);
+      const float y = r * std::sin(phi) + noiseDist(rng);
+      auto sp = spacePoints.createSpacePoint();
+      sp.x() = x;
+      sp.y() = y;
+      sp.z() = z0 + r * cotTheta;
+      sp.r() = std::hypot(x, y);
+      sp.phi() = std::atan2(y, x);
+      sp.extra(layerColumn) = l;
+      sp.extra(clusterWidthColumn) = 0;
+      sp.extra(localPositionColumn) = 0;
+    }
+  }
+  return spacePoints;
+}
+
+/// Space point indices and quality of each seed
+using SeedList = std::vector<std::pair<std::vector<SpacePointIndex2>, float>>;
+
+SeedList findSeeds(const std::shared_ptr<GbtsGeometry>& geometry,
+                   const SpacePointContainer2& spacePoints,
+                   std::uint32_t numThreads,
+                   const ParallelExecutor& executor = {}) {
+  GraphBasedTrackSeeder::Config config;
+  config.minPt = minPt;
+  config.numThreads = numThreads;
+  config.executor = executor;
+  const GraphBasedTrackSeeder seeder(
+      GraphBasedTrackSeeder::DerivedConfig(config), geometry,
+      getDefaultLogger("Gbts", Logging::ERROR));
+
+  const GbtsRoiDescriptor roi(0, -4.5, 4.5, 0, -std::numbers::pi,
+                              std::numbers::pi, 0, -150., 150.);
+  const GbtsTrackingFilter filter({}, geometry);
+  SeedContainer2 seeds;
+  seeder.createSeeds(spacePoints, roi, layerRadii.size(), filter,
+                     GraphBasedTrackSeeder::Options(bFieldInZ), seeds);
+
+  SeedList result;
+  for (const auto seed : seeds) {
+    const auto indices = seed.spacePointIndices();
+    result.emplace_back(
+        std::vector<SpacePointIndex2>(indices.begin(), indices.end()),
+        seed.quality());
+  }
+  return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSuite)
+
+BOOST_AUTO_TEST_CASE(GbtsSeedsIndependentOfThreads) {
+  const auto geometry = makeGeometry();
+  const SpacePointContainer2 spacePoints = makeSpacePoints(200);
+
+  const SeedList serialSeeds = findSeeds(geometry, spacePoints, 1);
+  BOOST_CHECK(!serialSeeds.empty());
+
+  for (std::uint32_t numThreads : {2u, 4u}) {
+    BOOST_TEST_INFO("threads " << numThreads);
+    BOOST_CHECK(findSeeds(geometry, spacePoints, numThreads) == serialSeeds);
+  }
+
+  // the tasks of a stage may run in any order
+  const ParallelExecutor reversed =
+      [](std::size_t numTasks, const std::function<void(std::size_t)>& task) {
+        for (std::size_t i = numTasks; i > 0; --i) {
+          task(i - 1);
+        }
+      };
+  BOOST_CHECK(findSeeds(geometry, spacePoints, 2, reversed) == serialSeeds);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -27,6 +27,7 @@
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -42,16 +43,19 @@
 #include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
 #include "ActsTests/CommonHelpers/MeasurementsCreator.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <random>
+#include <span>
 #include <string>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 using namespace Acts;
@@ -433,6 +437,96 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(BreadthFirstMatchesDepthFirst) {
+  Fixture f(0_T);
+  // allow several measurements per surface to create branches
+  MeasurementSelector measSel{MeasurementSelector::Config{
+      {GeometryIdentifier(),
+       {{}, {std::numeric_limits<double>::max()}, {2u}}}}};
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto trackStateCreator = makeTrackStateCreator(slAccessor, measSel);
+
+  auto options = f.makeCkfOptions();
+  options.extensions.createTrackStates
+      .template connect<&decltype(trackStateCreator)::createTrackStates>(
+          &trackStateCreator);
+
+  // hits of each found track, in order from the outermost state, or the
+  // error of the seed
+  using Hits = std::vector<std::pair<GeometryIdentifier, std::size_t>>;
+  using SeedResult = std::variant<std::vector<Hits>, std::error_code>;
+  auto findTracks = [&](CombinatorialKalmanFilterTraversal traversal) {
+    options.traversal = traversal;
+    TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+    auto results = f.ckf.findTracks(
+        std::span<const BoundTrackParameters>(f.startParameters), options, tc);
+    BOOST_REQUIRE_EQUAL(results.size(), f.startParameters.size());
+
+    std::vector<SeedResult> found;
+    for (const auto& res : results) {
+      if (!res.ok()) {
+        found.emplace_back(res.error());
+        continue;
+      }
+      std::vector<Hits> seedTracks;
+      for (const auto& track : *res) {
+        auto& hits = seedTracks.emplace_back();
+        for (const auto trackState : track.trackStatesReversed()) {
+          if (!trackState.typeFlags().isMeasurement()) {
+            continue;
+          }
+          auto sl = trackState.getUncalibratedSourceLink()
+                        .template get<TestSourceLink>();
+          hits.emplace_back(sl.m_geometryId, sl.sourceId);
+        }
+      }
+      // the order in which the branches are collected differs
+      std::ranges::sort(seedTracks);
+      found.emplace_back(std::move(seedTracks));
+    }
+    return found;
+  };
+
+  auto depthFirst = findTracks(CombinatorialKalmanFilterTraversal::DepthFirst);
+  auto breadthFirst =
+      findTracks(CombinatorialKalmanFilterTraversal::BreadthFirst);
+
+  for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+       ++trackId) {
+    BOOST_TEST_INFO("seed " << trackId);
+    BOOST_REQUIRE(std::holds_alternative<std::vector<Hits>>(
+        depthFirst[trackId]));
+    // there has to be branching for this test to be meaningful
+    BOOST_CHECK_GT(std::get<std::vector<Hits>>(depthFirst[trackId]).size(),
+                   1u);
+    BOOST_CHECK(depthFirst[trackId] == breadthFirst[trackId]);
+  }
+
+  // All branches of a seed share the step limit in both traversals. A seed
+  // running out of steps fails the same way in both of them, independent of
+  // the branch which reaches the limit.
+  bool limitReached = false;
+  for (unsigned int maxSteps : {50u, 150u, 400u, 1000u}) {
+    options.propagatorPlainOptions.maxSteps = maxSteps;
+    depthFirst = findTracks(CombinatorialKalmanFilterTraversal::DepthFirst);
+    breadthFirst = findTracks(CombinatorialKalmanFilterTraversal::BreadthFirst);
+    for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+         ++trackId) {
+      BOOST_TEST_INFO("max steps " << maxSteps << ", seed " << trackId);
+      BOOST_CHECK(depthFirst[trackId] == breadthFirst[trackId]);
+      const auto* error = std::get_if<std::error_code>(&depthFirst[trackId]);
+      if (error != nullptr) {
+        BOOST_CHECK(*error == PropagatorError::StepCountLimitReached);
+        limitReached = true;
+      }
+    }
+  }
+  BOOST_CHECK(limitReached);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
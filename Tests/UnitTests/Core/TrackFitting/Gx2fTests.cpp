@@ -34,6 +34,7 @@
 #include "ActsTests/CommonHelpers/PredefinedMaterials.hpp"
 
 #include <numbers>
+#include <random>
 #include <vector>
 
 #include "FitterTestsCommon.hpp"
@@ -211,6 +212,75 @@ std::shared_ptr<const TrackingGeometry> makeToyDetector(
   return detector;
 }
 
+/// @brief Fill a gx2f system with a toy track
+///
+/// The track crosses nLayers layers with a 2D measurement each. All layers
+/// but the last one have material. The time is not measured.
+///
+/// @param extendedSystem The system to fill. Needs to have eBoundSize + 2 * (nLayers - 1) dimensions.
+/// @param nLayers Number of layers
+/// @param seed Seed for the random numbers, use the same for different solvers
+static void fillToySystem(Gx2fSystem& extendedSystem, const std::size_t nLayers,
+                          const unsigned int seed) {
+  std::default_random_engine rng(seed);
+  std::normal_distribution<double> gauss(0., 1.);
+
+  const bool structured = extendedSystem.solver() == Gx2fSolver::eStructured;
+  const auto logger = getDefaultLogger("fillToySystem", Logging::INFO);
+
+  Matrix<2, eBoundSize> projector = Matrix<2, eBoundSize>::Zero();
+  projector(0, eBoundLoc0) = 1.;
+  projector(1, eBoundLoc1) = 1.;
+  const SquareMatrix<2> covariance = Vector2(1e-2, 4e-2).asDiagonal();
+
+  std::vector<BoundMatrix> jacobianFromStart = {BoundMatrix::Identity()};
+  for (std::size_t iLayer = 0; iLayer < nLayers; ++iLayer) {
+    // Straight line between the layers with a small bending in phi
+    BoundMatrix transport = BoundMatrix::Identity();
+    transport(eBoundLoc0, eBoundPhi) = 30.;
+    transport(eBoundLoc1, eBoundTheta) = 30.;
+    transport(eBoundLoc0, eBoundQOverP) = 0.15;
+    transport(eBoundPhi, eBoundQOverP) = 1e-2;
+    if (structured) {
+      jacobianFromStart.back() = transport * jacobianFromStart.back();
+    } else {
+      for (auto& jac : jacobianFromStart) {
+        jac = transport * jac;
+      }
+    }
+
+    BoundVector predicted = BoundVector::Zero();
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      predicted[i] = gauss(rng);
+    }
+    const Vector2 measurement = projector * predicted +
+                                Vector2(0.1 * gauss(rng), 0.2 * gauss(rng));
+    extendedSystem.ndf() += 2;
+    addMeasurementToGx2fSumsBackend(extendedSystem, jacobianFromStart,
+                                    covariance, predicted, measurement,
+                                    projector, *logger);
+
+    if (iLayer + 1 == nLayers) {
+      break;
+    }
+
+    // Material contribution with an inverse covariance of 1e4
+    const Vector2 scatteringBVector(1e-2 * gauss(rng), 1e-2 * gauss(rng));
+    if (structured) {
+      Gx2fSegment& segment = extendedSystem.segments().emplace_back();
+      segment.transport = jacobianFromStart.back();
+      segment.scatteringAMatrix = 1e4 * SquareMatrix<2>::Identity();
+      segment.scatteringBVector = scatteringBVector;
+    } else {
+      const std::size_t deltaPosition = eBoundSize + 2 * iLayer;
+      extendedSystem.aMatrix()(deltaPosition, deltaPosition) += 1e4;
+      extendedSystem.aMatrix()(deltaPosition + 1, deltaPosition + 1) += 1e4;
+      extendedSystem.bVector().segment<2>(deltaPosition) += scatteringBVector;
+    }
+    jacobianFromStart.emplace_back(BoundMatrix::Identity());
+  }
+}
+
 struct Detector {
   // geometry
   std::shared_ptr<const TrackingGeometry> geometry;
@@ -1095,6 +1165,47 @@ BOOST_AUTO_TEST_CASE(Material) {
 
   ACTS_INFO("*** Test: Material -- Finish");
 }
+
+// This test checks that the structured solver reproduces the dense solution
+// of the extended system
+BOOST_AUTO_TEST_CASE(StructuredSolver) {
+  ACTS_INFO("*** Test: StructuredSolver -- Start");
+
+  for (const std::size_t nLayers : {3u, 10u, 40u}) {
+    const std::size_t nDims = eBoundSize + 2 * (nLayers - 1);
+
+    Gx2fSystem denseSystem{nDims, Gx2fSolver::eDense};
+    fillToySystem(denseSystem, nLayers, 42);
+    Gx2fSystem structuredSystem{nDims, Gx2fSolver::eStructured};
+    fillToySystem(structuredSystem, nLayers, 42);
+
+    BOOST_CHECK_EQUAL(structuredSystem.segments().size(), nLayers);
+    BOOST_CHECK(structuredSystem.aMatrix().size() == 0);
+    CHECK_CLOSE_REL(structuredSystem.chi2(), denseSystem.chi2(), 1e-12);
+    CHECK_CLOSE_OR_SMALL(structuredSystem.trackParametersDiagonal(),
+                         denseSystem.trackParametersDiagonal(), 1e-8, 1e-12);
+    BOOST_CHECK_EQUAL(structuredSystem.findRequiredNdf(),
+                      denseSystem.findRequiredNdf());
+
+    BOOST_CHECK_EQUAL(structuredSystem.findRequiredNdf(), 5u);
+
+    const Eigen::VectorXd denseDelta = computeGx2fDeltaParams(denseSystem);
+    const Eigen::VectorXd structuredDelta =
+        computeGx2fDeltaParams(structuredSystem);
+    BOOST_REQUIRE_EQUAL(structuredDelta.size(), denseDelta.size());
+    BOOST_CHECK_LT((structuredDelta - denseDelta).norm(),
+                   1e-6 * denseDelta.norm());
+
+    BoundMatrix denseCovariance = BoundMatrix::Identity();
+    updateGx2fCovarianceParams(denseCovariance, denseSystem);
+    BoundMatrix structuredCovariance = BoundMatrix::Identity();
+    updateGx2fCovarianceParams(structuredCovariance, structuredSystem);
+    BOOST_CHECK_LT((structuredCovariance - denseCovariance).norm(),
+                   1e-6 * denseCovariance.norm());
+  }
+
+  ACTS_INFO("*** Test: StructuredSolver -- Finish");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -0,0 +1,199 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/AsyncPrintPolicy.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Logging;
+
+namespace ActsTests {
+
+namespace {
+
+/// Splits the written output into lines
+std::vector<std::string> lines(const std::string& output) {
+  std::vector<std::string> result;
+  std::istringstream is(output);
+  for (std::string line; std::getline(is, line);) {
+    result.push_back(line);
+  }
+  return result;
+}
+
+/// Stream buffer which holds back all output until it is opened
+class GatedBuffer : public std::stringbuf {
+ public:
+  void open() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_open = true;
+    }
+    m_condition.notify_all();
+  }
+
+ protected:
+  std::streamsize xsputn(const char* s, std::streamsize n) override {
+    wait();
+    return std::stringbuf::xsputn(s, n);
+  }
+
+  int_type overflow(int_type c) override {
+    wait();
+    return std::stringbuf::overflow(c);
+  }
+
+ private:
+  void wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_open; });
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_open = false;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(UtilitiesSuite)
+
+BOOST_AUTO_TEST_CASE(AsyncLoggerOutput) {
+  std::ostringstream os;
+  AsyncLogSink::Config cfg;
+  cfg.out = &os;
+  auto sink = std::make_shared<AsyncLogSink>(cfg);
+
+  auto log = getAsyncLogger("AsyncLogger", Logging::INFO, sink);
+  auto clone = log->clone("AsyncClone");
+  {
+    ACTS_LOCAL_LOGGER(std::move(log));
+    ACTS_INFO("info level");
+    ACTS_DEBUG("debug level");
+    ACTS_WARNING("warning level");
+  }
+  clone->log(Logging::INFO, "cloned logger");
+  sink->flush();
+
+  auto output = lines(os.str());
+  BOOST_REQUIRE_EQUAL(output.size(), 3u);
+  BOOST_CHECK(output[0].find("AsyncLogger") != std::string::npos);
+  BOOST_CHECK(output[0].find("info level") != std::string::npos);
+  BOOST_CHECK(output[1].find("warning level") != std::string::npos);
+  BOOST_CHECK(output[2].find("AsyncClone") != std::string::npos);
+  BOOST_CHECK(output[2].find("cloned logger") != std::string::npos);
+  BOOST_CHECK_EQUAL(sink->droppedMessages(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncLogSinkThreads) {
+  constexpr std::size_t nThreads = 8;
+  constexpr std::size_t nMessages = 500;
+
+  std::ostringstream os;
+  {
+    AsyncLogSink::Config cfg;
+    cfg.out = &os;
+    cfg.bufferSize = 16;
+    cfg.overflowPolicy = AsyncLogSink::OverflowPolicy::Block;
+    AsyncLogSink sink(cfg);
+
+    std::vector<std::thread> threads;
+    for (std::size_t it = 0; it < nThreads; ++it) {
+      threads.emplace_back([&sink, it] {
+        for (std::size_t im = 0; im < nMessages; ++im) {
+          sink.push(std::to_string(it) + " " + std::to_string(im));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    BOOST_CHECK_EQUAL(sink.droppedMessages(), 0u);
+    // the destructor writes the remaining records
+  }
+
+  // Every message is written once, in order for each thread
+  auto output = lines(os.str());
+  BOOST_CHECK_EQUAL(output.size(), nThreads * nMessages);
+  std::vector<std::size_t> next(nThreads, 0);
+  for (const auto& line : output) {
+    std::istringstream is(line);
+    std::size_t it = 0;
+    std::size_t im = 0;
+    is >> it >> im;
+    BOOST_REQUIRE_LT(it, nThreads);
+    BOOST_CHECK_EQUAL(im, next[it]);
+    next[it] = im + 1;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AsyncLogSinkOverflow) {
+  // The background thread is stuck on writing the first record, which keeps
+  // it in the buffer, so only the first four messages fit.
+  GatedBuffer dropBuffer;
+  std::ostream dropStream(&dropBuffer);
+  {
+    AsyncLogSink::Config cfg;
+    cfg.out = &dropStream;
+    cfg.bufferSize = 4;
+    cfg.overflowPolicy = AsyncLogSink::OverflowPolicy::Drop;
+    AsyncLogSink sink(cfg);
+
+    std::size_t accepted = 0;
+    for (std::size_t im = 0; im < 10; ++im) {
+      accepted += sink.push("message " + std::to_string(im)) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(accepted, 4u);
+    BOOST_CHECK_EQUAL(sink.droppedMessages(), 6u);
+
+    dropBuffer.open();
+    sink.flush();
+  }
+  auto output = lines(dropBuffer.str());
+  BOOST_REQUIRE_EQUAL(output.size(), 4u);
+  BOOST_CHECK_EQUAL(output[3], "message 3");
+
+  // With blocking, the messages wait for the background thread instead
+  GatedBuffer blockBuffer;
+  std::ostream blockStream(&blockBuffer);
+  {
+    AsyncLogSink::Config cfg;
+    cfg.out = &blockStream;
+    cfg.bufferSize = 4;
+    cfg.overflowPolicy = AsyncLogSink::OverflowPolicy::Block;
+    AsyncLogSink sink(cfg);
+
+    std::thread producer([&sink] {
+      for (std::size_t im = 0; im < 10; ++im) {
+        sink.push("message " + std::to_string(im));
+      }
+    });
+    blockBuffer.open();
+    producer.join();
+    sink.flush();
+    BOOST_CHECK_EQUAL(sink.droppedMessages(), 0u);
+  }
+  output = lines(blockBuffer.str());
+  BOOST_REQUIRE_EQUAL(output.size(), 10u);
+  BOOST_CHECK_EQUAL(output[9], "message 9");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
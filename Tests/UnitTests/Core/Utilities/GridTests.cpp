@@ -1006,6 +1006,46 @@ BOOST_AUTO_TEST_CASE(grid_interpolation) {
   CHECK_CLOSE_REL(g.interpolate(Point({{2., 3., 4.}})), 80., 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(grid_interpolation_corners) {
+  using Point = std::array<double, 3>;
+  Axis a(AxisClosed, 0.0, 4.0, 4u);
+  Axis b(AxisOpen, {0.0, 1.0, 3.0, 6.0});
+  Axis c(AxisOpen, -1.0, 1.0, 5u);
+  Grid g(Type<double>, std::move(a), std::move(b), std::move(c));
+
+  // fill with distinct values and check the bin arithmetic on the way
+  for (std::size_t bin = 0; bin < g.size(); ++bin) {
+    const auto localBins = g.localBinsFromGlobalBin(bin);
+    BOOST_CHECK_EQUAL(g.globalBinFromLocalBins(localBins), bin);
+    BOOST_CHECK_EQUAL(grid_helper::getGlobalBin(localBins, g.axesTuple()),
+                      bin);
+    g.at(bin) = 0.5 * bin * bin - 3. * bin;
+    BOOST_CHECK_EQUAL(g.atUnchecked(bin), g.at(bin));
+    BOOST_CHECK_EQUAL(g.atLocalBinsUnchecked(localBins), g.at(bin));
+  }
+
+  // compare against the interpolation over the neighborhood of each point,
+  // the last bin of the closed axis interpolates to its first bin
+  for (double x : {0.0, 0.3, 1.5, 2.99, 3.2, 3.999}) {
+    for (double y : {0.0, 0.7, 1.0, 2.4, 5.9}) {
+      for (double z : {-1.0, -0.33, 0.1, 0.95}) {
+        Point p = {x, y, z};
+        const auto localBins = g.localBinsFromPosition(p);
+        std::array<double, 8> neighbors{};
+        std::size_t i = 0;
+        for (std::size_t bin : g.closestPointsIndices(p)) {
+          neighbors.at(i++) = g.at(bin);
+        }
+        BOOST_CHECK_EQUAL(i, 8u);
+        double expected =
+            interpolate(p, g.lowerLeftBinEdge(localBins),
+                        g.upperRightBinEdge(localBins), neighbors);
+        CHECK_CLOSE_REL(g.interpolate(p), expected, 1e-12);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(neighborhood) {
   using bins_t = std::vector<std::size_t>;
 
@@ -622,6 +622,87 @@ BOOST_AUTO_TEST_CASE(range_search_many_same) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(range_search_batch, TreeFixture3DDoubleInt2) {
+  std::vector<RangeXD<3, double>> ranges;
+  for (double xmin = -10.0; xmin <= 10.0; xmin += 2.5) {
+    for (double ymin = -10.0; ymin <= 10.0; ymin += 5.0) {
+      RangeXD<3, double> range;
+      range[0].shrink(xmin, xmin + 5.0);
+      range[1].shrink(ymin, ymin + 7.5);
+      range[2].shrink(-5.0, 5.0);
+      ranges.push_back(range);
+    }
+  }
+  // a range covering everything and one covering nothing
+  ranges.push_back(RangeXD<3, double>());
+  RangeXD<3, double> empty;
+  empty[0].shrink(100.0, 101.0);
+  ranges.push_back(empty);
+
+  std::vector<std::vector<int>> results = tree.rangeSearchBatch(ranges);
+
+  BOOST_CHECK_EQUAL(results.size(), ranges.size());
+  for (std::size_t q = 0; q < ranges.size(); ++q) {
+    BOOST_CHECK(results[q] == tree.rangeSearch(ranges[q]));
+  }
+  BOOST_CHECK_EQUAL(results[ranges.size() - 2].size(), 100);
+  BOOST_CHECK(results.back().empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(knn_search, TreeFixture3DDoubleInt2) {
+  for (const std::array<double, 3>& point :
+       {std::array<double, 3>{0.0, 0.0, 0.0},
+        std::array<double, 3>{-8.5, 2.3, -1.6},
+        std::array<double, 3>{20.0, -20.0, 5.0}}) {
+    // brute force reference, sorted by distance
+    std::vector<std::pair<double, int>> reference;
+    for (const auto& [c, v] : test_vector) {
+      double d = 0.0;
+      for (std::size_t j = 0; j < 3; ++j) {
+        d += (c[j] - point[j]) * (c[j] - point[j]);
+      }
+      reference.emplace_back(d, v);
+    }
+    std::ranges::sort(reference);
+
+    for (std::size_t k : {0u, 1u, 5u, 17u, 100u, 150u}) {
+      std::vector<std::pair<std::array<double, 3>, int>> result =
+          tree.knnSearch(point, k);
+
+      BOOST_CHECK_EQUAL(result.size(), std::min(k, test_vector.size()));
+      for (std::size_t i = 0; i < result.size(); ++i) {
+        BOOST_CHECK_EQUAL(result[i].second, reference[i].second);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(range_search_large_leaves) {
+  std::vector<std::pair<std::array<double, 3>, int>> points(test_vector);
+
+  KDTree<3, int, double, std::array, 32> tree(std::move(points));
+
+  RangeXD<3, double> range;
+  range[0].shrink(-5.0, 5.0);
+  range[2].shrink(-5.0, 5.0);
+
+  std::vector<int> result = tree.rangeSearch(range);
+
+  std::size_t expected = 0;
+  for (const auto& [c, v] : test_vector) {
+    if (-5.0 <= c[0] && c[0] < 5.0 && -5.0 <= c[2] && c[2] < 5.0) {
+      ++expected;
+      BOOST_CHECK(rangeContainsValue(result, v));
+    }
+  }
+  BOOST_CHECK_EQUAL(result.size(), expected);
+
+  std::vector<std::pair<std::array<double, 3>, int>> nearest =
+      tree.knnSearch(std::array<double, 3>{1.0, 1.0, 1.0}, 3);
+  BOOST_CHECK_EQUAL(nearest.size(), 3);
+  BOOST_CHECK_EQUAL(nearest.front().second, 45);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
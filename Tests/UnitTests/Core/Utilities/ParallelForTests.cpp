@@ -0,0 +1,127 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(UtilitiesSuite)
+
+BOOST_AUTO_TEST_CASE(ParallelForVisitsEveryTask) {
+  for (std::size_t numThreads : {1u, 2u, 4u}) {
+    BOOST_TEST_INFO("threads " << numThreads);
+    std::vector<std::atomic<int>> calls(1000);
+    parallelFor(calls.size(), numThreads, [&](std::size_t i) { ++calls[i]; });
+    for (const auto& c : calls) {
+      BOOST_CHECK_EQUAL(c.load(), 1);
+    }
+
+    // chunks cover the range exactly once
+    std::vector<std::atomic<int>> indices(1001);
+    parallelForChunks(indices.size(), 64, numThreads,
+                      [&](std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                          ++indices[i];
+                        }
+                      });
+    for (const auto& c : indices) {
+      BOOST_CHECK_EQUAL(c.load(), 1);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelPhasesAreSequential) {
+  for (std::size_t numThreads : {1u, 3u}) {
+    BOOST_TEST_INFO("threads " << numThreads);
+    // every task of a phase sees the complete previous phase
+    std::vector<int> values(100, 0);
+    int phase = 0;
+    std::atomic<int> mismatches = 0;
+    parallelPhases(
+        values.size(), numThreads,
+        [&](std::size_t i) {
+          if (values[i] != phase) {
+            ++mismatches;
+          }
+          ++values[i];
+        },
+        [&]() -> std::size_t {
+          ++phase;
+          for (int v : values) {
+            if (v != phase) {
+              ++mismatches;
+            }
+          }
+          return phase < 5 ? values.size() : 0;
+        });
+    BOOST_CHECK_EQUAL(phase, 5);
+    BOOST_CHECK_EQUAL(mismatches.load(), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForForwardsExceptions) {
+  for (std::size_t numThreads : {1u, 2u, 4u}) {
+    BOOST_TEST_INFO("threads " << numThreads);
+    BOOST_CHECK_THROW(parallelFor(100, numThreads,
+                                  [](std::size_t i) {
+                                    if (i == 42) {
+                                      throw std::runtime_error("task");
+                                    }
+                                  }),
+                      std::runtime_error);
+
+    int phase = 0;
+    BOOST_CHECK_THROW(parallelPhases(
+                          10, numThreads, [](std::size_t) {},
+                          [&]() -> std::size_t {
+                            if (++phase == 3) {
+                              throw std::runtime_error("phase");
+                            }
+                            return 10;
+                          }),
+                      std::runtime_error);
+    BOOST_CHECK_EQUAL(phase, 3);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForUsesExecutor) {
+  std::size_t executed = 0;
+  ParallelExecutor executor =
+      [&](std::size_t numTasks, const std::function<void(std::size_t)>& task) {
+        executed += numTasks;
+        for (std::size_t i = 0; i < numTasks; ++i) {
+          task(i);
+        }
+      };
+
+  std::vector<int> calls(10, 0);
+  parallelFor(
+      calls.size(), 2, [&](std::size_t i) { ++calls[i]; }, executor);
+  BOOST_CHECK_EQUAL(executed, calls.size());
+  for (int c : calls) {
+    BOOST_CHECK_EQUAL(c, 1);
+  }
+
+  // a single thread does not use the executor
+  parallelFor(
+      calls.size(), 1, [&](std::size_t i) { ++calls[i]; }, executor);
+  BOOST_CHECK_EQUAL(executed, calls.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -17,10 +17,14 @@
 #include "Acts/Vertexing/AdaptiveGridTrackDensity.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <numbers>
 #include <optional>
+#include <random>
 #include <utility>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::UnitLiterals;
@@ -648,6 +652,57 @@ BOOST_AUTO_TEST_CASE(track_removing) {
   CHECK_CLOSE_ABS(0., sixthDensitySum2D, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(density_map_matches_sorted_map) {
+  std::mt19937 rng(31415);
+  std::uniform_int_distribution<std::int32_t> zDist(-200, 200);
+  std::uniform_int_distribution<std::int32_t> tDist(-2, 2);
+  std::uniform_real_distribution<float> densityDist(0., 1.);
+
+  AdaptiveGridTrackDensity::DensityMap densityMap;
+  std::map<AdaptiveGridTrackDensity::Bin, float> reference;
+  std::vector<AdaptiveGridTrackDensity::DensityMap> trackDensityMaps;
+
+  for (std::size_t i = 0; i < 500; ++i) {
+    // Rows of bins crossing tile boundaries, including negative z bins
+    AdaptiveGridTrackDensity::DensityMap trackDensityMap;
+    std::int32_t zBin = zDist(rng);
+    std::int32_t tBin = tDist(rng);
+    for (std::int32_t dz = -10; dz <= 10; ++dz) {
+      trackDensityMap[{zBin + dz, tBin}] = densityDist(rng);
+    }
+    densityMap.add(trackDensityMap);
+    for (const auto& [bin, density] : trackDensityMap) {
+      reference[bin] += density;
+    }
+    trackDensityMaps.push_back(trackDensityMap);
+
+    // Remove some tracks again, the bins stay part of the map
+    if (i % 3 == 0) {
+      const auto& removed = trackDensityMaps[rng() % trackDensityMaps.size()];
+      densityMap.subtract(removed);
+      for (const auto& [bin, density] : removed) {
+        reference[bin] -= density;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(reference.size(), densityMap.size());
+    for (const auto& [bin, density] : reference) {
+      BOOST_CHECK_EQUAL(density, densityMap.at(bin));
+    }
+
+    // The cached maximum has to follow the modifications
+    auto refMax = std::max_element(
+        reference.begin(), reference.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    auto max = densityMap.highestDensityEntry();
+    BOOST_CHECK(max->first == refMax->first);
+    BOOST_CHECK_EQUAL(max->second, refMax->second);
+  }
+
+  BOOST_CHECK(!densityMap.contains({1000, 0}));
+  BOOST_CHECK(densityMap.find({1000, 0}) == densityMap.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
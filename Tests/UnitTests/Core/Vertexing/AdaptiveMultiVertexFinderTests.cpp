@@ -36,11 +36,13 @@
 #include <array>
 #include <chrono>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <numbers>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -671,6 +673,111 @@ BOOST_AUTO_TEST_CASE(
   }
 }
 
+/// @brief AMVF test with several vertex candidates per iteration
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_parallel_candidates_test) {
+  // Set up constant B-Field
+  auto bField = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+
+  // Set up EigenStepper
+  EigenStepper<> stepper(bField);
+
+  // Set up propagator with void navigator
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  // IP Estimator
+  ImpactPointEstimator::Config ipEstCfg(bField, propagator);
+  ImpactPointEstimator ipEst(ipEstCfg);
+
+  std::vector<double> temperatures{
+      8., 4., 2., std::numbers::sqrt2, std::sqrt(3. / 2.), 1.};
+  AnnealingUtility::Config annealingConfig;
+  annealingConfig.setOfTemperatures = temperatures;
+  AnnealingUtility annealingUtility(annealingConfig);
+
+  // Linearizer for BoundTrackParameters type test
+  Linearizer::Config ltConfig;
+  ltConfig.bField = bField;
+  ltConfig.propagator = propagator;
+  Linearizer linearizer(ltConfig);
+
+  // Grid density used during vertex seed finding
+  AdaptiveGridTrackDensity::Config gridDensityCfg;
+  gridDensityCfg.spatialTrkGridSizeRange = {55, 55};
+  gridDensityCfg.spatialBinExtent = 0.05;
+  AdaptiveGridTrackDensity gridDensity(gridDensityCfg);
+
+  using Fitter = AdaptiveMultiVertexFitter;
+  using SeedFinder = AdaptiveGridDensityVertexFinder;
+  using ForEach = std::function<void(std::size_t,
+                                     const std::function<void(std::size_t)>&)>;
+
+  auto makeFinder = [&](ForEach forEach) {
+    Fitter::Config fitterCfg(ipEst);
+    fitterCfg.annealingTool = annealingUtility;
+    fitterCfg.doSmoothing = true;
+    fitterCfg.extractParameters.connect<&InputTrack::extractParameters>();
+    fitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(
+        &linearizer);
+    Fitter fitter(fitterCfg);
+
+    SeedFinder::Config seedFinderCfg(gridDensity);
+    seedFinderCfg.cacheGridStateForTrackRemoval = true;
+    seedFinderCfg.extractParameters.connect<&InputTrack::extractParameters>();
+    auto seedFinder = std::make_shared<SeedFinder>(seedFinderCfg);
+
+    AdaptiveMultiVertexFinder::Config finderConfig(
+        std::move(fitter), std::move(seedFinder), ipEst, bField);
+    finderConfig.extractParameters.connect<&InputTrack::extractParameters>();
+    finderConfig.maxParallelCandidates = 4;
+    finderConfig.forEachCandidate = std::move(forEach);
+    return AdaptiveMultiVertexFinder(std::move(finderConfig));
+  };
+
+  // Runs every task on its own thread
+  ForEach threaded = [](std::size_t n,
+                        const std::function<void(std::size_t)>& task) {
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < n; ++i) {
+      threads.emplace_back(task, i);
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  };
+
+  auto csvData = readTracksAndVertexCSV(toolString);
+  auto tracks = std::get<TracksData>(csvData);
+  std::vector<InputTrack> inputTracks;
+  for (const auto& trk : tracks) {
+    inputTracks.emplace_back(&trk);
+  }
+
+  Vertex bsConstr = std::get<BeamSpotData>(csvData);
+  VertexingOptions vertexingOptions(geoContext, magFieldContext, bsConstr);
+
+  auto findVertices = [&](const AdaptiveMultiVertexFinder& finder) {
+    IVertexFinder::State state = finder.makeState(magFieldContext);
+    auto findResult = finder.find(inputTracks, vertexingOptions, state);
+    BOOST_REQUIRE(findResult.ok());
+    return *findResult;
+  };
+
+  std::vector<Vertex> sequentialVertices =
+      findVertices(makeFinder(ForEach{}));
+  std::vector<Vertex> threadedVertices = findVertices(makeFinder(threaded));
+
+  BOOST_CHECK(!sequentialVertices.empty());
+
+  // The vertices must not depend on how the candidates are executed
+  BOOST_REQUIRE_EQUAL(sequentialVertices.size(), threadedVertices.size());
+  for (std::size_t i = 0; i < sequentialVertices.size(); ++i) {
+    BOOST_CHECK(sequentialVertices[i].fullPosition() ==
+                threadedVertices[i].fullPosition());
+    BOOST_CHECK_EQUAL(sequentialVertices[i].tracks().size(),
+                      threadedVertices[i].tracks().size());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
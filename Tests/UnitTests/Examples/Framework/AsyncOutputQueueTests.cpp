@@ -0,0 +1,132 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Utilities/AsyncOutputQueue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+BOOST_AUTO_TEST_CASE(AsyncOutputQueueOrder) {
+  std::vector<int> consumed;
+  AsyncOutputQueue<int> queue(4, [&](int&& value) {
+    consumed.push_back(value);
+  });
+  for (int i = 0; i < 1000; ++i) {
+    queue.push(i);
+  }
+  queue.close();
+  // a second close has no effect
+  queue.close();
+
+  BOOST_REQUIRE_EQUAL(consumed.size(), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    BOOST_CHECK_EQUAL(consumed[i], i);
+  }
+  BOOST_CHECK_THROW(queue.push(0), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncOutputQueueProducers) {
+  const std::size_t nProducers = 8;
+  const std::size_t nRecords = 500;
+
+  // the records of one producer stay in order
+  std::vector<std::vector<std::size_t>> consumed(nProducers);
+  AsyncOutputQueue<std::vector<std::size_t>> queue(
+      2, [&](std::vector<std::size_t>&& record) {
+        consumed[record[0]].push_back(record[1]);
+      });
+
+  std::vector<std::thread> producers;
+  for (std::size_t p = 0; p < nProducers; ++p) {
+    producers.emplace_back([&queue, p]() {
+      for (std::size_t i = 0; i < nRecords; ++i) {
+        queue.push({p, i});
+      }
+    });
+  }
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  queue.close();
+
+  for (const std::vector<std::size_t>& records : consumed) {
+    BOOST_REQUIRE_EQUAL(records.size(), nRecords);
+    BOOST_CHECK(std::ranges::is_sorted(records));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AsyncOutputQueueCapacity) {
+  std::atomic<bool> release = false;
+  std::atomic<std::size_t> nConsumed = 0;
+  AsyncOutputQueue<int> queue(2, [&](int&& /*value*/) {
+    while (!release) {
+      std::this_thread::yield();
+    }
+    ++nConsumed;
+  });
+
+  // one record is held by the consumer, two wait in the queue
+  std::atomic<std::size_t> nPushed = 0;
+  std::thread producer([&]() {
+    for (int i = 0; i < 4; ++i) {
+      queue.push(i);
+      ++nPushed;
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  BOOST_CHECK_EQUAL(nPushed.load(), 3u);
+  BOOST_CHECK_EQUAL(nConsumed.load(), 0u);
+
+  release = true;
+  producer.join();
+  queue.close();
+  BOOST_CHECK_EQUAL(nPushed.load(), 4u);
+  BOOST_CHECK_EQUAL(nConsumed.load(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncOutputQueueError) {
+  BOOST_CHECK_THROW(AsyncOutputQueue<int>(0, [](int&&) {}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(AsyncOutputQueue<int>(1, nullptr), std::invalid_argument);
+
+  std::vector<int> consumed;
+  AsyncOutputQueue<int> queue(1, [&](int&& value) {
+    if (value == 3) {
+      throw std::runtime_error("Consumer failed");
+    }
+    consumed.push_back(value);
+  });
+
+  // the error reaches the pushes after the failure and the close
+  try {
+    for (int i = 0; i < 100; ++i) {
+      queue.push(i);
+    }
+  } catch (const std::runtime_error&) {
+  }
+  BOOST_CHECK_THROW(queue.close(), std::runtime_error);
+  BOOST_CHECK_NO_THROW(queue.close());
+  BOOST_CHECK_EQUAL(consumed.size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,101 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/EventArena.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+BOOST_AUTO_TEST_CASE(EventArenaGrowth) {
+  EventArena arena(1024, false);
+  BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+
+  {
+    std::pmr::vector<double> values(&arena);
+    values.reserve(1000);
+    values.assign(1000, 1.);
+    BOOST_CHECK_EQUAL(arena.allocated(), 1000 * sizeof(double));
+
+    void* ptr = arena.allocate(16, 64);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0u);
+  }
+
+  // the buffer grows to the peak usage of the previous event
+  arena.reset();
+  BOOST_CHECK_EQUAL(arena.allocated(), 0u);
+  BOOST_CHECK_GE(arena.capacity(), 1000 * sizeof(double) + 16);
+
+  const std::size_t capacity = arena.capacity();
+  {
+    std::pmr::vector<double> values(500, 2., &arena);
+    BOOST_CHECK_EQUAL(values.back(), 2.);
+  }
+  arena.reset();
+  BOOST_CHECK_EQUAL(arena.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(EventArenaSynchronized) {
+  EventArena arena(64, true);
+
+  std::atomic<std::size_t> nValid = 0;
+  std::vector<std::thread> threads;
+  for (std::size_t it = 0; it < 4; ++it) {
+    threads.emplace_back([&arena, &nValid, it] {
+      std::pmr::vector<std::size_t> values(&arena);
+      for (std::size_t i = 0; i < 1000; ++i) {
+        values.push_back(it);
+      }
+      for (std::size_t value : values) {
+        nValid += (value == it) ? 1 : 0;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(nValid, 4 * 1000u);
+  BOOST_CHECK_GT(arena.allocated(), 4 * 1000 * sizeof(std::size_t));
+}
+
+BOOST_AUTO_TEST_CASE(EventArenaPoolReuse) {
+  EventArenaPool pool(1024, false);
+
+  EventArena* first = nullptr;
+  {
+    auto lease = pool.acquire();
+    first = lease.get();
+    BOOST_REQUIRE(first != nullptr);
+    BOOST_CHECK(first->allocate(100, 8) != nullptr);
+
+    // a concurrent event gets its own arena
+    auto other = pool.acquire();
+    BOOST_CHECK_NE(other.get(), first);
+    BOOST_CHECK_EQUAL(pool.size(), 2u);
+  }
+
+  // returned arenas are reset and reused
+  auto lease = pool.acquire();
+  BOOST_CHECK_EQUAL(pool.size(), 2u);
+  BOOST_CHECK_EQUAL(lease.get()->allocated(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,207 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/EventArena.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+/// Writes a constant value
+class ProduceAlgorithm final : public IAlgorithm {
+ public:
+  ProduceAlgorithm(const std::string& output, int value)
+      : IAlgorithm("Produce_" + output), m_value(value) {
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    m_output(ctx, int{m_value});
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  int m_value;
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+/// Writes the sum of two inputs
+class SumAlgorithm final : public IAlgorithm {
+ public:
+  SumAlgorithm(const std::string& lhs, const std::string& rhs,
+               const std::string& output)
+      : IAlgorithm("Sum_" + output) {
+    m_lhs.initialize(lhs);
+    m_rhs.initialize(rhs);
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    m_output(ctx, m_lhs(ctx) + m_rhs(ctx));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  ReadDataHandle<int> m_lhs{this, "Lhs"};
+  ReadDataHandle<int> m_rhs{this, "Rhs"};
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+/// Consumes an input and checks its value
+class CheckAlgorithm final : public IAlgorithm {
+ public:
+  CheckAlgorithm(const std::string& input, int expected,
+                 std::atomic<std::size_t>& nValid)
+      : IAlgorithm("Check_" + input), m_expected(expected), m_nValid(nValid) {
+    m_input.initialize(input);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    if (m_input(ctx) == m_expected) {
+      m_nValid++;
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  int m_expected;
+  std::atomic<std::size_t>& m_nValid;
+  ConsumeDataHandle<int> m_input{this, "Input"};
+};
+
+/// Writes a vector allocated from the event memory resource
+class ArenaAlgorithm final : public IAlgorithm {
+ public:
+  ArenaAlgorithm(const std::string& output, std::atomic<std::size_t>& nArena)
+      : IAlgorithm("Arena_" + output), m_nArena(nArena) {
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    if (dynamic_cast<EventArena*>(ctx.memoryResource) != nullptr) {
+      m_nArena++;
+    }
+    std::pmr::vector<int> values(100, 1, ctx.memoryResource);
+    m_output(ctx, std::move(values));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::atomic<std::size_t>& m_nArena;
+  WriteDataHandle<std::pmr::vector<int>> m_output{this, "Output"};
+};
+
+/// Writes the sum of the entries of a vector
+class AccumulateAlgorithm final : public IAlgorithm {
+ public:
+  AccumulateAlgorithm(const std::string& input, const std::string& output)
+      : IAlgorithm("Accumulate_" + output) {
+    m_input.initialize(input);
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    int sum = 0;
+    for (int value : m_input(ctx)) {
+      sum += value;
+    }
+    m_output(ctx, int{sum});
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  ReadDataHandle<std::pmr::vector<int>> m_input{this, "Input"};
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+std::size_t runArena(bool intraEventParallelism, int numThreads,
+                     std::atomic<std::size_t>& nArena) {
+  Sequencer::Config cfg;
+  cfg.events = 20;
+  cfg.numThreads = numThreads;
+  cfg.trackFpes = false;
+  cfg.intraEventParallelism = intraEventParallelism;
+  cfg.useEventArena = true;
+  // small enough that the arenas have to grow
+  cfg.eventArenaSize = 64;
+  Sequencer sequencer(cfg);
+
+  std::atomic<std::size_t> nValid = 0;
+
+  sequencer.addAlgorithm(std::make_shared<ArenaAlgorithm>("a", nArena));
+  sequencer.addAlgorithm(std::make_shared<ArenaAlgorithm>("b", nArena));
+  sequencer.addAlgorithm(std::make_shared<AccumulateAlgorithm>("a", "sa"));
+  sequencer.addAlgorithm(std::make_shared<AccumulateAlgorithm>("b", "sb"));
+  sequencer.addAlgorithm(std::make_shared<CheckAlgorithm>("sa", 100, nValid));
+  sequencer.addAlgorithm(std::make_shared<CheckAlgorithm>("sb", 100, nValid));
+
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  return nValid;
+}
+
+std::size_t runDiamond(bool intraEventParallelism, int numThreads) {
+  Sequencer::Config cfg;
+  cfg.events = 20;
+  cfg.numThreads = numThreads;
+  cfg.trackFpes = false;
+  cfg.intraEventParallelism = intraEventParallelism;
+  Sequencer sequencer(cfg);
+
+  std::atomic<std::size_t> nValid = 0;
+
+  // a -> (b, c) -> d, where d consumes a value that b and c also read
+  sequencer.addAlgorithm(std::make_shared<ProduceAlgorithm>("a", 1));
+  sequencer.addAlgorithm(std::make_shared<ProduceAlgorithm>("x", 2));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>("a", "x", "b"));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>("a", "a", "c"));
+  sequencer.addAlgorithm(std::make_shared<CheckAlgorithm>("a", 1, nValid));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>("b", "c", "d"));
+  sequencer.addAlgorithm(std::make_shared<CheckAlgorithm>("d", 5, nValid));
+
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  return nValid;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+BOOST_AUTO_TEST_CASE(SequencerSerialElements) {
+  BOOST_CHECK_EQUAL(runDiamond(false, 1), 40u);
+}
+
+BOOST_AUTO_TEST_CASE(SequencerIntraEventParallelism) {
+  BOOST_CHECK_EQUAL(runDiamond(true, 1), 40u);
+  BOOST_CHECK_EQUAL(runDiamond(true, 4), 40u);
+}
+
+BOOST_AUTO_TEST_CASE(SequencerEventArena) {
+  for (bool intraEventParallelism : {false, true}) {
+    std::atomic<std::size_t> nArena = 0;
+    BOOST_CHECK_EQUAL(runArena(intraEventParallelism, 4, nArena), 40u);
+    BOOST_CHECK_EQUAL(nArena, 40u);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -55,11 +55,7 @@ auto makeTestSimhits(std::size_t nSimHits) {
   return simhits;
 }
 
-namespace ActsTests {
-
-BOOST_AUTO_TEST_SUITE(RootSuite)
-
-BOOST_AUTO_TEST_CASE(RoundTripTest) {
+void roundTrip(RootOutputMode outputMode) {
   ////////////////////////////
   // Create some dummy data //
   ////////////////////////////
@@ -72,6 +68,7 @@ BOOST_AUTO_TEST_CASE(RoundTripTest) {
   RootSimHitWriter::Config writerConfig;
   writerConfig.inputSimHits = "hits";
   writerConfig.filePath = "./testhits.root";
+  writerConfig.outputMode = outputMode;
 
   RootSimHitWriter writer(writerConfig, Logging::WARNING);
 
@@ -121,6 +118,22 @@ BOOST_AUTO_TEST_CASE(RoundTripTest) {
   check(hitsRead2, simhits2, 1.e-6);
 }
 
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(RootSuite)
+
+BOOST_AUTO_TEST_CASE(RoundTripTest) {
+  roundTrip(RootOutputMode::Locked);
+}
+
+BOOST_AUTO_TEST_CASE(RoundTripAsyncTest) {
+  roundTrip(RootOutputMode::Async);
+}
+
+BOOST_AUTO_TEST_CASE(RoundTripFilePerThreadTest) {
+  roundTrip(RootOutputMode::FilePerThread);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
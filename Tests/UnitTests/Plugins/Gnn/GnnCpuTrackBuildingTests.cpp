@@ -0,0 +1,119 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
+#include "ActsPlugins/Gnn/CpuTrackBuilding.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace Acts;
+using namespace ActsPlugins;
+
+namespace {
+
+PipelineTensors makeTensors(const std::vector<std::int64_t> &src,
+                            const std::vector<std::int64_t> &tgt,
+                            const std::vector<float> &scores,
+                            std::size_t numNodes) {
+  ExecutionContext execCtx{Device::Cpu(), {}};
+
+  auto edgeTensor = Tensor<std::int64_t>::Create({2, src.size()}, execCtx);
+  std::copy(src.begin(), src.end(), edgeTensor.data());
+  std::copy(tgt.begin(), tgt.end(), edgeTensor.data() + src.size());
+
+  auto scoreTensor = Tensor<float>::Create({scores.size(), 1}, execCtx);
+  std::copy(scores.begin(), scores.end(), scoreTensor.data());
+
+  auto dummyNodes = Tensor<float>::Create({numNodes, 4}, execCtx);
+
+  return {std::move(dummyNodes), std::move(edgeTensor), std::nullopt,
+          std::move(scoreTensor)};
+}
+
+void sortTracks(std::vector<std::vector<int>> &tracks) {
+  std::ranges::for_each(tracks, [](auto &t) { std::ranges::sort(t); });
+  std::ranges::sort(tracks);
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(GnnSuite)
+
+BOOST_AUTO_TEST_CASE(test_cpu_track_building_vs_boost) {
+  const std::size_t numNodes = 2000;
+  std::vector<int> spacePointIds(numNodes);
+  std::iota(spacePointIds.begin(), spacePointIds.end(), 100);
+
+  // Random sparse graph with components of very different sizes
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<std::int64_t> node(0, numNodes - 1);
+  std::vector<std::int64_t> src, tgt;
+  std::vector<float> scores;
+  for (std::size_t i = 0; i < 1500; ++i) {
+    src.push_back(node(rng));
+    tgt.push_back(node(rng));
+    scores.push_back(1.f);
+  }
+
+  BoostTrackBuilding boostBuilder(
+      {}, getDefaultLogger("BoostTrackBuilding", Logging::ERROR));
+  auto refTracks = boostBuilder(makeTensors(src, tgt, scores, numNodes),
+                                spacePointIds);
+  sortTracks(refTracks);
+
+  for (std::size_t numThreads : {1ul, 4ul}) {
+    CpuTrackBuilding::Config cfg;
+    cfg.minCandidateSize = 1;
+    cfg.numThreads = numThreads;
+    CpuTrackBuilding cpuBuilder(
+        cfg, getDefaultLogger("CpuTrackBuilding", Logging::ERROR));
+
+    auto testTracks = cpuBuilder(makeTensors(src, tgt, scores, numNodes),
+                                 spacePointIds);
+    sortTracks(testTracks);
+
+    BOOST_CHECK(testTracks == refTracks);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_cpu_track_building_junction_removal) {
+  // Track 0 -> 1 -> 2 -> 3 with a lower score branch 1 -> 4 and a lower score
+  // merging edge 5 -> 2
+  std::vector<int> spacePointIds(6);
+  std::iota(spacePointIds.begin(), spacePointIds.end(), 0);
+  const std::vector<std::int64_t> src = {0, 1, 1, 2, 5};
+  const std::vector<std::int64_t> tgt = {1, 2, 4, 3, 2};
+  const std::vector<float> scores = {0.9f, 0.8f, 0.6f, 0.9f, 0.7f};
+
+  CpuTrackBuilding::Config cfg;
+  cfg.minCandidateSize = 1;
+  CpuTrackBuilding noJunctionRemoval(
+      cfg, getDefaultLogger("CpuTrackBuilding", Logging::ERROR));
+  auto tracks =
+      noJunctionRemoval(makeTensors(src, tgt, scores, 6), spacePointIds);
+  BOOST_REQUIRE_EQUAL(tracks.size(), 1);
+  BOOST_CHECK_EQUAL(tracks.front().size(), 6);
+
+  cfg.doJunctionRemoval = true;
+  cfg.minCandidateSize = 3;
+  CpuTrackBuilding junctionRemoval(
+      cfg, getDefaultLogger("CpuTrackBuilding", Logging::ERROR));
+  tracks = junctionRemoval(makeTensors(src, tgt, scores, 6), spacePointIds);
+  BOOST_REQUIRE_EQUAL(tracks.size(), 1);
+  BOOST_CHECK(tracks.front() == std::vector<int>({0, 1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
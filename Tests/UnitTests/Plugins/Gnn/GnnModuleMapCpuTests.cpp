@@ -0,0 +1,227 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+using namespace Acts;
+using namespace ActsPlugins;
+
+namespace {
+
+// Three layers, each with two modules for the two halves in phi
+constexpr std::array<float, 3> layerRadii = {30.f, 60.f, 90.f};
+
+std::uint64_t moduleId(std::size_t layer, std::size_t half) {
+  return 10 * (layer + 1) + half;
+}
+
+std::shared_ptr<const ModuleMapCpu::ModuleMap> makeModuleMap() {
+  ModuleMapCpu::DoubletCuts cuts;
+  cuts.z0Min = -100.f;
+  cuts.z0Max = 100.f;
+  cuts.dphiMin = -0.1f;
+  cuts.dphiMax = 0.1f;
+  cuts.phiSlopeMin = -0.01f;
+  cuts.phiSlopeMax = 0.01f;
+  cuts.detaMin = -1.f;
+  cuts.detaMax = 1.f;
+
+  auto moduleMap = std::make_shared<ModuleMapCpu::ModuleMap>();
+  for (std::size_t half : {0ul, 1ul}) {
+    for (std::size_t layer : {0ul, 1ul}) {
+      moduleMap->doublets.push_back(
+          {moduleId(layer, half), moduleId(layer + 1, half), cuts});
+    }
+    ModuleMapCpu::Triplet triplet;
+    triplet.module1 = moduleId(0, half);
+    triplet.module2 = moduleId(1, half);
+    triplet.module3 = moduleId(2, half);
+    triplet.cuts12 = cuts;
+    triplet.cuts23 = cuts;
+    triplet.diffDydxMin = -0.05f;
+    triplet.diffDydxMax = 0.05f;
+    triplet.diffDzdrMin = -0.05f;
+    triplet.diffDzdrMax = 0.05f;
+    moduleMap->triplets.push_back(triplet);
+  }
+  return moduleMap;
+}
+
+void addHit(std::vector<float> &features, std::vector<std::uint64_t> &modules,
+            std::size_t layer, float phi, float z) {
+  const float r = layerRadii.at(layer);
+  features.insert(features.end(), {r, phi, z, std::asinh(z / r)});
+  modules.push_back(moduleId(layer, phi > 0.f ? 0 : 1));
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(GnnSuite)
+
+BOOST_AUTO_TEST_CASE(test_module_map_cpu) {
+  std::vector<float> features;
+  std::vector<std::uint64_t> modules;
+
+  // Two straight tracks, hits 0-2 and 3-5
+  for (float phi : {0.5f, -2.f}) {
+    for (std::size_t layer = 0; layer < 3; ++layer) {
+      addHit(features, modules, layer, phi, 0.5f * layerRadii.at(layer));
+    }
+  }
+  // Hit 6 fails the dphi cut of the doublets
+  addHit(features, modules, 1, 1.f, 30.f);
+  // Hit 7 passes the doublet cuts with hit 1, but fails the triplet cuts
+  addHit(features, modules, 2, 0.5f, 65.f);
+  // Hit 8 is on a module that is not in the module map
+  features.insert(features.end(), {60.f, 0.5f, 30.f, 0.5f});
+  modules.push_back(999);
+
+  std::optional<std::vector<std::int64_t>> refEdgeIndex;
+  for (std::size_t numThreads : {1ul, 3ul}) {
+    ModuleMapCpu::Config cfg;
+    cfg.moduleMap = makeModuleMap();
+    cfg.numThreads = numThreads;
+    ModuleMapCpu graphConstructor(
+        cfg, getDefaultLogger("ModuleMapCpu", Logging::ERROR));
+
+    auto tensors = graphConstructor(features, modules.size(), modules);
+
+    BOOST_CHECK(tensors.nodeFeatures.shape() ==
+                (Tensor<float>::Shape{modules.size(), 4}));
+    BOOST_CHECK(std::equal(features.begin(), features.end(),
+                           tensors.nodeFeatures.data()));
+
+    const std::size_t nEdges = tensors.edgeIndex.shape().at(1);
+    BOOST_REQUIRE_EQUAL(nEdges, 4);
+    BOOST_REQUIRE(tensors.edgeFeatures.has_value());
+    BOOST_CHECK(tensors.edgeFeatures->shape() ==
+                (Tensor<float>::Shape{nEdges, 6}));
+
+    std::set<std::pair<std::int64_t, std::int64_t>> edges;
+    for (std::size_t i = 0; i < nEdges; ++i) {
+      edges.emplace(tensors.edgeIndex.data()[i],
+                    tensors.edgeIndex.data()[nEdges + i]);
+    }
+    const std::set<std::pair<std::int64_t, std::int64_t>> refEdges = {
+        {0, 1}, {1, 2}, {3, 4}, {4, 5}};
+    BOOST_CHECK(edges == refEdges);
+
+    // The edge order must not depend on the number of threads
+    std::vector<std::int64_t> edgeIndex(tensors.edgeIndex.data(),
+                                        tensors.edgeIndex.data() + 2 * nEdges);
+    if (refEdgeIndex) {
+      BOOST_CHECK(edgeIndex == *refEdgeIndex);
+    }
+    refEdgeIndex = edgeIndex;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_module_map_cpu_invalid) {
+  ModuleMapCpu::Config cfg;
+  BOOST_CHECK_THROW(
+      ModuleMapCpu(cfg, getDefaultLogger("ModuleMapCpu", Logging::ERROR)),
+      std::invalid_argument);
+
+  // Triplet without the corresponding doublets
+  auto moduleMap = std::make_shared<ModuleMapCpu::ModuleMap>();
+  moduleMap->triplets.push_back({1, 2, 3, {}, {}, 0.f, 0.f, 0.f, 0.f});
+  cfg.moduleMap = moduleMap;
+  BOOST_CHECK_THROW(
+      ModuleMapCpu(cfg, getDefaultLogger("ModuleMapCpu", Logging::ERROR)),
+      std::invalid_argument);
+
+  // No hits
+  cfg.moduleMap = makeModuleMap();
+  ModuleMapCpu graphConstructor(
+      cfg, getDefaultLogger("ModuleMapCpu", Logging::ERROR));
+  std::vector<float> features;
+  BOOST_CHECK_THROW(graphConstructor(features, 0, {}), NoEdgesError);
+}
+
+BOOST_AUTO_TEST_CASE(test_module_map_cpu_csv) {
+  const std::string prefix =
+      (std::filesystem::temp_directory_path() / "acts-gnn-module-map").string();
+
+  auto moduleMap = makeModuleMap();
+  ModuleMapCpu::writeModuleMap(*moduleMap, prefix);
+  auto readMap = ModuleMapCpu::readModuleMap(prefix);
+
+  auto checkCuts = [](const ModuleMapCpu::DoubletCuts &a,
+                      const ModuleMapCpu::DoubletCuts &b) {
+    BOOST_CHECK_EQUAL(a.z0Min, b.z0Min);
+    BOOST_CHECK_EQUAL(a.z0Max, b.z0Max);
+    BOOST_CHECK_EQUAL(a.dphiMin, b.dphiMin);
+    BOOST_CHECK_EQUAL(a.dphiMax, b.dphiMax);
+    BOOST_CHECK_EQUAL(a.phiSlopeMin, b.phiSlopeMin);
+    BOOST_CHECK_EQUAL(a.phiSlopeMax, b.phiSlopeMax);
+    BOOST_CHECK_EQUAL(a.detaMin, b.detaMin);
+    BOOST_CHECK_EQUAL(a.detaMax, b.detaMax);
+  };
+
+  BOOST_REQUIRE_EQUAL(readMap->doublets.size(), moduleMap->doublets.size());
+  for (std::size_t i = 0; i < moduleMap->doublets.size(); ++i) {
+    const auto &ref = moduleMap->doublets[i];
+    const auto &test = readMap->doublets[i];
+    BOOST_CHECK_EQUAL(test.module1, ref.module1);
+    BOOST_CHECK_EQUAL(test.module2, ref.module2);
+    checkCuts(test.cuts, ref.cuts);
+  }
+
+  BOOST_REQUIRE_EQUAL(readMap->triplets.size(), moduleMap->triplets.size());
+  for (std::size_t i = 0; i < moduleMap->triplets.size(); ++i) {
+    const auto &ref = moduleMap->triplets[i];
+    const auto &test = readMap->triplets[i];
+    BOOST_CHECK_EQUAL(test.module1, ref.module1);
+    BOOST_CHECK_EQUAL(test.module2, ref.module2);
+    BOOST_CHECK_EQUAL(test.module3, ref.module3);
+    checkCuts(test.cuts12, ref.cuts12);
+    checkCuts(test.cuts23, ref.cuts23);
+    BOOST_CHECK_EQUAL(test.diffDydxMin, ref.diffDydxMin);
+    BOOST_CHECK_EQUAL(test.diffDydxMax, ref.diffDydxMax);
+    BOOST_CHECK_EQUAL(test.diffDzdrMin, ref.diffDzdrMin);
+    BOOST_CHECK_EQUAL(test.diffDzdrMax, ref.diffDzdrMax);
+  }
+
+  // The graph constructor reads the module map from the path if none is given
+  ModuleMapCpu::Config cfg;
+  cfg.moduleMapPath = prefix;
+  ModuleMapCpu graphConstructor(
+      cfg, getDefaultLogger("ModuleMapCpu", Logging::ERROR));
+  BOOST_CHECK_EQUAL(graphConstructor.config().moduleMap->triplets.size(),
+                    moduleMap->triplets.size());
+
+  // Files with a different layout are rejected
+  {
+    std::ofstream doublets(prefix + ".doublets.csv");
+    doublets << "module1,module2\n1,2\n";
+  }
+  BOOST_CHECK_THROW(ModuleMapCpu::readModuleMap(prefix), std::runtime_error);
+  BOOST_CHECK_THROW(ModuleMapCpu::readModuleMap(prefix + "-missing"),
+                    std::runtime_error);
+
+  std::filesystem::remove(prefix + ".doublets.csv");
+  std::filesystem::remove(prefix + ".triplets.csv");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
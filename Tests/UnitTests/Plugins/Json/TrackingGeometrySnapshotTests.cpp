@@ -0,0 +1,213 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Material/Material.hpp"
+#include "ActsPlugins/Json/TrackingGeometryJsonConverter.hpp"
+#include "ActsPlugins/Json/TrackingGeometrySnapshot.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "ActsTests/CommonHelpers/TemporaryDirectory.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(JsonSuite)
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotRoundTrip) {
+  GeometryContext gctx = GeometryContext::dangerouslyDefaultConstruct();
+  TemporaryDirectory tmp{};
+
+  CylindricalTrackingGeometry cylindricalGeometryBuilder(gctx, true);
+  auto sourceGeometry = cylindricalGeometryBuilder();
+
+  const Material material = Material::fromMolarDensity(1., 2., 3., 4., 5.);
+  sourceGeometry->highestTrackingVolume()->assignVolumeMaterial(
+      std::make_shared<HomogeneousVolumeMaterial>(material));
+
+  // any file can act as geometry source
+  const auto sourcePath = tmp.path() / "source.txt";
+  {
+    std::ofstream out(sourcePath);
+    out << "geometry source";
+  }
+  const std::uint64_t hash = TrackingGeometrySnapshot::sourceHash({sourcePath});
+
+  const auto snapshotPath = tmp.path() / "geometry.snapshot";
+  BOOST_CHECK(!TrackingGeometrySnapshot::readSourceHash(snapshotPath));
+
+  TrackingGeometrySnapshot::write(snapshotPath, gctx, *sourceGeometry, hash);
+  BOOST_CHECK(TrackingGeometrySnapshot::readSourceHash(snapshotPath) == hash);
+
+  // the binary snapshot is more compact than the JSON text
+  const std::string jsonText =
+      TrackingGeometryJsonConverter{}.toJson(gctx, *sourceGeometry).dump();
+  BOOST_CHECK_LT(std::filesystem::file_size(snapshotPath), jsonText.size());
+
+  auto decodedGeometry =
+      TrackingGeometrySnapshot::read(snapshotPath, gctx, hash);
+  BOOST_REQUIRE(decodedGeometry != nullptr);
+
+  std::vector<const TrackingVolume*> sourceVolumes;
+  sourceGeometry->visitVolumes(
+      [&](const TrackingVolume* volume) { sourceVolumes.push_back(volume); });
+  std::vector<const TrackingVolume*> decodedVolumes;
+  decodedGeometry->visitVolumes(
+      [&](const TrackingVolume* volume) { decodedVolumes.push_back(volume); });
+  BOOST_REQUIRE_EQUAL(sourceVolumes.size(), decodedVolumes.size());
+  for (std::size_t i = 0; i < sourceVolumes.size(); ++i) {
+    BOOST_CHECK_EQUAL(sourceVolumes[i]->geometryId(),
+                      decodedVolumes[i]->geometryId());
+    BOOST_CHECK_EQUAL(sourceVolumes[i]->portals().size(),
+                      decodedVolumes[i]->portals().size());
+    BOOST_CHECK_EQUAL(sourceVolumes[i]->surfaces().size(),
+                      decodedVolumes[i]->surfaces().size());
+  }
+
+  const auto* decodedMaterial =
+      decodedGeometry->highestTrackingVolume()->volumeMaterial();
+  BOOST_REQUIRE(decodedMaterial != nullptr);
+  BOOST_CHECK_EQUAL(decodedMaterial->material(Vector3::Zero()), material);
+
+  // snapshots of other sources are rejected
+  BOOST_CHECK_THROW(
+      TrackingGeometrySnapshot::read(snapshotPath, gctx, hash + 1),
+      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotInvalid) {
+  GeometryContext gctx = GeometryContext::dangerouslyDefaultConstruct();
+  TemporaryDirectory tmp{};
+
+  const auto path = tmp.path() / "invalid.snapshot";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "not a geometry snapshot";
+  }
+  BOOST_CHECK(!TrackingGeometrySnapshot::readSourceHash(path));
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot::read(path, gctx, 0),
+                    std::runtime_error);
+
+  CylindricalTrackingGeometry cylindricalGeometryBuilder(gctx, true);
+  auto geometry = cylindricalGeometryBuilder();
+  TrackingGeometrySnapshot::write(path, gctx, *geometry, 42);
+
+  // truncate the payload
+  const auto size = std::filesystem::file_size(path);
+  std::filesystem::resize_file(path, size / 2);
+  BOOST_CHECK(TrackingGeometrySnapshot::readSourceHash(path) == 42u);
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot::read(path, gctx, 42),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotLoad) {
+  GeometryContext gctx = GeometryContext::dangerouslyDefaultConstruct();
+  TemporaryDirectory tmp{};
+
+  const auto modulePath = tmp.path() / "module.so";
+  const auto configPath = tmp.path() / "config.xml";
+  auto writeSource = [](const std::filesystem::path& path,
+                        const std::string& content) {
+    std::ofstream out(path);
+    out << content;
+  };
+  writeSource(modulePath, "module");
+  writeSource(configPath, "config");
+  const std::vector<std::filesystem::path> sources = {modulePath, configPath};
+
+  std::size_t nBuilds = 0;
+  auto build = [&]() -> std::shared_ptr<TrackingGeometry> {
+    ++nBuilds;
+    CylindricalTrackingGeometry cylindricalGeometryBuilder(gctx, true);
+    return cylindricalGeometryBuilder();
+  };
+
+  auto countVolumes = [](const TrackingGeometry& geometry) {
+    std::size_t nVolumes = 0;
+    geometry.visitVolumes([&](const TrackingVolume*) { ++nVolumes; });
+    return nVolumes;
+  };
+
+  // the first job builds the geometry and writes the snapshot
+  const auto snapshotPath = tmp.path() / "geometry.snapshot";
+  auto built =
+      TrackingGeometrySnapshot::load(snapshotPath, sources, build, gctx);
+  BOOST_CHECK_EQUAL(nBuilds, 1u);
+  BOOST_CHECK(TrackingGeometrySnapshot::readSourceHash(snapshotPath) ==
+              TrackingGeometrySnapshot::sourceHash(sources));
+
+  // the following jobs read it
+  auto loaded =
+      TrackingGeometrySnapshot::load(snapshotPath, sources, build, gctx);
+  BOOST_CHECK_EQUAL(nBuilds, 1u);
+  BOOST_REQUIRE(loaded != nullptr);
+  BOOST_CHECK_EQUAL(countVolumes(*loaded), countVolumes(*built));
+
+  // a changed configuration file invalidates the snapshot
+  writeSource(configPath, "changed config");
+  TrackingGeometrySnapshot::load(snapshotPath, sources, build, gctx);
+  BOOST_CHECK_EQUAL(nBuilds, 2u);
+  TrackingGeometrySnapshot::load(snapshotPath, sources, build, gctx);
+  BOOST_CHECK_EQUAL(nBuilds, 2u);
+}
+
+/// Volume material type the Json converter does not support
+class UnsupportedVolumeMaterial final : public IVolumeMaterial {
+ public:
+  const Material material(const Vector3& /*position*/) const override {
+    return Material::Vacuum();
+  }
+  std::ostream& toStream(std::ostream& sl) const override { return sl; }
+};
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshotUnsupportedMaterial) {
+  GeometryContext gctx = GeometryContext::dangerouslyDefaultConstruct();
+  TemporaryDirectory tmp{};
+
+  auto build = [&]() -> std::shared_ptr<TrackingGeometry> {
+    CylindricalTrackingGeometry cylindricalGeometryBuilder(gctx, true);
+    auto geometry = cylindricalGeometryBuilder();
+    geometry->highestTrackingVolume()->assignVolumeMaterial(
+        std::make_shared<UnsupportedVolumeMaterial>());
+    return geometry;
+  };
+
+  BOOST_CHECK_THROW(TrackingGeometryJsonConverter{}.toJson(gctx, *build()),
+                    std::invalid_argument);
+
+  // the geometry is still built, but no snapshot is written
+  const auto sourcePath = tmp.path() / "source.txt";
+  {
+    std::ofstream out(sourcePath);
+    out << "geometry source";
+  }
+  const auto snapshotPath = tmp.path() / "geometry.snapshot";
+  auto geometry =
+      TrackingGeometrySnapshot::load(snapshotPath, {sourcePath}, build, gctx);
+  BOOST_CHECK(geometry != nullptr);
+  BOOST_CHECK(!std::filesystem::exists(snapshotPath));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
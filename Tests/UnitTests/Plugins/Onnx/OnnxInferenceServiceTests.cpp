@@ -0,0 +1,211 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsPlugins;
+
+namespace {
+
+using Model = OnnxInferenceService::Model;
+
+constexpr std::size_t nInput = 3;
+constexpr std::size_t nOutput = 2;
+
+// Stub network, which returns the sum and the product of the features of
+// every row and records the size of the batches
+struct StubNetwork {
+  std::mutex mutex;
+  std::vector<std::size_t> batchSizes;
+  std::atomic<std::size_t> running = 0;
+  std::atomic<std::size_t> maxRunning = 0;
+
+  Model::RunFunction function() {
+    return [this](const float* input, float* output, std::size_t rows) {
+      const std::size_t nRunning = ++running;
+      std::size_t previous = maxRunning;
+      while (previous < nRunning &&
+             !maxRunning.compare_exchange_weak(previous, nRunning)) {
+      }
+      {
+        std::lock_guard lock(mutex);
+        batchSizes.push_back(rows);
+      }
+      // Give the other callers the chance to queue their requests
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      for (std::size_t i = 0; i < rows; ++i) {
+        const float* row = input + i * nInput;
+        if (std::any_of(row, row + nInput, [](float v) { return v < 0.f; })) {
+          --running;
+          throw std::runtime_error("negative input");
+        }
+        output[i * nOutput] = std::accumulate(row, row + nInput, 0.f);
+        output[i * nOutput + 1] =
+            std::accumulate(row, row + nInput, 1.f, std::multiplies<float>{});
+      }
+      --running;
+    };
+  }
+};
+
+NetworkBatchInput makeInput(std::size_t rows, float offset) {
+  NetworkBatchInput input(rows, nInput);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < nInput; ++j) {
+      input(i, j) = offset + static_cast<float>(i + j);
+    }
+  }
+  return input;
+}
+
+void checkOutput(const NetworkBatchInput& input,
+                 const std::vector<std::vector<float>>& output) {
+  BOOST_REQUIRE_EQUAL(output.size(), static_cast<std::size_t>(input.rows()));
+  for (std::size_t i = 0; i < output.size(); ++i) {
+    BOOST_REQUIRE_EQUAL(output[i].size(), nOutput);
+    BOOST_CHECK_EQUAL(output[i][0], input.row(i).sum());
+    BOOST_CHECK_EQUAL(output[i][1], input.row(i).prod());
+  }
+}
+
+// Run one inference per input in concurrent threads
+std::vector<std::vector<std::vector<float>>> inferConcurrently(
+    Model& model, const std::vector<NetworkBatchInput>& inputs) {
+  std::vector<std::vector<std::vector<float>>> outputs(inputs.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    threads.emplace_back(
+        [&, i]() { outputs[i] = model.infer(inputs.at(i)); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return outputs;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(OnnxSuite)
+
+BOOST_AUTO_TEST_CASE(test_inference_service_batching) {
+  std::vector<NetworkBatchInput> inputs;
+  std::size_t totalRows = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    inputs.push_back(makeInput(i + 1, 10.f * i));
+    totalRows += i + 1;
+  }
+
+  // The first caller waits until the requests of all callers are queued
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = totalRows;
+  cfg.maxLatency = std::chrono::seconds(10);
+  StubNetwork network;
+  Model model(nInput, nOutput, network.function(), cfg);
+
+  auto outputs = inferConcurrently(model, inputs);
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    checkOutput(inputs[i], outputs[i]);
+  }
+  BOOST_CHECK(network.batchSizes == std::vector<std::size_t>{totalRows});
+}
+
+BOOST_AUTO_TEST_CASE(test_inference_service_queueing) {
+  std::vector<NetworkBatchInput> inputs;
+  std::size_t totalRows = 0;
+  for (std::size_t i = 0; i < 16; ++i) {
+    inputs.push_back(makeInput(1 + i % 3, static_cast<float>(i)));
+    totalRows += 1 + i % 3;
+  }
+  // Larger than a full batch, which is run on its own
+  inputs.push_back(makeInput(7, 100.f));
+  totalRows += 7;
+
+  for (std::size_t maxConcurrentBatches : {1ul, 2ul}) {
+    OnnxInferenceService::Config cfg;
+    cfg.maxBatchSize = 4;
+    cfg.maxConcurrentBatches = maxConcurrentBatches;
+    StubNetwork network;
+    Model model(nInput, nOutput, network.function(), cfg);
+
+    auto outputs = inferConcurrently(model, inputs);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      checkOutput(inputs[i], outputs[i]);
+    }
+
+    BOOST_CHECK_LE(network.maxRunning.load(), maxConcurrentBatches);
+    BOOST_CHECK_EQUAL(std::accumulate(network.batchSizes.begin(),
+                                      network.batchSizes.end(), 0ul),
+                      totalRows);
+    BOOST_CHECK_EQUAL(std::count(network.batchSizes.begin(),
+                                 network.batchSizes.end(), 7ul),
+                      1);
+    for (std::size_t batchSize : network.batchSizes) {
+      BOOST_CHECK(batchSize <= cfg.maxBatchSize || batchSize == 7);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_inference_service_errors) {
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = 4;
+  cfg.maxLatency = std::chrono::seconds(10);
+  StubNetwork network;
+  Model model(nInput, nOutput, network.function(), cfg);
+
+  // The error of the batch is reported to all callers in it
+  std::vector<NetworkBatchInput> inputs = {makeInput(2, 1.f),
+                                           makeInput(2, -10.f)};
+  std::atomic<std::size_t> nErrors = 0;
+  std::vector<std::thread> threads;
+  for (const auto& input : inputs) {
+    threads.emplace_back([&]() {
+      try {
+        model.infer(input);
+      } catch (const std::runtime_error&) {
+        ++nErrors;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(nErrors.load(), 2);
+  BOOST_CHECK(network.batchSizes == std::vector<std::size_t>{4});
+
+  // The model is still usable after a failed batch, a full batch does not
+  // wait for more requests
+  NetworkBatchInput input = makeInput(4, 2.f);
+  checkOutput(input, model.infer(input));
+
+  // Invalid input
+  BOOST_CHECK_THROW(model.infer(NetworkBatchInput(2, nInput + 1)),
+                    std::invalid_argument);
+  BOOST_CHECK(model.infer(NetworkBatchInput(0, nInput)).empty());
+
+  cfg.maxBatchSize = 0;
+  BOOST_CHECK_THROW(Model(nInput, nOutput, network.function(), cfg),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests